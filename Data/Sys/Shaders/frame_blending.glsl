@@ -0,0 +1,12 @@
+// Blends the previously presented frame into the current one. Games that run at a
+// locked 30fps get a cheap motion-smoothing effect on high-refresh displays, at the
+// cost of some ghosting during fast camera movement.
+
+void main()
+{
+	float4 current = Sample();
+	if (PreviousFrameAvailable())
+		SetOutput((current + SamplePrevious()) * 0.5);
+	else
+		SetOutput(current);
+}
@@ -65,6 +65,29 @@ public:
     ////////////////////////////////////////////////////////////
     virtual ~Packet();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor and assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet(const Packet& copy) = default;
+    Packet& operator =(const Packet& right) = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    /// Steals the data of \a moved, which is left empty.
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet(Packet&& moved) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    /// Steals the data of \a moved, which is left empty.
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& operator =(Packet&& moved) noexcept;
+
     ////////////////////////////////////////////////////////////
     /// \brief Append data to the end of the packet
     ///
@@ -30,6 +30,7 @@
 #include <SFML/System/String.hpp>
 #include <cstring>
 #include <cwchar>
+#include <utility>
 
 
 namespace sf
@@ -51,6 +52,32 @@ Packet::~Packet()
 }
 
 
+////////////////////////////////////////////////////////////
+Packet::Packet(Packet&& moved) noexcept :
+m_data   (std::move(moved.m_data)),
+m_readPos(moved.m_readPos),
+m_sendPos(moved.m_sendPos),
+m_isValid(moved.m_isValid)
+{
+    moved.clear();
+    moved.m_sendPos = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::operator =(Packet&& moved) noexcept
+{
+    m_data    = std::move(moved.m_data);
+    m_readPos = moved.m_readPos;
+    m_sendPos = moved.m_sendPos;
+    m_isValid = moved.m_isValid;
+    moved.clear();
+    moved.m_sendPos = 0;
+
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Packet::append(const void* data, std::size_t sizeInBytes)
 {
@@ -55,7 +55,17 @@ void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsign
   // Place a lower limit of 10% speed.  When a game boots up, there will be
   // many silence samples.  These do not need to be timestretched.
   m_stretch_ratio = std::max(m_stretch_ratio, 0.1);
-  m_sound_touch.setTempo(m_stretch_ratio);
+
+  // SoundTouch re-derives its sequence and seek-window parameters whenever the tempo moves, so
+  // don't push every bit of per-call jitter through it. Only apply the tempo once it has drifted
+  // noticeably from what SoundTouch is currently running with; the backlog feedback above
+  // absorbs the small quantization error this introduces.
+  constexpr double tempo_hysteresis = 0.01;
+  if (std::abs(m_stretch_ratio - m_applied_tempo) > m_applied_tempo * tempo_hysteresis)
+  {
+    m_sound_touch.setTempo(m_stretch_ratio);
+    m_applied_tempo = m_stretch_ratio;
+  }
 
   DEBUG_LOG_FMT(AUDIO, "Audio stretching: samples:{}/{} ratio:{} backlog:{} gain: {}", num_in,
                 num_out, m_stretch_ratio, backlog_fullness, lpf_gain);
@@ -63,6 +73,11 @@ void AudioStretcher::ProcessSamples(const short* in, unsigned int num_in, unsign
   m_sound_touch.putSamples(in, num_in);
 }
 
+double AudioStretcher::GetBacklogLatency() const
+{
+  return m_sound_touch.numSamples() / static_cast<double>(m_sample_rate);
+}
+
 void AudioStretcher::GetStretchedSamples(short* out, unsigned int num_out)
 {
   const size_t samples_received = m_sound_touch.receiveSamples(out, num_out);
@@ -17,11 +17,17 @@ public:
   void GetStretchedSamples(short* out, unsigned int num_out);
   void Clear();
 
+  // Telemetry for logging/debugging: the smoothed stretch ratio currently in effect, and how
+  // much output is sitting in the stretcher's backlog (in seconds).
+  double GetStretchRatio() const { return m_stretch_ratio; }
+  double GetBacklogLatency() const;
+
 private:
   unsigned int m_sample_rate;
   std::array<short, 2> m_last_stretched_sample = {};
   soundtouch::SoundTouch m_sound_touch;
   double m_stretch_ratio = 1.0;
+  double m_applied_tempo = 1.0;
 };
 
 }  // namespace AudioCommon
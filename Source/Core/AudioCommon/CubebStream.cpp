@@ -1,6 +1,9 @@
 // Copyright 2017 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
+
 #include <cubeb/cubeb.h>
 
 #include "AudioCommon/CubebStream.h"
@@ -13,16 +16,46 @@
 // ~10 ms - needs to be at least 240 for surround
 constexpr u32 BUFFER_SAMPLES = 512;
 
+// ~40 seconds of 10 ms callbacks between telemetry reports.
+constexpr u64 CALLBACK_REPORT_INTERVAL = 4096;
+
 long CubebStream::DataCallback(cubeb_stream* stream, void* user_data, const void* /*input_buffer*/,
                                void* output_buffer, long num_frames)
 {
   auto* self = static_cast<CubebStream*>(user_data);
 
+  const auto start = std::chrono::steady_clock::now();
+  if (self->m_last_callback_time != std::chrono::steady_clock::time_point{})
+  {
+    const s64 gap =
+        std::chrono::duration_cast<std::chrono::microseconds>(start - self->m_last_callback_time)
+            .count();
+    self->m_max_callback_gap_us = std::max(self->m_max_callback_gap_us, gap);
+  }
+  self->m_last_callback_time = start;
+
   if (self->m_stereo)
     self->m_mixer->Mix(static_cast<short*>(output_buffer), num_frames);
   else
     self->m_mixer->MixSurround(static_cast<float*>(output_buffer), num_frames);
 
+  const s64 duration = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+  self->m_sum_callback_duration_us += duration;
+  self->m_max_callback_duration_us = std::max(self->m_max_callback_duration_us, duration);
+
+  if ((++self->m_callback_count % CALLBACK_REPORT_INTERVAL) == 0)
+  {
+    INFO_LOG_FMT(AUDIO, "Cubeb callback timing: avg {} us, max {} us, max gap {} us over {} calls",
+                 self->m_sum_callback_duration_us / CALLBACK_REPORT_INTERVAL,
+                 self->m_max_callback_duration_us, self->m_max_callback_gap_us,
+                 CALLBACK_REPORT_INTERVAL);
+    self->m_sum_callback_duration_us = 0;
+    self->m_max_callback_duration_us = 0;
+    self->m_max_callback_gap_us = 0;
+  }
+
   return num_frames;
 }
 
@@ -58,9 +91,17 @@ bool CubebStream::Init()
     ERROR_LOG_FMT(AUDIO, "Error getting minimum latency");
   INFO_LOG_FMT(AUDIO, "Minimum latency: {} frames", minimum_latency);
 
+  // Target the user's latency setting, bounded below by what cubeb reports as
+  // usable and by what the surround decoder needs per callback.
+  u32 target_latency = params.rate * SConfig::GetInstance().iLatency / 1000;
+  if (!m_stereo)
+    target_latency = std::max(target_latency, BUFFER_SAMPLES);
+  const u32 latency = std::max(target_latency, minimum_latency);
+  INFO_LOG_FMT(AUDIO, "Latency: {} frames", latency);
+
   return cubeb_stream_init(m_ctx.get(), &m_stream, "Dolphin Audio Output", nullptr, nullptr,
-                           nullptr, &params, std::max(BUFFER_SAMPLES, minimum_latency),
-                           DataCallback, StateCallback, this) == CUBEB_OK;
+                           nullptr, &params, latency, DataCallback, StateCallback,
+                           this) == CUBEB_OK;
 }
 
 bool CubebStream::SetRunning(bool running)
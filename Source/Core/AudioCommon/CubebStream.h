@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <vector>
 
 #include "AudioCommon/SoundStream.h"
+#include "Common/CommonTypes.h"
 
 #include <cubeb/cubeb.h>
 
@@ -27,6 +29,15 @@ private:
   std::vector<short> m_short_buffer;
   std::vector<float> m_floatstereo_buffer;
 
+  // Callback timing telemetry. Only touched from the cubeb callback thread; a long gap between
+  // callbacks is how starvation by a higher-priority thread shows up, since cubeb itself only
+  // reports dropped frames on some backends.
+  std::chrono::steady_clock::time_point m_last_callback_time{};
+  s64 m_sum_callback_duration_us = 0;
+  s64 m_max_callback_duration_us = 0;
+  s64 m_max_callback_gap_us = 0;
+  u64 m_callback_count = 0;
+
   static long DataCallback(cubeb_stream* stream, void* user_data, const void* /*input_buffer*/,
                            void* output_buffer, long num_frames);
   static void StateCallback(cubeb_stream* stream, void* user_data, cubeb_state state);
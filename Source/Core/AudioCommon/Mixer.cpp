@@ -10,11 +10,117 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
+#include "Common/SharedMemoryExport.h"
 #include "Common/Swap.h"
+#include "Common/Tracing.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
+// Applies per-channel volume to interpolated samples and accumulates them into
+// the output buffer, clamping to [-32767, 32767]. Both buffers are interleaved
+// R, L to match the output layout; count is the number of s16 values.
+static void ApplyVolumeAndMix(const s16* input, s16* output, u32 count, s32 rvolume, s32 lvolume)
+{
+  u32 i = 0;
+
+#if defined(_M_X86)
+  // SSE2: widen the 16x16 multiplies to 32 bits, accumulate, then use the
+  // saturating pack as the clamp (with a max against -32767 to match the
+  // scalar bound).
+  const __m128i volume =
+      _mm_set_epi16(static_cast<s16>(lvolume), static_cast<s16>(rvolume), static_cast<s16>(lvolume),
+                    static_cast<s16>(rvolume), static_cast<s16>(lvolume), static_cast<s16>(rvolume),
+                    static_cast<s16>(lvolume), static_cast<s16>(rvolume));
+  const __m128i min_sample = _mm_set1_epi16(-32767);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    const __m128i mul_lo = _mm_mullo_epi16(in, volume);
+    const __m128i mul_hi = _mm_mulhi_epi16(in, volume);
+    const __m128i prod0 = _mm_srai_epi32(_mm_unpacklo_epi16(mul_lo, mul_hi), 8);
+    const __m128i prod1 = _mm_srai_epi32(_mm_unpackhi_epi16(mul_lo, mul_hi), 8);
+
+    const __m128i out = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&output[i]));
+    const __m128i out0 = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), out), 16);
+    const __m128i out1 = _mm_srai_epi32(_mm_unpackhi_epi16(_mm_setzero_si128(), out), 16);
+
+    __m128i sum = _mm_packs_epi32(_mm_add_epi32(prod0, out0), _mm_add_epi32(prod1, out1));
+    sum = _mm_max_epi16(sum, min_sample);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]), sum);
+  }
+#elif defined(_M_ARM_64)
+  const int16x4_t volume = {static_cast<s16>(rvolume), static_cast<s16>(lvolume),
+                            static_cast<s16>(rvolume), static_cast<s16>(lvolume)};
+  const int16x8_t min_sample = vdupq_n_s16(-32767);
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t in = vld1q_s16(&input[i]);
+    int32x4_t sum0 = vshrq_n_s32(vmull_s16(vget_low_s16(in), volume), 8);
+    int32x4_t sum1 = vshrq_n_s32(vmull_s16(vget_high_s16(in), volume), 8);
+
+    const int16x8_t out = vld1q_s16(&output[i]);
+    sum0 = vaddw_s16(sum0, vget_low_s16(out));
+    sum1 = vaddw_s16(sum1, vget_high_s16(out));
+
+    int16x8_t sum = vcombine_s16(vqmovn_s32(sum0), vqmovn_s32(sum1));
+    sum = vmaxq_s16(sum, min_sample);
+    vst1q_s16(&output[i], sum);
+  }
+#endif
+
+  for (; i < count; i += 2)
+  {
+    int sampleR = (input[i] * rvolume) >> 8;
+    int sampleL = (input[i + 1] * lvolume) >> 8;
+    output[i] = std::clamp(sampleR + output[i], -32767, 32767);
+    output[i + 1] = std::clamp(sampleL + output[i + 1], -32767, 32767);
+  }
+}
+
+// Polyphase windowed-sinc filter used to resample the wiimote speaker FIFO.
+// SINC_TAPS input samples contribute to every output sample, with the
+// fractional position quantized to SINC_PHASES precomputed coefficient sets.
+constexpr u32 SINC_TAPS = 8;
+constexpr u32 SINC_PHASES = 256;
+
+using WindowedSincTable = std::array<std::array<float, SINC_TAPS>, SINC_PHASES>;
+
+static const WindowedSincTable& GetWindowedSincTable()
+{
+  static const WindowedSincTable table = [] {
+    WindowedSincTable result{};
+    for (u32 phase = 0; phase < SINC_PHASES; ++phase)
+    {
+      const double offset = static_cast<double>(phase) / SINC_PHASES;
+      double gain = 0.0;
+      for (u32 tap = 0; tap < SINC_TAPS; ++tap)
+      {
+        // Distance from the interpolation point; the taps cover the
+        // SINC_TAPS / 2 - 1 samples behind the read position and the
+        // SINC_TAPS / 2 samples ahead of it.
+        const double x = static_cast<double>(tap) - (SINC_TAPS / 2 - 1) - offset;
+        const double sinc =
+            std::abs(x) < 1e-9 ? 1.0 : std::sin(MathUtil::PI * x) / (MathUtil::PI * x);
+        const double window = 0.5 + 0.5 * std::cos(MathUtil::TAU * x / SINC_TAPS);  // Hann
+        result[phase][tap] = static_cast<float>(sinc * window);
+        gain += result[phase][tap];
+      }
+      // Normalize every phase to unity DC gain.
+      for (u32 tap = 0; tap < SINC_TAPS; ++tap)
+        result[phase][tap] = static_cast<float>(result[phase][tap] / gain);
+    }
+    return result;
+  }();
+  return table;
+}
+
 static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 {
   switch (quality)
@@ -93,28 +199,60 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  // The resampling gathers from the ring buffer at a variable stride, so it
+  // stays scalar; the volume multiply, accumulate and clamp run over each
+  // interpolated block with SIMD where available.
+  constexpr u32 MIX_BLOCK_SIZE = 128;
+  s16 block[MIX_BLOCK_SIZE];  // interleaved R, L
+
+  // The windowed-sinc filter reads SINC_TAPS / 2 samples ahead of the read
+  // position, so it needs more lookahead than the linear interpolator's one.
+  const u32 lookahead = m_use_windowed_sinc ? SINC_TAPS + 2 : 2;
+
+  while (currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > lookahead)
   {
-    u32 indexR2 = indexR + 2;  // next sample
-
-    s16 l1 = Common::swap16(m_buffer[indexR & INDEX_MASK]);   // current
-    s16 l2 = Common::swap16(m_buffer[indexR2 & INDEX_MASK]);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
-
-    s16 r1 = Common::swap16(m_buffer[(indexR + 1) & INDEX_MASK]);   // current
-    s16 r2 = Common::swap16(m_buffer[(indexR2 + 1) & INDEX_MASK]);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
-
-    m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
-    m_frac &= 0xffff;
+    u32 block_samples = 0;
+    for (; block_samples < MIX_BLOCK_SIZE && currentSample + block_samples < numSamples * 2 &&
+           ((indexW - indexR) & INDEX_MASK) > lookahead;
+         block_samples += 2)
+    {
+      if (m_use_windowed_sinc)
+      {
+        const auto& coeffs = GetWindowedSincTable()[m_frac >> 8];
+        float sample_l = 0.0f;
+        float sample_r = 0.0f;
+        for (u32 tap = 0; tap < SINC_TAPS; ++tap)
+        {
+          // First tap sits SINC_TAPS / 2 - 1 sample pairs behind the read position.
+          const u32 index = indexR + 2 * tap - (SINC_TAPS - 2);
+          sample_l += coeffs[tap] * Common::swap16(m_buffer[index & INDEX_MASK]);
+          sample_r += coeffs[tap] * Common::swap16(m_buffer[(index + 1) & INDEX_MASK]);
+        }
+        block[block_samples + 1] =
+            static_cast<s16>(std::clamp(static_cast<s32>(sample_l), -32768, 32767));
+        block[block_samples + 0] =
+            static_cast<s16>(std::clamp(static_cast<s32>(sample_r), -32768, 32767));
+      }
+      else
+      {
+        u32 indexR2 = indexR + 2;  // next sample
+
+        s16 l1 = Common::swap16(m_buffer[indexR & INDEX_MASK]);   // current
+        s16 l2 = Common::swap16(m_buffer[indexR2 & INDEX_MASK]);  // next
+        block[block_samples + 1] = static_cast<s16>(((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16);
+
+        s16 r1 = Common::swap16(m_buffer[(indexR + 1) & INDEX_MASK]);   // current
+        s16 r2 = Common::swap16(m_buffer[(indexR2 + 1) & INDEX_MASK]);  // next
+        block[block_samples + 0] = static_cast<s16>(((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16);
+      }
+
+      m_frac += ratio;
+      indexR += 2 * (u16)(m_frac >> 16);
+      m_frac &= 0xffff;
+    }
+
+    ApplyVolumeAndMix(block, samples + currentSample, block_samples, rvolume, lvolume);
+    currentSample += block_samples;
   }
 
   // Actual number of samples written to the buffer without padding.
@@ -143,11 +281,15 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
 
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
+  TRACE_ZONE("Mixer::Mix");
+
   if (!samples)
     return 0;
 
   memset(samples, 0, num_samples * 2 * sizeof(short));
 
+  DecodeWiimoteSpeakerReports();
+
   if (SConfig::GetInstance().m_audio_stretch)
   {
     unsigned int available_samples =
@@ -175,6 +317,9 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
     m_is_stretching = false;
   }
 
+  if (Config::Get(Config::MAIN_SHARED_MEMORY_EXPORT))
+    Common::SharedMemoryExport::PushAudioSamples(samples, num_samples, m_sampleRate);
+
   return num_samples;
 }
 
@@ -247,21 +392,68 @@ void Mixer::PushStreamingSamples(const short* samples, unsigned int num_samples)
     m_wave_writer_dtk.AddStereoSamplesBE(samples, num_samples, sample_rate);
 }
 
-void Mixer::PushWiimoteSpeakerSamples(const short* samples, unsigned int num_samples,
-                                      unsigned int sample_rate)
+void Mixer::PushWiimoteSpeakerReport(const WiimoteSpeakerReport& report)
+{
+  m_wiimote_speaker_reports.Push(report);
+}
+
+// Yamaha ADPCM decoder code based on The ffmpeg Project (Copyright (s) 2001-2003)
+s16 Mixer::AdpcmYamahaExpandNibble(u8 nibble)
 {
-  short samples_stereo[MAX_SAMPLES * 2];
+  static constexpr s32 yamaha_difflookup[] = {1,  3,  5,  7,  9,  11,  13,  15,
+                                              -1, -3, -5, -7, -9, -11, -13, -15};
+  static constexpr s32 yamaha_indexscale[] = {230, 230, 230, 230, 307, 409, 512, 614,
+                                              230, 230, 230, 230, 307, 409, 512, 614};
+
+  YamahaAdpcmState& s = m_wiimote_adpcm_state;
+  s.predictor += (s.step * yamaha_difflookup[nibble]) / 8;
+  s.predictor = std::clamp(s.predictor, -32768, 32767);
+  s.step = (s.step * yamaha_indexscale[nibble]) >> 8;
+  s.step = std::clamp(s.step, 127, 24576);
+  return static_cast<s16>(s.predictor);
+}
 
-  if (num_samples < MAX_SAMPLES)
+// Executed from sound stream thread
+void Mixer::DecodeWiimoteSpeakerReports()
+{
+  WiimoteSpeakerReport report;
+  while (m_wiimote_speaker_reports.Pop(report))
   {
-    m_wiimote_speaker_mixer.SetInputSampleRate(sample_rate);
+    if (report.reset_decoder)
+      m_wiimote_adpcm_state = {};
+
+    if (report.length == 0 || report.sample_rate == 0)
+      continue;
+
+    // ADPCM carries two samples per byte, PCM one.
+    s16 samples[WiimoteSpeakerReport::MAX_DATA_SIZE * 2];
+    unsigned int num_samples;
+    if (report.is_adpcm)
+    {
+      num_samples = report.length * 2;
+      for (u32 i = 0; i < report.length; ++i)
+      {
+        samples[i * 2] = AdpcmYamahaExpandNibble((report.data[i] >> 4) & 0xf);
+        samples[i * 2 + 1] = AdpcmYamahaExpandNibble(report.data[i] & 0xf);
+      }
+    }
+    else
+    {
+      num_samples = report.length;
+      for (u32 i = 0; i < report.length; ++i)
+        samples[i] = static_cast<s16>(static_cast<s8>(report.data[i])) * 0x100;
+    }
 
+    // The FIFO stores big-endian stereo pairs; we are both the producer and
+    // the consumer here, so pushing from the audio thread is safe.
+    short samples_stereo[WiimoteSpeakerReport::MAX_DATA_SIZE * 4];
     for (unsigned int i = 0; i < num_samples; ++i)
     {
       samples_stereo[i * 2] = Common::swap16(samples[i]);
       samples_stereo[i * 2 + 1] = Common::swap16(samples[i]);
     }
 
+    m_wiimote_speaker_mixer.SetInputSampleRate(report.sample_rate);
     m_wiimote_speaker_mixer.PushSamples(samples_stereo, num_samples);
   }
 }
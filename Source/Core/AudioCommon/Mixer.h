@@ -10,6 +10,7 @@
 #include "AudioCommon/SurroundDecoder.h"
 #include "AudioCommon/WaveFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/SPSCQueue.h"
 
 class PointerWrap;
 
@@ -25,11 +26,24 @@ public:
   unsigned int Mix(short* samples, unsigned int numSamples);
   unsigned int MixSurround(float* samples, unsigned int num_samples);
 
+  // A raw wiimote speaker report. Queued from the CPU thread and decoded on the
+  // audio thread so the CPU thread never touches the ADPCM decoder.
+  struct WiimoteSpeakerReport
+  {
+    // Largest speaker report payload (report 0x18 carries up to 20 bytes).
+    static constexpr u32 MAX_DATA_SIZE = 20;
+
+    std::array<u8, MAX_DATA_SIZE> data{};
+    u8 length = 0;
+    bool is_adpcm = false;
+    bool reset_decoder = false;
+    u32 sample_rate = 0;
+  };
+
   // Called from main thread
   void PushSamples(const short* samples, unsigned int num_samples);
   void PushStreamingSamples(const short* samples, unsigned int num_samples);
-  void PushWiimoteSpeakerSamples(const short* samples, unsigned int num_samples,
-                                 unsigned int sample_rate);
+  void PushWiimoteSpeakerReport(const WiimoteSpeakerReport& report);
   unsigned int GetSampleRate() const { return m_sampleRate; }
   void SetDMAInputSampleRate(unsigned int rate);
   void SetStreamInputSampleRate(unsigned int rate);
@@ -57,7 +71,8 @@ private:
   class MixerFifo final
   {
   public:
-    MixerFifo(Mixer* mixer, unsigned sample_rate) : m_mixer(mixer), m_input_sample_rate(sample_rate)
+    MixerFifo(Mixer* mixer, unsigned sample_rate, bool use_windowed_sinc)
+        : m_mixer(mixer), m_input_sample_rate(sample_rate), m_use_windowed_sinc(use_windowed_sinc)
     {
     }
     void DoState(PointerWrap& p);
@@ -71,6 +86,9 @@ private:
   private:
     Mixer* m_mixer;
     unsigned m_input_sample_rate;
+    // Linear interpolation is very audible on low input rates (the wiimote
+    // speaker runs at 3-6 kHz); this selects a polyphase windowed-sinc filter.
+    const bool m_use_windowed_sinc;
     std::array<short, MAX_SAMPLES * 2> m_buffer{};
     std::atomic<u32> m_indexW{0};
     std::atomic<u32> m_indexR{0};
@@ -81,11 +99,24 @@ private:
     u32 m_frac = 0;
   };
 
-  MixerFifo m_dma_mixer{this, 32000};
-  MixerFifo m_streaming_mixer{this, 48000};
-  MixerFifo m_wiimote_speaker_mixer{this, 3000};
+  // Called from audio threads
+  void DecodeWiimoteSpeakerReports();
+  s16 AdpcmYamahaExpandNibble(u8 nibble);
+
+  struct YamahaAdpcmState
+  {
+    s32 predictor = 0;
+    s32 step = 127;
+  };
+
+  MixerFifo m_dma_mixer{this, 32000, false};
+  MixerFifo m_streaming_mixer{this, 48000, false};
+  MixerFifo m_wiimote_speaker_mixer{this, 3000, true};
   unsigned int m_sampleRate;
 
+  Common::SPSCQueue<WiimoteSpeakerReport, false> m_wiimote_speaker_reports;
+  YamahaAdpcmState m_wiimote_adpcm_state;
+
   bool m_is_stretching = false;
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
@@ -58,21 +58,26 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
     // Decode
     const float* dpl2_fs = m_fsdecoder->decode(m_float_conversion_buffer.data());
 
-    // Add to ring buffer and fix channel mapping
+    // Fix the channel mapping, then append the whole decoded block to the ring buffer at once.
     // Maybe modify FreeSurround to output the correct mapping?
     // FreeSurround:
     // FL | FC | FR | BL | BR | LFE
     // Most backends:
     // FL | FR | FC | LFE | BL | BR
+    // The input conversion buffer is free again after decode(), so remap into it.
     for (size_t i = 0; i < m_frame_block_size; ++i)
     {
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 0]);  // LEFTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 2]);  // RIGHTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 1]);  // CENTREFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 5]);  // sub/lfe
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 3]);  // LEFTREAR
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 4]);  // RIGHTREAR
+      const float* src = &dpl2_fs[i * SURROUND_CHANNELS];
+      float* dst = &m_float_conversion_buffer[i * SURROUND_CHANNELS];
+      dst[0] = src[0];  // LEFTFRONT
+      dst[1] = src[2];  // RIGHTFRONT
+      dst[2] = src[1];  // CENTREFRONT
+      dst[3] = src[5];  // sub/lfe
+      dst[4] = src[3];  // LEFTREAR
+      dst[5] = src[4];  // RIGHTREAR
     }
+    m_decoded_fifo.push_block(m_float_conversion_buffer.data(),
+                              m_frame_block_size * SURROUND_CHANNELS);
 
     remaining_frames = remaining_frames - static_cast<int>(m_frame_block_size);
     frame_index = frame_index + m_frame_block_size;
@@ -82,11 +87,7 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
 void SurroundDecoder::ReceiveFrames(float* out, const size_t num_frames_out)
 {
   // Copy to output array with desired num_frames_out
-  for (size_t i = 0, num_samples_output = num_frames_out * SURROUND_CHANNELS;
-       i < num_samples_output; ++i)
-  {
-    out[i] = m_decoded_fifo.pop_front();
-  }
+  m_decoded_fifo.pop_block(out, num_frames_out * SURROUND_CHANNELS);
 }
 
 }  // namespace AudioCommon
@@ -89,11 +89,20 @@ bool WaveFileWriter::Start(const std::string& filename, unsigned int HLESampleRa
   if (file.Tell() != 44)
     PanicAlertFmt("Wrong offset: {}", file.Tell());
 
+  write_worker.Reset([this](std::vector<short> samples) {
+    const u32 num_bytes = static_cast<u32>(samples.size() * sizeof(short));
+    file.WriteBytes(samples.data(), num_bytes);
+    audio_size += num_bytes;
+  });
+
   return true;
 }
 
 void WaveFileWriter::Stop()
 {
+  // Flush any sample data still queued before patching the header.
+  write_worker.Shutdown();
+
   // u32 file_size = (u32)ftello(file);
   file.Seek(4, SEEK_SET);
   Write(audio_size + 36);
@@ -136,6 +145,7 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count, int
       return;
   }
 
+  std::vector<short> conv_buffer(count * 2);
   for (u32 i = 0; i < count; i++)
   {
     // Flip the audio channels from RL to LR
@@ -153,6 +163,5 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count, int
     current_sample_rate = sample_rate;
   }
 
-  file.WriteBytes(conv_buffer.data(), count * 4);
-  audio_size += count * 4;
+  write_worker.EmplaceItem(std::move(conv_buffer));
 }
@@ -13,11 +13,12 @@
 
 #pragma once
 
-#include <array>
 #include <string>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/WorkQueueThread.h"
 
 class WaveFileWriter
 {
@@ -43,7 +44,9 @@ private:
   File::IOFile file;
   bool skip_silence = false;
   u32 audio_size = 0;
-  std::array<short, BUFFER_SIZE> conv_buffer{};
+  // Writes sample data to disk so the audio path that feeds us never blocks on I/O.
+  // Only runs between Start() and Stop(), which drains it before touching the header.
+  Common::WorkQueueThread<std::vector<short>> write_worker;
   void Write(u32 value);
   void Write4(const char* ptr);
   std::string basename;
@@ -50,6 +50,11 @@ public:
   PointerWrap(u8** ptr_, Mode mode_) : ptr(ptr_), mode(mode_) {}
   void SetMode(Mode mode_) { mode = mode_; }
   Mode GetMode() const { return mode; }
+
+  // If a buffer end is set, writes that would run past it abort the save by switching to
+  // MODE_MEASURE instead of overrunning the buffer. This lets callers skip the measure pass
+  // by serializing into a buffer sized from a previous save and retrying on overflow.
+  void SetBufferEnd(u8* end) { m_end = end; }
   template <typename K, class V>
   void Do(std::map<K, V>& x)
   {
@@ -279,6 +284,76 @@ public:
     }
   }
 
+  struct StateRegion
+  {
+    void* data;
+    u32 size;
+  };
+
+  // Builds an entry for DoRegions(). Kept as a function so the trivially-copyable
+  // requirement is checked where the table is built.
+  template <typename T>
+  static StateRegion MakeStateRegion(T& x)
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only sane for trivially copyable types");
+    return {&x, sizeof(x)};
+  }
+
+  // Serializes a flat table of regions describing trivially copyable state. Subsystems with
+  // many small members can build the table once and have every savestate pass walk it with
+  // one wide copy per region instead of a mode dispatch per field. Bools in a region keep
+  // their in-memory size; that matches Do(bool) on all supported platforms.
+  void DoRegions(const StateRegion* regions, size_t count)
+  {
+    switch (mode)
+    {
+    case MODE_READ:
+      for (size_t i = 0; i != count; ++i)
+      {
+        memcpy(regions[i].data, *ptr, regions[i].size);
+        *ptr += regions[i].size;
+      }
+      break;
+
+    case MODE_WRITE:
+      for (size_t i = 0; i != count; ++i)
+      {
+        if (m_end && *ptr + regions[i].size > m_end)
+        {
+          // Out of buffer space: measure the remaining regions, like DoVoid().
+          mode = MODE_MEASURE;
+          for (; i != count; ++i)
+            *ptr += regions[i].size;
+          break;
+        }
+        memcpy(*ptr, regions[i].data, regions[i].size);
+        *ptr += regions[i].size;
+      }
+      break;
+
+    case MODE_MEASURE:
+      for (size_t i = 0; i != count; ++i)
+        *ptr += regions[i].size;
+      break;
+
+    case MODE_VERIFY:
+      for (size_t i = 0; i != count; ++i)
+      {
+        DEBUG_ASSERT_MSG(COMMON, !memcmp(regions[i].data, *ptr, regions[i].size),
+                         "Savestate verification failure: buf %p != %p (size %u).\n",
+                         regions[i].data, *ptr, regions[i].size);
+        *ptr += regions[i].size;
+      }
+      break;
+    }
+  }
+
+  template <std::size_t N>
+  void DoRegions(const std::array<StateRegion, N>& regions)
+  {
+    DoRegions(regions.data(), N);
+  }
+
   template <typename T, typename Functor>
   void DoEachElement(T& container, Functor member)
   {
@@ -291,6 +366,8 @@ public:
   }
 
 private:
+  u8* m_end = nullptr;
+
   template <typename T>
   void DoContiguousContainer(T& container)
   {
@@ -317,6 +394,11 @@ private:
       break;
 
     case MODE_WRITE:
+      if (m_end && *ptr + size > m_end)
+      {
+        mode = MODE_MEASURE;
+        break;
+      }
       memcpy(*ptr, data, size);
       break;
 
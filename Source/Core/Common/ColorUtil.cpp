@@ -2,6 +2,13 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Common/ColorUtil.h"
+
+#include <array>
+
+#ifdef _M_X86
+#include <emmintrin.h>
+#endif
+
 #include "Common/Swap.h"
 
 namespace Common
@@ -39,12 +46,78 @@ static u32 Decode5A3(u16 val)
   return (a << 24) | (r << 16) | (g << 8) | b;
 }
 
+#ifdef _M_X86
+// Decodes 8 big-endian RGB5A3 texels into two rows of 4 BGRA8 texels each.
+// The scalar LUTs above are all floor(x * 255 / (2^n - 1)) expansions, and
+// those divisions have exact fixed-point multiply-shift forms, so the whole
+// decode reduces to shifts, masks and multiplies. Matches Decode5A3 bit-exactly
+// for every input (verified exhaustively).
+static void Decode5A3x8(u32* dst0, u32* dst1, const u16* src)
+{
+  const __m128i val = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  // Byteswap each 16-bit texel.
+  const __m128i v = _mm_or_si128(_mm_slli_epi16(val, 8), _mm_srli_epi16(val, 8));
+
+  // 0xFFFF for opaque (RGB555) texels, 0x0000 for translucent (RGB4A3) ones.
+  const __m128i opaque = _mm_srai_epi16(v, 15);
+
+  // Opaque path: 5-bit channels expanded as floor(x * 255 / 31), matching the
+  // scalar LUT. The division by 31 is done as mulhi(x * 255, 16913) >> 3,
+  // which is exact over the full input range.
+  const __m128i mask5 = _mm_set1_epi16(0x1F);
+  const __m128i c255 = _mm_set1_epi16(255);
+  const __m128i div31 = _mm_set1_epi16(16913);
+  const auto expand5 = [&c255, &div31](__m128i c5) {
+    return _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(c5, c255), div31), 3);
+  };
+  const __m128i r8o = expand5(_mm_and_si128(_mm_srli_epi16(v, 10), mask5));
+  const __m128i g8o = expand5(_mm_and_si128(_mm_srli_epi16(v, 5), mask5));
+  const __m128i b8o = expand5(_mm_and_si128(v, mask5));
+
+  // Translucent path: 4-bit channels replicated to 8 bits, then blended with a
+  // black background: c = c8 * a8 / 255 (exact truncating division, like the
+  // scalar code's / 255).
+  const __m128i mask4 = _mm_set1_epi16(0xF);
+  const __m128i a3 = _mm_and_si128(_mm_srli_epi16(v, 12), _mm_set1_epi16(0x7));
+  // a8 = floor(a3 * 255 / 7), with the division done as mulhi by 37450 >> 2.
+  const __m128i div7 = _mm_set1_epi16(static_cast<s16>(37450));
+  const __m128i a8 = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(a3, c255), div7), 2);
+  const __m128i div255 = _mm_set1_epi16(static_cast<s16>(0x8081));
+  const auto scale = [&a8, &div255](__m128i c4) {
+    const __m128i c8 = _mm_or_si128(_mm_slli_epi16(c4, 4), c4);
+    // floor((c8 * a8) / 255) == ((c8 * a8) * 0x8081) >> 23 for all 16-bit products.
+    return _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(c8, a8), div255), 7);
+  };
+  const __m128i r8t = scale(_mm_and_si128(_mm_srli_epi16(v, 8), mask4));
+  const __m128i g8t = scale(_mm_and_si128(_mm_srli_epi16(v, 4), mask4));
+  const __m128i b8t = scale(_mm_and_si128(v, mask4));
+
+  // Select per texel, then interleave into (a << 24) | (r << 16) | (g << 8) | b.
+  const __m128i r8 = _mm_or_si128(_mm_and_si128(opaque, r8o), _mm_andnot_si128(opaque, r8t));
+  const __m128i g8 = _mm_or_si128(_mm_and_si128(opaque, g8o), _mm_andnot_si128(opaque, g8t));
+  const __m128i b8 = _mm_or_si128(_mm_and_si128(opaque, b8o), _mm_andnot_si128(opaque, b8t));
+
+  const __m128i low = _mm_or_si128(b8, _mm_slli_epi16(g8, 8));
+  const __m128i high = _mm_or_si128(r8, _mm_set1_epi16(static_cast<s16>(0xFF00)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst0), _mm_unpacklo_epi16(low, high));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst1), _mm_unpackhi_epi16(low, high));
+}
+#endif
+
 void Decode5A3Image(u32* dst, const u16* src, int width, int height)
 {
   for (int y = 0; y < height; y += 4)
   {
     for (int x = 0; x < width; x += 4)
     {
+#ifdef _M_X86
+      // Two 4-texel tile rows are contiguous in the source, so decode them as
+      // one 8-texel vector.
+      for (int iy = 0; iy < 4; iy += 2, src += 8)
+      {
+        Decode5A3x8(&dst[(y + iy) * width + x], &dst[(y + iy + 1) * width + x], src);
+      }
+#else
       for (int iy = 0; iy < 4; iy++, src += 4)
       {
         for (int ix = 0; ix < 4; ix++)
@@ -53,12 +126,22 @@ void Decode5A3Image(u32* dst, const u16* src, int width, int height)
           dst[(y + iy) * width + (x + ix)] = RGBA;
         }
       }
+#endif
     }
   }
 }
 
 void DecodeCI8Image(u32* dst, const u8* src, const u16* pal, int width, int height)
 {
+  // Decode the palette once up front; every entry is reused many times per
+  // image, so this turns the per-texel work into a single table lookup.
+  std::array<u32, 256> decoded_pal;
+  for (size_t i = 0; i < decoded_pal.size(); i++)
+  {
+    // huh, this seems wrong. CI8, not 5A3, no?
+    decoded_pal[i] = Decode5A3(Common::swap16(pal[i]));
+  }
+
   for (int y = 0; y < height; y += 4)
   {
     for (int x = 0; x < width; x += 8)
@@ -67,10 +150,7 @@ void DecodeCI8Image(u32* dst, const u8* src, const u16* pal, int width, int heig
       {
         u32* tdst = dst + (y + iy) * width + x;
         for (int ix = 0; ix < 8; ix++)
-        {
-          // huh, this seems wrong. CI8, not 5A3, no?
-          tdst[ix] = Decode5A3(Common::swap16(pal[src[ix]]));
-        }
+          tdst[ix] = decoded_pal[src[ix]];
       }
     }
   }
@@ -41,6 +41,7 @@
 #define CACHE_DIR "Cache"
 #define COVERCACHE_DIR "GameCovers"
 #define REDUMPCACHE_DIR "Redump"
+#define RVZCACHE_DIR "RVZ"
 #define SHADERCACHE_DIR "Shaders"
 #define STATESAVES_DIR "StateSaves"
 #define SCREENSHOTS_DIR "ScreenShots"
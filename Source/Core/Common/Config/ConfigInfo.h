@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -39,6 +40,133 @@ struct CachedValue
   u64 config_version;
 };
 
+namespace detail
+{
+// Storage for Info's cached value. Config reads on hot paths boil down to
+// GetCachedValue(), so for trivially copyable types the value and its version
+// stamp live in separate word-sized atomics published under a tiny seqlock and
+// reads take no lock at all. Everything else (strings) keeps the shared_mutex.
+template <typename T, bool lock_free = std::is_trivially_copyable_v<T>>
+class CachedValueStorage
+{
+public:
+  CachedValueStorage() = default;
+  constexpr CachedValueStorage(const T& value, u64 config_version)
+      : m_cached_value{value, config_version}
+  {
+  }
+
+  CachedValue<T> Get() const
+  {
+    std::shared_lock lock(m_mutex);
+    return m_cached_value;
+  }
+
+  template <typename U>
+  CachedValue<U> GetCasted() const
+  {
+    std::shared_lock lock(m_mutex);
+    return CachedValue<U>{static_cast<U>(m_cached_value.value), m_cached_value.config_version};
+  }
+
+  void Set(const CachedValue<T>& cached_value)
+  {
+    std::unique_lock lock(m_mutex);
+    if (m_cached_value.config_version < cached_value.config_version)
+      m_cached_value = cached_value;
+  }
+
+  // Unconditional overwrite, used when copying Info objects around.
+  CachedValueStorage& operator=(const CachedValue<T>& cached_value)
+  {
+    std::unique_lock lock(m_mutex);
+    m_cached_value = cached_value;
+    return *this;
+  }
+
+private:
+  CachedValue<T> m_cached_value{};
+  mutable std::shared_mutex m_mutex;
+};
+
+// A single std::atomic<CachedValue<T>> would be the obvious representation, but at
+// 16 bytes it is not lock-free on common targets and drags in libatomic, so the value
+// and version stay in separate word-sized atomics and a seqlock pairs them up.
+template <typename T>
+class CachedValueStorage<T, true>
+{
+public:
+  CachedValueStorage() = default;
+  constexpr CachedValueStorage(const T& value, u64 config_version)
+      : m_value{value}, m_version{config_version}
+  {
+  }
+
+  CachedValue<T> Get() const
+  {
+    // Seqlock reader: retry if a writer was active (odd sequence) or finished in
+    // between, so the value and version always come from the same write.
+    while (true)
+    {
+      const u64 sequence = m_sequence.load(std::memory_order_acquire);
+      if ((sequence & 1) == 0)
+      {
+        const CachedValue<T> result{m_value.load(std::memory_order_relaxed),
+                                    m_version.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == sequence)
+          return result;
+      }
+    }
+  }
+
+  template <typename U>
+  CachedValue<U> GetCasted() const
+  {
+    const CachedValue<T> cached = Get();
+    return CachedValue<U>{static_cast<U>(cached.value), cached.config_version};
+  }
+
+  void Set(const CachedValue<T>& cached_value) { Write(cached_value, true); }
+
+  // Unconditional overwrite, used when copying Info objects around.
+  CachedValueStorage& operator=(const CachedValue<T>& cached_value)
+  {
+    Write(cached_value, false);
+    return *this;
+  }
+
+private:
+  void Write(const CachedValue<T>& cached_value, bool only_if_newer)
+  {
+    // Seqlock writer: an odd sequence marks a write in progress. The version check
+    // runs inside the critical section, which keeps the version monotonic under
+    // racing writers like the locked specialization's check does: without it, the
+    // older value could end up stamped with the newest version and readers would
+    // serve stale config as fresh forever.
+    u64 sequence = m_sequence.load(std::memory_order_relaxed);
+    do
+    {
+      while (sequence & 1)
+        sequence = m_sequence.load(std::memory_order_relaxed);
+    } while (!m_sequence.compare_exchange_weak(sequence, sequence + 1,
+                                               std::memory_order_acquire,
+                                               std::memory_order_relaxed));
+
+    if (!only_if_newer || m_version.load(std::memory_order_relaxed) < cached_value.config_version)
+    {
+      m_value.store(cached_value.value, std::memory_order_relaxed);
+      m_version.store(cached_value.config_version, std::memory_order_relaxed);
+    }
+    m_sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  std::atomic<T> m_value{};
+  std::atomic<u64> m_version{0};
+  std::atomic<u64> m_sequence{0};
+};
+}  // namespace detail
+
 template <typename T>
 class Info
 {
@@ -94,31 +222,20 @@ public:
   constexpr const Location& GetLocation() const { return m_location; }
   constexpr const T& GetDefaultValue() const { return m_default_value; }
 
-  CachedValue<T> GetCachedValue() const
-  {
-    std::shared_lock lock(m_cached_value_mutex);
-    return m_cached_value;
-  }
+  CachedValue<T> GetCachedValue() const { return m_cached_value.Get(); }
 
   template <typename U>
   CachedValue<U> GetCachedValueCasted() const
   {
-    std::shared_lock lock(m_cached_value_mutex);
-    return CachedValue<U>{static_cast<U>(m_cached_value.value), m_cached_value.config_version};
+    return m_cached_value.template GetCasted<U>();
   }
 
-  void SetCachedValue(const CachedValue<T>& cached_value) const
-  {
-    std::unique_lock lock(m_cached_value_mutex);
-    if (m_cached_value.config_version < cached_value.config_version)
-      m_cached_value = cached_value;
-  }
+  void SetCachedValue(const CachedValue<T>& cached_value) const { m_cached_value.Set(cached_value); }
 
 private:
   Location m_location;
   T m_default_value;
 
-  mutable CachedValue<T> m_cached_value;
-  mutable std::shared_mutex m_cached_value_mutex;
+  mutable detail::CachedValueStorage<T> m_cached_value;
 };
 }  // namespace Config
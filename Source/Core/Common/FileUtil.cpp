@@ -123,6 +123,7 @@ void FileInfo::AndroidContentInit(const std::string& path)
   m_exists = result != -1;
   m_stat.st_mode = result == -2 ? S_IFDIR : S_IFREG;
   m_stat.st_size = result >= 0 ? result : 0;
+  m_stat.st_mtime = 0;
 }
 #endif
 
@@ -146,6 +147,11 @@ u64 FileInfo::GetSize() const
   return IsFile() ? m_stat.st_size : 0;
 }
 
+u64 FileInfo::GetModificationTime() const
+{
+  return m_exists ? static_cast<u64>(m_stat.st_mtime) : 0;
+}
+
 // Returns true if the path exists
 bool Exists(const std::string& path)
 {
@@ -937,6 +943,7 @@ static void RebuildUserDirectories(unsigned int dir_index)
     s_user_paths[D_CACHE_IDX] = s_user_paths[D_USER_IDX] + CACHE_DIR DIR_SEP;
     s_user_paths[D_COVERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + COVERCACHE_DIR DIR_SEP;
     s_user_paths[D_REDUMPCACHE_IDX] = s_user_paths[D_CACHE_IDX] + REDUMPCACHE_DIR DIR_SEP;
+    s_user_paths[D_RVZCACHE_IDX] = s_user_paths[D_CACHE_IDX] + RVZCACHE_DIR DIR_SEP;
     s_user_paths[D_SHADERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + SHADERCACHE_DIR DIR_SEP;
     s_user_paths[D_SHADERS_IDX] = s_user_paths[D_USER_IDX] + SHADERS_DIR DIR_SEP;
     s_user_paths[D_STATESAVES_IDX] = s_user_paths[D_USER_IDX] + STATESAVES_DIR DIR_SEP;
@@ -1004,6 +1011,7 @@ static void RebuildUserDirectories(unsigned int dir_index)
   case D_CACHE_IDX:
     s_user_paths[D_COVERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + COVERCACHE_DIR DIR_SEP;
     s_user_paths[D_REDUMPCACHE_IDX] = s_user_paths[D_CACHE_IDX] + REDUMPCACHE_DIR DIR_SEP;
+    s_user_paths[D_RVZCACHE_IDX] = s_user_paths[D_CACHE_IDX] + RVZCACHE_DIR DIR_SEP;
     s_user_paths[D_SHADERCACHE_IDX] = s_user_paths[D_CACHE_IDX] + SHADERCACHE_DIR DIR_SEP;
     break;
 
@@ -36,6 +36,7 @@ enum
   D_CACHE_IDX,
   D_COVERCACHE_IDX,
   D_REDUMPCACHE_IDX,
+  D_RVZCACHE_IDX,
   D_SHADERCACHE_IDX,
   D_SHADERS_IDX,
   D_STATESAVES_IDX,
@@ -111,6 +112,8 @@ public:
   bool IsFile() const;
   // Returns the size of a file (or returns 0 if the path doesn't refer to a file)
   u64 GetSize() const;
+  // Returns the time of last modification (or 0 if the path doesn't exist)
+  u64 GetModificationTime() const;
 
 private:
 #ifdef ANDROID
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 
@@ -72,6 +74,55 @@ public:
     return temp;
   }
 
+  // Appends num values from source in at most two memcpy spans, dropping the oldest contents
+  // if the queue overflows. Only available for trivially copyable types.
+  void push_block(const T* source, size_t num)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    if (num >= static_cast<size_t>(N))
+    {
+      source += num - N;
+      num = N;
+    }
+
+    size_t remaining = num;
+    while (remaining > 0)
+    {
+      const size_t chunk = std::min(remaining, static_cast<size_t>(N - tail));
+      std::memcpy(&storage[tail], source, chunk * sizeof(T));
+      source += chunk;
+      tail = static_cast<int>((tail + chunk) % N);
+      remaining -= chunk;
+    }
+
+    count += static_cast<int>(num);
+    if (count > N)
+    {
+      head = tail;
+      count = N;
+    }
+  }
+
+  // Removes num values into dest in at most two memcpy spans. The caller must not pop more
+  // than size() values. Only available for trivially copyable types.
+  void pop_block(T* dest, size_t num)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    size_t remaining = num;
+    while (remaining > 0)
+    {
+      const size_t chunk = std::min(remaining, static_cast<size_t>(N - head));
+      std::memcpy(dest, &storage[head], chunk * sizeof(T));
+      dest += chunk;
+      head = static_cast<int>((head + chunk) % N);
+      remaining -= chunk;
+    }
+
+    count -= static_cast<int>(num);
+  }
+
   T& front() noexcept { return storage[head]; }
   const T& front() const noexcept { return storage[head]; }
   size_t size() const noexcept { return count; }
@@ -5,10 +5,14 @@
 
 #include <algorithm>
 #include <cstring>
+
+#include <xxhash.h>
+
 #include "Common/BitUtils.h"
 #include "Common/CPUDetect.h"
 #include "Common/CommonFuncs.h"
 #include "Common/Intrinsics.h"
+#include "Common/SIMDDispatch.h"
 
 #ifdef _M_ARM_64
 #ifdef _MSC_VER
@@ -506,27 +510,27 @@ static u64 GetMurmurHash3(const u8* src, u32 len, u32 samples)
 
 u64 GetHash64(const u8* src, u32 len, u32 samples)
 {
+  // A full hash (samples == 0) doesn't need the strided access pattern the sampled
+  // functions are built around, so use XXH64 for it: it runs at full speed on every
+  // architecture and mixes far better than the concatenated per-lane CRC32 values.
+  // The sampled variants keep the CRC/Murmur implementations, whose stride handling
+  // the "accuracy" settings are tuned for.
+  if (samples == 0)
+    return XXH64(src, len, 0);
+
   return ptrHashFunction(src, len, samples);
 }
 
 // sets the hash function used for the texture cache
 void SetHash64Function()
 {
+  SIMD::Variants<u64(const u8* src, u32 len, u32 samples)> hash;
+  hash.generic = &GetMurmurHash3;
 #if defined(_M_X86_64) || defined(_M_X86)
-  if (cpu_info.bSSE4_2)  // sse crc32 version
-  {
-    ptrHashFunction = &GetCRC32;
-  }
-  else
+  hash.sse4_2 = &GetCRC32;
 #elif defined(_M_ARM_64)
-  if (cpu_info.bCRC32)
-  {
-    ptrHashFunction = &GetCRC32;
-  }
-  else
+  hash.arm_crc32 = &GetCRC32;
 #endif
-  {
-    ptrHashFunction = &GetMurmurHash3;
-  }
+  ptrHashFunction = SIMD::Select(hash);
 }
 }  // namespace Common
@@ -7,6 +7,8 @@
 #include <cstddef>
 #include <fstream>
 #include <map>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -14,6 +16,7 @@
 
 #include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
+#include "Common/WorkQueueThread.h"
 
 void IniFile::ParseLine(std::string_view line, std::string* keyOut, std::string* valueOut)
 {
@@ -313,42 +316,111 @@ bool IniFile::Load(const std::string& filename, bool keep_current_data)
   return true;
 }
 
-bool IniFile::Save(const std::string& filename)
+void IniFile::Merge(const IniFile& other)
 {
-  std::ofstream out;
-  std::string temp = File::GetTempFilenameForAtomicWrite(filename);
-  File::OpenFStream(out, temp, std::ios::out);
-
-  if (out.fail())
+  for (const Section& other_section : other.sections)
   {
-    return false;
+    Section* section = GetOrCreateSection(other_section.name);
+    for (const std::string& key : other_section.keys_order)
+    {
+      const auto it = other_section.values.find(key);
+      if (it != other_section.values.end())
+        section->Set(key, it->second);
+    }
+    section->m_lines.insert(section->m_lines.end(), other_section.m_lines.begin(),
+                            other_section.m_lines.end());
   }
+}
+
+std::string IniFile::Serialize() const
+{
+  // Match what writing through a text-mode stream used to produce.
+#ifdef _WIN32
+  constexpr std::string_view line_ending = "\r\n";
+#else
+  constexpr std::string_view line_ending = "\n";
+#endif
 
+  std::ostringstream out;
   for (const Section& section : sections)
   {
     if (!section.keys_order.empty() || !section.m_lines.empty())
-      out << '[' << section.name << ']' << std::endl;
+      out << '[' << section.name << ']' << line_ending;
 
     if (section.keys_order.empty())
     {
       for (const std::string& s : section.m_lines)
-        out << s << std::endl;
+        out << s << line_ending;
     }
     else
     {
       for (const std::string& kvit : section.keys_order)
       {
         auto pair = section.values.find(kvit);
-        out << pair->first << " = " << pair->second << std::endl;
+        out << pair->first << " = " << pair->second << line_ending;
       }
     }
   }
+  return std::move(out).str();
+}
 
-  out.close();
+static bool WriteFileAtomically(const std::string& filename, std::string_view contents)
+{
+  const std::string temp = File::GetTempFilenameForAtomicWrite(filename);
+  if (!File::WriteStringToFile(temp, contents))
+    return false;
 
   return File::RenameSync(temp, filename);
 }
 
+namespace
+{
+// Contents of queued asynchronous saves, keyed by destination path. A newer serialization
+// replaces a pending one for the same file, so bursts of changes produce a single write.
+std::mutex s_queued_saves_mutex;
+std::map<std::string, std::string> s_queued_saves;
+
+void WriteQueuedSave(std::string filename)
+{
+  std::string contents;
+  {
+    std::lock_guard lock(s_queued_saves_mutex);
+    const auto it = s_queued_saves.find(filename);
+    if (it == s_queued_saves.end())
+      return;
+    contents = std::move(it->second);
+    s_queued_saves.erase(it);
+  }
+  WriteFileAtomically(filename, contents);
+}
+
+Common::WorkQueueThread<std::string>& GetSaveWriteThread()
+{
+  // Created on first use; its destructor drains the queue, so writes that are still
+  // pending on a normal exit reach the disk before static teardown completes.
+  static Common::WorkQueueThread<std::string> s_write_thread{WriteQueuedSave};
+  return s_write_thread;
+}
+}  // Anonymous namespace
+
+bool IniFile::Save(const std::string& filename)
+{
+  return WriteFileAtomically(filename, Serialize());
+}
+
+void IniFile::QueueSave(const std::string& filename)
+{
+  bool newly_queued;
+  {
+    std::lock_guard lock(s_queued_saves_mutex);
+    newly_queued = s_queued_saves.insert_or_assign(filename, Serialize()).second;
+  }
+
+  // If a write for this file is already queued, the worker will pick up the new contents.
+  if (newly_queued)
+    GetSaveWriteThread().EmplaceItem(filename);
+}
+
 // Unit test. TODO: Move to the real unit test framework.
 /*
    int main()
@@ -116,8 +116,22 @@ public:
    */
   bool Load(const std::string& filename, bool keep_current_data = false);
 
+  /**
+   * Extends the currently loaded sections and keys with another file's contents (replacing
+   * existing entries), with the same semantics as Load() with keep_current_data set. Used to
+   * layer already-parsed files without going through the text parser again.
+   */
+  void Merge(const IniFile& other);
+
   bool Save(const std::string& filename);
 
+  /**
+   * Serializes the file now but performs the atomic temp-file write and rename on a shared
+   * background thread, so the caller doesn't block on disk I/O. Rapid successive saves of the
+   * same file are coalesced into a single write. Pending writes are flushed on normal exit.
+   */
+  void QueueSave(const std::string& filename);
+
   bool Exists(std::string_view section_name) const;
   // Returns true if key exists in section
   bool Exists(std::string_view section_name, std::string_view key) const;
@@ -164,6 +178,8 @@ public:
   const std::list<Section>& GetSections() const { return sections; }
 
 private:
+  std::string Serialize() const;
+
   std::list<Section> sections;
 
   static const std::string& NULL_STRING;
@@ -27,6 +27,9 @@
  */
 
 #include <x86intrin.h>
+#ifndef __AVX2__
+#define FUNCTION_TARGET_AVX2 [[gnu::target("avx2")]]
+#endif
 #ifndef __SSE4_2__
 #define FUNCTION_TARGET_SSE42 [[gnu::target("sse4.2")]]
 #endif
@@ -49,6 +52,14 @@
 
 #endif  // defined(_MSC_VER) || defined(__INTEL_COMPILER)
 
+#elif defined(_M_ARM_64)
+
+/**
+ * NEON is a mandatory part of AArch64, so the intrinsics are always available without any
+ * function attributes and no runtime check is required (cpu_info.bASIMD reflects this).
+ */
+#include <arm_neon.h>
+
 #endif  // _M_X86
 
 /**
@@ -57,6 +68,9 @@
  * version without the macro around a #ifdef guard. Be careful when using intrinsics, as all use
  * should still be placed around a #ifdef _M_X86 if the file is compiled on all architectures.
  */
+#ifndef FUNCTION_TARGET_AVX2
+#define FUNCTION_TARGET_AVX2
+#endif
 #ifndef FUNCTION_TARGET_SSE42
 #define FUNCTION_TARGET_SSE42
 #endif
@@ -69,41 +69,62 @@ public:
     m_header.Init();
     if (m_file.IsOpen() && ValidateHeader())
     {
-      // good header, read some key/value pairs
-      K key;
-
-      std::unique_ptr<V[]> value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-      u64 last_valid_value_start = m_file.Tell();
-
-      while (m_file.ReadArray(&value_size, 1))
+      // Good header. Slurp the rest of the file into one buffer and parse the key/value
+      // pairs from memory. This replaces thousands of small freads with a single large one,
+      // and the reader is handed pointers into the buffer, so consumers (e.g. a driver's
+      // pipeline cache) can ingest values without an intermediate copy.
+      const u64 data_start = m_file.Tell();
+      const u64 data_size = file_size - data_start;
+
+      // TODO: use make_unique_for_overwrite in C++20
+      std::unique_ptr<u8[]> data(new u8[data_size]);
+      if (data_size == 0 || m_file.ReadBytes(data.get(), data_size))
       {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
-          break;
+        K key;
+        u32 value_size = 0;
+        u32 entry_number = 0;
+        u64 pos = 0;
+        u64 last_valid_value_start = 0;
 
-        // TODO: use make_unique_for_overwrite in C++20
-        value = std::unique_ptr<V[]>(new V[value_size]);
-
-        // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
-            m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
+        while (pos + sizeof(value_size) <= data_size)
         {
-          last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
-        }
-        else
-        {
-          break;
+          std::memcpy(&value_size, &data[pos], sizeof(value_size));
+
+          const u64 entry_size = sizeof(value_size) + sizeof(key) +
+                                 static_cast<u64>(value_size) * sizeof(V) + sizeof(entry_number);
+          if (pos + entry_size > data_size)
+            break;
+
+          std::memcpy(&key, &data[pos + sizeof(value_size)], sizeof(key));
+          std::memcpy(&entry_number, &data[pos + entry_size - sizeof(entry_number)],
+                      sizeof(entry_number));
+          if (entry_number != m_num_entries + 1)
+            break;
+
+          const u8* const value_begin = &data[pos + sizeof(value_size) + sizeof(key)];
+          pos += entry_size;
+          last_valid_value_start = pos;
+          m_num_entries++;
+
+          if (reinterpret_cast<uintptr_t>(value_begin) % alignof(V) == 0)
+          {
+            reader.Read(key, reinterpret_cast<const V*>(value_begin), value_size);
+          }
+          else
+          {
+            // Entries aren't aligned in the file, so values of types wider than a byte may
+            // need a bounce copy before the reader can legally access them.
+            std::unique_ptr<V[]> value(new V[value_size]);
+            std::memcpy(value.get(), value_begin, static_cast<u64>(value_size) * sizeof(V));
+            reader.Read(key, value.get(), value_size);
+          }
         }
 
-        m_num_entries++;
-      }
-      m_file.Clear();
-      m_file.Seek(last_valid_value_start, SEEK_SET);
+        m_file.Clear();
+        m_file.Seek(data_start + last_valid_value_start, SEEK_SET);
 
-      return m_num_entries;
+        return m_num_entries;
+      }
     }
 
     // failed to open file for reading or bad header
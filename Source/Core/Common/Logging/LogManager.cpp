@@ -19,12 +19,11 @@
 #include "Common/Logging/ConsoleListener.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 
 namespace Common::Log
 {
-constexpr size_t MAX_MSGLEN = 1024;
-
 const Config::Info<bool> LOGGER_WRITE_TO_FILE{{Config::System::Logger, "Options", "WriteToFile"},
                                               false};
 const Config::Info<bool> LOGGER_WRITE_TO_CONSOLE{
@@ -72,8 +71,8 @@ void GenericLog(LOG_LEVELS level, LOG_TYPE type, const char* file, int line, con
 
   va_list args;
   va_start(args, fmt);
-  char message[MAX_MSGLEN];
-  CharArrayFromFormatV(message, MAX_MSGLEN, fmt, args);
+  char message[LogManager::MAX_MSGLEN];
+  CharArrayFromFormatV(message, LogManager::MAX_MSGLEN, fmt, args);
   va_end(args);
 
   instance->Log(level, type, file, line, message);
@@ -89,8 +88,13 @@ void GenericLogFmtImpl(LOG_LEVELS level, LOG_TYPE type, const char* file, int li
   if (!instance->IsEnabled(type, level))
     return;
 
-  const auto message = fmt::vformat(format, args);
-  instance->Log(level, type, file, line, message.c_str());
+  // Format into a stack buffer rather than through fmt::vformat; together
+  // with the deferred fan-out in LogManager::Log this keeps an enabled log
+  // statement free of heap allocations on the calling thread.
+  char message[LogManager::MAX_MSGLEN];
+  const auto result = fmt::vformat_to_n(message, LogManager::MAX_MSGLEN - 1, format, args);
+  *result.out = '\0';
+  instance->Log(level, type, file, line, message);
 }
 
 static size_t DeterminePathCutOffPoint()
@@ -190,10 +194,20 @@ LogManager::LogManager()
         Config::Info<bool>{{Config::System::Logger, "Logs", container.m_short_name}, false});
 
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_drain_thread = std::thread(&LogManager::DrainThread, this);
 }
 
 LogManager::~LogManager()
 {
+  m_drain_shutdown.Set();
+  m_drain_wakeup.Set();
+  if (m_drain_thread.joinable())
+    m_drain_thread.join();
+
+  // Flush anything that raced with the shutdown flag.
+  DrainAllBuffers();
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
@@ -225,7 +239,73 @@ void LogManager::Log(LOG_LEVELS level, LOG_TYPE type, const char* file, int line
   if (!IsEnabled(type, level) || !static_cast<bool>(m_listener_ids))
     return;
 
-  LogWithFullPath(level, type, file + m_path_cutoff_point, line, message);
+  // Hand the message off to the drain thread instead of fanning out to the
+  // listeners here, so hot callsites never pay for timestamp formatting,
+  // the listener lock or file I/O. The ring recycles its nodes, so pushing
+  // does not allocate in the steady state.
+  LogEntry entry;
+  entry.level = level;
+  entry.type = type;
+  entry.file = file;
+  entry.line = line;
+  std::strncpy(entry.message.data(), message, MAX_MSGLEN - 1);
+  entry.message[MAX_MSGLEN - 1] = '\0';
+
+  GetThreadLogBuffer()->queue.Push(std::move(entry));
+  m_drain_wakeup.Set();
+}
+
+LogManager::LogBuffer* LogManager::GetThreadLogBuffer()
+{
+  // Re-registers if the LogManager has been torn down and recreated since
+  // this thread last logged.
+  static thread_local LogManager* s_buffer_owner = nullptr;
+  static thread_local std::shared_ptr<LogBuffer> s_buffer;
+
+  if (s_buffer_owner != this)
+  {
+    s_buffer = std::make_shared<LogBuffer>();
+    s_buffer_owner = this;
+
+    std::lock_guard lk(m_buffers_lock);
+    m_buffers.push_back(s_buffer);
+  }
+  return s_buffer.get();
+}
+
+void LogManager::DrainThread()
+{
+  Common::SetCurrentThreadName("Log drain");
+
+  while (true)
+  {
+    m_drain_wakeup.Wait();
+    DrainAllBuffers();
+
+    if (m_drain_shutdown.IsSet())
+      break;
+  }
+}
+
+void LogManager::DrainAllBuffers()
+{
+  std::vector<std::shared_ptr<LogBuffer>> buffers;
+  {
+    std::lock_guard lk(m_buffers_lock);
+    buffers = m_buffers;
+  }
+
+  // Messages are drained in per-thread order; interleaving between threads
+  // follows registration order rather than strict wall-clock order.
+  LogEntry entry;
+  for (const auto& buffer : buffers)
+  {
+    while (buffer->queue.Pop(entry))
+    {
+      LogWithFullPath(entry.level, entry.type, entry.file + m_path_cutoff_point, entry.line,
+                      entry.message.data());
+    }
+  }
 }
 
 void LogManager::LogWithFullPath(LOG_LEVELS level, LOG_TYPE type, const char* file, int line,
@@ -6,10 +6,17 @@
 #include <array>
 #include <cstdarg>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Common/BitSet.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/Logging/Log.h"
+#include "Common/SPSCQueue.h"
 
 namespace Common::Log
 {
@@ -56,6 +63,8 @@ public:
 
   void SaveSettings();
 
+  static constexpr size_t MAX_MSGLEN = 1024;
+
 private:
   struct LogContainer
   {
@@ -64,6 +73,27 @@ private:
     bool m_enable = false;
   };
 
+  // A pending message as written by a hot callsite. The message text is
+  // stored inline so that enqueueing never touches the heap; the file name
+  // is a __FILE__ literal and can be kept by pointer.
+  struct LogEntry
+  {
+    LOG_LEVELS level;
+    LOG_TYPE type;
+    const char* file;
+    int line;
+    std::array<char, MAX_MSGLEN> message;
+  };
+
+  // Each logging thread owns one of these rings. Only the owning thread
+  // pushes and only the drain thread pops, so no lock is taken on the hot
+  // path. The shared_ptr keeps a ring alive until its last entries have
+  // been drained, even if the owning thread has already exited.
+  struct LogBuffer
+  {
+    SPSCQueue<LogEntry, false> queue;
+  };
+
   LogManager();
   ~LogManager();
 
@@ -75,10 +105,20 @@ private:
   void LogWithFullPath(LOG_LEVELS level, LOG_TYPE type, const char* file, int line,
                        const char* message);
 
+  LogBuffer* GetThreadLogBuffer();
+  void DrainThread();
+  void DrainAllBuffers();
+
   LOG_LEVELS m_level;
   std::array<LogContainer, NUMBER_OF_LOGS> m_log{};
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  std::vector<std::shared_ptr<LogBuffer>> m_buffers;
+  std::mutex m_buffers_lock;
+  std::thread m_drain_thread;
+  Event m_drain_wakeup;
+  Flag m_drain_shutdown;
 };
 }  // namespace Common::Log
@@ -3,38 +3,108 @@
 
 #include "Common/MD5.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <functional>
-#include <mbedtls/md5.h>
+#include <future>
+#include <memory>
 #include <string>
+#include <vector>
+
+#include <mbedtls/md5.h>
 
 #include <fmt/format.h>
 
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 
 namespace MD5
 {
+// Bump this to invalidate every cached digest (e.g. if the format below changes).
+constexpr u32 CACHE_REVISION = 1;
+
+static std::string DigestCachePath(const std::string& file_path)
+{
+  const u64 path_hash = Common::GetHash64(reinterpret_cast<const u8*>(file_path.data()),
+                                          static_cast<u32>(file_path.size()), 0);
+  return fmt::format("{}md5-{:016x}.cache", File::GetUserPath(D_CACHE_IDX), path_hash);
+}
+
 std::string MD5Sum(const std::string& file_path, std::function<bool(int)> report_progress)
 {
   std::string output_string;
-  std::vector<u8> data(8 * 1024 * 1024);
-  u64 read_offset = 0;
-  mbedtls_md5_context ctx;
+
+  // Hashing a dual-layer image takes minutes, so the digest is cached keyed on the
+  // file's size and modification time. Repeat verifications then cost one stat call.
+  // An mtime of 0 means the time couldn't be determined; the digest isn't cached then.
+  const std::string cache_path = DigestCachePath(file_path);
+  const File::FileInfo file_info(file_path);
+  const u64 file_size = file_info.GetSize();
+  const u64 file_mtime = file_info.GetModificationTime();
+
+  std::string cache_contents;
+  if (file_mtime != 0 && File::ReadFileToString(cache_path, cache_contents))
+  {
+    u32 cached_revision;
+    unsigned long long cached_size, cached_mtime;
+    char cached_digest[33]{};
+    if (std::sscanf(cache_contents.c_str(), "%u %llu %llu %32s", &cached_revision, &cached_size,
+                    &cached_mtime, cached_digest) == 4 &&
+        cached_revision == CACHE_REVISION && cached_size == file_size &&
+        cached_mtime == file_mtime && std::strlen(cached_digest) == 32)
+    {
+      report_progress(100);
+      return cached_digest;
+    }
+  }
 
   std::unique_ptr<DiscIO::BlobReader> file(DiscIO::CreateBlobReader(file_path));
   u64 game_size = file->GetDataSize();
 
+  mbedtls_md5_context ctx;
   mbedtls_md5_starts_ret(&ctx);
 
+  // MD5 itself is strictly sequential, but the read (and for compressed blobs, the
+  // decompression) of the next chunk can overlap with hashing the current one.
+  // Double-buffer: a worker reads chunk n+1 while this thread hashes chunk n.
+  std::array<std::vector<u8>, 2> buffers{std::vector<u8>(8 * 1024 * 1024),
+                                         std::vector<u8>(8 * 1024 * 1024)};
+
+  const auto read_chunk = [&file, game_size](std::vector<u8>* buffer, u64 offset) -> size_t {
+    const size_t read_size = std::min(static_cast<u64>(buffer->size()), game_size - offset);
+    if (!file->Read(offset, read_size, buffer->data()))
+      return 0;
+    return read_size;
+  };
+
+  u64 read_offset = 0;
+  size_t buffer_index = 0;
+  std::future<size_t> pending_read;
+  if (read_offset < game_size)
+    pending_read = std::async(std::launch::async, read_chunk, &buffers[buffer_index], read_offset);
+
   while (read_offset < game_size)
   {
-    size_t read_size = std::min(static_cast<u64>(data.size()), game_size - read_offset);
-    if (!file->Read(read_offset, read_size, data.data()))
+    const size_t chunk_size = pending_read.get();
+    if (chunk_size == 0)
       return output_string;
 
-    mbedtls_md5_update_ret(&ctx, data.data(), read_size);
-    read_offset += read_size;
+    const u64 next_offset = read_offset + chunk_size;
+    if (next_offset < game_size)
+    {
+      pending_read =
+          std::async(std::launch::async, read_chunk, &buffers[buffer_index ^ 1], next_offset);
+    }
+
+    mbedtls_md5_update_ret(&ctx, buffers[buffer_index].data(), chunk_size);
+    buffer_index ^= 1;
+    read_offset = next_offset;
 
     int progress =
         static_cast<int>(static_cast<float>(read_offset) / static_cast<float>(game_size) * 100);
@@ -49,6 +119,12 @@ std::string MD5Sum(const std::string& file_path, std::function<bool(int)> report
   for (u8 n : output)
     output_string += fmt::format("{:02x}", n);
 
+  if (file_mtime != 0)
+  {
+    std::ofstream cache(cache_path, std::ios::trunc | std::ios::binary);
+    cache << fmt::format("{} {} {} {}\n", CACHE_REVISION, file_size, file_mtime, output_string);
+  }
+
   return output_string;
 }
 }  // namespace MD5
@@ -0,0 +1,80 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Common
+{
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path)
+{
+  // Can't use make_unique due to the private constructor. The destructor cleans up whatever
+  // was acquired before a failure.
+  std::unique_ptr<MappedFile> file(new MappedFile());
+
+#ifdef _WIN32
+  const HANDLE handle = CreateFile(UTF8ToTStr(path).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                   nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (handle == INVALID_HANDLE_VALUE)
+    return nullptr;
+  file->m_file = handle;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0)
+    return nullptr;
+
+  const HANDLE mapping = CreateFileMapping(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr)
+    return nullptr;
+  file->m_mapping = mapping;
+
+  file->m_data = static_cast<const u8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+  if (file->m_data == nullptr)
+    return nullptr;
+  file->m_size = static_cast<u64>(size.QuadPart);
+#else
+  file->m_fd = open(path.c_str(), O_RDONLY);
+  if (file->m_fd < 0)
+    return nullptr;
+
+  struct stat st;
+  if (fstat(file->m_fd, &st) != 0 || st.st_size <= 0)
+    return nullptr;
+
+  void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, file->m_fd, 0);
+  if (data == MAP_FAILED)
+    return nullptr;
+  file->m_data = static_cast<const u8*>(data);
+  file->m_size = static_cast<u64>(st.st_size);
+#endif
+
+  return file;
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+  if (m_data != nullptr)
+    UnmapViewOfFile(m_data);
+  if (m_mapping != nullptr)
+    CloseHandle(m_mapping);
+  if (m_file != nullptr)
+    CloseHandle(m_file);
+#else
+  if (m_data != nullptr)
+    munmap(const_cast<u8*>(m_data), static_cast<size_t>(m_size));
+  if (m_fd >= 0)
+    close(m_fd);
+#endif
+}
+}  // namespace Common
@@ -0,0 +1,40 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Read-only memory-mapped view of an entire file. The view stays valid for the lifetime of
+// the object.
+class MappedFile
+{
+public:
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Returns nullptr if the file could not be opened or mapped (this includes empty files).
+  static std::unique_ptr<MappedFile> Open(const std::string& path);
+
+  const u8* Data() const { return m_data; }
+  u64 Size() const { return m_size; }
+
+private:
+  MappedFile() = default;
+
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+#ifdef _WIN32
+  void* m_file = nullptr;
+  void* m_mapping = nullptr;
+#else
+  int m_fd = -1;
+#endif
+};
+}  // namespace Common
@@ -211,8 +211,6 @@ bool SDCardCreate(u64 disk_size /*in MB*/, const std::string& filename)
     return false;
   }
 
-  // Pretty unlikely to overflow.
-  const u32 sectors_per_disk = static_cast<u32>(disk_size / BYTES_PER_SECTOR);
   const u32 sectors_per_fat = get_sectors_per_fat(disk_size, get_sectors_per_cluster(disk_size));
 
   boot_sector_init(s_boot_sector, s_fsinfo_sector, disk_size, nullptr);
@@ -276,7 +274,10 @@ bool SDCardCreate(u64 disk_size /*in MB*/, const std::string& filename)
   if (!write_empty(file, sectors_per_fat - 1))
     goto FailWrite;
 
-  if (!write_empty(file, sectors_per_disk - RESERVED_SECTORS - 2 * sectors_per_fat))
+  // The data region is all zeros, so extend the file with Resize() instead of writing
+  // them out. On filesystems with sparse file support the image then only occupies
+  // space for blocks that have actually been written.
+  if (!file.Resize(disk_size))
     goto FailWrite;
 
   return true;
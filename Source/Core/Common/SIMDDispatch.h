@@ -0,0 +1,59 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CPUDetect.h"
+
+namespace Common::SIMD
+{
+/**
+ * Shared runtime dispatch over per-instruction-set function variants.
+ *
+ * SIMD consumers fill in the variants they implement (each slot mirrors the
+ * corresponding CPUInfo feature flag) and Select() returns the best one the
+ * host CPU supports, falling back down the ladder to the mandatory generic
+ * implementation. Variant functions are typically defined in the same
+ * translation unit with the matching FUNCTION_TARGET_* attribute from
+ * Intrinsics.h.
+ *
+ * Select() reads cpu_info, so the result should be cached (e.g. in a function
+ * pointer chosen at init) rather than re-selected per call in hot loops.
+ */
+template <typename F>
+struct Variants
+{
+  F* generic = nullptr;
+
+  // x86, best first.
+  F* avx2 = nullptr;
+  F* sse4_2 = nullptr;
+  F* sse4_1 = nullptr;
+  F* ssse3 = nullptr;
+
+  // AArch64.
+  F* arm_crc32 = nullptr;
+  F* neon = nullptr;
+};
+
+template <typename F>
+F* Select(const Variants<F>& variants)
+{
+#if defined(_M_X86) || defined(_M_X86_64)
+  if (variants.avx2 && cpu_info.bAVX2)
+    return variants.avx2;
+  if (variants.sse4_2 && cpu_info.bSSE4_2)
+    return variants.sse4_2;
+  if (variants.sse4_1 && cpu_info.bSSE4_1)
+    return variants.sse4_1;
+  if (variants.ssse3 && cpu_info.bSSSE3)
+    return variants.ssse3;
+#elif defined(_M_ARM_64)
+  if (variants.arm_crc32 && cpu_info.bCRC32)
+    return variants.arm_crc32;
+  if (variants.neon && cpu_info.bASIMD)
+    return variants.neon;
+#endif
+  return variants.generic;
+}
+}  // namespace Common::SIMD
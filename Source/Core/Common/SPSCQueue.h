@@ -18,12 +18,12 @@ template <typename T, bool NeedSize = true>
 class SPSCQueue
 {
 public:
-  SPSCQueue() : m_size(0) { m_write_ptr = m_read_ptr = new ElementPtr(); }
-  ~SPSCQueue()
+  SPSCQueue() : m_size(0)
   {
-    // this will empty out the whole queue
-    delete m_read_ptr;
+    m_write_ptr = m_first = m_read_copy = new ElementPtr();
+    m_read_ptr.store(m_write_ptr, std::memory_order_relaxed);
   }
+  ~SPSCQueue() { DeleteChain(m_first); }
 
   u32 Size() const
   {
@@ -31,8 +31,11 @@ public:
     return m_size.load();
   }
 
-  bool Empty() const { return !m_read_ptr->next.load(); }
-  T& Front() const { return m_read_ptr->current; }
+  bool Empty() const
+  {
+    return !m_read_ptr.load(std::memory_order_acquire)->next.load(std::memory_order_acquire);
+  }
+  T& Front() const { return m_read_ptr.load(std::memory_order_relaxed)->current; }
   template <typename Arg>
   void Push(Arg&& t)
   {
@@ -40,7 +43,7 @@ public:
     m_write_ptr->current = std::forward<Arg>(t);
     // set the next pointer to a new element ptr
     // then advance the write pointer
-    ElementPtr* new_ptr = new ElementPtr();
+    ElementPtr* new_ptr = AllocElement();
     m_write_ptr->next.store(new_ptr, std::memory_order_release);
     m_write_ptr = new_ptr;
     if (NeedSize)
@@ -51,12 +54,11 @@ public:
   {
     if (NeedSize)
       m_size--;
-    ElementPtr* tmpptr = m_read_ptr;
-    // advance the read pointer
-    m_read_ptr = tmpptr->next.load();
-    // set the next element to nullptr to stop the recursive deletion
-    tmpptr->next.store(nullptr);
-    delete tmpptr;  // this also deletes the element
+    ElementPtr* tmpptr = m_read_ptr.load(std::memory_order_relaxed);
+    // destroy the element's value, then hand the node back to the producer
+    // for reuse by advancing the read pointer past it
+    tmpptr->current = T();
+    m_read_ptr.store(tmpptr->next.load(std::memory_order_acquire), std::memory_order_release);
   }
 
   bool Pop(T& t)
@@ -67,11 +69,9 @@ public:
     if (NeedSize)
       m_size--;
 
-    ElementPtr* tmpptr = m_read_ptr;
-    m_read_ptr = tmpptr->next.load(std::memory_order_acquire);
+    ElementPtr* tmpptr = m_read_ptr.load(std::memory_order_relaxed);
     t = std::move(tmpptr->current);
-    tmpptr->next.store(nullptr);
-    delete tmpptr;
+    m_read_ptr.store(tmpptr->next.load(std::memory_order_acquire), std::memory_order_release);
     return true;
   }
 
@@ -79,8 +79,9 @@ public:
   void Clear()
   {
     m_size.store(0);
-    delete m_read_ptr;
-    m_write_ptr = m_read_ptr = new ElementPtr();
+    DeleteChain(m_first);
+    m_write_ptr = m_first = m_read_copy = new ElementPtr();
+    m_read_ptr.store(m_write_ptr, std::memory_order_relaxed);
   }
 
 private:
@@ -90,20 +91,45 @@ private:
   {
   public:
     ElementPtr() : next(nullptr) {}
-    ~ElementPtr()
-    {
-      ElementPtr* next_ptr = next.load();
-
-      if (next_ptr)
-        delete next_ptr;
-    }
 
     T current;
     std::atomic<ElementPtr*> next;
   };
 
+  // Recycle nodes the consumer has finished with instead of allocating a new
+  // one per push. Only the producer touches m_first and m_read_copy; the
+  // consumer's position is republished through m_read_ptr.
+  ElementPtr* AllocElement()
+  {
+    if (m_first == m_read_copy)
+      m_read_copy = m_read_ptr.load(std::memory_order_acquire);
+    if (m_first != m_read_copy)
+    {
+      ElementPtr* result = m_first;
+      m_first = result->next.load(std::memory_order_relaxed);
+      result->next.store(nullptr, std::memory_order_relaxed);
+      return result;
+    }
+    return new ElementPtr();
+  }
+
+  static void DeleteChain(ElementPtr* ptr)
+  {
+    while (ptr)
+    {
+      ElementPtr* next_ptr = ptr->next.load(std::memory_order_relaxed);
+      delete ptr;
+      ptr = next_ptr;
+    }
+  }
+
+  // Producer state: the write position, plus the oldest node not yet recycled
+  // and a cached copy of the consumer's position.
   ElementPtr* m_write_ptr;
-  ElementPtr* m_read_ptr;
+  ElementPtr* m_first;
+  ElementPtr* m_read_copy;
+  // Consumer state.
+  std::atomic<ElementPtr*> m_read_ptr;
   std::atomic<u32> m_size;
 };
 }  // namespace Common
@@ -0,0 +1,194 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/SharedMemoryExport.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "Common/Logging/Log.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Common::SharedMemoryExport
+{
+constexpr u32 FRAME_SLOT_COUNT = 3;
+constexpr u32 MAX_FRAME_WIDTH = 3840;
+constexpr u32 MAX_FRAME_HEIGHT = 2160;
+constexpr u32 FRAME_SLOT_SIZE = MAX_FRAME_WIDTH * MAX_FRAME_HEIGHT * 4;
+constexpr u32 AUDIO_RING_FRAMES = 32768;  // ~0.7 s at 48 kHz
+
+static std::once_flag s_init_flag;
+static Header* s_header = nullptr;
+static u8* s_region = nullptr;
+static size_t s_region_size = 0;
+static std::string s_region_name;
+#ifdef _WIN32
+static HANDLE s_mapping_handle = nullptr;
+#endif
+
+static void MapRegion()
+{
+  const size_t header_size = (sizeof(Header) + 63) & ~size_t(63);  // keep payload cache-aligned
+  const size_t frame_data_size = size_t(FRAME_SLOT_SIZE) * FRAME_SLOT_COUNT;
+  const size_t audio_ring_size = size_t(AUDIO_RING_FRAMES) * 2 * sizeof(s16);
+  s_region_size = header_size + frame_data_size + audio_ring_size;
+
+#if defined(_WIN32)
+  s_region_name = fmt::format("dolphin-emu-export.{}", GetCurrentProcessId());
+  s_mapping_handle =
+      CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                         static_cast<DWORD>(s_region_size >> 32),
+                         static_cast<DWORD>(s_region_size), s_region_name.c_str());
+  if (!s_mapping_handle)
+  {
+    ERROR_LOG_FMT(COMMON, "SharedMemoryExport: CreateFileMapping failed: {}", GetLastError());
+    return;
+  }
+  s_region =
+      static_cast<u8*>(MapViewOfFile(s_mapping_handle, FILE_MAP_ALL_ACCESS, 0, 0, s_region_size));
+  if (!s_region)
+  {
+    CloseHandle(s_mapping_handle);
+    s_mapping_handle = nullptr;
+    return;
+  }
+#elif defined(ANDROID)
+  // No portable named shared memory for unrelated processes; not supported.
+  return;
+#else
+  s_region_name = fmt::format("/dolphin-emu-export.{}", getpid());
+  const int fd = shm_open(s_region_name.c_str(), O_CREAT | O_RDWR, 0600);
+  if (fd < 0)
+  {
+    ERROR_LOG_FMT(COMMON, "SharedMemoryExport: shm_open failed: {}", errno);
+    return;
+  }
+  if (ftruncate(fd, s_region_size) != 0)
+  {
+    close(fd);
+    shm_unlink(s_region_name.c_str());
+    return;
+  }
+  void* view = mmap(nullptr, s_region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (view == MAP_FAILED)
+  {
+    shm_unlink(s_region_name.c_str());
+    return;
+  }
+  s_region = static_cast<u8*>(view);
+#endif
+
+  s_header = reinterpret_cast<Header*>(s_region);
+  std::memset(s_header, 0, sizeof(Header));
+  s_header->version = EXPORT_VERSION;
+  s_header->frame_slot_count = FRAME_SLOT_COUNT;
+  s_header->frame_slot_size = FRAME_SLOT_SIZE;
+  s_header->frame_data_offset = static_cast<u32>(header_size);
+  s_header->audio_ring_offset = static_cast<u32>(header_size + frame_data_size);
+  s_header->audio_ring_frames = AUDIO_RING_FRAMES;
+  // The magic is published last so tools never see a half-initialized header.
+  std::atomic_thread_fence(std::memory_order_release);
+  s_header->magic = EXPORT_MAGIC;
+
+  NOTICE_LOG_FMT(COMMON, "SharedMemoryExport: serving capture region '{}' ({} MiB)",
+                 s_region_name, s_region_size / (1024 * 1024));
+}
+
+static bool EnsureInitialized()
+{
+  std::call_once(s_init_flag, MapRegion);
+  return s_header != nullptr;
+}
+
+void PushVideoFrame(const u8* data, const u32 width, const u32 height, const u32 stride)
+{
+  if (!EnsureInitialized())
+    return;
+
+  if (width > MAX_FRAME_WIDTH || height > MAX_FRAME_HEIGHT)
+  {
+    static bool warned = false;
+    if (!warned)
+    {
+      warned = true;
+      WARN_LOG_FMT(COMMON, "SharedMemoryExport: {}x{} frame exceeds the slot capacity, skipping",
+                   width, height);
+    }
+    return;
+  }
+
+  const u32 slot = (s_header->latest_slot + 1) % FRAME_SLOT_COUNT;
+  u8* slot_data = s_region + s_header->frame_data_offset + size_t(slot) * FRAME_SLOT_SIZE;
+
+  // Seqlock: odd sequence marks the slot as mid-write.
+  s_header->slot_sequence[slot]++;
+  std::atomic_thread_fence(std::memory_order_release);
+
+  // Pack rows tightly; readback strides can include padding.
+  const u32 row_bytes = width * 4;
+  for (u32 row = 0; row < height; row++)
+    std::memcpy(slot_data + size_t(row) * row_bytes, data + size_t(row) * stride, row_bytes);
+
+  s_header->frame_width = width;
+  s_header->frame_height = height;
+  std::atomic_thread_fence(std::memory_order_release);
+  s_header->slot_sequence[slot]++;
+  s_header->latest_slot = slot;
+  s_header->frame_count++;
+}
+
+void PushAudioSamples(const s16* samples, const u32 num_frames, const u32 sample_rate)
+{
+  if (num_frames == 0 || !EnsureInitialized())
+    return;
+
+  s16* ring = reinterpret_cast<s16*>(s_region + s_header->audio_ring_offset);
+  const u64 cursor = s_header->audio_write_cursor;
+
+  u32 pos = static_cast<u32>(cursor % AUDIO_RING_FRAMES);
+  u32 remaining = std::min(num_frames, AUDIO_RING_FRAMES);
+  const s16* src = samples;
+  while (remaining > 0)
+  {
+    const u32 chunk = std::min(remaining, AUDIO_RING_FRAMES - pos);
+    std::memcpy(&ring[size_t(pos) * 2], src, size_t(chunk) * 2 * sizeof(s16));
+    src += size_t(chunk) * 2;
+    pos = (pos + chunk) % AUDIO_RING_FRAMES;
+    remaining -= chunk;
+  }
+
+  s_header->audio_sample_rate = sample_rate;
+  std::atomic_thread_fence(std::memory_order_release);
+  s_header->audio_write_cursor = cursor + num_frames;
+}
+
+void Shutdown()
+{
+  if (!s_region)
+    return;
+
+#if defined(_WIN32)
+  UnmapViewOfFile(s_region);
+  CloseHandle(s_mapping_handle);
+  s_mapping_handle = nullptr;
+#elif !defined(ANDROID)
+  munmap(s_region, s_region_size);
+  shm_unlink(s_region_name.c_str());
+#endif
+  s_region = nullptr;
+  s_header = nullptr;
+}
+}  // namespace Common::SharedMemoryExport
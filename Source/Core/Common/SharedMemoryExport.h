@@ -0,0 +1,63 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace Common::SharedMemoryExport
+{
+// A shared-memory surface that exports presented frames and mixed audio to
+// external capture tools (OBS plugins and the like) without any IPC copies on
+// their side: the tool maps the region read-only and consumes directly from it.
+//
+// The region is named dolphin-emu-export.<pid> (shm_open name /dolphin-emu-export.<pid>
+// on POSIX, file mapping name dolphin-emu-export.<pid> on Windows) and starts
+// with the Header below, which is the whole control protocol:
+//
+//  - Video is triple-buffered. The writer fills slots round-robin, guarded by a
+//    per-slot seqlock: slot_sequence[i] is odd while slot i is being written.
+//    A reader copies the slot named by latest_slot and retries if the slot's
+//    sequence changed (or was odd) across the copy. Pixels are tightly packed
+//    RGBA8 rows, width * 4 bytes apart.
+//  - Audio is a ring of interleaved stereo s16 frames. audio_write_cursor is
+//    the total number of frames ever written; a reader keeps its own cursor
+//    and copies the difference (mod audio_ring_frames) each poll.
+//
+// All multi-byte fields are little-endian and naturally aligned; 64-bit fields
+// are written with single aligned stores, so readers on the supported
+// architectures never observe torn values.
+struct Header
+{
+  u32 magic;    // EXPORT_MAGIC
+  u32 version;  // EXPORT_VERSION
+
+  u32 frame_slot_count;
+  u32 frame_slot_size;    // capacity of one slot in bytes
+  u32 frame_data_offset;  // offset of slot 0 from the start of the region
+  u32 audio_ring_offset;  // offset of the audio ring from the start of the region
+  u32 audio_ring_frames;  // ring capacity in stereo sample frames
+
+  // Dimensions of the most recently completed frame.
+  u32 frame_width;
+  u32 frame_height;
+
+  u32 latest_slot;  // slot holding the most recently completed frame
+  u32 audio_sample_rate;
+
+  u64 frame_count;  // total completed frames, for pacing/skip detection
+  u64 slot_sequence[3];
+  u64 audio_write_cursor;  // total stereo frames written to the ring
+};
+
+constexpr u32 EXPORT_MAGIC = 0x584C4F44;  // "DOLX" when read as bytes
+constexpr u32 EXPORT_VERSION = 1;
+
+// Callers gate these on the user config; the region is created on first use.
+// Frames larger than the slot capacity (4K RGBA) are skipped with a warning.
+void PushVideoFrame(const u8* data, u32 width, u32 height, u32 stride);
+void PushAudioSamples(const s16* samples, u32 num_frames, u32 sample_rate);
+
+// Unmaps and unlinks the region (no-op if it was never created).
+void Shutdown();
+}  // namespace Common::SharedMemoryExport
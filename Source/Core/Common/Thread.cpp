@@ -2,6 +2,12 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Common/Thread.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
@@ -30,6 +36,8 @@
 
 namespace Common
 {
+static thread_local const char* tls_current_thread_name = nullptr;
+
 int CurrentThreadId()
 {
 #ifdef _WIN32
@@ -112,6 +120,7 @@ void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+  tls_current_thread_name = name;
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -182,8 +191,114 @@ void SetCurrentThreadName(const char* name)
   // API.
   __itt_thread_set_name(name);
 #endif
+  tls_current_thread_name = name;
 }
 
 #endif
 
+#ifdef _WIN32
+
+static u32 ComputePerformanceCoreMask()
+{
+  DWORD size = 0;
+  GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &size);
+  if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+    return 0;
+
+  std::vector<u8> buffer(size);
+  auto* const info = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data());
+  if (!GetLogicalProcessorInformationEx(RelationProcessorCore, info, &size))
+    return 0;
+
+  // EfficiencyClass is relative within the package; a higher value means a faster core.
+  // On homogeneous systems every core reports class 0.
+  BYTE max_class = 0;
+  for (u8* ptr = buffer.data(); ptr < buffer.data() + size;)
+  {
+    const auto* entry = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(ptr);
+    max_class = std::max(max_class, entry->Processor.EfficiencyClass);
+    ptr += entry->Size;
+  }
+  if (max_class == 0)
+    return 0;
+
+  u32 mask = 0;
+  for (u8* ptr = buffer.data(); ptr < buffer.data() + size;)
+  {
+    const auto* entry = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(ptr);
+    if (entry->Processor.EfficiencyClass == max_class)
+    {
+      for (WORD group = 0; group < entry->Processor.GroupCount; ++group)
+      {
+        if (entry->Processor.GroupMask[group].Group == 0)
+          mask |= static_cast<u32>(entry->Processor.GroupMask[group].Mask);
+      }
+    }
+    ptr += entry->Size;
+  }
+  return mask;
+}
+
+#elif defined __linux__
+
+static u32 ComputePerformanceCoreMask()
+{
+  const u32 num_cpus = std::min<u32>(std::thread::hardware_concurrency(), 32);
+  if (num_cpus < 2)
+    return 0;
+
+  // cpufreq exposes each core's maximum frequency; efficiency cores top out well below
+  // performance cores (roughly 60-75% on current Intel hybrid and big.LITTLE designs).
+  // The tolerance keeps "favored" turbo cores from splitting the performance cluster.
+  u64 freqs[32] = {};
+  u64 max_freq = 0;
+  for (u32 i = 0; i < num_cpus; ++i)
+  {
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(i) +
+                       "/cpufreq/cpuinfo_max_freq");
+    if (!(file >> freqs[i]))
+      return 0;  // No cpufreq information, can't classify
+    max_freq = std::max(max_freq, freqs[i]);
+  }
+
+  u32 mask = 0;
+  for (u32 i = 0; i < num_cpus; ++i)
+  {
+    if (freqs[i] * 100 >= max_freq * 85)
+      mask |= 1u << i;
+  }
+
+  const u32 all_cpus = num_cpus == 32 ? 0xFFFFFFFF : (1u << num_cpus) - 1;
+  return mask == all_cpus ? 0 : mask;
+}
+
+#else
+
+static u32 ComputePerformanceCoreMask()
+{
+  // macOS doesn't support thread-to-core affinity; QoS classes are the only placement
+  // hint, and the default scheduling already prefers P-cores for busy threads.
+  return 0;
+}
+
+#endif
+
+u32 GetPerformanceCoreMask()
+{
+  static const u32 mask = ComputePerformanceCoreMask();
+  return mask;
+}
+
+void PinCurrentThreadToPerformanceCores()
+{
+  const u32 mask = GetPerformanceCoreMask();
+  if (mask != 0)
+    SetCurrentThreadAffinity(mask);
+}
+
+const char* GetCurrentThreadName()
+{
+  return tls_current_thread_name;
+}
+
 }  // namespace Common
@@ -22,6 +22,16 @@ int CurrentThreadId();
 void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask);
 void SetCurrentThreadAffinity(u32 mask);
 
+// Affinity mask of the logical processors classified as performance cores on hybrid
+// CPUs (Intel P/E designs, ARM big.LITTLE). Returns 0 when the topology is homogeneous
+// or can't be determined, in which case thread placement is best left to the OS.
+// Only the first 32 logical processors are considered, matching SetThreadAffinity.
+u32 GetPerformanceCoreMask();
+
+// Restricts the current thread to the performance cores. No-op on homogeneous systems
+// and on platforms without thread affinity support.
+void PinCurrentThreadToPerformanceCores();
+
 void SleepCurrentThread(int ms);
 void SwitchCurrentThread();  // On Linux, this is equal to sleep 1ms
 
@@ -35,4 +45,9 @@ inline void YieldCPU()
 
 void SetCurrentThreadName(const char* name);
 
+// Returns the name most recently passed to SetCurrentThreadName on this
+// thread, or nullptr if it was never named. The pointer is only guaranteed to
+// stay valid if the name was a string literal.
+const char* GetCurrentThreadName();
+
 }  // namespace Common
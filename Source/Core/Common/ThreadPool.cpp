@@ -0,0 +1,167 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+ThreadPool::WorkGroup::WorkGroup(ThreadPool& pool) : m_pool(pool)
+{
+}
+
+ThreadPool::WorkGroup::~WorkGroup()
+{
+  Wait();
+}
+
+void ThreadPool::WorkGroup::Push(std::function<void()> function, Priority priority,
+                                 int affinity_hint)
+{
+  {
+    std::lock_guard lock(m_mutex);
+    ++m_unfinished_jobs;
+  }
+  m_pool.PushJob(Job{std::move(function), this}, priority, affinity_hint);
+}
+
+void ThreadPool::WorkGroup::Wait()
+{
+  std::unique_lock lock(m_mutex);
+  while (m_unfinished_jobs != 0)
+  {
+    lock.unlock();
+    // Run queued jobs instead of going idle. If the queues are empty, every job of
+    // this group is either done or running on a worker, which will signal us.
+    const bool ran_job = m_pool.RunOneJob(0);
+    lock.lock();
+    if (!ran_job && m_unfinished_jobs != 0)
+      m_done_condvar.wait(lock);
+  }
+}
+
+void ThreadPool::WorkGroup::OnJobFinished()
+{
+  // Notifying under the lock makes sure the condition variable isn't destructed
+  // between a waiter's predicate check and this notification.
+  std::lock_guard lock(m_mutex);
+  if (--m_unfinished_jobs == 0)
+    m_done_condvar.notify_all();
+}
+
+ThreadPool& ThreadPool::GetInstance()
+{
+  static ThreadPool s_thread_pool;
+  return s_thread_pool;
+}
+
+ThreadPool::ThreadPool()
+{
+  // Leave one hardware thread for the caller, which WorkGroup::Wait puts to work.
+  const size_t worker_count = std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1;
+  m_workers.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; ++i)
+    m_workers.emplace_back(std::make_unique<Worker>());
+  for (size_t i = 0; i < worker_count; ++i)
+    m_workers[i]->thread = std::thread(&ThreadPool::WorkerThread, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard lock(m_wake_mutex);
+    m_shutdown.Set();
+  }
+  m_wake_condvar.notify_all();
+  for (std::unique_ptr<Worker>& worker : m_workers)
+    worker->thread.join();
+}
+
+void ThreadPool::Push(std::function<void()> function, Priority priority, int affinity_hint)
+{
+  PushJob(Job{std::move(function), nullptr}, priority, affinity_hint);
+}
+
+void ThreadPool::PushJob(Job job, Priority priority, int affinity_hint)
+{
+  const size_t worker_index = (affinity_hint >= 0 ? static_cast<size_t>(affinity_hint) :
+                                                    m_next_worker.fetch_add(1)) %
+                              m_workers.size();
+  {
+    std::lock_guard lock(m_workers[worker_index]->mutex);
+    m_workers[worker_index]->queues[static_cast<size_t>(priority)].push_back(std::move(job));
+  }
+  m_queued_jobs.fetch_add(1);
+  {
+    std::lock_guard lock(m_wake_mutex);
+  }
+  m_wake_condvar.notify_one();
+}
+
+bool ThreadPool::RunOneJob(size_t first_worker)
+{
+  if (m_queued_jobs.load() == 0)
+    return false;
+
+  Job job;
+  bool found = false;
+  // Check every queue of a priority class before moving to the next class, starting
+  // with the worker's own queue, so stolen jobs still respect priorities.
+  for (size_t priority = 0; priority < PRIORITY_CLASSES && !found; ++priority)
+  {
+    for (size_t i = 0; i < m_workers.size() && !found; ++i)
+    {
+      Worker& worker = *m_workers[(first_worker + i) % m_workers.size()];
+      std::lock_guard lock(worker.mutex);
+      std::deque<Job>& queue = worker.queues[priority];
+      if (queue.empty())
+        continue;
+
+      if (i == 0)
+      {
+        // The own queue is popped from the front (submission order)...
+        job = std::move(queue.front());
+        queue.pop_front();
+      }
+      else
+      {
+        // ...and stolen from the back, to stay out of the owner's way.
+        job = std::move(queue.back());
+        queue.pop_back();
+      }
+      found = true;
+    }
+  }
+
+  if (!found)
+    return false;
+
+  m_queued_jobs.fetch_sub(1);
+  job.function();
+  if (job.group)
+    job.group->OnJobFinished();
+  return true;
+}
+
+void ThreadPool::WorkerThread(size_t index)
+{
+  SetCurrentThreadName("Thread pool worker");
+
+  while (true)
+  {
+    if (!RunOneJob(index))
+    {
+      std::unique_lock lock(m_wake_mutex);
+      m_wake_condvar.wait(
+          lock, [this] { return m_shutdown.IsSet() || m_queued_jobs.load() != 0; });
+      if (m_shutdown.IsSet())
+        return;
+    }
+  }
+}
+
+}  // namespace Common
@@ -0,0 +1,111 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common/Flag.h"
+
+namespace Common
+{
+// A process-wide pool of worker threads, so that subsystems which just need "some spare
+// cores for a while" don't each spin up a private set of threads and oversubscribe the CPU.
+//
+// Each worker owns one queue per priority class. Push distributes jobs across the worker
+// queues (optionally directed by an affinity hint), and idle workers steal from the other
+// queues, so an uneven distribution of job lengths still keeps all workers busy.
+//
+// Jobs must not block on other jobs in the pool. Subsystems that need a dedicated thread
+// (real-time deadlines, per-thread GPU contexts, strict ordering) should keep one.
+class ThreadPool
+{
+public:
+  enum class Priority
+  {
+    High = 0,
+    Normal = 1,
+    Low = 2,
+  };
+
+  // Tracks completion of a batch of jobs. The jobs may outlive the scope that pushed
+  // them only if Wait is called before the WorkGroup is destructed.
+  class WorkGroup
+  {
+  public:
+    explicit WorkGroup(ThreadPool& pool);
+    ~WorkGroup();
+
+    // Schedules a job belonging to this group. An affinity hint directs jobs that
+    // benefit from running on the same worker (e.g. to reuse warmed-up caches) to
+    // the same queue; workers may still steal them. Negative means no preference.
+    void Push(std::function<void()> function, Priority priority = Priority::Normal,
+              int affinity_hint = -1);
+
+    // Blocks until every job pushed through this group has finished.
+    // The calling thread runs queued jobs while it waits instead of going idle.
+    void Wait();
+
+  private:
+    friend class ThreadPool;
+
+    void OnJobFinished();
+
+    ThreadPool& m_pool;
+    std::mutex m_mutex;
+    std::condition_variable m_done_condvar;
+    size_t m_unfinished_jobs = 0;
+  };
+
+  static ThreadPool& GetInstance();
+
+  ~ThreadPool();
+
+  // Schedules a job that nothing waits for. See WorkGroup::Push for the parameters.
+  void Push(std::function<void()> function, Priority priority = Priority::Normal,
+            int affinity_hint = -1);
+
+  size_t GetWorkerCount() const { return m_workers.size(); }
+
+private:
+  static constexpr size_t PRIORITY_CLASSES = 3;
+
+  struct Job
+  {
+    std::function<void()> function;
+    WorkGroup* group = nullptr;
+  };
+
+  struct Worker
+  {
+    std::mutex mutex;
+    std::array<std::deque<Job>, PRIORITY_CLASSES> queues;
+    std::thread thread;
+  };
+
+  ThreadPool();
+
+  void PushJob(Job job, Priority priority, int affinity_hint);
+  // Pops and runs one queued job. first_worker biases which queue is tried first.
+  // Returns false if every queue was empty.
+  bool RunOneJob(size_t first_worker);
+  void WorkerThread(size_t index);
+
+  // Pointers because Worker is neither copyable nor movable
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::atomic<size_t> m_next_worker{0};
+  std::atomic<size_t> m_queued_jobs{0};
+  std::mutex m_wake_mutex;
+  std::condition_variable m_wake_condvar;
+  Flag m_shutdown;
+};
+
+}  // namespace Common
@@ -0,0 +1,163 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/Tracing.h"
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+
+namespace Common::Tracing
+{
+namespace detail
+{
+std::atomic<bool> s_enabled{false};
+}
+
+namespace
+{
+struct Zone
+{
+  const char* name;
+  u64 start_us;
+  u64 end_us;
+};
+
+// Bounds memory use to roughly 6 MiB per traced thread; zones past this are
+// counted as dropped rather than recorded.
+constexpr size_t MAX_ZONES_PER_THREAD = 1 << 18;
+
+struct ThreadBuffer
+{
+  std::vector<Zone> zones;
+  // Number of fully written entries in zones. Stored with release ordering so
+  // the exporting thread (which loads with acquire) only ever reads complete
+  // entries.
+  std::atomic<size_t> count{0};
+  size_t dropped = 0;
+  std::string thread_name;
+};
+
+std::mutex s_registry_mutex;
+// Buffers are never freed: a thread's buffer has to stay valid for as long as
+// the thread may record zones into it. This leaks one buffer per traced
+// thread, which is bounded by the handful of long-lived emulator threads.
+std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+
+thread_local ThreadBuffer* tls_buffer = nullptr;
+
+ThreadBuffer* GetThreadBuffer()
+{
+  if (!tls_buffer)
+  {
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->zones.resize(MAX_ZONES_PER_THREAD);
+    const char* thread_name = GetCurrentThreadName();
+    std::lock_guard lk(s_registry_mutex);
+    buffer->thread_name =
+        thread_name ? thread_name : fmt::format("thread {}", s_buffers.size() + 1);
+    tls_buffer = buffer.get();
+    s_buffers.push_back(std::move(buffer));
+  }
+  return tls_buffer;
+}
+}  // namespace
+
+namespace detail
+{
+void RecordZone(const char* name, u64 start_us, u64 end_us)
+{
+  // Re-checked here so a Stop() while a zone was open drops the zone instead
+  // of racing with the export below.
+  if (!s_enabled.load(std::memory_order_relaxed))
+    return;
+
+  ThreadBuffer* buffer = GetThreadBuffer();
+  const size_t index = buffer->count.load(std::memory_order_relaxed);
+  if (index >= buffer->zones.size())
+  {
+    buffer->dropped++;
+    return;
+  }
+  buffer->zones[index] = Zone{name, start_us, end_us};
+  buffer->count.store(index + 1, std::memory_order_release);
+}
+}  // namespace detail
+
+void Start()
+{
+  std::lock_guard lk(s_registry_mutex);
+  for (auto& buffer : s_buffers)
+  {
+    buffer->count.store(0, std::memory_order_relaxed);
+    buffer->dropped = 0;
+  }
+  detail::s_enabled.store(true, std::memory_order_relaxed);
+  INFO_LOG_FMT(COMMON, "Performance tracing started");
+}
+
+std::string Stop()
+{
+  if (!detail::s_enabled.exchange(false, std::memory_order_relaxed))
+    return "";
+
+  const std::string path =
+      File::GetUserPath(D_DUMP_IDX) + fmt::format("trace_{}.json", Timer::GetTimeMs());
+
+  std::ofstream file;
+  File::OpenFStream(file, path, std::ios_base::out);
+  if (!file)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to open {} for writing performance trace", path);
+    return "";
+  }
+
+  std::lock_guard lk(s_registry_mutex);
+
+  file << "{\"traceEvents\":[";
+  bool first = true;
+  for (size_t tid = 0; tid < s_buffers.size(); tid++)
+  {
+    const ThreadBuffer& buffer = *s_buffers[tid];
+    if (!first)
+      file << ',';
+    first = false;
+    file << fmt::format(
+        "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}",
+        tid, buffer.thread_name);
+
+    const size_t count = buffer.count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++)
+    {
+      // Zone names are string literals from TRACE_ZONE call sites, so no JSON
+      // escaping is necessary.
+      const Zone& zone = buffer.zones[i];
+      file << fmt::format(",{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{},\"dur\":{}}}",
+                          zone.name, tid, zone.start_us, zone.end_us - zone.start_us);
+    }
+
+    if (buffer.dropped != 0)
+    {
+      WARN_LOG_FMT(COMMON, "Performance trace dropped {} zones on {}", buffer.dropped,
+                   buffer.thread_name);
+    }
+  }
+  file << "]}";
+
+  INFO_LOG_FMT(COMMON, "Performance trace written to {}", path);
+  return path;
+}
+
+bool IsEnabled()
+{
+  return detail::s_enabled.load(std::memory_order_relaxed);
+}
+}  // namespace Common::Tracing
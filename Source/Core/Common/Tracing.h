@@ -0,0 +1,65 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/Timer.h"
+
+// Lightweight scoped-zone tracer. Zones are recorded into per-thread buffers
+// without any locking on the hot path, and can be exported as a JSON file that
+// chrome://tracing (or any compatible viewer) understands.
+//
+// Unlike Common::Profiler this is safe to use from any thread, but zones are
+// only recorded while tracing is enabled, and zone names must be string
+// literals (they are stored by pointer).
+
+namespace Common::Tracing
+{
+// Begins collecting zones.
+void Start();
+
+// Stops collecting and writes the collected zones to a trace file in the dump
+// directory. Returns the path the trace was written to, or an empty string on
+// failure (or if tracing wasn't enabled).
+std::string Stop();
+
+bool IsEnabled();
+
+namespace detail
+{
+extern std::atomic<bool> s_enabled;
+void RecordZone(const char* name, u64 start_us, u64 end_us);
+}  // namespace detail
+
+class ScopedZone
+{
+public:
+  explicit ScopedZone(const char* name)
+  {
+    if (detail::s_enabled.load(std::memory_order_relaxed))
+    {
+      m_name = name;
+      m_start_us = Timer::GetTimeUs();
+    }
+  }
+
+  ~ScopedZone()
+  {
+    if (m_name)
+      detail::RecordZone(m_name, m_start_us, Timer::GetTimeUs());
+  }
+
+  ScopedZone(const ScopedZone&) = delete;
+  ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+  const char* m_name = nullptr;
+  u64 m_start_us = 0;
+};
+}  // namespace Common::Tracing
+
+#define TRACE_ZONE(name) Common::Tracing::ScopedZone trace_zone_(name)
@@ -60,7 +60,7 @@ public:
 
   bool IsCancelled() const { return m_cancelled.IsSet(); }
 
-private:
+  // Stops the worker thread, blocking until every already-queued item has been processed.
   void Shutdown()
   {
     if (m_thread.joinable())
@@ -71,6 +71,7 @@ private:
     }
   }
 
+private:
   void ThreadLoop()
   {
     Common::SetCurrentThreadName("WorkQueueThread");
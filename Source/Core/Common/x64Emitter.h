@@ -1173,6 +1173,20 @@ public:
     auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
     ABI_CallFunctionPC(trampoline, reinterpret_cast<const void*>(f), p1);
   }
+
+  template <typename T, typename... Args>
+  void ABI_CallLambdaCA(int bits, const std::function<T(Args...)>* f, u32 p1,
+                        const Gen::OpArg& arg2)
+  {
+    auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
+    // Set the last parameter first in case it aliases one of the other
+    // parameter registers.
+    if (!arg2.IsSimpleReg(ABI_PARAM3))
+      MOV(bits, R(ABI_PARAM3), arg2);
+    MOV(32, R(ABI_PARAM2), Imm32(p1));
+    MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(f)));
+    ABI_CallFunction(trampoline);
+  }
 };  // class XEmitter
 
 class X64CodeBlock : public Common::CodeBlock<XEmitter>
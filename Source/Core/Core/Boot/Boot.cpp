@@ -57,6 +57,7 @@ namespace fs = std::filesystem;
 #include "Core/PowerPC/PowerPC.h"
 
 #include "DiscIO/Enums.h"
+#include "DiscIO/RVZConversionCache.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/VolumeWad.h"
 
@@ -170,7 +171,20 @@ BootParameters::GenerateFromFile(std::vector<std::string> paths,
       {".gcm", ".iso", ".tgc", ".wbfs", ".ciso", ".gcz", ".wia", ".rvz", ".dol", ".elf"}};
   if (disc_image_extensions.find(extension) != disc_image_extensions.end() || is_drive)
   {
-    std::unique_ptr<DiscIO::VolumeDisc> disc = DiscIO::CreateDisc(path);
+    // When the RVZ conversion cache is enabled, boot legacy-format images from their cached
+    // conversion when one exists, and otherwise start producing one in the background for the
+    // next boot. The BootParameters keep the original path so per-game settings and the game
+    // list stay keyed to the file the user picked.
+    std::string blob_path = path;
+    if (Config::Get(Config::MAIN_RVZ_CONVERSION_CACHE))
+    {
+      if (std::optional<std::string> cached = DiscIO::FindCachedRVZ(path))
+        blob_path = std::move(*cached);
+      else
+        DiscIO::QueueRVZConversion(path);
+    }
+
+    std::unique_ptr<DiscIO::VolumeDisc> disc = DiscIO::CreateDisc(blob_path);
     if (disc)
     {
       return std::make_unique<BootParameters>(Disc{std::move(path), std::move(disc), paths},
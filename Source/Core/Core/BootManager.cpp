@@ -44,6 +44,7 @@
 #include "Core/Movie.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/ResumeSnapshot.h"
 #include "Core/WiiRoot.h"
 
 #include "DiscIO/Enums.h"
@@ -83,9 +84,11 @@ private:
   bool bDisableICache;
   bool m_EnableJIT;
   bool bSyncGPU;
+  bool bSyncGPUOnEFBCopies;
   int iSyncGpuMaxDistance;
   int iSyncGpuMinDistance;
   float fSyncGpuOverclock;
+  bool bSyncGpuAutoTune;
   bool bFastDiscSpeed;
   bool bDSPHLE;
   bool bHLE_BS2;
@@ -117,9 +120,11 @@ void ConfigCache::SaveConfig(const SConfig& config)
   bMMU = config.bMMU;
   m_EnableJIT = config.m_DSPEnableJIT;
   bSyncGPU = config.bSyncGPU;
+  bSyncGPUOnEFBCopies = config.bSyncGPUOnEFBCopies;
   iSyncGpuMaxDistance = config.iSyncGpuMaxDistance;
   iSyncGpuMinDistance = config.iSyncGpuMinDistance;
   fSyncGpuOverclock = config.fSyncGpuOverclock;
+  bSyncGpuAutoTune = config.bSyncGpuAutoTune;
   bFastDiscSpeed = config.bFastDiscSpeed;
   bDSPHLE = config.bDSPHLE;
   bHLE_BS2 = config.bHLE_BS2;
@@ -164,9 +169,11 @@ void ConfigCache::RestoreConfig(SConfig* config)
   config->bLowDCBZHack = bLowDCBZHack;
   config->m_DSPEnableJIT = m_EnableJIT;
   config->bSyncGPU = bSyncGPU;
+  config->bSyncGPUOnEFBCopies = bSyncGPUOnEFBCopies;
   config->iSyncGpuMaxDistance = iSyncGpuMaxDistance;
   config->iSyncGpuMinDistance = iSyncGpuMinDistance;
   config->fSyncGpuOverclock = fSyncGpuOverclock;
+  config->bSyncGpuAutoTune = bSyncGpuAutoTune;
   config->bFastDiscSpeed = bFastDiscSpeed;
   config->bDSPHLE = bDSPHLE;
   config->bHLE_BS2 = bHLE_BS2;
@@ -266,6 +273,13 @@ bool BootCore(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
     core_section->Get("MMU", &StartUp.bMMU, StartUp.bMMU);
     core_section->Get("LowDCBZHack", &StartUp.bLowDCBZHack, StartUp.bLowDCBZHack);
     core_section->Get("SyncGPU", &StartUp.bSyncGPU, StartUp.bSyncGPU);
+    core_section->Get("SyncGPUOnEFBCopies", &StartUp.bSyncGPUOnEFBCopies,
+                      StartUp.bSyncGPUOnEFBCopies);
+    core_section->Get("SyncGpuMaxDistance", &StartUp.iSyncGpuMaxDistance,
+                      StartUp.iSyncGpuMaxDistance);
+    core_section->Get("SyncGpuMinDistance", &StartUp.iSyncGpuMinDistance,
+                      StartUp.iSyncGpuMinDistance);
+    core_section->Get("SyncGpuAutoTune", &StartUp.bSyncGpuAutoTune, StartUp.bSyncGpuAutoTune);
     core_section->Get("FastDiscSpeed", &StartUp.bFastDiscSpeed, StartUp.bFastDiscSpeed);
     core_section->Get("DSPHLE", &StartUp.bDSPHLE, StartUp.bDSPHLE);
     core_section->Get("CPUCore", &StartUp.cpu_core, StartUp.cpu_core);
@@ -380,6 +394,8 @@ bool BootCore(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
     StartUp.iSyncGpuMaxDistance = netplay_settings.m_SyncGpuMaxDistance;
     StartUp.iSyncGpuMinDistance = netplay_settings.m_SyncGpuMinDistance;
     StartUp.fSyncGpuOverclock = netplay_settings.m_SyncGpuOverclock;
+    // The sync window has to stay at the values agreed on by all netplay peers.
+    StartUp.bSyncGpuAutoTune = false;
     StartUp.bJITFollowBranch = netplay_settings.m_JITFollowBranch;
     StartUp.bFastDiscSpeed = netplay_settings.m_FastDiscSpeed;
     StartUp.bMMU = netplay_settings.m_MMU;
@@ -436,6 +452,21 @@ bool BootCore(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
   if (StartUp.bWii && DiscIO::IsNTSC(StartUp.m_region) && Config::Get(Config::SYSCONF_PAL60))
     Config::SetCurrent(Config::SYSCONF_PAL60, false);
 
+  // Resume snapshots: boot from a snapshot captured with this exact build and game
+  // configuration if one exists, and arm the automatic capture otherwise. Movie playback
+  // manages its own savestates, so it bypasses both.
+  if (!boot->savestate_path && !Movie::IsPlayingInput())
+  {
+    std::string snapshot = ResumeSnapshot::FindSnapshot();
+    ResumeSnapshot::OnBoot(!snapshot.empty());
+    if (!snapshot.empty())
+      boot->savestate_path = std::move(snapshot);
+  }
+  else
+  {
+    ResumeSnapshot::OnBoot(true);
+  }
+
   Core::UpdateWantDeterminism(/*initial*/ true);
 
   if (StartUp.bWii)
@@ -19,6 +19,7 @@ namespace Config
 // Graphics.Hardware
 
 extern const Info<bool> GFX_VSYNC;
+extern const Info<bool> GFX_VSYNC_FRAME_PACING;
 extern const Info<int> GFX_ADAPTER;
 
 // Graphics.Settings
@@ -28,7 +29,9 @@ extern const Info<AspectMode> GFX_ASPECT_RATIO;
 extern const Info<AspectMode> GFX_SUGGESTED_ASPECT_RATIO;
 extern const Info<bool> GFX_CROP;
 extern const Info<int> GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES;
+extern const Info<int> GFX_TEXTURE_CACHE_VRAM_BUDGET_MB;
 extern const Info<bool> GFX_SHOW_FPS;
+extern const Info<bool> GFX_SHOW_INPUT_LATENCY;
 extern const Info<bool> GFX_SHOW_NETPLAY_PING;
 extern const Info<bool> GFX_SHOW_NETPLAY_MESSAGES;
 extern const Info<bool> GFX_LOG_RENDER_TIME_TO_FILE;
@@ -64,6 +67,7 @@ extern const Info<bool> GFX_BORDERLESS_FULLSCREEN;
 extern const Info<bool> GFX_ENABLE_VALIDATION_LAYER;
 extern const Info<bool> GFX_BACKEND_MULTITHREADING;
 extern const Info<int> GFX_COMMAND_BUFFER_EXECUTE_INTERVAL;
+extern const Info<int> GFX_COMMAND_LISTS_IN_FLIGHT;
 extern const Info<bool> GFX_SHADER_CACHE;
 extern const Info<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING;
 extern const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE;
@@ -76,6 +80,7 @@ extern const Info<bool> GFX_SW_ZFREEZE;
 extern const Info<bool> GFX_SW_DUMP_OBJECTS;
 extern const Info<bool> GFX_SW_DUMP_TEV_STAGES;
 extern const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES;
+extern const Info<bool> GFX_SW_FRAME_FINGERPRINT;
 extern const Info<int> GFX_SW_DRAW_START;
 extern const Info<int> GFX_SW_DRAW_END;
 
@@ -30,6 +30,9 @@ extern const Info<bool> MAIN_FASTMEM;
 extern const Info<bool> MAIN_DSP_HLE;
 extern const Info<int> MAIN_TIMING_VARIANCE;
 extern const Info<bool> MAIN_CPU_THREAD;
+extern const Info<bool> MAIN_EMU_THREADS_ON_PERFORMANCE_CORES;
+extern const Info<bool> MAIN_RESUME_SNAPSHOTS;
+extern const Info<int> MAIN_RESUME_SNAPSHOT_DELAY_SECS;
 extern const Info<bool> MAIN_SYNC_ON_SKIP_IDLE;
 extern const Info<std::string> MAIN_DEFAULT_ISO;
 extern const Info<bool> MAIN_ENABLE_CHEATS;
@@ -65,6 +68,7 @@ extern const Info<bool> MAIN_SYNC_GPU;
 extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
+extern const Info<bool> MAIN_SYNC_GPU_AUTO_TUNE;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FPRF;
@@ -80,9 +84,11 @@ extern const Info<u32> MAIN_MEM2_SIZE;
 extern const Info<std::string> MAIN_GFX_BACKEND;
 extern const Info<std::string> MAIN_GPU_DETERMINISM_MODE;
 extern const Info<std::string> MAIN_PERF_MAP_DIR;
+extern const Info<bool> MAIN_PERF_FLIGHT_RECORDER;
 extern const Info<bool> MAIN_CUSTOM_RTC_ENABLE;
 extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
+extern const Info<bool> MAIN_RVZ_CONVERSION_CACHE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
@@ -117,6 +123,7 @@ extern const Info<std::string> MAIN_LOAD_PATH;
 extern const Info<std::string> MAIN_RESOURCEPACK_PATH;
 extern const Info<std::string> MAIN_FS_PATH;
 extern const Info<std::string> MAIN_SD_PATH;
+extern const Info<bool> MAIN_SHARED_MEMORY_EXPORT;
 
 // Main.Network
 
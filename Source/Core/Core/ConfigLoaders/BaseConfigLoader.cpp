@@ -171,7 +171,9 @@ public:
 
     for (const auto& system : system_to_ini)
     {
-      inis[system.first].Save(File::GetUserPath(system.second));
+      // Saves can come from hotkey-driven settings changes during emulation; hand the
+      // writes to the background thread so the calling thread doesn't stall on disk I/O.
+      inis[system.first].QueueSave(File::GetUserPath(system.second));
     }
   }
 
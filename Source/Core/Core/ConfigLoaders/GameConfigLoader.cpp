@@ -26,6 +26,7 @@
 
 #include "Core/Config/SYSCONFSettings.h"
 #include "Core/ConfigLoaders/IsSettingSaveable.h"
+#include "Core/ConfigManager.h"
 
 namespace ConfigLoaders
 {
@@ -160,17 +161,12 @@ public:
 
   void Load(Config::Layer* layer) override
   {
+    // Go through SConfig's loaders so all consumers share the same parsed-INI cache.
     IniFile ini;
     if (layer->GetLayer() == Config::LayerType::GlobalGame)
-    {
-      for (const std::string& filename : GetGameIniFilenames(m_id, m_revision))
-        ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
-    }
+      ini = SConfig::LoadDefaultGameIni(m_id, m_revision);
     else
-    {
-      for (const std::string& filename : GetGameIniFilenames(m_id, m_revision))
-        ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + filename, true);
-    }
+      ini = SConfig::LoadLocalGameIni(m_id, m_revision);
 
     const std::list<IniFile::Section>& system_sections = ini.GetSections();
 
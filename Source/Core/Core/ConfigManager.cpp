@@ -6,7 +6,9 @@
 #include <algorithm>
 #include <cinttypes>
 #include <climits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -23,6 +25,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/IniFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -210,9 +213,11 @@ void SConfig::SaveCoreSettings(IniFile& ini)
   core->Set("DSPHLE", bDSPHLE);
   core->Set("SyncOnSkipIdle", bSyncGPUOnSkipIdleHack);
   core->Set("SyncGPU", bSyncGPU);
+  core->Set("SyncGPUOnEFBCopies", bSyncGPUOnEFBCopies);
   core->Set("SyncGpuMaxDistance", iSyncGpuMaxDistance);
   core->Set("SyncGpuMinDistance", iSyncGpuMinDistance);
   core->Set("SyncGpuOverclock", fSyncGpuOverclock);
+  core->Set("SyncGpuAutoTune", bSyncGpuAutoTune);
   core->Set("FPRF", bFPRF);
   core->Set("AccurateNaNs", bAccurateNaNs);
   core->Set("EnableCheats", bEnableCheats);
@@ -294,6 +299,8 @@ void SConfig::SaveFifoPlayerSettings(IniFile& ini)
   IniFile::Section* fifoplayer = ini.GetOrCreateSection("FifoPlayer");
 
   fifoplayer->Set("LoopReplay", bLoopFifoReplay);
+  fifoplayer->Set("LoopReplayCount", uLoopFifoReplayCount);
+  fifoplayer->Set("TimingStatsFile", sFifoReplayTimingFile);
 }
 
 void SConfig::SaveBluetoothPassthroughSettings(IniFile& ini)
@@ -506,9 +513,11 @@ void SConfig::LoadCoreSettings(IniFile& ini)
   core->Get("MMU", &bMMU, bMMU);
   core->Get("BBDumpPort", &iBBDumpPort, -1);
   core->Get("SyncGPU", &bSyncGPU, false);
+  core->Get("SyncGPUOnEFBCopies", &bSyncGPUOnEFBCopies, false);
   core->Get("SyncGpuMaxDistance", &iSyncGpuMaxDistance, 200000);
   core->Get("SyncGpuMinDistance", &iSyncGpuMinDistance, -200000);
   core->Get("SyncGpuOverclock", &fSyncGpuOverclock, 1.0f);
+  core->Get("SyncGpuAutoTune", &bSyncGpuAutoTune, false);
   core->Get("FastDiscSpeed", &bFastDiscSpeed, false);
   core->Get("LowDCBZHack", &bLowDCBZHack, false);
   core->Get("FPRF", &bFPRF, false);
@@ -567,6 +576,8 @@ void SConfig::LoadFifoPlayerSettings(IniFile& ini)
   IniFile::Section* fifoplayer = ini.GetOrCreateSection("FifoPlayer");
 
   fifoplayer->Get("LoopReplay", &bLoopFifoReplay, true);
+  fifoplayer->Get("LoopReplayCount", &uLoopFifoReplayCount, 0);
+  fifoplayer->Get("TimingStatsFile", &sFifoReplayTimingFile, "");
 }
 
 void SConfig::LoadBluetoothPassthroughSettings(IniFile& ini)
@@ -756,6 +767,8 @@ void SConfig::LoadDefaults()
   bLowDCBZHack = false;
   iBBDumpPort = -1;
   bSyncGPU = false;
+  bSyncGPUOnEFBCopies = false;
+  bSyncGpuAutoTune = false;
   bFastDiscSpeed = false;
   bEnableMemcardSdWriting = true;
   SelectedLanguage = 0;
@@ -767,6 +780,8 @@ void SConfig::LoadDefaults()
   m_audio_stretch_max_latency = 80;
 
   bLoopFifoReplay = true;
+  uLoopFifoReplayCount = 0;
+  sFifoReplayTimingFile.clear();
 
   bJITOff = false;  // debugger only settings
   bJITLoadStoreOff = false;
@@ -1029,11 +1044,48 @@ IniFile SConfig::LoadGameIni() const
   return LoadGameIni(GetGameID(), m_revision);
 }
 
+// Game INIs are re-read in full by every consumer (the config system, PatchEngine, Gecko codes,
+// ActionReplay) at boot and on every config refresh, and titles with large code lists take long
+// enough to parse that refreshes stall. Cache the parsed files keyed by content hash so only
+// files that actually changed go through the text parser again.
+struct CachedParsedIni
+{
+  u32 hash = 0;
+  IniFile ini;
+};
+static std::mutex s_game_ini_cache_mutex;
+static std::map<std::string, CachedParsedIni> s_game_ini_cache;
+
+static void LoadGameIniThroughCache(IniFile* game_ini, const std::string& path)
+{
+  std::string text;
+  if (!File::ReadFileToString(path, text))
+    return;
+  const u32 hash = Common::HashAdler32(reinterpret_cast<const u8*>(text.data()), text.size());
+
+  std::lock_guard lock(s_game_ini_cache_mutex);
+  const auto it = s_game_ini_cache.find(path);
+  if (it != s_game_ini_cache.end() && it->second.hash == hash)
+  {
+    game_ini->Merge(it->second.ini);
+    return;
+  }
+
+  CachedParsedIni& entry = s_game_ini_cache[path];
+  entry.ini = IniFile();
+  entry.ini.Load(path);
+  entry.hash = hash;
+  game_ini->Merge(entry.ini);
+}
+
 IniFile SConfig::LoadDefaultGameIni(const std::string& id, std::optional<u16> revision)
 {
   IniFile game_ini;
   for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
+  {
+    LoadGameIniThroughCache(&game_ini,
+                            File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename);
+  }
   return game_ini;
 }
 
@@ -1041,7 +1093,7 @@ IniFile SConfig::LoadLocalGameIni(const std::string& id, std::optional<u16> revi
 {
   IniFile game_ini;
   for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + filename, true);
+    LoadGameIniThroughCache(&game_ini, File::GetUserPath(D_GAMESETTINGS_IDX) + filename);
   return game_ini;
 }
 
@@ -1049,9 +1101,12 @@ IniFile SConfig::LoadGameIni(const std::string& id, std::optional<u16> revision)
 {
   IniFile game_ini;
   for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename, true);
+  {
+    LoadGameIniThroughCache(&game_ini,
+                            File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP + filename);
+  }
   for (const std::string& filename : ConfigLoaders::GetGameIniFilenames(id, revision))
-    game_ini.Load(File::GetUserPath(D_GAMESETTINGS_IDX) + filename, true);
+    LoadGameIniThroughCache(&game_ini, File::GetUserPath(D_GAMESETTINGS_IDX) + filename);
   return game_ini;
 }
 
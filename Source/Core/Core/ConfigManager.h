@@ -93,6 +93,7 @@ struct SConfig
   bool bJITFollowBranch;
   bool bJITNoBlockCache = false;
   bool bJITNoBlockLinking = false;
+  bool bJITTieredMode = false;
   bool bJITOff = false;
   bool bJITLoadStoreOff = false;
   bool bJITLoadStorelXzOff = false;
@@ -136,9 +137,11 @@ struct SConfig
   bool bFastDiscSpeed = false;
 
   bool bSyncGPU = false;
+  bool bSyncGPUOnEFBCopies = false;
   int iSyncGpuMaxDistance;
   int iSyncGpuMinDistance;
   float fSyncGpuOverclock;
+  bool bSyncGpuAutoTune = false;
 
   int SelectedLanguage = 0;
   bool bOverrideRegionSettings = false;
@@ -164,6 +167,12 @@ struct SConfig
 
   // Fifo Player related settings
   bool bLoopFifoReplay = true;
+  // Stop playback after this many loops of the frame range (0 = play forever). Used for
+  // benchmark runs together with sFifoReplayTimingFile.
+  u32 uLoopFifoReplayCount = 0;
+  // If non-empty, per-frame playback timing statistics are written here as JSON when
+  // playback ends.
+  std::string sFifoReplayTimingFile;
 
   // Custom RTC
   bool bEnableCustomRTC;
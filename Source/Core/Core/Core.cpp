@@ -38,6 +38,7 @@
 
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
@@ -61,8 +62,10 @@
 #include "Core/NetPlayClient.h"
 #include "Core/NetPlayProto.h"
 #include "Core/PatchEngine.h"
+#include "Core/PerformanceFlightRecorder.h"
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/ResumeSnapshot.h"
 #include "Core/State.h"
 #include "Core/WiiRoot.h"
 
@@ -150,14 +153,6 @@ void FrameUpdateOnCPUThread()
     NetPlay::NetPlayClient::SendTimeBase();
 }
 
-void OnFrameEnd()
-{
-#ifdef USE_MEMORYWATCHER
-  if (s_memory_watcher)
-    s_memory_watcher->Step();
-#endif
-}
-
 // Display messages and return values
 
 // Formatted stop message
@@ -338,6 +333,10 @@ static void CpuThread(const std::optional<std::string>& savestate_path, bool del
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
 
+  // On hybrid CPUs, keep the latency-critical emulation threads off the efficiency cores.
+  if (Config::Get(Config::MAIN_EMU_THREADS_ON_PERFORMANCE_CORES))
+    Common::PinCurrentThreadToPerformanceCores();
+
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
 
@@ -405,6 +404,9 @@ static void FifoPlayerThread(const std::optional<std::string>& savestate_path,
   else
     Common::SetCurrentThreadName("FIFO-GPU thread");
 
+  if (Config::Get(Config::MAIN_EMU_THREADS_ON_PERFORMANCE_CORES))
+    Common::PinCurrentThreadToPerformanceCores();
+
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = FifoPlayer::GetInstance().GetCPUCore())
   {
@@ -434,12 +436,16 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
 {
   const SConfig& core_parameter = SConfig::GetInstance();
   CallOnStateChangedCallbacks(State::Starting);
+  FlightRecorder::Reset();
   Common::ScopeGuard flag_guard{[] {
     s_is_booting.Clear();
     s_is_started = false;
     s_is_stopping = false;
     s_wants_determinism = false;
 
+    if (FlightRecorder::IsEnabled())
+      FlightRecorder::Dump("emulation stopped");
+
     CallOnStateChangedCallbacks(State::Uninitialized);
 
     INFO_LOG_FMT(CONSOLE, "Stop\t\t---- Shutdown complete ----");
@@ -526,7 +532,17 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
   AudioCommon::InitSoundStream();
   Common::ScopeGuard audio_guard{&AudioCommon::ShutdownSoundStream};
 
+  // Cold boot regularly takes several seconds before the first frame, so log
+  // how long each initialization stage takes to make regressions diagnosable.
+  Common::Timer stage_timer;
+  stage_timer.Start();
+  const auto log_stage_time = [&stage_timer](const char* stage) {
+    INFO_LOG_FMT(BOOT, "{} took {} ms", stage, stage_timer.GetTimeDifference());
+    stage_timer.Update();
+  };
+
   HW::Init();
+  log_stage_time("Hardware initialization");
 
   Common::ScopeGuard hw_guard{[] {
     // We must set up this flag before executing HW::Shutdown()
@@ -555,6 +571,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
     return;
   }
   Common::ScopeGuard video_guard{[] { g_video_backend->Shutdown(); }};
+  log_stage_time("Video backend initialization");
 
   // Render a single frame without anything on it to clear the screen.
   // This avoids the game list being displayed while the core is finishing initializing.
@@ -571,6 +588,7 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
     PanicAlertFmt("Failed to initialize DSP emulation!");
     return;
   }
+  log_stage_time("DSP initialization");
 
   // Inputs loading may have generated custom dynamic textures
   // it's now ok to initialize any custom textures
@@ -578,6 +596,15 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
 
   AudioCommon::PostInitSoundStream();
 
+  // HW::Init only started the IOS kernel bring-up; it runs on a worker thread
+  // so the video backend and DSP could initialize in parallel with it. It has
+  // to be complete before anything can talk to IOS.
+  if (core_parameter.bWii)
+  {
+    IOS::HLE::WaitForInit();
+    log_stage_time("IOS bring-up (overlapped)");
+  }
+
   // The hardware is initialized.
   s_hardware_initialized = true;
   s_is_booting.Clear();
@@ -630,6 +657,9 @@ static void EmuThread(std::unique_ptr<BootParameters> boot, WindowSystemInfo wsi
     UndeclareAsCPUThread();
     FPURoundMode::LoadDefaultSIMDState();
 
+    if (Config::Get(Config::MAIN_EMU_THREADS_ON_PERFORMANCE_CORES))
+      Common::PinCurrentThreadToPerformanceCores();
+
     // Spawn the CPU thread. The CPU thread will signal the event that boot is complete.
     s_cpu_thread = std::thread(cpuThreadFunc, savestate_path, delete_savestate);
 
@@ -892,6 +922,8 @@ void Callback_FramePresented(double actual_emulation_speed)
 // Called from VideoInterface::Update (CPU thread) at emulated field boundaries
 void Callback_NewField()
 {
+  ResumeSnapshot::OnFieldEnd();
+
   if (s_frame_step)
   {
     // To ensure that s_stop_frame_step is up to date, wait for the GPU thread queue to empty,
@@ -120,7 +120,6 @@ void SaveScreenShot(std::string_view name);
 void DisplayMessage(std::string message, int time_in_ms);
 
 void FrameUpdateOnCPUThread();
-void OnFrameEnd();
 
 void VideoThrottle();
 void RequestRefreshInfo();
@@ -136,6 +136,10 @@ void Init()
 
   s_event_fifo_id = 0;
   s_ev_lost = RegisterEvent("_lost_event", &EmptyTimedCallback);
+
+  // Reserve enough space that steady-state scheduling never reallocates the
+  // heap's backing storage on the CPU thread.
+  s_event_queue.reserve(128);
 }
 
 void Shutdown()
@@ -102,12 +102,39 @@ public:
   explicit LLEAccelerator(SDSP& dsp) : m_dsp{dsp} {}
 
 protected:
-  u8 ReadMemory(u32 address) override { return Host::ReadHostMemory(address); }
-  void WriteMemory(u32 address, u8 value) override { Host::WriteHostMemory(value, address); }
+  u8 ReadMemory(u32 address) override
+  {
+    if (const u8* aram = GetDirectARAM())
+      return aram[address & m_aram_mask];
+    return Host::ReadHostMemory(address);
+  }
+  void WriteMemory(u32 address, u8 value) override
+  {
+    if (u8* aram = GetDirectARAM())
+      aram[address & m_aram_mask] = value;
+    else
+      Host::WriteHostMemory(value, address);
+  }
   void OnEndException() override { m_dsp.SetException(ExceptionType::AcceleratorOverflow); }
 
 private:
+  // Direct pointer to ARAM, bypassing the per-byte host callbacks on the sample decode path.
+  // It can't be fetched in the constructor: the host only sets up ARAM after creating the DSP
+  // emulator (see DSP::Reinit), so it is cached on first use instead.
+  u8* GetDirectARAM()
+  {
+    if (!m_aram_checked)
+    {
+      m_aram = Host::GetHostMemoryPtr(&m_aram_mask);
+      m_aram_checked = true;
+    }
+    return m_aram;
+  }
+
   SDSP& m_dsp;
+  u8* m_aram = nullptr;
+  u32 m_aram_mask = 0;
+  bool m_aram_checked = false;
 };
 
 SDSP::SDSP(DSPCore& core) : m_dsp_core{core}
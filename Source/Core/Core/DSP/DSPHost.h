@@ -21,6 +21,10 @@ namespace DSP::Host
 {
 u8 ReadHostMemory(u32 addr);
 void WriteHostMemory(u8 value, u32 addr);
+// Returns a host pointer to the memory behind Read/WriteHostMemory together with its address
+// mask, or nullptr when accesses cannot be satisfied from a single linear buffer. The pointer
+// stays valid for the lifetime of the DSP emulator.
+u8* GetHostMemoryPtr(u32* mask);
 void DMAToDSP(u16* dst, u32 addr, u32 size);
 void DMAFromDSP(const u16* src, u32 addr, u32 size);
 void OSD_AddMessage(std::string str, u32 ms);
@@ -236,12 +236,17 @@ constexpr std::array<InterpreterOpInfo, 25> s_opcodes_ext
 
 namespace
 {
-std::array<InterpreterFunction, 65536> s_op_table;
+std::array<InterpreterDecodeInfo, 65536> s_op_table;
 std::array<InterpreterFunction, 256> s_ext_op_table;
 bool s_tables_initialized = false;
 }  // Anonymous namespace
 
 InterpreterFunction GetOp(UDSPInstruction inst)
+{
+  return s_op_table[inst].function;
+}
+
+const InterpreterDecodeInfo& GetDecodeInfo(UDSPInstruction inst)
 {
   return s_op_table[inst];
 }
@@ -261,6 +266,10 @@ void InitInstructionTables()
   if (s_tables_initialized)
     return;
 
+  // The fused entries below consult the opcode templates, so make sure the
+  // shared template table has been built first.
+  InitInstructionTable();
+
   // ext op table
   for (size_t i = 0; i < s_ext_op_table.size(); i++)
   {
@@ -276,13 +285,17 @@ void InitInstructionTables()
   // op table
   for (size_t i = 0; i < s_op_table.size(); i++)
   {
-    s_op_table[i] = &Interpreter::nop;
+    const auto inst = static_cast<UDSPInstruction>(i);
+
+    s_op_table[i].function = &Interpreter::nop;
+    s_op_table[i].ext_function =
+        GetOpTemplate(inst)->extended ? GetExtOp(inst) : nullptr;
 
-    const auto iter = FindByOpcode(static_cast<UDSPInstruction>(i), s_opcodes);
+    const auto iter = FindByOpcode(inst, s_opcodes);
     if (iter == s_opcodes.cend())
       continue;
 
-    s_op_table[i] = iter->function;
+    s_op_table[i].function = iter->function;
   }
 
   s_tables_initialized = true;
@@ -11,7 +11,17 @@ class Interpreter;
 
 using InterpreterFunction = void (Interpreter::*)(UDSPInstruction);
 
+// Fused decode entry: the main handler together with the extension handler
+// (nullptr when the instruction has no extension), so stepping resolves an
+// instruction with a single table read.
+struct InterpreterDecodeInfo
+{
+  InterpreterFunction function;
+  InterpreterFunction ext_function;
+};
+
 InterpreterFunction GetOp(UDSPInstruction inst);
 InterpreterFunction GetExtOp(UDSPInstruction inst);
+const InterpreterDecodeInfo& GetDecodeInfo(UDSPInstruction inst);
 void InitInstructionTables();
 }  // namespace DSP::Interpreter
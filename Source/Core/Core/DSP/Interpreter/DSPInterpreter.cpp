@@ -28,16 +28,18 @@ Interpreter::~Interpreter() = default;
 
 void Interpreter::ExecuteInstruction(const UDSPInstruction inst)
 {
-  const DSPOPCTemplate* opcode_template = GetOpTemplate(inst);
+  // A single fused table lookup resolves both the main handler and the
+  // extension handler, instead of walking the opcode template tables per step.
+  const InterpreterDecodeInfo& decode_info = GetDecodeInfo(inst);
 
-  if (opcode_template->extended)
+  if (decode_info.ext_function != nullptr)
   {
-    (this->*GetExtOp(inst))(inst);
+    (this->*decode_info.ext_function)(inst);
   }
 
-  (this->*GetOp(inst))(inst);
+  (this->*decode_info.function)(inst);
 
-  if (opcode_template->extended)
+  if (decode_info.ext_function != nullptr)
   {
     ApplyWriteBackLog();
   }
@@ -222,6 +222,11 @@ std::string PPCDebugInterface::Disassemble(u32 address) const
     }
 
     const u32 op = PowerPC::HostRead_Instruction(address);
+
+    const auto cached = m_disasm_cache.find(address);
+    if (cached != m_disasm_cache.end() && cached->second.first == op)
+      return cached->second.second;
+
     std::string disasm = Common::GekkoDisassembler::Disassemble(op, address);
     const UGeckoInstruction inst{op};
 
@@ -230,6 +235,12 @@ std::string PPCDebugInterface::Disassemble(u32 address) const
       disasm += " (hle)";
     }
 
+    // Keep the cache from growing without bound during long scrolling sessions.
+    constexpr size_t MAX_DISASM_CACHE_ENTRIES = 65536;
+    if (m_disasm_cache.size() >= MAX_DISASM_CACHE_ENTRIES)
+      m_disasm_cache.clear();
+    m_disasm_cache.emplace(address, std::make_pair(op, disasm));
+
     return disasm;
   }
   else
@@ -427,4 +438,5 @@ void PPCDebugInterface::Clear()
   ClearPatches();
   ClearWatches();
   m_network_logger.reset();
+  m_disasm_cache.clear();
 }
@@ -6,6 +6,8 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "Common/Debug/MemoryPatches.h"
 #include "Common/Debug/Watches.h"
@@ -91,4 +93,9 @@ private:
   Common::Debug::Watches m_watches;
   PPCPatches m_patches;
   std::shared_ptr<Core::NetworkCaptureLogger> m_network_logger;
+
+  // Cache for Disassemble(), which the debugger views call for every visible line on each
+  // repaint. Entries are validated against the current opcode at the address, so patched or
+  // recompiled code self-invalidates without hooking icache invalidation.
+  mutable std::unordered_map<u32, std::pair<u32, std::string>> m_disasm_cache;
 };
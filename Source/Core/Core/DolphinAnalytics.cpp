@@ -132,6 +132,7 @@ void DolphinAnalytics::ReportGameStart()
   InitializePerformanceSampling();
 }
 
+#if defined(USE_ANALYTICS) && USE_ANALYTICS
 // Keep in sync with enum class GameQuirk definition.
 constexpr std::array<const char*, 19> GAME_QUIRKS_NAMES{
     "icache-matters",
@@ -172,17 +173,9 @@ void DolphinAnalytics::ReportGameQuirk(GameQuirk quirk)
   Send(builder);
 }
 
-void DolphinAnalytics::ReportPerformanceInfo(PerformanceSample&& sample)
+void DolphinAnalytics::CollectPerformanceSample(PerformanceSample&& sample)
 {
-  if (ShouldStartPerformanceSampling())
-  {
-    m_sampling_performance_info = true;
-  }
-
-  if (m_sampling_performance_info)
-  {
-    m_performance_samples.emplace_back(std::move(sample));
-  }
+  m_performance_samples.emplace_back(std::move(sample));
 
   if (m_performance_samples.size() >= NUM_PERFORMANCE_SAMPLES_PER_REPORT)
   {
@@ -211,6 +204,7 @@ void DolphinAnalytics::ReportPerformanceInfo(PerformanceSample&& sample)
     m_sampling_performance_info = false;
   }
 }
+#endif  // USE_ANALYTICS
 
 void DolphinAnalytics::InitializePerformanceSampling()
 {
@@ -99,21 +99,42 @@ public:
   // per-game base data.
   void ReportGameStart();
 
-  // Generates a report for a special condition being hit by a game. This is automatically throttled
-  // to once per game run.
-  void ReportGameQuirk(GameQuirk quirk);
-
   struct PerformanceSample
   {
     double speed_ratio;  // See SystemTimers::GetEstimatedEmulationPerformance().
     int num_prims;
     int num_draw_calls;
   };
-  // Reports performance information. This method performs its own throttling / aggregation --
-  // calling it does not guarantee when a report will actually be sent.
+
+  // The following report methods are called from frame-path code (opcode decoding, frame
+  // presentation), so when analytics support is compiled out they collapse to empty inlines
+  // and the compiler discards the argument construction at the call sites too.
+#if defined(USE_ANALYTICS) && USE_ANALYTICS
+  // Generates a report for a special condition being hit by a game. This is automatically throttled
+  // to once per game run.
+  void ReportGameQuirk(GameQuirk quirk);
+
+  // Reports performance information. The builder functor is only invoked while a sampling
+  // window is open, so the cost of gathering the sample inputs is skipped for the vast
+  // majority of frames. This method performs its own throttling / aggregation -- calling it
+  // does not guarantee when a report will actually be sent.
   //
   // This method is NOT thread-safe.
-  void ReportPerformanceInfo(PerformanceSample&& sample);
+  template <typename SampleBuilder>
+  void ReportPerformanceInfo(SampleBuilder&& build_sample)
+  {
+    if (ShouldStartPerformanceSampling())
+      m_sampling_performance_info = true;
+    if (m_sampling_performance_info)
+      CollectPerformanceSample(build_sample());
+  }
+#else
+  void ReportGameQuirk(GameQuirk) {}
+  template <typename SampleBuilder>
+  void ReportPerformanceInfo(SampleBuilder&&)
+  {
+  }
+#endif
 
   // Forward Send method calls to the reporter.
   template <typename T>
@@ -150,6 +171,7 @@ private:
   // Performance sampling state & internal helpers.
   void InitializePerformanceSampling();  // Called on game start / title switch.
   bool ShouldStartPerformanceSampling();
+  void CollectPerformanceSample(PerformanceSample&& sample);
   u64 m_sampling_next_start_us;              // Next timestamp (in us) at which to trigger sampling.
   bool m_sampling_performance_info = false;  // Whether we are currently collecting samples.
   std::vector<PerformanceSample> m_performance_samples;
@@ -7,8 +7,11 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <zstd.h>
+
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
@@ -101,9 +104,115 @@ bool FifoDataFile::GetIsWii() const
   return GetFlag(FLAG_IS_WII);
 }
 
+// Frames are compressed on the video thread as they are recorded, so use a fast level.
+constexpr int FRAME_COMPRESSION_LEVEL = 1;
+
+static std::vector<u8> CompressData(const u8* src, size_t size)
+{
+  std::vector<u8> result(ZSTD_compressBound(size));
+  // Can't fail, as the destination buffer is large enough for any input.
+  const size_t compressed_size =
+      ZSTD_compress(result.data(), result.size(), src, size, FRAME_COMPRESSION_LEVEL);
+  result.resize(compressed_size);
+  result.shrink_to_fit();
+  return result;
+}
+
+static void UncompressData(const std::vector<u8>& src, u8* dst, size_t dst_size)
+{
+  if (ZSTD_decompress(dst, dst_size, src.data(), src.size()) != dst_size)
+    PanicAlertFmt("FifoDataFile: Failed to inflate recorded frame data");
+}
+
+FifoDataFile::CompressedFrame FifoDataFile::CompressFrame(const FifoFrameInfo& frame)
+{
+  CompressedFrame result;
+  result.holdsData = true;
+  result.fifoStart = frame.fifoStart;
+  result.fifoEnd = frame.fifoEnd;
+  result.rawFifoDataSize = static_cast<u32>(frame.fifoData.size());
+  result.fifoData = CompressData(frame.fifoData.data(), frame.fifoData.size());
+
+  result.memoryUpdates.reserve(frame.memoryUpdates.size());
+  for (const MemoryUpdate& update : frame.memoryUpdates)
+  {
+    CompressedMemoryUpdate compressed_update;
+    compressed_update.fifoPosition = update.fifoPosition;
+    compressed_update.address = update.address;
+    compressed_update.type = update.type;
+    compressed_update.rawDataSize = static_cast<u32>(update.data.size());
+    compressed_update.data = CompressData(update.data.data(), update.data.size());
+    result.memoryUpdates.push_back(std::move(compressed_update));
+  }
+
+  return result;
+}
+
+FifoFrameInfo FifoDataFile::InflateFrame(const CompressedFrame& frame)
+{
+  FifoFrameInfo result;
+  result.fifoStart = frame.fifoStart;
+  result.fifoEnd = frame.fifoEnd;
+  result.fifoData.resize(frame.rawFifoDataSize);
+  UncompressData(frame.fifoData, result.fifoData.data(), result.fifoData.size());
+
+  result.memoryUpdates.reserve(frame.memoryUpdates.size());
+  for (const CompressedMemoryUpdate& update : frame.memoryUpdates)
+  {
+    MemoryUpdate inflated_update;
+    inflated_update.fifoPosition = update.fifoPosition;
+    inflated_update.address = update.address;
+    inflated_update.type = update.type;
+    inflated_update.data.resize(update.rawDataSize);
+    UncompressData(update.data, inflated_update.data.data(), inflated_update.data.size());
+    result.memoryUpdates.push_back(std::move(inflated_update));
+  }
+
+  return result;
+}
+
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  // Keep the frame compressed in memory; an hour-long recording wouldn't fit in
+  // RAM uncompressed. GetFrame() inflates frames as they are needed.
+  m_CompressedFrames.push_back(CompressFrame(frameInfo));
+  m_Frames.emplace_back();
+}
+
+const FifoFrameInfo& FifoDataFile::GetFrame(u32 frame)
+{
+  CompressedFrame& compressed_frame = m_CompressedFrames[frame];
+  if (compressed_frame.holdsData)
+  {
+    m_Frames[frame] = InflateFrame(compressed_frame);
+    compressed_frame = CompressedFrame();
+  }
+  return m_Frames[frame];
+}
+
+u64 FifoDataFile::GetFrameFifoBytes(u32 frame) const
+{
+  const CompressedFrame& compressed_frame = m_CompressedFrames[frame];
+  if (compressed_frame.holdsData)
+    return compressed_frame.rawFifoDataSize;
+  return m_Frames[frame].fifoData.size();
+}
+
+u64 FifoDataFile::GetFrameMemoryBytes(u32 frame) const
+{
+  u64 result = 0;
+  const CompressedFrame& compressed_frame = m_CompressedFrames[frame];
+  if (compressed_frame.holdsData)
+  {
+    for (const CompressedMemoryUpdate& update : compressed_frame.memoryUpdates)
+      result += update.rawDataSize;
+  }
+  else
+  {
+    for (const MemoryUpdate& update : m_Frames[frame].memoryUpdates)
+      result += update.data.size();
+  }
+  return result;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
@@ -173,7 +282,13 @@ bool FifoDataFile::Save(const std::string& filename)
   // Write frames list
   for (unsigned int i = 0; i < m_Frames.size(); ++i)
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
+    // Inflate one frame at a time rather than going through GetFrame(), so that
+    // saving a long recording doesn't inflate the whole file into RAM at once.
+    const CompressedFrame& compressedFrame = m_CompressedFrames[i];
+    FifoFrameInfo inflatedFrame;
+    if (compressedFrame.holdsData)
+      inflatedFrame = InflateFrame(compressedFrame);
+    const FifoFrameInfo& srcFrame = compressedFrame.holdsData ? inflatedFrame : m_Frames[i];
 
     // Write FIFO data
     file.Seek(0, SEEK_END);
@@ -315,7 +430,10 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
                       dstFrame.memoryUpdates, file);
 
-    dataFile->AddFrame(dstFrame);
+    // Loaded frames are about to be analyzed and played back, so there is no
+    // point in running them through AddFrame()'s compression.
+    dataFile->m_Frames.push_back(std::move(dstFrame));
+    dataFile->m_CompressedFrames.emplace_back();
   }
 
   file.Close();
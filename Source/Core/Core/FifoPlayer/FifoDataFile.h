@@ -72,8 +72,12 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
+  // Inflates the frame on first access and keeps it inflated.
+  const FifoFrameInfo& GetFrame(u32 frame);
   u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // Uncompressed payload sizes of a frame, available without inflating it.
+  u64 GetFrameFifoBytes(u32 frame) const;
+  u64 GetFrameMemoryBytes(u32 frame) const;
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
@@ -84,6 +88,30 @@ private:
     FLAG_IS_WII = 1
   };
 
+  struct CompressedMemoryUpdate
+  {
+    u32 fifoPosition;
+    u32 address;
+    u32 rawDataSize;
+    std::vector<u8> data;
+    MemoryUpdate::Type type;
+  };
+
+  // A frame as added during recording: the bulk payloads are kept zstd-compressed
+  // until the frame is first accessed, so that long recordings fit in RAM.
+  struct CompressedFrame
+  {
+    std::vector<u8> fifoData;
+    u32 rawFifoDataSize = 0;
+    u32 fifoStart = 0;
+    u32 fifoEnd = 0;
+    std::vector<CompressedMemoryUpdate> memoryUpdates;
+    bool holdsData = false;
+  };
+
+  static CompressedFrame CompressFrame(const FifoFrameInfo& frame);
+  static FifoFrameInfo InflateFrame(const CompressedFrame& frame);
+
   void PadFile(size_t numBytes, File::IOFile& file);
 
   void SetFlag(u32 flag, bool set);
@@ -104,5 +132,8 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
+  // m_Frames[i] stays empty (apart from being allocated) until the compressed
+  // counterpart in m_CompressedFrames[i] has been inflated into it.
   std::vector<FifoFrameInfo> m_Frames;
+  std::vector<CompressedFrame> m_CompressedFrames;
 };
@@ -4,11 +4,18 @@
 #include "Core/FifoPlayer/FifoPlayer.h"
 
 #include <algorithm>
+#include <fstream>
 #include <mutex>
+#include <numeric>
+
+#include <fmt/format.h>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -32,7 +39,9 @@
 
 bool IsPlayingBackFifologWithBrokenEFBCopies = false;
 
-FifoPlayer::FifoPlayer() : m_Loop{SConfig::GetInstance().bLoopFifoReplay}
+FifoPlayer::FifoPlayer()
+    : m_Loop{SConfig::GetInstance().bLoopFifoReplay}, m_LoopCount{
+                                                          SConfig::GetInstance().uLoopFifoReplayCount}
 {
 }
 
@@ -85,10 +94,17 @@ public:
     IsPlayingBackFifologWithBrokenEFBCopies = m_parent->m_File->HasBrokenEFBCopies();
 
     m_parent->m_CurrentFrame = m_parent->m_FrameRangeStart;
+    m_parent->m_LoopsPlayed = 0;
+    m_parent->m_FrameDurations.clear();
+    m_parent->m_LastFrameTime = 0;
     m_parent->LoadMemory();
   }
 
-  void Shutdown() override { IsPlayingBackFifologWithBrokenEFBCopies = false; }
+  void Shutdown() override
+  {
+    m_parent->WriteTimingStats();
+    IsPlayingBackFifologWithBrokenEFBCopies = false;
+  }
   void ClearCache() override
   {
     // Nothing to clear.
@@ -132,7 +148,8 @@ CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame > m_FrameRangeEnd)
   {
-    if (!m_Loop)
+    ++m_LoopsPlayed;
+    if (!m_Loop || (m_LoopCount != 0 && m_LoopsPlayed >= m_LoopCount))
       return CPU::State::PowerDown;
 
     // When looping, reload the contents of all the BP/CP/CF registers.
@@ -152,10 +169,65 @@ CPU::State FifoPlayer::AdvanceFrame()
 
   WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
 
+  // Collect per-frame durations for the timing statistics. These are measured CPU-side;
+  // in dual core mode they include FIFO backpressure, which is what makes them track how
+  // fast the video backend actually consumes the frames.
+  if (!SConfig::GetInstance().sFifoReplayTimingFile.empty())
+  {
+    const u64 now = Common::Timer::GetTimeUs();
+    if (m_LastFrameTime != 0)
+      m_FrameDurations.push_back(now - m_LastFrameTime);
+    m_LastFrameTime = now;
+  }
+
   ++m_CurrentFrame;
   return CPU::State::Running;
 }
 
+void FifoPlayer::WriteTimingStats()
+{
+  const std::string& filename = SConfig::GetInstance().sFifoReplayTimingFile;
+  if (filename.empty() || m_FrameDurations.empty())
+    return;
+
+  std::vector<u64> sorted = m_FrameDurations;
+  std::sort(sorted.begin(), sorted.end());
+
+  const auto percentile = [&sorted](double fraction) {
+    const size_t index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1));
+    return sorted[index];
+  };
+  const u64 total = std::accumulate(sorted.begin(), sorted.end(), u64{0});
+
+  std::ofstream file;
+  File::OpenFStream(file, filename, std::ios_base::out);
+  if (!file)
+  {
+    ERROR_LOG_FMT(CORE, "Failed to open fifo timing stats file {}", filename);
+    return;
+  }
+
+  file << fmt::format("{{\n"
+                      "  \"frames\": {},\n"
+                      "  \"loops\": {},\n"
+                      "  \"frame_time_us\": {{\n"
+                      "    \"average\": {},\n"
+                      "    \"min\": {},\n"
+                      "    \"max\": {},\n"
+                      "    \"p50\": {},\n"
+                      "    \"p90\": {},\n"
+                      "    \"p95\": {},\n"
+                      "    \"p99\": {}\n"
+                      "  }}\n"
+                      "}}\n",
+                      sorted.size(), m_LoopsPlayed, total / sorted.size(), sorted.front(),
+                      sorted.back(), percentile(0.50), percentile(0.90), percentile(0.95),
+                      percentile(0.99));
+
+  m_FrameDurations.clear();
+  m_LastFrameTime = 0;
+}
+
 std::unique_ptr<CPUCoreBase> FifoPlayer::GetCPUCore()
 {
   if (!m_File || m_File->GetFrameCount() == 0)
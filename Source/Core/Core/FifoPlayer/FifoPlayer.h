@@ -140,7 +140,17 @@ private:
   static bool IsIdleSet();
   static bool IsHighWatermarkSet();
 
+  // Writes the JSON timing statistics for a benchmark playback, if one was requested.
+  void WriteTimingStats();
+
   bool m_Loop;
+  // Number of times to play the frame range before stopping (0 = play forever).
+  u32 m_LoopCount;
+  u32 m_LoopsPlayed = 0;
+
+  // Wall-clock duration of each played frame, in microseconds.
+  std::vector<u64> m_FrameDurations;
+  u64 m_LastFrameTime = 0;
 
   u32 m_CurrentFrame = 0;
   u32 m_FrameRangeStart = 0;
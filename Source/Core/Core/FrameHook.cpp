@@ -0,0 +1,112 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/FrameHook.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "Core/Movie.h"
+#include "Core/PowerPC/MMU.h"
+
+namespace FrameHook
+{
+namespace
+{
+struct Entry
+{
+  int handle;
+  Callback callback;
+};
+
+std::mutex s_callbacks_mutex;
+std::vector<Entry> s_callbacks;
+int s_next_handle = 1;
+}  // namespace
+
+u8 MemoryAccess::ReadU8(u32 address) const
+{
+  return PowerPC::HostRead_U8(address);
+}
+
+u16 MemoryAccess::ReadU16(u32 address) const
+{
+  return PowerPC::HostRead_U16(address);
+}
+
+u32 MemoryAccess::ReadU32(u32 address) const
+{
+  return PowerPC::HostRead_U32(address);
+}
+
+u64 MemoryAccess::ReadU64(u32 address) const
+{
+  return PowerPC::HostRead_U64(address);
+}
+
+void MemoryAccess::WriteU8(u8 value, u32 address) const
+{
+  PowerPC::HostWrite_U8(value, address);
+}
+
+void MemoryAccess::WriteU16(u16 value, u32 address) const
+{
+  PowerPC::HostWrite_U16(value, address);
+}
+
+void MemoryAccess::WriteU32(u32 value, u32 address) const
+{
+  PowerPC::HostWrite_U32(value, address);
+}
+
+void MemoryAccess::WriteU64(u64 value, u32 address) const
+{
+  PowerPC::HostWrite_U64(value, address);
+}
+
+bool MemoryAccess::IsRAMAddress(u32 address) const
+{
+  return PowerPC::HostIsRAMAddress(address);
+}
+
+u32 MemoryAccess::ChasePointer(const std::vector<u32>& offsets) const
+{
+  u32 value = 0;
+  for (u32 offset : offsets)
+  {
+    value = PowerPC::HostRead_U32(value + offset);
+    if (!PowerPC::HostIsRAMAddress(value))
+      break;
+  }
+  return value;
+}
+
+int AddCallback(Callback callback)
+{
+  std::lock_guard lock(s_callbacks_mutex);
+  const int handle = s_next_handle++;
+  s_callbacks.push_back({handle, std::move(callback)});
+  return handle;
+}
+
+void RemoveCallback(int handle)
+{
+  std::lock_guard lock(s_callbacks_mutex);
+  s_callbacks.erase(std::remove_if(s_callbacks.begin(), s_callbacks.end(),
+                                   [handle](const Entry& entry) { return entry.handle == handle; }),
+                    s_callbacks.end());
+}
+
+void Execute()
+{
+  std::lock_guard lock(s_callbacks_mutex);
+  if (s_callbacks.empty())
+    return;
+
+  FrameInfo info;
+  info.frame = Movie::GetCurrentFrame();
+  for (const Entry& entry : s_callbacks)
+    entry.callback(info);
+}
+}  // namespace FrameHook
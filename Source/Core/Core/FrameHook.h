@@ -0,0 +1,58 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// In-process per-frame hook surface for tooling that drives the emulator
+// programmatically. Callbacks registered here run on the CPU thread once per frame, at
+// the Movie::FrameUpdate boundary, and are handed a batched accessor with direct access
+// to emulated memory. One callback can perform thousands of reads and writes per frame,
+// replacing per-access IPC round-trips (MemoryWatcher datagrams, socket pokes) with a
+// single in-process call.
+namespace FrameHook
+{
+// Batched memory accessor handed to frame callbacks. Accesses go through the MMU-aware
+// host paths (the same ones the debugger and ActionReplay use), so they are only valid
+// on the CPU thread while a game is running.
+class MemoryAccess
+{
+public:
+  u8 ReadU8(u32 address) const;
+  u16 ReadU16(u32 address) const;
+  u32 ReadU32(u32 address) const;
+  u64 ReadU64(u32 address) const;
+
+  void WriteU8(u8 value, u32 address) const;
+  void WriteU16(u16 value, u32 address) const;
+  void WriteU32(u32 value, u32 address) const;
+  void WriteU64(u64 value, u32 address) const;
+
+  bool IsRAMAddress(u32 address) const;
+
+  // Follows a chain of pointer offsets starting from address 0 and returns the last
+  // value read, stopping early when a link leaves RAM. Matches the address lists used
+  // by MemoryWatcher's Locations.txt.
+  u32 ChasePointer(const std::vector<u32>& offsets) const;
+};
+
+struct FrameInfo
+{
+  u64 frame = 0;  // Current frame count, as tracked by Movie
+  MemoryAccess memory;
+};
+
+using Callback = std::function<void(const FrameInfo&)>;
+
+// Registers a callback; may be called from any thread. Returns a handle for removal.
+// Callbacks must not add or remove callbacks from within their invocation.
+int AddCallback(Callback callback);
+void RemoveCallback(int handle);
+
+// Runs the registered callbacks. Called on the CPU thread once per frame.
+void Execute();
+}  // namespace FrameHook
@@ -60,9 +60,200 @@ enum class Installation
 static Installation s_code_handler_installed = Installation::Uninstalled;
 // the currently active codes
 static std::vector<GeckoCode> s_active_codes;
+// the subset of the active codes that RunCodeHandler() interprets on the host each frame;
+// only the remainder is placed into the guest GCT for the codehandler
+static std::vector<GeckoCode> s_active_host_codes;
 static std::vector<GeckoCode> s_synced_codes;
 static std::mutex s_active_codes_lock;
 
+// Returns true if the code consists entirely of opcodes the host interpreter below handles:
+// ba-relative RAM writes (00/02/04/06), if-blocks (20-2E) and the terminators (E0, and E2
+// without the else flag). Anything else — po addressing, gotos, Gecko registers, asm inserts —
+// keeps the code on the guest codehandler path.
+static bool IsHostExecutable(const GeckoCode& code)
+{
+  for (size_t i = 0; i < code.codes.size(); ++i)
+  {
+    const u32 word1 = code.codes[i].address;
+    switch (word1 & 0xFE000000)
+    {
+    case 0x00000000:  // 8-bit write & fill
+    case 0x02000000:  // 16-bit write & fill
+    case 0x04000000:  // 32-bit write
+    case 0x20000000:  // 32-bit if equal
+    case 0x22000000:  // 32-bit if not equal
+    case 0x24000000:  // 32-bit if greater
+    case 0x26000000:  // 32-bit if lower
+    case 0x28000000:  // 16-bit if equal
+    case 0x2A000000:  // 16-bit if not equal
+    case 0x2C000000:  // 16-bit if greater
+    case 0x2E000000:  // 16-bit if lower
+      break;
+    case 0x06000000:  // string write; the payload occupies the following entries
+    {
+      const size_t payload_entries = (code.codes[i].data + 7) / 8;
+      if (i + payload_entries >= code.codes.size())
+        return false;
+      i += payload_entries;
+      break;
+    }
+    case 0xE0000000:  // full terminator
+      if (word1 != 0xE0000000)
+        return false;
+      break;
+    case 0xE2000000:  // endif(s)
+      if ((word1 & 0x00F00000) != 0)  // the else form is not supported
+        return false;
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
+// Requires s_active_codes_lock.
+// Interprets one host-executable code against guest memory, with the same semantics the guest
+// codehandler applies: ba starts at 0x80000000, writes and if-conditions are big-endian guest
+// accesses, and terminators can load a new ba from their data word.
+static void RunHostCodeLocked(const GeckoCode& code)
+{
+  u32 ba = 0x80000000;
+  u32 if_depth = 0;     // open if-blocks
+  u32 false_depth = 0;  // how many of them did not take their branch
+
+  const auto pop_if = [&] {
+    if (if_depth > 0)
+    {
+      --if_depth;
+      if (false_depth > 0)
+        --false_depth;
+    }
+  };
+
+  for (size_t i = 0; i < code.codes.size(); ++i)
+  {
+    const u32 word1 = code.codes[i].address;
+    const u32 word2 = code.codes[i].data;
+    const u32 type = word1 & 0xFE000000;
+
+    // String writes carry their payload in the following entries. Skip it up front so the loop
+    // stays in sync even when the write itself sits inside a false branch.
+    const size_t payload_index = i + 1;
+    if (type == 0x06000000)
+      i += (word2 + 7) / 8;
+
+    // Terminators execute regardless of the branch state.
+    if (type == 0xE0000000 || type == 0xE2000000)
+    {
+      if (type == 0xE0000000)
+      {
+        if_depth = 0;
+        false_depth = 0;
+      }
+      else
+      {
+        for (u32 count = word1 & 0xFF; count > 0; --count)
+          pop_if();
+      }
+      if ((word2 & 0xFFFF0000) != 0)
+        ba = word2 & 0xFFFF0000;
+      continue;
+    }
+
+    if (type >= 0x20000000)
+    {
+      // If-blocks. An odd address applies one endif before the new if opens.
+      if ((word1 & 1) != 0)
+        pop_if();
+
+      bool condition = false;
+      if (false_depth == 0)
+      {
+        const u32 addr = ba + (word1 & 0x01FFFFFE);
+        u32 value;
+        u32 compare;
+        if (type < 0x28000000)
+        {
+          value = PowerPC::HostRead_U32(addr);
+          compare = word2;
+        }
+        else
+        {
+          // The upper half of the data word masks bits out of the comparison.
+          value = PowerPC::HostRead_U16(addr) & ~(word2 >> 16) & 0xFFFF;
+          compare = word2 & 0xFFFF;
+        }
+        switch (type & 0x06000000)
+        {
+        case 0x00000000:
+          condition = value == compare;
+          break;
+        case 0x02000000:
+          condition = value != compare;
+          break;
+        case 0x04000000:
+          condition = value > compare;
+          break;
+        case 0x06000000:
+          condition = value < compare;
+          break;
+        }
+      }
+      ++if_depth;
+      if (false_depth > 0 || !condition)
+        ++false_depth;
+      continue;
+    }
+
+    // RAM writes.
+    if (false_depth != 0)
+      continue;
+
+    const u32 addr = ba + (word1 & 0x01FFFFFF);
+    switch (type)
+    {
+    case 0x00000000:  // 8-bit write & fill
+    {
+      const u32 count = (word2 >> 16) + 1;
+      const u8 value = static_cast<u8>(word2);
+      for (u32 j = 0; j < count; ++j)
+        PowerPC::HostWrite_U8(value, addr + j);
+      break;
+    }
+    case 0x02000000:  // 16-bit write & fill
+    {
+      const u32 count = (word2 >> 16) + 1;
+      const u16 value = static_cast<u16>(word2);
+      for (u32 j = 0; j < count; ++j)
+        PowerPC::HostWrite_U16(value, addr + j * 2);
+      break;
+    }
+    case 0x04000000:  // 32-bit write
+      PowerPC::HostWrite_U32(word2, addr);
+      break;
+    case 0x06000000:  // string write
+    {
+      for (u32 j = 0; j < word2; ++j)
+      {
+        const GeckoCode::Code& payload = code.codes[payload_index + j / 8];
+        const u32 word = (j % 8 < 4) ? payload.address : payload.data;
+        PowerPC::HostWrite_U8(static_cast<u8>(word >> (24 - 8 * (j % 4))), addr + j);
+      }
+      break;
+    }
+    }
+  }
+}
+
+// Requires s_active_codes_lock.
+static void ClassifyActiveCodesLocked()
+{
+  s_active_host_codes.clear();
+  std::copy_if(s_active_codes.begin(), s_active_codes.end(),
+               std::back_inserter(s_active_host_codes), IsHostExecutable);
+}
+
 void SetActiveCodes(const std::vector<GeckoCode>& gcodes)
 {
   std::lock_guard lk(s_active_codes_lock);
@@ -75,6 +266,7 @@ void SetActiveCodes(const std::vector<GeckoCode>& gcodes)
                  [](const GeckoCode& code) { return code.enabled; });
   }
   s_active_codes.shrink_to_fit();
+  ClassifyActiveCodesLocked();
 
   s_code_handler_installed = Installation::Uninstalled;
 }
@@ -84,6 +276,7 @@ void SetSyncedCodesAsActive()
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
+  ClassifyActiveCodesLocked();
 }
 
 void UpdateSyncedCodes(const std::vector<GeckoCode>& gcodes)
@@ -107,6 +300,7 @@ std::vector<GeckoCode> SetAndReturnActiveCodes(const std::vector<GeckoCode>& gco
                  [](const GeckoCode& code) { return code.enabled; });
   }
   s_active_codes.shrink_to_fit();
+  ClassifyActiveCodesLocked();
 
   s_code_handler_installed = Installation::Uninstalled;
 
@@ -172,6 +366,10 @@ static Installation InstallCodeHandlerLocked()
   // NOTE: Only active codes are in the list
   for (const GeckoCode& active_code : s_active_codes)
   {
+    // Codes the host interpreter runs are not placed in the GCT at all.
+    if (IsHostExecutable(active_code))
+      continue;
+
     // If the code is not going to fit in the space we have left then we have to skip it
     if (next_address + active_code.codes.size() * CODE_SIZE > end_address)
     {
@@ -226,6 +424,7 @@ void Shutdown()
 {
   std::lock_guard codes_lock(s_active_codes_lock);
   s_active_codes.clear();
+  s_active_host_codes.clear();
   s_code_handler_installed = Installation::Uninstalled;
 }
 
@@ -237,11 +436,21 @@ void RunCodeHandler()
   // NOTE: Need to release the lock because of GUI deadlocks with PanicAlert in HostWrite_*
   {
     std::lock_guard codes_lock(s_active_codes_lock);
+
+    // Codes made purely of RAM writes and if-blocks are interpreted right here on the host.
+    for (const GeckoCode& host_code : s_active_host_codes)
+      RunHostCodeLocked(host_code);
+
+    // If every active code ran host-side, the guest codehandler (and the phantom
+    // branch-and-link into it below) is not needed at all.
+    if (s_active_codes.size() == s_active_host_codes.size())
+      return;
+
     if (s_code_handler_installed != Installation::Installed)
     {
       // Don't spam retry if the install failed. The corrupt / missing disk file is not likely to be
       // fixed within 1 frame of the last error.
-      if (s_active_codes.empty() || s_code_handler_installed == Installation::Failed)
+      if (s_code_handler_installed == Installation::Failed)
         return;
       s_code_handler_installed = InstallCodeHandlerLocked();
 
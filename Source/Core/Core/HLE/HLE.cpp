@@ -185,6 +185,11 @@ HookFlag GetHookFlagsByIndex(u32 index)
   return os_patches[index].flags;
 }
 
+HookFunction GetHookFunctionByIndex(u32 index)
+{
+  return os_patches[index].function;
+}
+
 bool IsEnabled(HookFlag flag)
 {
   return flag != HLE::HookFlag::Debug || SConfig::GetInstance().bEnableDebugging ||
@@ -48,6 +48,10 @@ u32 GetHookByAddress(u32 address);
 u32 GetHookByFunctionAddress(u32 address);
 HookType GetHookTypeByIndex(u32 index);
 HookFlag GetHookFlagsByIndex(u32 index);
+// Returns the function executed by the hook at the given index. Used by the JITs,
+// which know the index at compile time and can call the function directly instead
+// of going through Execute().
+HookFunction GetHookFunctionByIndex(u32 index);
 
 bool IsEnabled(HookFlag flag);
 
@@ -4,6 +4,7 @@
 #include "Core/HW/AddressSpace.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "Common/BitUtils.h"
 #include "Core/ConfigManager.h"
@@ -57,6 +58,35 @@ float Accessors::ReadF32(u32 address) const
   return Common::BitCast<float>(ReadU32(address));
 }
 
+void Accessors::ReadRange(u32 address, u32 size, u8* out_data, u8* out_valid) const
+{
+  for (u32 i = 0; i < size; i++)
+  {
+    const bool valid = IsValidAddress(address + i);
+    out_data[i] = valid ? ReadU8(address + i) : 0;
+    out_valid[i] = valid ? 1 : 0;
+  }
+}
+
+Accessors::RangeSnapshot Accessors::ReadRange(u32 address, u32 size) const
+{
+  RangeSnapshot snapshot;
+  snapshot.data.resize(size);
+  snapshot.valid.resize(size);
+  // Split ranges that wrap past the end of the address space so the overrides only have to
+  // deal with contiguous spans.
+  const u64 range_end = static_cast<u64>(address) + size;
+  const u32 first_size =
+      range_end > 0x100000000 ? static_cast<u32>(0x100000000 - address) : size;
+  ReadRange(address, first_size, snapshot.data.data(), snapshot.valid.data());
+  if (first_size != size)
+  {
+    ReadRange(0, size - first_size, snapshot.data.data() + first_size,
+              snapshot.valid.data() + first_size);
+  }
+  return snapshot;
+}
+
 Accessors::iterator Accessors::begin() const
 {
   return nullptr;
@@ -90,6 +120,52 @@ struct EffectiveAddressSpaceAccessors : Accessors
   void WriteU64(u32 address, u64 value) override { PowerPC::HostWrite_U64(value, address); }
   float ReadF32(u32 address) const override { return PowerPC::HostRead_F32(address); };
 
+  void ReadRange(u32 address, u32 size, u8* out_data, u8* out_valid) const override
+  {
+    // Same page walk as Matches(): translate each page once and copy whole spans instead of
+    // going through the per-byte host accessors for every byte.
+    while (size != 0)
+    {
+      const u32 offset = address & 0x00000fff;
+      const u32 chunk_size = std::min(0x1000 - offset, size);
+
+      if (!PowerPC::HostIsRAMAddress(address))
+      {
+        std::memset(out_data, 0, chunk_size);
+        std::memset(out_valid, 0, chunk_size);
+      }
+      else
+      {
+        const u8* page_ptr = nullptr;
+        auto page_physical_address = PowerPC::GetTranslatedAddress(address & 0xfffff000);
+        if (page_physical_address.has_value())
+        {
+          // Same mem1/mem2 restriction as Matches(), see the comment there
+          const u32 memory_area = (*page_physical_address) >> 24;
+          if (memory_area == 0x00 || memory_area == 0x01)
+            page_ptr = Memory::GetPointer(*page_physical_address);
+        }
+
+        if (page_ptr != nullptr)
+        {
+          std::memcpy(out_data, page_ptr + offset, chunk_size);
+        }
+        else
+        {
+          // Readable, but not backed by plain mem1/mem2 (e.g. the locked cache region)
+          for (u32 i = 0; i < chunk_size; i++)
+            out_data[i] = PowerPC::HostRead_U8(address + i);
+        }
+        std::memset(out_valid, 1, chunk_size);
+      }
+
+      address += chunk_size;
+      size -= chunk_size;
+      out_data += chunk_size;
+      out_valid += chunk_size;
+    }
+  }
+
   bool Matches(u32 haystack_start, const u8* needle_start, std::size_t needle_size) const
   {
     u32 page_base = haystack_start & 0xfffff000;
@@ -189,6 +265,16 @@ struct AuxiliaryAddressSpaceAccessors : Accessors
 
   iterator end() const override { return DSP::GetARAMPtr() + GetSize(); }
 
+  void ReadRange(u32 address, u32 size, u8* out_data, u8* out_valid) const override
+  {
+    const u32 valid_size = IsValidAddress(address) ? std::min(size, GetSize() - address) : 0;
+    if (valid_size != 0)
+      std::memcpy(out_data, DSP::GetARAMPtr() + address, valid_size);
+    std::memset(out_valid, 1, valid_size);
+    std::memset(out_data + valid_size, 0, size - valid_size);
+    std::memset(out_valid + valid_size, 0, size - valid_size);
+  }
+
   std::optional<u32> Search(u32 haystack_offset, const u8* needle_start, std::size_t needle_size,
                             bool forward) const override
   {
@@ -264,6 +350,31 @@ struct CompositeAddressSpaceAccessors : Accessors
     return it->accessors->WriteU8(address, value);
   }
 
+  void ReadRange(u32 address, u32 size, u8* out_data, u8* out_valid) const override
+  {
+    while (size != 0)
+    {
+      auto it = FindAppropriateAccessor(address);
+      if (it == m_accessor_mappings.end())
+      {
+        *out_data++ = 0;
+        *out_valid++ = 0;
+        address++;
+        size--;
+        continue;
+      }
+      // Delegate the longest span that stays within this mapping
+      u32 span = 1;
+      while (span < size && it->accessors->IsValidAddress(address + span - it->base))
+        span++;
+      it->accessors->ReadRange(address - it->base, span, out_data, out_valid);
+      address += span;
+      size -= span;
+      out_data += span;
+      out_valid += span;
+    }
+  }
+
   std::optional<u32> Search(u32 haystack_offset, const u8* needle_start, std::size_t needle_size,
                             bool forward) const override
   {
@@ -321,6 +432,16 @@ struct SmallBlockAccessors : Accessors
     return (*alloc_base == nullptr) ? nullptr : (*alloc_base + size);
   }
 
+  void ReadRange(u32 address, u32 count, u8* out_data, u8* out_valid) const override
+  {
+    const u32 valid_count = IsValidAddress(address) ? std::min(count, size - address) : 0;
+    if (valid_count != 0)
+      std::memcpy(out_data, *alloc_base + address, valid_count);
+    std::memset(out_valid, 1, valid_count);
+    std::memset(out_data + valid_count, 0, count - valid_count);
+    std::memset(out_valid + valid_count, 0, count - valid_count);
+  }
+
   std::optional<u32> Search(u32 haystack_offset, const u8* needle_start, std::size_t needle_size,
                             bool forward) const override
   {
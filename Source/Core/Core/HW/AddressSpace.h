@@ -4,6 +4,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -23,10 +24,26 @@ struct Accessors
 {
   using iterator = const u8*;
 
+  // A bulk snapshot of a range of the address space, for consumers like the debugger's memory
+  // view that want to read a whole visible window at once and diff successive refreshes.
+  // valid holds one entry per byte (1 = readable).
+  struct RangeSnapshot
+  {
+    std::vector<u8> data;
+    std::vector<u8> valid;
+  };
+
   virtual bool IsValidAddress(u32 address) const = 0;
   virtual u8 ReadU8(u32 address) const = 0;
   virtual void WriteU8(u32 address, u8 value) = 0;
 
+  // Reads size bytes into out_data, with out_valid marking which bytes were readable (0/1);
+  // unreadable bytes are zeroed. The naive implementation reads per byte, accessors backed by
+  // a linear buffer copy whole spans. Callers must not pass ranges that wrap past the end of
+  // the address space (the snapshot overload below splits such ranges).
+  virtual void ReadRange(u32 address, u32 size, u8* out_data, u8* out_valid) const;
+  RangeSnapshot ReadRange(u32 address, u32 size) const;
+
   // overrideable naive implementations of below are defined
   virtual u16 ReadU16(u32 address) const;
   virtual void WriteU16(u32 address, u16 value);
@@ -23,6 +23,7 @@
 
 #include "Core/HW/DSP.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "AudioCommon/AudioCommon.h"
@@ -33,9 +34,11 @@
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
 
+#include "Core/HW/AudioInterface.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/ProcessorInterface.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/PowerPC.h"
 
 namespace DSP
@@ -136,6 +139,9 @@ static ARAM_Info s_ARAM_Info;
 static u16 s_AR_MODE;
 static u16 s_AR_REFRESH;
 static int s_dsp_slice = 0;
+// Tick at which the block at current_source_address started transferring; the audio DMA
+// position is advanced lazily from this instead of by a per-block event.
+static u64 s_audio_dma_block_start_ticks = 0;
 
 static std::unique_ptr<DSPEmulator> s_dsp_emulator;
 
@@ -155,6 +161,7 @@ void DoState(PointerWrap& p)
   p.Do(s_AR_MODE);
   p.Do(s_AR_REFRESH);
   p.Do(s_dsp_slice);
+  p.Do(s_audio_dma_block_start_ticks);
 
   s_dsp_emulator->DoState(p);
 }
@@ -162,6 +169,7 @@ void DoState(PointerWrap& p)
 static void UpdateInterrupts();
 static void Do_ARAM_DMA();
 static void GenerateDSPInterrupt(u64 DSPIntType, s64 cyclesLate = 0);
+static void ConsumeAudioDMABlocks();
 
 static CoreTiming::EventType* s_et_GenerateDSPInterrupt;
 static CoreTiming::EventType* s_et_CompleteARAM;
@@ -386,6 +394,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
         {
           s_audioDMA.current_source_address = s_audioDMA.SourceAddress;
           s_audioDMA.remaining_blocks_count = s_audioDMA.AudioDMAControl.NumBlocks;
+          s_audio_dma_block_start_ticks = CoreTiming::GetTicks();
 
           INFO_LOG_FMT(AUDIO_INTERFACE, "Audio DMA configured: {} blocks from {:#010x}",
                        s_audioDMA.AudioDMAControl.NumBlocks, s_audioDMA.SourceAddress);
@@ -405,6 +414,9 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // the read side.
   mmio->Register(
       base | AUDIO_DMA_BLOCKS_LEFT, MMIO::ComplexRead<u16>([](u32) {
+        // The count is only advanced at buffer boundaries now, so bring it up to date for
+        // games that poll DMA progress.
+        ConsumeAudioDMABlocks();
         // remaining_blocks_count is zero-based.  DreamMix World Fighters will hang if it never
         // reaches zero.
         return (s_audioDMA.remaining_blocks_count > 0 ? s_audioDMA.remaining_blocks_count - 1 : 0);
@@ -464,24 +476,44 @@ void UpdateDSPSlice(int cycles)
   }
 }
 
-// This happens at 4 khz, since 32 bytes at 4khz = 4 bytes at 32 khz (16bit stereo pcm)
-void UpdateAudioDMA()
+// Number of ticks it takes to transfer one 32-byte block (4 stereo 16-bit samples at the
+// AID rate, nominally 4 khz).
+static int GetAudioDMABlockPeriod()
+{
+  return SystemTimers::GetTicksPerSecond() / (AudioInterface::GetAIDSampleRate() * 4 / 32);
+}
+
+// Advances the DMA position by the number of whole blocks the hardware would have
+// transferred since the last advance. The per-block event this used to piggyback on no
+// longer exists, so both the buffer-boundary callback and MMIO reads of the DMA progress
+// derive the position from CoreTiming ticks instead.
+static void ConsumeAudioDMABlocks()
+{
+  if (!s_audioDMA.AudioDMAControl.Enable)
+    return;
+
+  const int block_period = GetAudioDMABlockPeriod();
+  u32 blocks =
+      static_cast<u32>((CoreTiming::GetTicks() - s_audio_dma_block_start_ticks) / block_period);
+  blocks = std::min<u32>(blocks, s_audioDMA.remaining_blocks_count);
+  s_audioDMA.remaining_blocks_count -= blocks;
+  s_audioDMA.current_source_address += blocks * 32;
+  s_audio_dma_block_start_ticks += static_cast<u64>(blocks) * block_period;
+}
+
+// Called once per DMA buffer rather than per 32-byte block; returns how many block
+// periods until it needs to run again (the remainder of the current buffer).
+u32 UpdateAudioDMA()
 {
   static short zero_samples[8 * 2] = {0};
   if (s_audioDMA.AudioDMAControl.Enable)
   {
-    // Read audio at g_audioDMA.current_source_address in RAM and push onto an
-    // external audio fifo in the emulator, to be mixed with the disc
-    // streaming output.
-
-    if (s_audioDMA.remaining_blocks_count != 0)
-    {
-      s_audioDMA.remaining_blocks_count--;
-      s_audioDMA.current_source_address += 32;
-    }
-
+    ConsumeAudioDMABlocks();
     if (s_audioDMA.remaining_blocks_count == 0)
     {
+      // Buffer finished: autoload the next one. Read audio at
+      // s_audioDMA.current_source_address in RAM and push onto an external audio fifo
+      // in the emulator, to be mixed with the disc streaming output.
       s_audioDMA.current_source_address = s_audioDMA.SourceAddress;
       s_audioDMA.remaining_blocks_count = s_audioDMA.AudioDMAControl.NumBlocks;
 
@@ -493,11 +525,11 @@ void UpdateAudioDMA()
       }
       GenerateDSPInterrupt(DSP::INT_AID);
     }
+    return std::max<u32>(s_audioDMA.remaining_blocks_count, 1);
   }
-  else
-  {
-    AudioCommon::SendAIBuffer(&zero_samples[0], 8);
-  }
+
+  AudioCommon::SendAIBuffer(&zero_samples[0], 8);
+  return 1;
 }
 
 static void Do_ARAM_DMA()
@@ -636,4 +668,13 @@ u8* GetARAMPtr()
   return s_ARAM.ptr;
 }
 
+u8* GetLinearARAMPtr(u32* mask)
+{
+  if (s_ARAM.wii_mode)
+    return nullptr;
+
+  *mask = s_ARAM.mask;
+  return s_ARAM.ptr;
+}
+
 }  // end of namespace DSP
@@ -77,8 +77,13 @@ void WriteARAM(u8 value, u32 address);
 
 // Debugger Helper
 u8* GetARAMPtr();
+// Returns ARAM as a single linear host buffer together with its address mask, or nullptr when
+// accelerator accesses cannot be satisfied from one buffer (on Wii, reads can alias main RAM
+// depending on the address - see ReadARAM).
+u8* GetLinearARAMPtr(u32* mask);
 
-void UpdateAudioDMA();
+// Returns the number of 32-byte block periods until it needs to be called again.
+u32 UpdateAudioDMA();
 void UpdateDSPSlice(int cycles);
 
 }  // namespace DSP
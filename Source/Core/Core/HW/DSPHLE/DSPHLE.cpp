@@ -6,6 +6,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Common/Tracing.h"
 #include "Core/Core.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 #include "Core/HW/SystemTimers.h"
@@ -44,6 +45,7 @@ void DSPHLE::Shutdown()
 
 void DSPHLE::DSP_Update(int cycles)
 {
+  TRACE_ZONE("DSPHLE::DSP_Update");
   if (m_ucode != nullptr)
     m_ucode->Update();
 }
@@ -13,6 +13,8 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/Thread.h"
+#include "Core/Core.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/DSPHLE.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -30,14 +32,77 @@ AXUCode::AXUCode(DSPHLE* dsphle, u32 crc) : UCodeInterface(dsphle, crc), m_cmdli
 
 AXUCode::~AXUCode()
 {
+  ShutdownCommandListThread();
+
   m_mail_handler.Clear();
 }
 
+void AXUCode::ShutdownCommandListThread()
+{
+  if (!m_cmdlist_thread.joinable())
+    return;
+
+  if (m_cmdlist_in_flight)
+  {
+    m_cmdlist_done_event.Wait();
+    m_cmdlist_in_flight = false;
+  }
+
+  m_cmdlist_thread_running.Clear();
+  m_cmdlist_ready_event.Set();
+  m_cmdlist_thread.join();
+}
+
 void AXUCode::Initialize()
 {
   m_mail_handler.PushMail(DSP_INIT, true);
 
   LoadResamplingCoefficients();
+
+  m_cmdlist_thread_running.Set();
+  m_cmdlist_thread = std::thread(&AXUCode::CommandListThread, this);
+}
+
+void AXUCode::CommandListThread()
+{
+  Common::SetCurrentThreadName("AX HLE worker");
+
+  while (true)
+  {
+    m_cmdlist_ready_event.Wait();
+    if (!m_cmdlist_thread_running.IsSet())
+      return;
+
+    HandleCommandList();
+    m_cmdlist_done_event.Set();
+  }
+}
+
+void AXUCode::StartCommandListProcessing()
+{
+  // When determinism is needed, process the list synchronously so the guest
+  // sees identical memory contents at identical instruction counts.
+  if (Core::WantsDeterminism())
+  {
+    HandleCommandList();
+    m_cmdlist_size = 0;
+    SignalWorkEnd();
+    return;
+  }
+
+  m_cmdlist_in_flight = true;
+  m_cmdlist_ready_event.Set();
+}
+
+void AXUCode::FinishCommandListProcessing()
+{
+  if (!m_cmdlist_in_flight)
+    return;
+
+  m_cmdlist_done_event.Wait();
+  m_cmdlist_in_flight = false;
+  m_cmdlist_size = 0;
+  SignalWorkEnd();
 }
 
 void AXUCode::LoadResamplingCoefficients()
@@ -623,12 +688,14 @@ void AXUCode::HandleMail(u32 mail)
 
   bool set_next_is_cmdlist = false;
 
+  // A new mail means the CPU is done with the previous yield, so any command
+  // list still on the worker has to be retired first.
+  FinishCommandListProcessing();
+
   if (next_is_cmdlist)
   {
     CopyCmdList(mail, cmdlist_size);
-    HandleCommandList();
-    m_cmdlist_size = 0;
-    SignalWorkEnd();
+    StartCommandListProcessing();
   }
   else if (m_upload_setup_in_progress)
   {
@@ -681,6 +748,12 @@ void AXUCode::CopyCmdList(u32 addr, u16 size)
 
 void AXUCode::Update()
 {
+  // The yield mail for an asynchronously processed command list is sent from
+  // here, once mixing has finished and its results are guest-visible. This
+  // adds up to 1ms of emulated time to the yield, well within the lag
+  // observed under DSP-LLE (see SignalWorkEnd).
+  FinishCommandListProcessing();
+
   // Used for UCode switching.
   if (NeedsResumeMail())
   {
@@ -690,6 +763,10 @@ void AXUCode::Update()
 
 void AXUCode::DoAXState(PointerWrap& p)
 {
+  // The sample buffers below are the worker's scratch space; make sure it is
+  // idle before serializing them.
+  FinishCommandListProcessing();
+
   p.Do(m_cmdlist);
   p.Do(m_cmdlist_size);
 
@@ -11,8 +11,12 @@
 
 #pragma once
 
+#include <thread>
+
 #include "Common/BitUtils.h"
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/Swap.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
 
@@ -132,6 +136,18 @@ protected:
   virtual void HandleCommandList();
   void SignalWorkEnd();
 
+  // Command lists are normally processed on a worker thread while the CPU
+  // thread continues running; the results only become guest-visible once the
+  // yield mail has been sent, so that is where we wait for the worker. The
+  // command list itself is snapshotted into m_cmdlist on the CPU thread
+  // before the worker starts.
+  void StartCommandListProcessing();
+  void FinishCommandListProcessing();
+
+  // Stops the worker. Derived classes must call this from their destructor
+  // so the worker cannot touch their members while they are torn down.
+  void ShutdownCommandListThread();
+
   void SetupProcessing(u32 init_addr);
   void DownloadAndMixWithVolume(u32 addr, u16 vol_main, u16 vol_auxa, u16 vol_auxb);
   void ProcessPBList(u32 pb_addr);
@@ -148,6 +164,15 @@ protected:
   void DoAXState(PointerWrap& p);
 
 private:
+  void CommandListThread();
+
+  std::thread m_cmdlist_thread;
+  Common::Flag m_cmdlist_thread_running;
+  Common::Event m_cmdlist_ready_event;
+  Common::Event m_cmdlist_done_event;
+  // Only ever accessed from the CPU thread.
+  bool m_cmdlist_in_flight = false;
+
   enum CmdType
   {
     CMD_SETUP = 0x00,
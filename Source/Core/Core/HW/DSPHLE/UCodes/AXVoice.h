@@ -12,10 +12,11 @@
 #endif
 
 #include <algorithm>
-#include <functional>
 #include <memory>
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
@@ -235,7 +236,11 @@ u16 AcceleratorGetSample()
 // We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
 // avoids discontinuities in the audio stream, especially with very low ratios
 // which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
+// The callback is a template parameter rather than a std::function: this runs once per output
+// sample for every active voice, and the indirect call would otherwise dominate the accelerator
+// decode it wraps.
+template <typename InputCallback>
+u32 ResampleAudio(InputCallback input_callback, s16* output, u32 count, s16* last_samples,
                   u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
 {
   int read_samples_count = 0;
@@ -371,6 +376,44 @@ void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
   pb.adpcm.pred_scale = s_accelerator->GetPredScale();
 }
 
+#ifdef _M_X86
+// Mixes as many samples as fit in whole SIMD registers at a constant volume and returns
+// the number of samples processed; the caller handles the remainder. The s16 * u16
+// product fits in 32 bits, so everything can be done in s32 lanes.
+FUNCTION_TARGET_SSR41
+u32 MixAddConstantVolume_SSE41(int* out, const s16* input, u32 count, u16 volume)
+{
+  const __m128i vol = _mm_set1_epi32(volume);
+  const __m128i min = _mm_set1_epi32(-32767);
+  const __m128i max = _mm_set1_epi32(32767);
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i in = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)&input[i]));
+    __m128i sample = _mm_srai_epi32(_mm_mullo_epi32(in, vol), 15);
+    sample = _mm_min_epi32(_mm_max_epi32(sample, min), max);
+    _mm_storeu_si128((__m128i*)&out[i],
+                     _mm_add_epi32(_mm_loadu_si128((const __m128i*)&out[i]), sample));
+  }
+  return i;
+}
+#elif defined(_M_ARM_64)
+u32 MixAddConstantVolume_NEON(int* out, const s16* input, u32 count, u16 volume)
+{
+  const int32x4_t min = vdupq_n_s32(-32767);
+  const int32x4_t max = vdupq_n_s32(32767);
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const int32x4_t in = vmovl_s16(vld1_s16(&input[i]));
+    int32x4_t sample = vshrq_n_s32(vmulq_n_s32(in, volume), 15);
+    sample = vminq_s32(vmaxq_s32(sample, min), max);
+    vst1q_s32(&out[i], vaddq_s32(vld1q_s32(&out[i]), sample));
+  }
+  return i;
+}
+#endif
+
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ramp)
 {
@@ -383,16 +426,31 @@ void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ra
   if (!ramp)
     volume_delta = 0;
 
-  for (u32 i = 0; i < count; ++i)
+  if (volume_delta == 0)
   {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    sample = std::clamp((s32)sample, -32767, 32767);  // -32768 ?
-
-    out[i] += (s16)sample;
-    volume += volume_delta;
+    // Constant volume: the per-sample state disappears (dpop only keeps the last mixed
+    // sample), leaving a pure batch multiply-accumulate we can hand to SIMD.
+    u32 i = 0;
+#ifdef _M_X86
+    if (cpu_info.bSSE4_1)
+      i = MixAddConstantVolume_SSE41(out, input, count, volume);
+#elif defined(_M_ARM_64)
+    i = MixAddConstantVolume_NEON(out, input, count, volume);
+#endif
+    for (; i < count; ++i)
+      out[i] += (s16)std::clamp(((s32)input[i] * volume) >> 15, -32767, 32767);  // -32768 ?
 
+    *dpop = (s16)std::clamp(((s32)input[count - 1] * volume) >> 15, -32767, 32767);
+  }
+  else
+  {
+    s32 sample = 0;
+    for (u32 i = 0; i < count; ++i)
+    {
+      sample = std::clamp(((s32)input[i] * volume) >> 15, -32767, 32767);  // -32768 ?
+      out[i] += (s16)sample;
+      volume += volume_delta;
+    }
     *dpop = (s16)sample;
   }
 }
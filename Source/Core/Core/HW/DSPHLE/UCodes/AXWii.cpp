@@ -32,6 +32,7 @@ AXWiiUCode::AXWiiUCode(DSPHLE* dsphle, u32 crc) : AXUCode(dsphle, crc), m_last_m
 
 AXWiiUCode::~AXWiiUCode()
 {
+  ShutdownCommandListThread();
 }
 
 void AXWiiUCode::HandleCommandList()
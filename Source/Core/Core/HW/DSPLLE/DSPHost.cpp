@@ -36,6 +36,11 @@ void WriteHostMemory(u8 value, u32 addr)
   DSP::WriteARAM(value, addr);
 }
 
+u8* GetHostMemoryPtr(u32* mask)
+{
+  return DSP::GetLinearARAMPtr(mask);
+}
+
 void DMAToDSP(u16* dst, u32 addr, u32 size)
 {
   Memory::CopyFromEmuSwapped(dst, addr, size);
@@ -4,7 +4,9 @@
 #include "Core/HW/DVD/DVDInterface.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -147,6 +149,10 @@ static UDICR s_DICR;
 static u32 s_DIIMMBUF;
 static UDICFG s_DICFG;
 
+// Guards s_adpcm_decoder: the DVD thread decodes DTK blocks while the CPU thread can
+// reset the filter from the stream-start command path at any time. Taken once per
+// decoded batch and on the rare resets, so it is effectively uncontended.
+static std::mutex s_adpcm_decoder_mutex;
 static StreamADPCM::ADPCMDecoder s_adpcm_decoder;
 
 // DTK
@@ -239,23 +245,35 @@ void DoState(PointerWrap& p)
   s_adpcm_decoder.DoState(p);
 }
 
-static size_t ProcessDTKSamples(std::vector<s16>* temp_pcm, const std::vector<u8>& audio_data)
+std::vector<u8> DecodeDTKSamples(const std::vector<u8>& audio_data)
 {
-  size_t samples_processed = 0;
-  size_t bytes_processed = 0;
-  while (samples_processed < temp_pcm->size() / 2 && bytes_processed < audio_data.size())
+  // Runs on the DVD thread. DTK reads are issued one at a time, so decodes never overlap
+  // each other, but the CPU thread can reset the filter from the stream-start command path
+  // while a decode is still in flight -- hence the mutex. Savestates quiesce the DVD thread
+  // before serializing the decoder.
+  const size_t num_blocks = audio_data.size() / StreamADPCM::ONE_BLOCK_SIZE;
+  std::vector<u8> pcm(num_blocks * StreamADPCM::SAMPLES_PER_BLOCK * 2 * sizeof(s16));
+  s16* out = reinterpret_cast<s16*>(pcm.data());
+  std::lock_guard lock(s_adpcm_decoder_mutex);
+  for (size_t block = 0; block < num_blocks; ++block)
   {
-    s_adpcm_decoder.DecodeBlock(&(*temp_pcm)[samples_processed * 2], &audio_data[bytes_processed]);
+    s_adpcm_decoder.DecodeBlock(out, &audio_data[block * StreamADPCM::ONE_BLOCK_SIZE]);
     for (size_t i = 0; i < StreamADPCM::SAMPLES_PER_BLOCK * 2; ++i)
     {
       // TODO: Fix the mixer so it can accept non-byte-swapped samples.
-      s16* sample = &(*temp_pcm)[samples_processed * 2 + i];
-      *sample = Common::swap16(*sample);
+      out[i] = Common::swap16(out[i]);
     }
-    samples_processed += StreamADPCM::SAMPLES_PER_BLOCK;
-    bytes_processed += StreamADPCM::ONE_BLOCK_SIZE;
+    out += StreamADPCM::SAMPLES_PER_BLOCK * 2;
   }
-  return samples_processed;
+  return pcm;
+}
+
+static size_t ProcessDTKSamples(std::vector<s16>* temp_pcm, const std::vector<u8>& audio_data)
+{
+  // audio_data already contains byte-swapped PCM decoded on the DVD thread.
+  const size_t bytes = std::min(temp_pcm->size() * sizeof(s16), audio_data.size());
+  std::memcpy(temp_pcm->data(), audio_data.data(), bytes);
+  return bytes / (2 * sizeof(s16));
 }
 
 static u32 AdvanceDTK(u32 maximum_samples, u32* samples_to_process)
@@ -283,6 +301,7 @@ static u32 AdvanceDTK(u32 maximum_samples, u32* samples_to_process)
         break;
       }
 
+      std::lock_guard lock(s_adpcm_decoder_mutex);
       s_adpcm_decoder.ResetFilter();
     }
 
@@ -1055,7 +1074,12 @@ void ExecuteCommand(ReplyType reply_type)
           s_current_start = s_next_start;
           s_current_length = s_next_length;
           s_audio_position = s_current_start;
-          s_adpcm_decoder.ResetFilter();
+          {
+            // A game restarting the stream can get here while the DVD thread is still
+            // decoding the previous read.
+            std::lock_guard lock(s_adpcm_decoder_mutex);
+            s_adpcm_decoder.ResetFilter();
+          }
           s_stream = true;
         }
       }
@@ -144,6 +144,10 @@ void SetDriveError(DriveError error);
 void FinishExecutingCommand(ReplyType reply_type, DIInterruptType interrupt_type, s64 cycles_late,
                             const std::vector<u8>& data = std::vector<u8>());
 
+// Used by DVDThread; runs on the DVD thread. Decodes a DTK audio read into byte-swapped
+// PCM so that the CPU thread only has to hand the samples to the mixer.
+std::vector<u8> DecodeDTKSamples(const std::vector<u8>& audio_data);
+
 // Used by IOS HLE
 void SetInterruptEnabled(DIInterruptType interrupt, bool enabled);
 void ClearInterrupt(DIInterruptType interrupt);
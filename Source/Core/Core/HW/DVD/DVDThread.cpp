@@ -3,6 +3,8 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -27,6 +29,7 @@
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/DVD/FileMonitor.h"
 #include "Core/HW/Memmap.h"
+#include "Core/HW/StreamADPCM.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/IOS/ES/Formats.h"
 
@@ -53,6 +56,10 @@ struct ReadRequest
   // it's fine to re-use IDs of requests that have existed in the past.
   u64 id;
 
+  // How many bytes of the result have already been copied to emulated RAM
+  // by DMAChunk events. Only used for copy_to_ram requests.
+  u32 dma_progress;
+
   // Only used for logging
   u64 time_started_ticks;
   u64 realtime_started_us;
@@ -74,6 +81,18 @@ static void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offs
 static void FinishRead(u64 id, s64 cycles_late);
 static CoreTiming::EventType* s_finish_read;
 
+static void DMAChunk(u64 id, s64 cycles_late);
+static CoreTiming::EventType* s_dma_chunk;
+
+// Large buffer-miss reads used to be copied to emulated RAM in one go when the
+// completion event fired, which showed up as multi-millisecond CPU thread
+// spikes in frame pacing traces. Requests bigger than this are instead copied
+// one chunk at a time by DMAChunk events spread across the emulated transfer
+// window, with FinishRead copying whatever remains. Hardware performs the DMA
+// incrementally during the transfer too, so the partial data is not
+// observable by well-behaved software (which waits for the interrupt).
+constexpr u32 DMA_CHUNK_SIZE = 64 * 1024;
+
 static u64 s_next_id = 0;
 
 static std::thread s_dvd_thread;
@@ -87,9 +106,29 @@ static std::map<u64, ReadResult> s_result_map;
 
 static std::unique_ptr<DiscIO::Volume> s_disc;
 
+// Readahead for sequential access runs (e.g. streaming audio). Once enough
+// consecutive requests continue where the previous one ended, the DVD thread
+// speculatively reads ahead while the request queue is empty, and later
+// requests covered by the buffer are served from memory. This state is only
+// touched from the DVD thread while it is running, and from the CPU thread
+// only between StopDVDThread and StartDVDThread; it is not savestated since
+// it caches disc contents.
+constexpr u32 READAHEAD_CHUNK_SIZE = 128 * 1024;
+constexpr size_t READAHEAD_MAX_SIZE = 1024 * 1024;
+constexpr u32 READAHEAD_TRIGGER = 2;
+
+static DiscIO::Partition s_readahead_partition;
+static u64 s_readahead_offset = 0;
+static std::vector<u8> s_readahead_buffer;
+
+static DiscIO::Partition s_expected_partition;
+static u64 s_expected_next_offset = 0;
+static u32 s_sequential_run = 0;
+
 void Start()
 {
   s_finish_read = CoreTiming::RegisterEvent("FinishReadDVDThread", FinishRead);
+  s_dma_chunk = CoreTiming::RegisterEvent("DVDThreadDMAChunk", DMAChunk);
 
   s_request_queue_expanded.Reset();
   s_result_queue_expanded.Reset();
@@ -177,6 +216,10 @@ void SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
   s_disc = std::move(disc);
+
+  // The readahead buffer caches the old disc's contents.
+  s_readahead_buffer.clear();
+  s_sequential_run = 0;
 }
 
 bool HasDisc()
@@ -281,6 +324,7 @@ static void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offs
   request.length = length;
   request.partition = partition;
   request.reply_type = reply_type;
+  request.dma_progress = 0;
 
   u64 id = s_next_id++;
   request.id = id;
@@ -292,6 +336,57 @@ static void StartReadInternal(bool copy_to_ram, u32 output_address, u64 dvd_offs
   s_request_queue_expanded.Set();
 
   CoreTiming::ScheduleEvent(ticks_until_completion, s_finish_read, id);
+
+  // Interleave the copy to emulated RAM with CPU slices; see DMA_CHUNK_SIZE.
+  if (copy_to_ram && length > DMA_CHUNK_SIZE)
+  {
+    const s64 chunks = (length + DMA_CHUNK_SIZE - 1) / DMA_CHUNK_SIZE;
+    for (s64 i = 1; i < chunks; ++i)
+      CoreTiming::ScheduleEvent(ticks_until_completion * i / chunks, s_dma_chunk, id);
+  }
+}
+
+// Returns the result for the given request if the DVD thread has already
+// delivered it, without blocking. The result stays in s_result_map until
+// FinishRead consumes it.
+static ReadResult* TryGetResult(u64 id)
+{
+  const auto it = s_result_map.find(id);
+  if (it != s_result_map.end())
+    return &it->second;
+
+  ReadResult result;
+  while (s_result_queue.Pop(result))
+  {
+    const u64 result_id = result.first.id;
+    const auto inserted = s_result_map.emplace(result_id, std::move(result)).first;
+    if (result_id == id)
+      return &inserted->second;
+  }
+
+  return nullptr;
+}
+
+static void DMAChunk(u64 id, s64 cycles_late)
+{
+  // If the DVD thread hasn't delivered the data yet, skip this chunk rather
+  // than wait for it; FinishRead will copy whatever is left. This event
+  // therefore never blocks the CPU thread.
+  ReadResult* result = TryGetResult(id);
+  if (!result)
+    return;
+
+  ReadRequest& request = result->first;
+  const std::vector<u8>& buffer = result->second;
+
+  // Read errors are handled by FinishRead.
+  if (buffer.size() != request.length || request.dma_progress >= request.length)
+    return;
+
+  const u32 length = std::min(DMA_CHUNK_SIZE, request.length - request.dma_progress);
+  Memory::CopyToEmu(request.output_address + request.dma_progress,
+                    buffer.data() + request.dma_progress, length);
+  request.dma_progress += length;
 }
 
 static void FinishRead(u64 id, s64 cycles_late)
@@ -340,8 +435,16 @@ static void FinishRead(u64 id, s64 cycles_late)
                 (CoreTiming::GetTicks() - request.time_started_ticks) /
                     (SystemTimers::GetTicksPerSecond() / 1000000));
 
+  // DTK reads are decoded to PCM on the DVD thread, so their buffers are larger
+  // than the amount of disc data that was requested.
+  const size_t expected_size =
+      request.reply_type == DVDInterface::ReplyType::DTK ?
+          request.length / StreamADPCM::ONE_BLOCK_SIZE * StreamADPCM::SAMPLES_PER_BLOCK * 2 *
+              sizeof(s16) :
+          request.length;
+
   DVDInterface::DIInterruptType interrupt;
-  if (buffer.size() != request.length)
+  if (buffer.size() != expected_size)
   {
     PanicAlertFmtT("The disc could not be read (at {0:#x} - {1:#x}).", request.dvd_offset,
                    request.dvd_offset + request.length);
@@ -352,7 +455,13 @@ static void FinishRead(u64 id, s64 cycles_late)
   else
   {
     if (request.copy_to_ram)
-      Memory::CopyToEmu(request.output_address, buffer.data(), request.length);
+    {
+      // Copy whatever the DMAChunk events haven't gotten to (everything, if
+      // the data arrived late or the request was below the chunking threshold).
+      Memory::CopyToEmu(request.output_address + request.dma_progress,
+                        buffer.data() + request.dma_progress,
+                        request.length - request.dma_progress);
+    }
 
     interrupt = DVDInterface::DIInterruptType::TCINT;
   }
@@ -361,6 +470,66 @@ static void FinishRead(u64 id, s64 cycles_late)
   DVDInterface::FinishExecutingCommand(request.reply_type, interrupt, cycles_late, buffer);
 }
 
+// Reads from the readahead buffer when it covers the request, otherwise from
+// the disc. Runs on the DVD thread.
+static bool ReadForRequest(const ReadRequest& request, u8* out)
+{
+  if (!s_readahead_buffer.empty() && request.partition == s_readahead_partition &&
+      request.dvd_offset >= s_readahead_offset &&
+      request.dvd_offset + request.length <= s_readahead_offset + s_readahead_buffer.size())
+  {
+    std::memcpy(out, &s_readahead_buffer[request.dvd_offset - s_readahead_offset], request.length);
+    return true;
+  }
+
+  return s_disc->Read(request.dvd_offset, request.length, out, request.partition);
+}
+
+// Tracks whether requests form a sequential run. Runs on the DVD thread.
+static void UpdateReadaheadHeuristics(const ReadRequest& request)
+{
+  if (request.partition == s_expected_partition && request.dvd_offset == s_expected_next_offset)
+    ++s_sequential_run;
+  else
+    s_sequential_run = 0;
+
+  s_expected_partition = request.partition;
+  s_expected_next_offset = request.dvd_offset + request.length;
+}
+
+// Speculatively extends the readahead buffer past the end of the current
+// sequential run. Only called while the request queue is empty, so at worst
+// a new request waits for one chunk-sized read.
+static void PerformReadahead()
+{
+  if (s_sequential_run < READAHEAD_TRIGGER)
+    return;
+
+  // Restart the buffer if the predicted next offset isn't covered by it.
+  if (s_readahead_buffer.empty() || s_expected_partition != s_readahead_partition ||
+      s_expected_next_offset < s_readahead_offset ||
+      s_expected_next_offset > s_readahead_offset + s_readahead_buffer.size())
+  {
+    s_readahead_partition = s_expected_partition;
+    s_readahead_offset = s_expected_next_offset;
+    s_readahead_buffer.clear();
+  }
+
+  if (s_readahead_buffer.size() >= READAHEAD_MAX_SIZE)
+    return;
+
+  const size_t old_size = s_readahead_buffer.size();
+  s_readahead_buffer.resize(old_size + READAHEAD_CHUNK_SIZE);
+  if (!s_disc->Read(s_readahead_offset + old_size, READAHEAD_CHUNK_SIZE,
+                    &s_readahead_buffer[old_size], s_readahead_partition))
+  {
+    // Probably the end of the partition; stop speculating until the
+    // heuristics trigger again.
+    s_readahead_buffer.resize(old_size);
+    s_sequential_run = 0;
+  }
+}
+
 static void DVDThread()
 {
   Common::SetCurrentThreadName("DVD thread");
@@ -372,14 +541,24 @@ static void DVDThread()
     if (s_dvd_thread_exiting.IsSet())
       return;
 
+    bool serviced_request = false;
     ReadRequest request;
     while (s_request_queue.Pop(request))
     {
+      serviced_request = true;
       FileMonitor::Log(*s_disc, request.partition, request.dvd_offset);
 
       std::vector<u8> buffer(request.length);
-      if (!s_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+      if (!ReadForRequest(request, buffer.data()))
         buffer.resize(0);
+      else if (request.reply_type == DVDInterface::ReplyType::DTK)
+      {
+        // Decode disc audio here instead of on the CPU thread, so the ADPCM decode
+        // doesn't add to CPU thread time on top of the read it just waited for.
+        buffer = DVDInterface::DecodeDTKSamples(buffer);
+      }
+
+      UpdateReadaheadHeuristics(request);
 
       request.realtime_done_us = Common::Timer::GetTimeUs();
 
@@ -389,6 +568,9 @@ static void DVDThread()
       if (s_dvd_thread_exiting.IsSet())
         return;
     }
+
+    if (serviced_request)
+      PerformReadahead();
   }
 }
 }  // namespace DVDThread
@@ -100,5 +100,13 @@ void GCIFile::DoState(PointerWrap& p)
     p.DoPOD<GCMBlock>(*itr);
   }
   p.Do(m_used_blocks);
+
+  if (p.GetMode() == PointerWrap::MODE_READ)
+  {
+    // The restored data may differ from what is on disk, so force the next
+    // flush to rewrite the whole file.
+    m_dirty_blocks.clear();
+    m_on_disk_synced = false;
+  }
 }
 }  // namespace Memcard
@@ -25,6 +25,13 @@ public:
   DEntry m_gci_header;
   std::vector<GCMBlock> m_save_data;
   std::vector<u16> m_used_blocks;
+  // Which entries of m_save_data changed since the last flush, and whether
+  // the file on disk is otherwise a byte-exact image of this save. Both are
+  // maintained by GCMemcardDirectory so flushes can rewrite only the blocks
+  // that changed; they are deliberately not serialized into savestates, so
+  // the first flush after loading a state falls back to a full write.
+  std::vector<u8> m_dirty_blocks;
+  bool m_on_disk_synced = false;
   bool m_dirty;
   std::string m_filename;
 };
@@ -329,16 +329,25 @@ bool GCMemcard::Save()
 static std::pair<u16, u16> CalculateMemcardChecksums(const u8* data, size_t size)
 {
   ASSERT(size % 2 == 0);
-  u16 csum = 0;
-  u16 inv_csum = 0;
 
+  // The checksum is a 16-bit sum of big-endian words, so the bytes at even
+  // and odd offsets can be accumulated independently and combined at the
+  // end; this byte loop vectorizes, unlike the old word-at-a-time version
+  // with its byteswap. The inverted checksum sums d ^ 0xffff = 0xffff - d
+  // per word, so it follows arithmetically from the plain sum and the word
+  // count and needs no second pass.
+  u32 sum_hi = 0;
+  u32 sum_lo = 0;
   for (size_t i = 0; i < size; i += 2)
   {
-    u16 d = Common::swap16(&data[i]);
-    csum += d;
-    inv_csum += static_cast<u16>(d ^ 0xffff);
+    sum_hi += data[i];
+    sum_lo += data[i + 1];
   }
 
+  const u32 sum = sum_hi * 0x100 + sum_lo;
+  u16 csum = static_cast<u16>(sum);
+  u16 inv_csum = static_cast<u16>(static_cast<u32>(size / 2) * 0xffff - sum);
+
   csum = Common::swap16(csum);
   inv_csum = Common::swap16(inv_csum);
 
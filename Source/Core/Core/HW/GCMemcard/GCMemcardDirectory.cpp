@@ -26,6 +26,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
+#include "Common/ThreadPool.h"
 #include "Common/Timer.h"
 
 #include "Core/Config/MainSettings.h"
@@ -167,29 +168,56 @@ GCMemcardDirectory::GCMemcardDirectory(const std::string& directory, int slot,
   const bool current_game_only = Config::Get(Config::SESSION_GCI_FOLDER_CURRENT_GAME_ONLY);
   std::vector<std::string> filenames = Common::DoFileSearch({m_save_directory}, {".gci"});
 
+  // Read and verify all the headers in parallel; folders with a save per
+  // game accumulate hundreds of files, and loading them serially is bound
+  // by per-file disk latency.
+  std::vector<Memcard::GCIFile> gcis(filenames.size());
+  std::vector<u8> header_loaded(filenames.size(), 0);
+  {
+    Common::ThreadPool::WorkGroup work_group(Common::ThreadPool::GetInstance());
+    for (size_t i = 0; i < filenames.size(); ++i)
+    {
+      Memcard::GCIFile& gci = gcis[i];
+      gci.m_filename = filenames[i];
+      gci.m_dirty = false;
+      work_group.Push([&gci, &loaded = header_loaded[i]] { loaded = gci.LoadHeader() ? 1 : 0; });
+    }
+    work_group.Wait();
+  }
+
   // split up into files for current games we should definitely load,
   // and files for other games that we don't care too much about
   std::vector<Memcard::GCIFile> gci_current_game;
   std::vector<Memcard::GCIFile> gci_other_games;
-  for (const std::string& filename : filenames)
+  for (size_t i = 0; i < gcis.size(); ++i)
   {
-    Memcard::GCIFile gci;
-    gci.m_filename = filename;
-    gci.m_dirty = false;
-    if (!gci.LoadHeader())
+    if (!header_loaded[i])
     {
-      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to load header of {}", filename);
+      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to load header of {}", gcis[i].m_filename);
       continue;
     }
 
-    if (m_game_id == Common::swap32(gci.m_gci_header.m_gamecode.data()))
-      gci_current_game.emplace_back(std::move(gci));
+    if (m_game_id == Common::swap32(gcis[i].m_gci_header.m_gamecode.data()))
+      gci_current_game.emplace_back(std::move(gcis[i]));
     else if (!current_game_only)
-      gci_other_games.emplace_back(std::move(gci));
+      gci_other_games.emplace_back(std::move(gcis[i]));
   }
 
   m_saves.reserve(Memcard::DIRLEN);
 
+  // Pull the current game's save data off disk in parallel as well;
+  // LoadSaveBlocks is a no-op for anything already in memory, so LoadGCI
+  // below then only performs the order-dependent BAT assignment.
+  {
+    Common::ThreadPool::WorkGroup work_group(Common::ThreadPool::GetInstance());
+    for (Memcard::GCIFile& gci : gci_current_game)
+    {
+      if (gci.m_gci_header.m_block_count <= 2043)
+        work_group.Push([&gci] { gci.LoadSaveBlocks(); });
+    }
+    work_group.Wait();
+  }
+
   // load files for current game
   size_t failed_loads_current_game = 0;
   for (Memcard::GCIFile& gci : gci_current_game)
@@ -527,6 +555,8 @@ inline s32 GCMemcardDirectory::SaveAreaRW(u32 block, bool writing)
         if (writing)
         {
           m_saves[i].m_dirty = true;
+          m_saves[i].m_dirty_blocks.resize(m_saves[i].m_save_data.size());
+          m_saves[i].m_dirty_blocks[idx] = 1;
         }
 
         m_last_block = block;
@@ -595,20 +625,40 @@ bool GCMemcardDirectory::SetUsedBlocks(int save_index)
 
 void GCMemcardDirectory::FlushToFile()
 {
-  std::unique_lock l(m_write_mutex);
-  int errors = 0;
-  Memcard::DEntry invalid;
-  for (Memcard::GCIFile& save : m_saves)
+  const u64 flush_start_us = Common::Timer::GetTimeUs();
+
+  // Snapshot the dirty saves under the lock and do the actual disk writes
+  // afterwards, so that the EXI thread never blocks on file I/O when it
+  // takes m_write_mutex in the middle of a flush. A save whose file is
+  // already a clean image on disk only has its changed blocks copied out;
+  // everything else gets a full rewrite.
+  struct PendingWrite
+  {
+    size_t save_index;
+    std::string filename;
+    Memcard::DEntry header;
+    bool full_write;
+    std::vector<u16> block_indices;  // entries of blocks, only used for partial writes
+    std::vector<Memcard::GCMBlock> blocks;
+    bool succeeded = false;
+  };
+  std::vector<PendingWrite> pending_writes;
+
   {
-    if (save.m_dirty)
+    std::unique_lock l(m_write_mutex);
+    for (size_t i = 0; i < m_saves.size(); ++i)
     {
+      Memcard::GCIFile& save = m_saves[i];
+      if (!save.m_dirty)
+        continue;
+
       if (save.m_gci_header.m_gamecode != Memcard::DEntry::UNINITIALIZED_GAMECODE)
       {
         save.m_dirty = false;
         if (save.m_save_data.empty())
         {
-          // The save's header has been changed but the actual save blocks haven't been read/written
-          // to
+          // The save's header has been changed but the actual save blocks haven't been
+          // read/written to
           // skip flushing this file until actual save data is modified
           ERROR_LOG_FMT(EXPANSIONINTERFACE,
                         "GCI header modified without corresponding save data changes");
@@ -632,25 +682,30 @@ void GCMemcardDirectory::FlushToFile()
           }
           save.m_filename = default_save_name;
         }
-        File::IOFile gci(save.m_filename, "wb");
-        if (gci)
-        {
-          gci.WriteBytes(&save.m_gci_header, Memcard::DENTRY_SIZE);
-          for (const Memcard::GCMBlock& block : save.m_save_data)
-            gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
 
-          if (gci.IsGood())
-          {
-            Core::DisplayMessage(fmt::format("Wrote save contents to {}", save.m_filename), 4000);
-          }
-          else
+        PendingWrite pending;
+        pending.save_index = i;
+        pending.filename = save.m_filename;
+        pending.header = save.m_gci_header;
+        pending.full_write =
+            !save.m_on_disk_synced || save.m_dirty_blocks.size() != save.m_save_data.size();
+        if (pending.full_write)
+        {
+          pending.blocks = save.m_save_data;
+        }
+        else
+        {
+          for (u16 b = 0; b < save.m_save_data.size(); ++b)
           {
-            ++errors;
-            Core::DisplayMessage(
-                fmt::format("Failed to write save contents to {}", save.m_filename), 4000);
-            ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", save.m_filename);
+            if (save.m_dirty_blocks[b])
+            {
+              pending.block_indices.push_back(b);
+              pending.blocks.push_back(save.m_save_data[b]);
+            }
           }
         }
+        std::fill(save.m_dirty_blocks.begin(), save.m_dirty_blocks.end(), 0);
+        pending_writes.emplace_back(std::move(pending));
       }
       else if (save.m_filename.length() != 0)
       {
@@ -663,6 +718,85 @@ void GCMemcardDirectory::FlushToFile()
         save.m_filename.clear();
         save.m_save_data.clear();
         save.m_used_blocks.clear();
+        save.m_dirty_blocks.clear();
+        save.m_on_disk_synced = false;
+      }
+    }
+
+    // Invalidate the cached block pointer so the next guest write goes
+    // through SaveAreaRW and re-marks its block as dirty.
+    m_last_block = -1;
+    m_last_block_address = nullptr;
+  }
+
+  size_t bytes_written = 0;
+  size_t full_writes = 0;
+  for (PendingWrite& write : pending_writes)
+  {
+    if (write.full_write)
+    {
+      File::IOFile gci(write.filename, "wb");
+      if (gci)
+      {
+        gci.WriteBytes(&write.header, Memcard::DENTRY_SIZE);
+        for (const Memcard::GCMBlock& block : write.blocks)
+          gci.WriteBytes(block.m_block.data(), Memcard::BLOCK_SIZE);
+        write.succeeded = gci.IsGood();
+      }
+      bytes_written += Memcard::DENTRY_SIZE + write.blocks.size() * Memcard::BLOCK_SIZE;
+      ++full_writes;
+    }
+    else
+    {
+      File::IOFile gci(write.filename, "r+b");
+      if (gci)
+      {
+        bool good = gci.WriteBytes(&write.header, Memcard::DENTRY_SIZE);
+        for (size_t b = 0; good && b < write.block_indices.size(); ++b)
+        {
+          good = gci.Seek(Memcard::DENTRY_SIZE +
+                              static_cast<s64>(write.block_indices[b]) * Memcard::BLOCK_SIZE,
+                          SEEK_SET) &&
+                 gci.WriteBytes(write.blocks[b].m_block.data(), Memcard::BLOCK_SIZE);
+        }
+        write.succeeded = good && gci.IsGood();
+      }
+      bytes_written += Memcard::DENTRY_SIZE + write.blocks.size() * Memcard::BLOCK_SIZE;
+    }
+
+    if (write.succeeded)
+    {
+      Core::DisplayMessage(fmt::format("Wrote save contents to {}", write.filename), 4000);
+    }
+    else
+    {
+      Core::DisplayMessage(fmt::format("Failed to write save contents to {}", write.filename),
+                           4000);
+      ERROR_LOG_FMT(EXPANSIONINTERFACE, "Failed to save data to {}", write.filename);
+    }
+  }
+
+  bool any_failed = false;
+  {
+    std::unique_lock l(m_write_mutex);
+    for (const PendingWrite& write : pending_writes)
+    {
+      if (write.save_index >= m_saves.size())
+        continue;
+      Memcard::GCIFile& save = m_saves[write.save_index];
+      if (save.m_filename != write.filename)
+        continue;
+
+      if (write.succeeded)
+      {
+        save.m_on_disk_synced = true;
+      }
+      else
+      {
+        // Re-dirty the save so the next flush retries with a full rewrite.
+        save.m_dirty = true;
+        save.m_on_disk_synced = false;
+        any_failed = true;
       }
     }
 
@@ -671,13 +805,31 @@ void GCMemcardDirectory::FlushToFile()
     // simultaneously
     // this ensures that the save data for all of the current games gci files are stored in the
     // savestate
-    const u32 gamecode = Common::swap32(save.m_gci_header.m_gamecode.data());
-    if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && !save.m_save_data.empty())
+    // This runs after the disk writes so that a save is never reloaded from
+    // a file its own pending flush has not reached yet.
+    for (Memcard::GCIFile& save : m_saves)
     {
-      INFO_LOG_FMT(EXPANSIONINTERFACE, "Flushing savedata to disk for {}", save.m_filename);
-      save.m_save_data.clear();
+      const u32 gamecode = Common::swap32(save.m_gci_header.m_gamecode.data());
+      if (gamecode != m_game_id && gamecode != 0xFFFFFFFF && !save.m_dirty &&
+          !save.m_save_data.empty())
+      {
+        INFO_LOG_FMT(EXPANSIONINTERFACE, "Flushing savedata to disk for {}", save.m_filename);
+        save.m_save_data.clear();
+        save.m_dirty_blocks.clear();
+      }
     }
   }
+
+  if (any_failed)
+    m_flush_trigger.Set();
+
+  if (!pending_writes.empty())
+  {
+    INFO_LOG_FMT(EXPANSIONINTERFACE,
+                 "Flushed {} save file(s) ({} bytes, {} full / {} partial) in {} us",
+                 pending_writes.size(), bytes_written, full_writes,
+                 pending_writes.size() - full_writes, Common::Timer::GetTimeUs() - flush_start_us);
+  }
 #if _WRITE_MC_HEADER
   u8 mc[BLOCK_SIZE * MC_FST_BLOCKS];
   Read(0, BLOCK_SIZE * MC_FST_BLOCKS, mc);
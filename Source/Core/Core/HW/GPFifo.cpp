@@ -3,6 +3,7 @@
 
 #include "Core/HW/GPFifo.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
@@ -69,27 +70,34 @@ void ResetGatherPipe()
 void UpdateGatherPipe()
 {
   size_t pipe_count = GetGatherPipeCount();
-  size_t processed;
-  u8* cur_mem = Memory::GetPointer(ProcessorInterface::Fifo_CPUWritePointer);
-  for (processed = 0; pipe_count >= GATHER_PIPE_SIZE; processed += GATHER_PIPE_SIZE)
+  size_t processed = 0;
+  while (pipe_count >= GATHER_PIPE_SIZE)
   {
-    // copy the GatherPipe
-    memcpy(cur_mem, s_gather_pipe + processed, GATHER_PIPE_SIZE);
-    pipe_count -= GATHER_PIPE_SIZE;
-
-    // increase the CPUWritePointer
-    if (ProcessorInterface::Fifo_CPUWritePointer == ProcessorInterface::Fifo_CPUEnd)
-    {
-      ProcessorInterface::Fifo_CPUWritePointer = ProcessorInterface::Fifo_CPUBase;
-      cur_mem = Memory::GetPointer(ProcessorInterface::Fifo_CPUWritePointer);
-    }
-    else
+    // Copy out all complete bursts up to the point where the FIFO wraps in one go.
+    // The last burst slot is at Fifo_CPUEnd itself, so the run is inclusive of it.
+    const size_t bursts_until_wrap =
+        (ProcessorInterface::Fifo_CPUEnd - ProcessorInterface::Fifo_CPUWritePointer) /
+            GATHER_PIPE_SIZE +
+        1;
+    const size_t bursts = std::min(pipe_count / GATHER_PIPE_SIZE, bursts_until_wrap);
+    u8* cur_mem = Memory::GetPointer(ProcessorInterface::Fifo_CPUWritePointer);
+    memcpy(cur_mem, s_gather_pipe + processed, bursts * GATHER_PIPE_SIZE);
+    processed += bursts * GATHER_PIPE_SIZE;
+    pipe_count -= bursts * GATHER_PIPE_SIZE;
+
+    // The command processor still gets notified once per burst; only the copy is
+    // batched. The data being in memory before the first notification is fine (the
+    // GPU may not read past CPReadWriteDistance, which only grows per notification).
+    for (size_t burst = 0; burst < bursts; burst++)
     {
-      cur_mem += GATHER_PIPE_SIZE;
-      ProcessorInterface::Fifo_CPUWritePointer += GATHER_PIPE_SIZE;
-    }
+      // increase the CPUWritePointer
+      if (ProcessorInterface::Fifo_CPUWritePointer == ProcessorInterface::Fifo_CPUEnd)
+        ProcessorInterface::Fifo_CPUWritePointer = ProcessorInterface::Fifo_CPUBase;
+      else
+        ProcessorInterface::Fifo_CPUWritePointer += GATHER_PIPE_SIZE;
 
-    CommandProcessor::GatherPipeBursted();
+      CommandProcessor::GatherPipeBursted();
+    }
   }
 
   // move back the spill bytes
@@ -26,6 +26,8 @@
 
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 
+#include "VideoCommon/LatencyTracker.h"
+
 namespace SerialInterface
 {
 // SI Interrupt Types
@@ -221,6 +223,14 @@ static USIStatusReg s_status_reg;
 static USIEXIClockCount s_exi_clock_count;
 static std::array<u8, 128> s_si_buffer;
 
+// Whether the game consumed SI data (polled input registers or a direct
+// transfer) since the last device update, and how many updates have skipped
+// the host-side input refresh. Used to avoid refreshing the controller
+// interface at the full poll cadence for games that read at a lower rate;
+// transient scheduling state, deliberately not saved.
+static bool s_si_data_consumed = true;
+static u32 s_polls_since_input_refresh = 0;
+
 static void SetNoResponse(u32 channel)
 {
   // raise the NO RESPONSE error
@@ -293,6 +303,10 @@ static void RunSIBuffer(u64 user_data, s64 cycles_late)
 {
   if (s_com_csr.TSTART)
   {
+    // Direct transfers read device state too, so keep the host-side input
+    // refresh in UpdateDevices armed.
+    s_si_data_consumed = true;
+
     const s32 request_length = ConvertSILengthField(s_com_csr.OUTLNGTH);
     const s32 expected_response_length = ConvertSILengthField(s_com_csr.INLNGTH);
     const std::vector<u8> request_copy(s_si_buffer.data(), s_si_buffer.data() + request_length);
@@ -475,6 +489,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    MMIO::DirectWrite<u32>(&s_channel[i].out.hex));
     mmio->Register(base | (SI_CHANNEL_0_IN_HI + 0xC * i),
                    MMIO::ComplexRead<u32>([i, rdst_bit](u32) {
+                     s_si_data_consumed = true;
                      s_status_reg.hex &= ~(1 << rdst_bit);
                      UpdateInterrupts();
                      return s_channel[i].in_hi.hex;
@@ -482,6 +497,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
                    MMIO::DirectWrite<u32>(&s_channel[i].in_hi.hex));
     mmio->Register(base | (SI_CHANNEL_0_IN_LO + 0xC * i),
                    MMIO::ComplexRead<u32>([i, rdst_bit](u32) {
+                     s_si_data_consumed = true;
                      s_status_reg.hex &= ~(1 << rdst_bit);
                      UpdateInterrupts();
                      return s_channel[i].in_lo.hex;
@@ -652,8 +668,20 @@ void UpdateDevices()
 
   // Update inputs at the rate of SI
   // Typically 120hz but is variable
-  g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::SerialInterface);
-  g_controller_interface.UpdateInput();
+  // Refreshing the host-side devices is the expensive part of a poll
+  // (mapping expressions are re-evaluated for every control), so it is
+  // skipped while the game is not consuming SI data at the poll cadence.
+  // A stale refresh is forced periodically as a safety net so input can
+  // never lag unboundedly behind for exotic read patterns.
+  constexpr u32 MAX_POLLS_WITHOUT_INPUT_REFRESH = 8;
+  if (s_si_data_consumed || ++s_polls_since_input_refresh >= MAX_POLLS_WITHOUT_INPUT_REFRESH)
+  {
+    g_controller_interface.SetCurrentInputChannel(ciface::InputChannel::SerialInterface);
+    g_controller_interface.UpdateInput();
+    LatencyTracker::OnInputPolled();
+    s_si_data_consumed = false;
+    s_polls_since_input_refresh = 0;
+  }
 
   // Update channels and set the status bit if there's new data
   s_status_reg.RDST0 =
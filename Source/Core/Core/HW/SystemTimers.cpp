@@ -44,6 +44,7 @@ IPC_HLE_PERIOD: For the Wii Remote this is the call schedule:
 
 #include "Core/HW/SystemTimers.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
@@ -102,6 +103,10 @@ std::mutex s_emu_to_real_time_mutex;
 // at initialization (or ever), since only the "derivative" of that value really matters.
 u64 s_time_spent_sleeping;
 
+// Running estimate (in us) of how much later than requested SleepCurrentThread wakes us up.
+// Used by the throttle to stop sleeping early and spin the remainder.
+s64 s_sleep_overshoot_estimate;
+
 // DSP/CPU timeslicing.
 void DSPCallback(u64 userdata, s64 cyclesLate)
 {
@@ -114,8 +119,9 @@ void DSPCallback(u64 userdata, s64 cyclesLate)
 void AudioDMACallback(u64 userdata, s64 cyclesLate)
 {
   int period = s_cpu_core_clock / (AudioInterface::GetAIDSampleRate() * 4 / 32);
-  DSP::UpdateAudioDMA();  // Push audio to speakers.
-  CoreTiming::ScheduleEvent(period - cyclesLate, et_AudioDMA);
+  // Push audio to speakers. One event per DMA buffer instead of per 32-byte block.
+  const u32 blocks = DSP::UpdateAudioDMA();
+  CoreTiming::ScheduleEvent(static_cast<s64>(period) * blocks - cyclesLate, et_AudioDMA);
 }
 
 void IPC_HLE_UpdateCallback(u64 userdata, s64 cyclesLate)
@@ -196,7 +202,22 @@ void ThrottleCallback(u64 last_time, s64 cyclesLate)
     }
     else if (diff > 1000)
     {
-      Common::SleepCurrentThread(diff / 1000);
+      // Hybrid wait: sleep coarsely until we are within a safety margin of the deadline, then
+      // spin for the remainder. Integer-millisecond sleeps alone overshoot by 1-2 ms on Windows
+      // timers, which shows up as judder on high-refresh displays. The margin tracks how late
+      // the OS actually wakes us so we don't spin more than necessary.
+      constexpr s64 SPIN_THRESHOLD_US = 500;
+      const s64 sleep_margin = SPIN_THRESHOLD_US + s_sleep_overshoot_estimate;
+      if (diff > sleep_margin + 1000)
+      {
+        const s64 sleep_ms = (diff - sleep_margin) / 1000;
+        Common::SleepCurrentThread(static_cast<u32>(sleep_ms));
+        const s64 overshoot = (Common::Timer::GetTimeUs() - time) - sleep_ms * 1000;
+        s_sleep_overshoot_estimate =
+            std::clamp<s64>((s_sleep_overshoot_estimate * 7 + overshoot) / 8, 0, max_fallback);
+      }
+      while (static_cast<s64>(Common::Timer::GetTimeUs()) < static_cast<s64>(last_time))
+        Common::YieldCPU();
       s_time_spent_sleeping += Common::Timer::GetTimeUs() - time;
     }
   }
@@ -338,6 +359,7 @@ void Init()
     CoreTiming::ScheduleEvent(s_ipc_hle_period, et_IPC_HLE);
 
   s_emu_to_real_time_ring_buffer.fill(0);
+  s_sleep_overshoot_estimate = 0;
 }
 
 void Shutdown()
@@ -21,12 +21,16 @@ void CameraLogic::Reset()
   m_reg_data = {};
 
   m_is_enabled = false;
+  m_last_inputs_valid = false;
 }
 
 void CameraLogic::DoState(PointerWrap& p)
 {
   p.Do(m_reg_data);
 
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    m_last_inputs_valid = false;
+
   // FYI: m_is_enabled is handled elsewhere.
 }
 
@@ -49,11 +53,31 @@ int CameraLogic::BusWrite(u8 slave_addr, u8 addr, int count, const u8* data_in)
   if (!m_is_enabled)
     return 0;
 
+  // Mode and sensitivity changes must trigger a recomputation.
+  m_last_inputs_valid = false;
+
   return RawWrite(&m_reg_data, addr, count, data_in);
 }
 
 void CameraLogic::Update(const Common::Matrix44& transform, Common::Vec2 field_of_view)
 {
+  const bool sensor_bar = static_cast<bool>(IOS::g_gpio_out[IOS::GPIO::SENSOR_BAR]);
+
+  // Register state has not changed since the previous poll (writes clear
+  // m_last_inputs_valid), so if the remaining inputs are also unchanged the
+  // camera data is already correct.
+  if (m_last_inputs_valid && sensor_bar == m_last_sensor_bar &&
+      transform.data == m_last_transform.data && field_of_view.x == m_last_fov.x &&
+      field_of_view.y == m_last_fov.y)
+  {
+    return;
+  }
+
+  m_last_transform = transform;
+  m_last_fov = field_of_view;
+  m_last_sensor_bar = sensor_bar;
+  m_last_inputs_valid = true;
+
   // IR data is read from offset 0x37 on real hardware.
   auto& data = m_reg_data.camera_data;
   data.fill(0xff);
@@ -66,7 +90,7 @@ void CameraLogic::Update(const Common::Matrix44& transform, Common::Vec2 field_o
     return;
 
   // If the sensor bar is off the camera will see no LEDs and return 0xFFs.
-  if (!IOS::g_gpio_out[IOS::GPIO::SENSOR_BAR])
+  if (!sensor_bar)
     return;
 
   using Common::Matrix33;
@@ -87,9 +111,18 @@ void CameraLogic::Update(const Common::Matrix44& transform, Common::Vec2 field_o
       Vec3{SENSOR_BAR_LED_SEPARATION / 2, 0, 0},
   };
 
-  const auto camera_view =
-      Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
-      Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4))) * transform;
+  // The perspective and camera-rotation factors only depend on the field of
+  // view, which practically never changes; rebuild them only when it does.
+  if (!m_prefix_valid || field_of_view.x != m_prefix_fov.x || field_of_view.y != m_prefix_fov.y)
+  {
+    m_camera_prefix =
+        Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
+        Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4)));
+    m_prefix_fov = field_of_view;
+    m_prefix_valid = true;
+  }
+
+  const auto camera_view = m_camera_prefix * transform;
 
   struct CameraPoint
   {
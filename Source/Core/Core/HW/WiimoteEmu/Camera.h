@@ -157,6 +157,20 @@ private:
 
   Register m_reg_data;
 
+  // The camera output is a pure function of Update's arguments, the sensor
+  // bar state and the register contents, so the previous inputs are kept to
+  // skip the reprojection entirely when nothing changed (the common case
+  // for a resting wiimote). Register writes invalidate the cache.
+  // The projection prefix (perspective * camera rotation) only depends on
+  // the field of view and is likewise reused across polls.
+  Common::Matrix44 m_camera_prefix;
+  Common::Vec2 m_prefix_fov;
+  Common::Matrix44 m_last_transform;
+  Common::Vec2 m_last_fov;
+  bool m_last_sensor_bar = false;
+  bool m_last_inputs_valid = false;
+  bool m_prefix_valid = false;
+
   // When disabled the camera does not respond on the bus.
   // Change is triggered by wiimote report 0x13.
   bool m_is_enabled;
@@ -3,12 +3,13 @@
 
 #include "Core/HW/WiimoteEmu/Speaker.h"
 
-#include <memory>
+#include <algorithm>
 
 #include "AudioCommon/AudioCommon.h"
+#include "AudioCommon/Mixer.h"
+#include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
-#include "Common/MathUtil.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/WiimoteEmu/WiimoteEmu.h"
 #include "InputCommon/ControllerEmu/ControlGroup/ControlGroup.h"
@@ -18,58 +19,31 @@
 #ifdef WIIMOTE_SPEAKER_DUMP
 #include <cstdlib>
 #include <fstream>
-#include "AudioCommon/WaveFile.h"
 #include "Common/FileUtil.h"
 #endif
 
 namespace WiimoteEmu
 {
-// Yamaha ADPCM decoder code based on The ffmpeg Project (Copyright (s) 2001-2003)
-
-static const s32 yamaha_difflookup[] = {1,  3,  5,  7,  9,  11,  13,  15,
-                                        -1, -3, -5, -7, -9, -11, -13, -15};
-
-static const s32 yamaha_indexscale[] = {230, 230, 230, 230, 307, 409, 512, 614,
-                                        230, 230, 230, 230, 307, 409, 512, 614};
-
-static s16 av_clip16(s32 a)
-{
-  if ((a + 32768) & ~65535)
-    return (a >> 31) ^ 32767;
-  else
-    return a;
-}
-
-static s32 av_clip(s32 a, s32 amin, s32 amax)
-{
-  if (a < amin)
-    return amin;
-  else if (a > amax)
-    return amax;
-  else
-    return a;
-}
-
-static s16 adpcm_yamaha_expand_nibble(ADPCMState& s, u8 nibble)
-{
-  s.predictor += (s.step * yamaha_difflookup[nibble]) / 8;
-  s.predictor = av_clip16(s.predictor);
-  s.step = (s.step * yamaha_indexscale[nibble]) >> 8;
-  s.step = av_clip(s.step, 127, 24576);
-  return s.predictor;
-}
-
 #ifdef WIIMOTE_SPEAKER_DUMP
 std::ofstream ofile;
-WaveFileWriter wav;
 
-void stopdamnwav()
+void stopdamnbin()
 {
-  wav.Stop();
   ofile.close();
 }
 #endif
 
+// Queues a decoder reset; the decoder itself lives on the audio side.
+static void ResetSpeakerDecoder()
+{
+  if (!g_sound_stream)
+    return;
+
+  Mixer::WiimoteSpeakerReport report;
+  report.reset_decoder = true;
+  g_sound_stream->GetMixer()->PushWiimoteSpeakerReport(report);
+}
+
 void SpeakerLogic::SpeakerData(const u8* data, int length, float speaker_pan)
 {
   // TODO: should we still process samples for the decoder state?
@@ -79,40 +53,26 @@ void SpeakerLogic::SpeakerData(const u8* data, int length, float speaker_pan)
   if (reg_data.sample_rate == 0 || length == 0)
     return;
 
-  // Even if volume is zero we process samples to maintain proper decoder state.
+  Mixer::WiimoteSpeakerReport report;
 
-  // TODO consider using static max size instead of new
-  std::unique_ptr<s16[]> samples(new s16[length * 2]);
-
-  unsigned int sample_rate_dividend, sample_length;
+  unsigned int sample_rate_dividend;
   u8 volume_divisor;
 
   if (reg_data.format == SpeakerLogic::DATA_FORMAT_PCM)
   {
     // 8 bit PCM
-    for (int i = 0; i < length; ++i)
-    {
-      samples[i] = ((s16)(s8)data[i]) * 0x100;
-    }
-
     // Following details from http://wiibrew.org/wiki/Wiimote#Speaker
     sample_rate_dividend = 12000000;
     volume_divisor = 0xff;
-    sample_length = (unsigned int)length;
+    report.is_adpcm = false;
   }
   else if (reg_data.format == SpeakerLogic::DATA_FORMAT_ADPCM)
   {
     // 4 bit Yamaha ADPCM (same as dreamcast)
-    for (int i = 0; i < length; ++i)
-    {
-      samples[i * 2] = adpcm_yamaha_expand_nibble(adpcm_state, (data[i] >> 4) & 0xf);
-      samples[i * 2 + 1] = adpcm_yamaha_expand_nibble(adpcm_state, data[i] & 0xf);
-    }
-
     // Following details from http://wiibrew.org/wiki/Wiimote#Speaker
     sample_rate_dividend = 6000000;
     volume_divisor = 0x7F;
-    sample_length = (unsigned int)length * 2;
+    report.is_adpcm = true;
   }
   else
   {
@@ -144,22 +104,27 @@ void SpeakerLogic::SpeakerData(const u8* data, int length, float speaker_pan)
   g_sound_stream->GetMixer()->SetWiimoteSpeakerVolume(l_volume, r_volume);
 
   // ADPCM sample rate is thought to be x2.(3000 x2 = 6000).
-  const unsigned int sample_rate = sample_rate_dividend / reg_data.sample_rate;
-  g_sound_stream->GetMixer()->PushWiimoteSpeakerSamples(samples.get(), sample_length,
-                                                        sample_rate * 2);
+  report.sample_rate = sample_rate_dividend / reg_data.sample_rate * 2;
+
+  // Even if volume is zero we queue the data so the decoder keeps proper state.
+  // Decoding and resampling happen on the audio thread.
+  for (int offset = 0; offset < length; offset += Mixer::WiimoteSpeakerReport::MAX_DATA_SIZE)
+  {
+    report.length = static_cast<u8>(
+        std::min<int>(length - offset, Mixer::WiimoteSpeakerReport::MAX_DATA_SIZE));
+    std::copy_n(data + offset, report.length, report.data.begin());
+    g_sound_stream->GetMixer()->PushWiimoteSpeakerReport(report);
+  }
 
 #ifdef WIIMOTE_SPEAKER_DUMP
   static int num = 0;
 
   if (num == 0)
   {
-    File::Delete("rmtdump.wav");
     File::Delete("rmtdump.bin");
-    atexit(stopdamnwav);
+    atexit(stopdamnbin);
     File::OpenFStream(ofile, "rmtdump.bin", ofile.binary | ofile.out);
-    wav.Start("rmtdump.wav", 6000);
   }
-  wav.AddMonoSamples(samples.get(), length * 2);
   if (ofile.good())
   {
     for (int i = 0; i < length; i++)
@@ -175,15 +140,17 @@ void SpeakerLogic::Reset()
 {
   reg_data = {};
 
-  // Yamaha ADPCM state initialize
-  adpcm_state.predictor = 0;
-  adpcm_state.step = 127;
+  ResetSpeakerDecoder();
 }
 
 void SpeakerLogic::DoState(PointerWrap& p)
 {
-  p.Do(adpcm_state);
   p.Do(reg_data);
+
+  // The decoder state is not saved; starting it from scratch after a load only
+  // costs a few samples of adaptation.
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    ResetSpeakerDecoder();
 }
 
 int SpeakerLogic::BusRead(u8 slave_addr, u8 addr, int count, u8* data_out)
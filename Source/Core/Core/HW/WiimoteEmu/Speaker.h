@@ -10,11 +10,6 @@
 
 namespace WiimoteEmu
 {
-struct ADPCMState
-{
-  s32 predictor, step;
-};
-
 class Wiimote;
 
 class SpeakerLogic : public I2CSlave
@@ -66,10 +61,6 @@ private:
 
   Register reg_data;
 
-  // TODO: What actions reset this state?
-  // Is this actually in the register somewhere?
-  ADPCMState adpcm_state;
-
   ControllerEmu::SettingValue<double> m_speaker_pan_setting;
 };
 
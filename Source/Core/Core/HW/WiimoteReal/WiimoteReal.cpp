@@ -15,6 +15,7 @@
 #include "Common/IniFile.h"
 #include "Common/Swap.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/HW/Wiimote.h"
@@ -216,7 +217,7 @@ void Wiimote::ResetDataReporting()
 
 void Wiimote::ClearReadQueue()
 {
-  Report rpt;
+  TimestampedReport rpt;
 
   // The "Clear" function isn't thread-safe :/
   while (m_read_reports.Pop(rpt))
@@ -295,7 +296,7 @@ void Wiimote::Read()
 
     // Add it to queue
     rpt.resize(result);
-    m_read_reports.Push(std::move(rpt));
+    m_read_reports.Push(TimestampedReport{std::move(rpt), Common::Timer::GetTimeUs()});
   }
   else if (0 == result)
   {
@@ -411,7 +412,51 @@ static bool IsDataReport(const Report& rpt)
 
 bool Wiimote::GetNextReport(Report* report)
 {
-  return m_read_reports.Pop(*report);
+  TimestampedReport rpt;
+  if (!m_read_reports.Pop(rpt))
+    return false;
+
+  RecordReportLatency(Common::Timer::GetTimeUs() - rpt.arrival_time_us);
+
+  *report = std::move(rpt.report);
+  return true;
+}
+
+void Wiimote::RecordReportLatency(u64 latency_us)
+{
+  constexpr std::array<u64, 5> bucket_limits_us{1000, 2000, 5000, 10000, 20000};
+
+  std::size_t bucket = bucket_limits_us.size();
+  for (std::size_t i = 0; i != bucket_limits_us.size(); ++i)
+  {
+    if (latency_us < bucket_limits_us[i])
+    {
+      bucket = i;
+      break;
+    }
+  }
+  ++m_latency_histogram[bucket];
+  m_latency_max_us = std::max(m_latency_max_us, latency_us);
+
+  // Periodically surface the queue-dwell histogram for latency debugging.
+  constexpr u64 LOG_INTERVAL_US = 5000000;
+  const u64 now_us = Common::Timer::GetTimeUs();
+  if (m_latency_last_log_us == 0)
+  {
+    m_latency_last_log_us = now_us;
+  }
+  else if (now_us - m_latency_last_log_us >= LOG_INTERVAL_US)
+  {
+    INFO_LOG_FMT(WIIMOTE,
+                 "Wii Remote {} report latency (ms): <1: {}, <2: {}, <5: {}, <10: {}, <20: {}, "
+                 ">=20: {}, max {:.1f}",
+                 m_index + 1, m_latency_histogram[0], m_latency_histogram[1],
+                 m_latency_histogram[2], m_latency_histogram[3], m_latency_histogram[4],
+                 m_latency_histogram[5], m_latency_max_us / 1000.0);
+    m_latency_histogram = {};
+    m_latency_max_us = 0;
+    m_latency_last_log_us = now_us;
+  }
 }
 
 // Returns the next report that should be sent
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -142,8 +143,24 @@ private:
   // Triggered when the thread has finished ConnectInternal.
   Common::Event m_thread_ready_event;
 
-  Common::SPSCQueue<Report> m_read_reports;
+  // Input reports are timestamped on arrival so the consumer can measure
+  // how long they sat in the queue.
+  struct TimestampedReport
+  {
+    Report report;
+    u64 arrival_time_us = 0;
+  };
+
+  void RecordReportLatency(u64 latency_us);
+
+  Common::SPSCQueue<TimestampedReport> m_read_reports;
   Common::SPSCQueue<Report> m_write_reports;
+
+  // Queue-dwell latency of consumed reports, bucketed <1/<2/<5/<10/<20/>=20 ms.
+  // Only touched from the consumer side; logged periodically.
+  std::array<u32, 6> m_latency_histogram{};
+  u64 m_latency_max_us = 0;
+  u64 m_latency_last_log_us = 0;
 };
 
 class WiimoteScannerBackend
@@ -1042,6 +1042,34 @@ ReturnCode ESDevice::VerifyContainer(VerifyContainerType type, VerifyMode mode,
   if (!IsIssuerCorrect(type, issuer_cert))
     return ES_EINVAL;
 
+  // If this exact blob has already been verified with these exact certificates,
+  // skip the expensive RSA operations. The cert store update still happens so
+  // behaviour is unchanged, and callers that need an issuer key handle take the
+  // full path since the handle must be recreated anyway.
+  const VerifiedSignatureKey signature_key{type, signed_blob.GetSha1(), issuer_cert.GetSha1(),
+                                           ca_cert.GetSha1()};
+  if (!issuer_handle_out && m_verified_signatures.count(signature_key) != 0)
+  {
+    ReturnCode cached_ret = IPC_SUCCESS;
+    if (mode == VerifyMode::UpdateCertStore)
+    {
+      cached_ret = WriteNewCertToStore(issuer_cert);
+      if (cached_ret != IPC_SUCCESS)
+      {
+        ERROR_LOG_FMT(IOS_ES, "VerifyContainer: Writing the issuer cert failed with return code {}",
+                      cached_ret);
+      }
+
+      cached_ret = WriteNewCertToStore(ca_cert);
+      if (cached_ret != IPC_SUCCESS)
+      {
+        ERROR_LOG_FMT(IOS_ES, "VerifyContainer: Writing the CA cert failed with return code {}",
+                      cached_ret);
+      }
+    }
+    return cached_ret;
+  }
+
   // Verify the whole cert chain using IOSC.
   // IOS assumes that the CA cert will always be signed by the root certificate,
   // and that the issuer is signed by the CA.
@@ -1098,10 +1126,14 @@ ReturnCode ESDevice::VerifyContainer(VerifyContainerType type, VerifyMode mode,
       ERROR_LOG_FMT(IOS_ES, "VerifyContainer: Writing the CA cert failed with return code {}", ret);
   }
 
-  if (ret == IPC_SUCCESS && issuer_handle_out)
+  if (ret == IPC_SUCCESS)
   {
-    *issuer_handle_out = issuer_handle;
-    issuer_guard.Dismiss();
+    m_verified_signatures.insert(signature_key);
+    if (issuer_handle_out)
+    {
+      *issuer_handle_out = issuer_handle;
+      issuer_guard.Dismiss();
+    }
   }
 
   return ret;
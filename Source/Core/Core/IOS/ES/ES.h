@@ -5,7 +5,9 @@
 
 #include <array>
 #include <map>
+#include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -389,5 +391,14 @@ private:
   ContextArray m_contexts;
   TitleContext m_title_context{};
   std::string m_pending_ppc_boot_content_path;
+
+  // Memoized successful signature checks, keyed by the SHA1 of the signed blob
+  // and of the exact certificates that were used to verify it, so a reinstalled
+  // or modified title never matches a stale entry. The Wii Menu and channel
+  // launches re-verify the same TMDs and tickets constantly; the RSA-2048
+  // operations behind each check dominate ES call latency.
+  using VerifiedSignatureKey =
+      std::tuple<VerifyContainerType, std::array<u8, 20>, std::array<u8, 20>, std::array<u8, 20>>;
+  std::set<VerifiedSignatureKey> m_verified_signatures;
 };
 }  // namespace IOS::HLE
@@ -108,7 +108,53 @@ HostFileSystem::HostFileSystem(const std::string& root_path) : m_root_path{root_
   LoadFst();
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  INFO_LOG_FMT(IOS_FS, "Metadata cache: {} stat hits / {} misses, {} readdir hits / {} misses",
+               m_stat_cache_hits, m_stat_cache_misses, m_readdir_cache_hits,
+               m_readdir_cache_misses);
+}
+
+const HostFileSystem::HostStat& HostFileSystem::GetHostStat(const std::string& wii_path)
+{
+  const auto it = m_stat_cache.find(wii_path);
+  if (it != m_stat_cache.end())
+  {
+    ++m_stat_cache_hits;
+    return it->second;
+  }
+
+  ++m_stat_cache_misses;
+  const File::FileInfo info{BuildFilename(wii_path)};
+  HostStat stat;
+  stat.exists = info.Exists();
+  stat.is_file = info.IsFile();
+  stat.size = info.GetSize();
+  return m_stat_cache.emplace(wii_path, stat).first->second;
+}
+
+void HostFileSystem::InvalidateStatCache(const std::string& wii_path)
+{
+  m_stat_cache.erase(wii_path);
+}
+
+void HostFileSystem::InvalidateCachePrefix(const std::string& wii_path)
+{
+  const std::string prefix = wii_path + '/';
+  const auto is_affected = [&](const std::string& path) {
+    return path == wii_path || StringBeginsWith(path, prefix);
+  };
+  for (auto it = m_stat_cache.begin(); it != m_stat_cache.end();)
+    it = is_affected(it->first) ? m_stat_cache.erase(it) : std::next(it);
+  for (auto it = m_readdir_cache.begin(); it != m_readdir_cache.end();)
+    it = is_affected(it->first) ? m_readdir_cache.erase(it) : std::next(it);
+}
+
+void HostFileSystem::ClearMetadataCaches()
+{
+  m_stat_cache.clear();
+  m_readdir_cache.clear();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
@@ -197,14 +243,15 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
   if (!IsValidNonRootPath(path))
     return nullptr;
 
-  const File::FileInfo host_file_info{BuildFilename(path)};
-  if (!host_file_info.Exists())
+  const HostStat& host_stat = GetHostStat(path);
+  if (!host_stat.exists)
     return nullptr;
 
   FstEntry* entry = &m_root_entry;
   std::string complete_path = "";
   for (const std::string& component : SplitString(std::string(path.substr(1)), '/'))
   {
+    const std::string parent_path = complete_path.empty() ? "/" : complete_path;
     complete_path += '/' + component;
     const auto next =
         std::find_if(entry->children.begin(), entry->children.end(), GetNamePredicate(component));
@@ -221,10 +268,12 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
       entry = &entry->children.emplace_back();
       entry->name = component;
       entry->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
+      // The new entry changes the FST-based sort order of its parent's listing.
+      m_readdir_cache.erase(parent_path);
     }
   }
 
-  entry->data.is_file = host_file_info.IsFile();
+  entry->data.is_file = host_stat.is_file;
   if (entry->data.is_file && !entry->children.empty())
   {
     WARN_LOG_FMT(IOS_FS, "{} is a file but also has children; clearing children", path);
@@ -236,6 +285,9 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
 
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  // Loading a state replaces /tmp wholesale, so cached metadata is no longer valid.
+  ClearMetadataCaches();
+
   // Temporarily close the file, to prevent any issues with the savestating of /tmp
   for (Handle& handle : m_handles)
     handle.host_file.reset();
@@ -351,6 +403,7 @@ ResultCode HostFileSystem::Format(Uid uid)
     return ResultCode::UnknownError;
   ResetFst();
   SaveFst();
+  ClearMetadataCaches();
   // Reset and close all handles.
   m_handles = {};
   return ResultCode::Success;
@@ -375,7 +428,7 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   if (!parent->CheckPermission(uid, gid, Mode::Write))
     return ResultCode::AccessDenied;
 
-  if (File::Exists(host_path))
+  if (GetHostStat(path).exists)
     return ResultCode::AlreadyExists;
 
   const bool ok = is_file ? File::CreateEmptyFile(host_path) : File::CreateDir(host_path);
@@ -385,6 +438,9 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
     return ResultCode::UnknownError;
   }
 
+  InvalidateStatCache(path);
+  m_readdir_cache.erase(split_path.parent);
+
   FstEntry* child = GetFstEntryForPath(path);
   *child = {};
   child->name = split_path.file_name;
@@ -438,16 +494,20 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
   if (!parent->CheckPermission(uid, gid, Mode::Write))
     return ResultCode::AccessDenied;
 
-  if (!File::Exists(host_path))
+  const HostStat host_stat = GetHostStat(path);
+  if (!host_stat.exists)
     return ResultCode::NotFound;
 
-  if (File::IsFile(host_path) && !IsFileOpened(path))
+  if (host_stat.is_file && !IsFileOpened(path))
     File::Delete(host_path);
-  else if (File::IsDirectory(host_path) && !IsDirectoryInUse(path))
+  else if (!host_stat.is_file && !IsDirectoryInUse(path))
     File::DeleteDirRecursively(host_path);
   else
     return ResultCode::InUse;
 
+  InvalidateCachePrefix(path);
+  m_readdir_cache.erase(split_path.parent);
+
   const auto it = std::find_if(parent->children.begin(), parent->children.end(),
                                GetNamePredicate(split_path.file_name));
   if (it != parent->children.end())
@@ -495,10 +555,11 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
   const std::string host_new_path = BuildFilename(new_path);
 
   // If there is already something of the same type at the new path, delete it.
-  if (File::Exists(host_new_path))
+  const HostStat new_stat = GetHostStat(new_path);
+  if (new_stat.exists)
   {
-    const bool old_is_file = File::IsFile(host_old_path);
-    const bool new_is_file = File::IsFile(host_new_path);
+    const bool old_is_file = GetHostStat(old_path).is_file;
+    const bool new_is_file = new_stat.is_file;
     if (old_is_file && new_is_file)
       File::Delete(host_new_path);
     else if (!old_is_file && !new_is_file)
@@ -513,6 +574,11 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     return ResultCode::NotFound;
   }
 
+  InvalidateCachePrefix(old_path);
+  InvalidateCachePrefix(new_path);
+  m_readdir_cache.erase(split_old_path.parent);
+  m_readdir_cache.erase(split_new_path.parent);
+
   // Finally, remove the child from the old parent and move it to the new parent.
   FstEntry* new_entry = GetFstEntryForPath(new_path);
   const auto it = std::find_if(old_parent->children.begin(), old_parent->children.end(),
@@ -544,6 +610,14 @@ Result<std::vector<std::string>> HostFileSystem::ReadDirectory(Uid uid, Gid gid,
   if (entry->data.is_file)
     return ResultCode::Invalid;
 
+  const auto cached = m_readdir_cache.find(path);
+  if (cached != m_readdir_cache.end())
+  {
+    ++m_readdir_cache_hits;
+    return cached->second;
+  }
+  ++m_readdir_cache_misses;
+
   const std::string host_path = BuildFilename(path);
   File::FSTEntry host_entry = File::ScanDirectoryTree(host_path, false);
   for (File::FSTEntry& child : host_entry.children)
@@ -584,6 +658,7 @@ Result<std::vector<std::string>> HostFileSystem::ReadDirectory(Uid uid, Gid gid,
   std::vector<std::string> output;
   for (const File::FSTEntry& child : host_entry.children)
     output.emplace_back(child.virtualName);
+  m_readdir_cache.emplace(path, output);
   return output;
 }
 
@@ -612,7 +687,7 @@ Result<Metadata> HostFileSystem::GetMetadata(Uid uid, Gid gid, const std::string
     return ResultCode::NotFound;
 
   Metadata metadata = entry->data;
-  metadata.size = File::GetSize(BuildFilename(path));
+  metadata.size = GetHostStat(path).size;
   return metadata;
 }
 
@@ -631,7 +706,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
   if (caller_uid != 0 && uid != entry->data.uid)
     return ResultCode::AccessDenied;
 
-  const bool is_empty = File::GetSize(BuildFilename(path)) == 0;
+  const bool is_empty = GetHostStat(path).size == 0;
   if (entry->data.uid != uid && entry->data.is_file && !is_empty)
     return ResultCode::FileNotEmpty;
 
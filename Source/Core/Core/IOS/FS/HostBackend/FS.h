@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -95,6 +96,24 @@ private:
   void ResetFst();
   void LoadFst();
   void SaveFst();
+
+  /// Cached result of stat'ing a path on the host filesystem.
+  struct HostStat
+  {
+    bool exists = false;
+    bool is_file = false;
+    u64 size = 0;
+  };
+  /// Returns cached host metadata for a Wii path, stat'ing the host at most
+  /// once per path between invalidations. Games issue IPC requests for the
+  /// same handful of /tmp and save paths thousands of times per second,
+  /// which otherwise turns into a host syscall storm.
+  const HostStat& GetHostStat(const std::string& wii_path);
+  /// Drop the cached metadata for a single path.
+  void InvalidateStatCache(const std::string& wii_path);
+  /// Drop the cached metadata and directory listings for a path and everything under it.
+  void InvalidateCachePrefix(const std::string& wii_path);
+  void ClearMetadataCaches();
   /// Get the FST entry for a file (or directory).
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
@@ -112,6 +131,16 @@ private:
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
+
+  /// Write-through caches of host metadata, keyed by Wii path. The host
+  /// filesystem stays the source of truth: every mutation that goes through
+  /// this backend invalidates the affected entries.
+  std::unordered_map<std::string, HostStat> m_stat_cache;
+  std::unordered_map<std::string, std::vector<std::string>> m_readdir_cache;
+  u32 m_stat_cache_hits = 0;
+  u32 m_stat_cache_misses = 0;
+  u32 m_readdir_cache_hits = 0;
+  u32 m_readdir_cache_misses = 0;
 };
 
 }  // namespace IOS::HLE::FS
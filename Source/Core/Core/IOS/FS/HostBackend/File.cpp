@@ -80,14 +80,14 @@ Result<FileHandle> HostFileSystem::OpenFile(Uid, Gid, const std::string& path, M
   if (!handle)
     return ResultCode::NoFreeHandle;
 
-  const std::string host_path = BuildFilename(path);
-  if (!File::IsFile(host_path))
+  const HostStat& host_stat = GetHostStat(path);
+  if (!host_stat.exists || !host_stat.is_file)
   {
     *handle = Handle{};
     return ResultCode::NotFound;
   }
 
-  handle->host_file = OpenHostFile(host_path);
+  handle->host_file = OpenHostFile(BuildFilename(path));
   if (!handle->host_file)
   {
     *handle = Handle{};
@@ -153,6 +153,9 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
   if (!handle->host_file->WriteBytes(ptr, count))
     return ResultCode::AccessDenied;
 
+  // The write may have grown the file, so any cached size is stale.
+  InvalidateStatCache(handle->wii_path);
+
   handle->file_offset += count;
   return count;
 }
@@ -11,12 +11,14 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/Thread.h"
 #include "Common/Timer.h"
 #include "Core/Boot/DolReader.h"
 #include "Core/Boot/ElfReader.h"
@@ -61,6 +63,7 @@
 namespace IOS::HLE
 {
 static std::unique_ptr<EmulationKernel> s_ios;
+static std::thread s_init_thread;
 
 constexpr u64 ENQUEUE_REQUEST_FLAG = 0x100000000ULL;
 static CoreTiming::EventType* s_event_enqueue;
@@ -893,18 +896,36 @@ void Init()
   DIDevice::s_finish_executing_di_command =
       CoreTiming::RegisterEvent("FinishDICommand", DIDevice::FinishDICommandCallback);
 
-  // Start with IOS80 to simulate part of the Wii boot process.
-  s_ios = std::make_unique<EmulationKernel>(Titles::SYSTEM_MENU_IOS);
-  // On a Wii, boot2 launches the system menu IOS, which then launches the system menu
-  // (which bootstraps the PPC). Bootstrapping the PPC results in memory values being set up.
-  // This means that the constants in the 0x3100 region are always set up by the time
-  // a game is launched. This is necessary because booting games from the game list skips
-  // a significant part of a Wii's boot process.
-  SetupMemory(Titles::SYSTEM_MENU_IOS, MemorySetupType::Full);
+  // Bringing up the kernel is dominated by NAND I/O (creating the directory
+  // structure, scanning installed titles, rewriting SYSCONF), none of which the
+  // rest of hardware or video initialization depends on. Run it on a worker
+  // thread so boot can overlap it with the video backend and DSP bring-up.
+  // The CPU is not running yet, so the devices' constructors cannot schedule
+  // CoreTiming events (see ESDevice::ESDevice), and nothing else touches the
+  // NAND until WaitForInit has been called.
+  s_init_thread = std::thread([] {
+    Common::SetCurrentThreadName("IOS Init");
+
+    // Start with IOS80 to simulate part of the Wii boot process.
+    s_ios = std::make_unique<EmulationKernel>(Titles::SYSTEM_MENU_IOS);
+    // On a Wii, boot2 launches the system menu IOS, which then launches the system menu
+    // (which bootstraps the PPC). Bootstrapping the PPC results in memory values being set up.
+    // This means that the constants in the 0x3100 region are always set up by the time
+    // a game is launched. This is necessary because booting games from the game list skips
+    // a significant part of a Wii's boot process.
+    SetupMemory(Titles::SYSTEM_MENU_IOS, MemorySetupType::Full);
+  });
+}
+
+void WaitForInit()
+{
+  if (s_init_thread.joinable())
+    s_init_thread.join();
 }
 
 void Shutdown()
 {
+  WaitForInit();
   s_ios.reset();
   ESDevice::FinalizeEmulationState();
 }
@@ -191,7 +191,10 @@ public:
 };
 
 // Used for controlling and accessing an IOS instance that is tied to emulation.
+// Init only starts the kernel bring-up (it runs on a worker thread as it is
+// dominated by NAND I/O); WaitForInit must be called before the kernel is used.
 void Init();
+void WaitForInit();
 void Shutdown();
 EmulationKernel* GetIOS();
 
@@ -0,0 +1,219 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/SDIO/SDCardBlockCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+
+namespace IOS::HLE
+{
+SDCardBlockCache::~SDCardBlockCache()
+{
+  Close();
+}
+
+bool SDCardBlockCache::Open(const std::string& path)
+{
+  Close();
+
+  std::lock_guard lock{m_lock};
+  if (!m_file.Open(path, "r+b"))
+    return false;
+
+  m_size = m_file.GetSize();
+  if (m_size == 0)
+  {
+    m_file.Close();
+    return false;
+  }
+
+  m_flush_thread_running.Set();
+  m_flush_thread = std::thread(&SDCardBlockCache::FlushThread, this);
+  return true;
+}
+
+void SDCardBlockCache::Close()
+{
+  if (m_flush_thread.joinable())
+  {
+    m_flush_thread_running.Clear();
+    m_flush_wakeup.Set();
+    m_flush_thread.join();
+  }
+
+  std::lock_guard lock{m_lock};
+  Flush();
+  m_blocks.clear();
+  m_use_counter = 0;
+  m_dirty_count = 0;
+  m_size = 0;
+  m_file.Close();
+}
+
+bool SDCardBlockCache::Read(u64 offset, u64 size, u8* dst)
+{
+  std::lock_guard lock{m_lock};
+  if (offset + size > m_size)
+    return false;
+
+  while (size != 0)
+  {
+    const u64 block_offset = offset % BLOCK_SIZE;
+    const u64 chunk = std::min<u64>(size, BLOCK_SIZE - block_offset);
+
+    CacheBlock* block = GetBlock(offset / BLOCK_SIZE);
+    if (!block)
+      return false;
+
+    std::memcpy(dst, block->data.data() + block_offset, chunk);
+    offset += chunk;
+    dst += chunk;
+    size -= chunk;
+  }
+  return true;
+}
+
+bool SDCardBlockCache::Write(u64 offset, u64 size, const u8* src)
+{
+  std::lock_guard lock{m_lock};
+  if (offset + size > m_size)
+    return false;
+
+  while (size != 0)
+  {
+    const u64 block_offset = offset % BLOCK_SIZE;
+    const u64 chunk = std::min<u64>(size, BLOCK_SIZE - block_offset);
+
+    CacheBlock* block = GetBlock(offset / BLOCK_SIZE);
+    if (!block)
+      return false;
+
+    std::memcpy(block->data.data() + block_offset, src, chunk);
+    if (!block->dirty)
+    {
+      block->dirty = true;
+      ++m_dirty_count;
+    }
+    offset += chunk;
+    src += chunk;
+    size -= chunk;
+  }
+
+  if (m_dirty_count >= DIRTY_WAKE_THRESHOLD)
+    m_flush_wakeup.Set();
+  return true;
+}
+
+void SDCardBlockCache::Flush()
+{
+  for (auto& [index, block] : m_blocks)
+  {
+    if (block.dirty && WriteBackBlock(index, block))
+    {
+      block.dirty = false;
+      --m_dirty_count;
+    }
+  }
+}
+
+SDCardBlockCache::CacheBlock* SDCardBlockCache::GetBlock(u64 block_index)
+{
+  const auto it = m_blocks.find(block_index);
+  if (it != m_blocks.end())
+  {
+    it->second.last_use = ++m_use_counter;
+    return &it->second;
+  }
+
+  if (m_blocks.size() >= MAX_CACHED_BLOCKS)
+    EvictBlock();
+
+  const u64 file_offset = block_index * BLOCK_SIZE;
+  const u64 block_size = std::min<u64>(BLOCK_SIZE, m_size - file_offset);
+
+  CacheBlock block;
+  block.data.resize(block_size);
+  block.last_use = ++m_use_counter;
+  if (!m_file.Seek(file_offset, SEEK_SET) || !m_file.ReadBytes(block.data.data(), block_size))
+  {
+    ERROR_LOG_FMT(IOS_SD, "Failed to read SD image block at {:#x}", file_offset);
+    m_file.Clear();
+    return nullptr;
+  }
+
+  return &m_blocks.emplace(block_index, std::move(block)).first->second;
+}
+
+bool SDCardBlockCache::WriteBackBlock(u64 block_index, CacheBlock& block)
+{
+  const u64 file_offset = block_index * BLOCK_SIZE;
+  if (!m_file.Seek(file_offset, SEEK_SET) ||
+      !m_file.WriteBytes(block.data.data(), block.data.size()))
+  {
+    ERROR_LOG_FMT(IOS_SD, "Failed to write back SD image block at {:#x}", file_offset);
+    m_file.Clear();
+    return false;
+  }
+  return true;
+}
+
+void SDCardBlockCache::EvictBlock()
+{
+  // Prefer evicting a clean block; if everything is dirty, write back the oldest one first.
+  auto victim = m_blocks.end();
+  for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it)
+  {
+    if (it->second.dirty)
+      continue;
+    if (victim == m_blocks.end() || it->second.last_use < victim->second.last_use)
+      victim = it;
+  }
+
+  if (victim == m_blocks.end())
+  {
+    for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it)
+    {
+      if (victim == m_blocks.end() || it->second.last_use < victim->second.last_use)
+        victim = it;
+    }
+    if (WriteBackBlock(victim->first, victim->second))
+      --m_dirty_count;
+  }
+
+  m_blocks.erase(victim);
+}
+
+void SDCardBlockCache::FlushThread()
+{
+  Common::SetCurrentThreadName("SD Flush");
+
+  while (m_flush_thread_running.IsSet())
+  {
+    m_flush_wakeup.WaitFor(std::chrono::seconds(1));
+
+    // Write back one dirty block per lock acquisition so in-flight card commands
+    // never wait behind a full cache flush.
+    while (m_flush_thread_running.IsSet())
+    {
+      std::lock_guard lock{m_lock};
+      if (m_dirty_count == 0)
+        break;
+
+      auto it = std::find_if(m_blocks.begin(), m_blocks.end(),
+                             [](const auto& entry) { return entry.second.dirty; });
+      if (it == m_blocks.end())
+        break;
+
+      if (!WriteBackBlock(it->first, it->second))
+        break;
+      it->second.dirty = false;
+      --m_dirty_count;
+    }
+  }
+}
+}  // namespace IOS::HLE
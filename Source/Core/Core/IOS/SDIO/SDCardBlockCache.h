@@ -0,0 +1,79 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
+#include "Common/IOFile.h"
+
+namespace IOS::HLE
+{
+// Write-back block cache sitting between the emulated SD host controller and the
+// raw card image on disk. Hot blocks are served from memory so that homebrew doing
+// heavy SD I/O doesn't stall the IOS thread on host file accesses; dirty blocks are
+// written back by a background thread (and synchronously on Flush/Close).
+class SDCardBlockCache
+{
+public:
+  SDCardBlockCache() = default;
+  ~SDCardBlockCache();
+
+  SDCardBlockCache(const SDCardBlockCache&) = delete;
+  SDCardBlockCache& operator=(const SDCardBlockCache&) = delete;
+
+  // Flushes and drops any previously cached state before (re)opening the image.
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const { return m_size != 0; }
+  explicit operator bool() const { return IsOpen(); }
+
+  u64 GetSize() const { return m_size; }
+
+  bool Read(u64 offset, u64 size, u8* dst);
+  bool Write(u64 offset, u64 size, const u8* src);
+
+private:
+  // Card data cached per block; 128 KiB keeps the block map small even for 32 GB images.
+  static constexpr u32 BLOCK_SIZE = 0x20000;
+  // Cache ceiling (16 MiB). Beyond this the least recently used block is evicted.
+  static constexpr size_t MAX_CACHED_BLOCKS = 128;
+  // Number of dirty blocks that wakes the write-back thread early.
+  static constexpr size_t DIRTY_WAKE_THRESHOLD = 8;
+
+  struct CacheBlock
+  {
+    std::vector<u8> data;
+    u64 last_use = 0;
+    bool dirty = false;
+  };
+
+  // All private helpers expect m_lock to be held by the caller.
+  void Flush();
+  CacheBlock* GetBlock(u64 block_index);
+  bool WriteBackBlock(u64 block_index, CacheBlock& block);
+  void EvictBlock();
+
+  void FlushThread();
+
+  File::IOFile m_file;
+  u64 m_size = 0;
+
+  std::map<u64, CacheBlock> m_blocks;
+  u64 m_use_counter = 0;
+  size_t m_dirty_count = 0;
+  std::mutex m_lock;
+
+  std::thread m_flush_thread;
+  Common::Event m_flush_wakeup;
+  Common::Flag m_flush_thread_running;
+};
+}  // namespace IOS::HLE
@@ -3,7 +3,6 @@
 
 #include "Core/IOS/SDIO/SDIOSlot0.h"
 
-#include <cstdio>
 #include <cstring>
 #include <memory>
 #include <vector>
@@ -11,7 +10,6 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
-#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/SDCardUtil.h"
 #include "Core/Config/MainSettings.h"
@@ -61,14 +59,14 @@ void SDIOSlot0Device::EventNotify()
 void SDIOSlot0Device::OpenInternal()
 {
   const std::string filename = File::GetUserPath(F_WIISDCARD_IDX);
-  m_card.Open(filename, "r+b");
+  m_card.Open(filename);
   if (!m_card)
   {
     WARN_LOG_FMT(IOS_SD, "Failed to open SD Card image, trying to create a new 128 MB image...");
     if (Common::SDCardCreate(128, filename))
     {
       INFO_LOG_FMT(IOS_SD, "Successfully created {}", filename);
-      m_card.Open(filename, "r+b");
+      m_card.Open(filename);
     }
     if (!m_card)
     {
@@ -251,17 +249,13 @@ s32 SDIOSlot0Device::ExecuteCommand(const Request& request, u32 buffer_in, u32 b
       const u32 size = req.bsize * req.blocks;
       const u64 address = GetAddressFromRequest(req.arg);
 
-      if (!m_card.Seek(address, SEEK_SET))
-        ERROR_LOG_FMT(IOS_SD, "Seek failed WTF");
-
-      if (m_card.ReadBytes(Memory::GetPointer(req.addr), size))
+      if (m_card.Read(address, size, Memory::GetPointer(req.addr)))
       {
         DEBUG_LOG_FMT(IOS_SD, "Outbuffer size {} got {}", rw_buffer_size, size);
       }
       else
       {
-        ERROR_LOG_FMT(IOS_SD, "Read Failed - error: {}, eof: {}", std::ferror(m_card.GetHandle()),
-                      std::feof(m_card.GetHandle()));
+        ERROR_LOG_FMT(IOS_SD, "Failed to read {} bytes at {:#x} from SD image", size, address);
         ret = RET_FAIL;
       }
     }
@@ -282,13 +276,9 @@ s32 SDIOSlot0Device::ExecuteCommand(const Request& request, u32 buffer_in, u32 b
       const u32 size = req.bsize * req.blocks;
       const u64 address = GetAddressFromRequest(req.arg);
 
-      if (!m_card.Seek(address, SEEK_SET))
-        ERROR_LOG_FMT(IOS_SD, "fseeko failed WTF");
-
-      if (!m_card.WriteBytes(Memory::GetPointer(req.addr), size))
+      if (!m_card.Write(address, size, Memory::GetPointer(req.addr)))
       {
-        ERROR_LOG_FMT(IOS_SD, "Write Failed - error: {}, eof: {}", std::ferror(m_card.GetHandle()),
-                      std::feof(m_card.GetHandle()));
+        ERROR_LOG_FMT(IOS_SD, "Failed to write {} bytes at {:#x} to SD image", size, address);
         ret = RET_FAIL;
       }
     }
@@ -9,9 +9,9 @@
 #include <string>
 
 #include "Common/CommonTypes.h"
-#include "Common/IOFile.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/IOS.h"
+#include "Core/IOS/SDIO/SDCardBlockCache.h"
 
 class PointerWrap;
 
@@ -161,6 +161,6 @@ private:
 
   std::array<u32, 0x200 / sizeof(u32)> m_registers;
 
-  File::IOFile m_card;
+  SDCardBlockCache m_card;
 };
 }  // namespace IOS::HLE
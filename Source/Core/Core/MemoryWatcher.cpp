@@ -10,7 +10,6 @@
 #include "Common/FileUtil.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/MemoryWatcher.h"
-#include "Core/PowerPC/MMU.h"
 
 MemoryWatcher::MemoryWatcher()
 {
@@ -20,6 +19,8 @@ MemoryWatcher::MemoryWatcher()
   if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
     return;
   m_running = true;
+  m_frame_hook = FrameHook::AddCallback(
+      [this](const FrameHook::FrameInfo& info) { Step(info.memory); });
 }
 
 MemoryWatcher::~MemoryWatcher()
@@ -27,6 +28,7 @@ MemoryWatcher::~MemoryWatcher()
   if (!m_running)
     return;
 
+  FrameHook::RemoveCallback(m_frame_hook);
   m_running = false;
   close(m_fd);
 }
@@ -42,19 +44,21 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   while (std::getline(locations, line))
     ParseLine(line);
 
-  return !m_values.empty();
+  return !m_watches.empty();
 }
 
 void MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  Watch watch;
+  watch.line = line;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    watch.offsets.push_back(offset);
+
+  m_watches.emplace_back(std::move(watch));
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -66,46 +70,35 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const std::string& line)
-{
-  u32 value = 0;
-  for (u32 offset : m_addresses[line])
-  {
-    value = PowerPC::HostRead_U32(value + offset);
-    if (!PowerPC::HostIsRAMAddress(value))
-      break;
-  }
-  return value;
-}
-
-std::string MemoryWatcher::ComposeMessages()
+std::string MemoryWatcher::ComposeMessages(const FrameHook::MemoryAccess& memory)
 {
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (Watch& watch : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(address);
-    if (new_value != current_value)
+    const u32 new_value = memory.ChasePointer(watch.offsets);
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      watch.value = new_value;
+      message_stream << watch.line << '\n' << new_value << '\n';
     }
   }
 
   return message_stream.str();
 }
 
-void MemoryWatcher::Step()
+void MemoryWatcher::Step(const FrameHook::MemoryAccess& memory)
 {
   if (!m_running)
     return;
 
-  std::string message = ComposeMessages();
+  const std::string message = ComposeMessages(memory);
+  // All changes of a frame go out as one datagram; if nothing changed, skip the syscall.
+  if (message.empty())
+    return;
+
   sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
          sizeof(m_addr));
 }
@@ -3,11 +3,13 @@
 
 #pragma once
 
-#include <map>
+#include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <vector>
 
+#include "Core/FrameHook.h"
+
 // MemoryWatcher reads a file containing in-game memory addresses and outputs
 // changes to those memory addresses to a unix domain socket as the game runs.
 //
@@ -21,23 +23,31 @@ class MemoryWatcher final
 public:
   MemoryWatcher();
   ~MemoryWatcher();
-  void Step();
 
 private:
+  struct Watch
+  {
+    // Address list as written in the file, echoed back on the socket
+    std::string line;
+    // Offsets to follow
+    std::vector<u32> offsets;
+    // Last value sent
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
 
   void ParseLine(const std::string& line);
-  u32 ChasePointer(const std::string& line);
-  std::string ComposeMessages();
+  // Runs as a FrameHook callback on the CPU thread once per frame.
+  void Step(const FrameHook::MemoryAccess& memory);
+  std::string ComposeMessages(const FrameHook::MemoryAccess& memory);
 
   bool m_running = false;
 
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  std::vector<Watch> m_watches;
+  int m_frame_hook = 0;
 };
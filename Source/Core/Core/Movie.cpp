@@ -41,6 +41,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/DSP/DSPCore.h"
+#include "Core/FrameHook.h"
 #include "Core/HW/CPU.h"
 #include "Core/HW/DVD/DVDInterface.h"
 #include "Core/HW/EXI/EXI_DeviceIPL.h"
@@ -60,6 +61,7 @@
 #include "Core/IOS/USB/Bluetooth/BTEmu.h"
 #include "Core/IOS/USB/Bluetooth/WiimoteDevice.h"
 #include "Core/NetPlayProto.h"
+#include "Core/PowerPC/CPUBenchmark.h"
 #include "Core/State.h"
 #include "Core/WiiUtils.h"
 
@@ -205,6 +207,9 @@ void FrameUpdate()
   }
 
   s_bPolled = false;
+
+  CPUBenchmark::FrameUpdate();
+  FrameHook::Execute();
 }
 
 static void CheckMD5();
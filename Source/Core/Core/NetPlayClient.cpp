@@ -53,6 +53,7 @@
 #include "Core/IOS/Uids.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayCommon.h"
+#include "Core/NetPlayRollback.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/SyncIdentifier.h"
 
@@ -384,7 +385,10 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
     packet >> title;
     u64 data_size = Common::PacketReadU64(packet);
 
-    m_chunked_data_receive_queue.emplace(cid, sf::Packet{});
+    ChunkedDataTransfer& transfer = m_chunked_data_receive_queue[cid];
+    transfer.data.resize(static_cast<size_t>(data_size));
+    transfer.received_bytes = 0;
+    transfer.end_received = false;
 
     std::vector<int> players;
     players.push_back(m_local_player->pid);
@@ -397,16 +401,11 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
     u32 cid;
     packet >> cid;
 
-    if (m_chunked_data_receive_queue.count(cid))
+    const auto it = m_chunked_data_receive_queue.find(cid);
+    if (it != m_chunked_data_receive_queue.end())
     {
-      OnData(m_chunked_data_receive_queue[cid]);
-      m_chunked_data_receive_queue.erase(cid);
-      m_dialog->HideChunkedProgressDialog();
-
-      sf::Packet complete_packet;
-      complete_packet << static_cast<MessageId>(NP_MSG_CHUNKED_DATA_COMPLETE);
-      complete_packet << cid;
-      Send(complete_packet, CHUNKED_DATA_CHANNEL);
+      it->second.end_received = true;
+      TryCompleteChunkedData(cid);
     }
   }
   break;
@@ -415,24 +414,39 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
   {
     u32 cid;
     packet >> cid;
+    const u64 offset = Common::PacketReadU64(packet);
 
-    if (m_chunked_data_receive_queue.count(cid))
+    const auto it = m_chunked_data_receive_queue.find(cid);
+    if (it != m_chunked_data_receive_queue.end())
     {
-      while (!packet.endOfPacket())
+      ChunkedDataTransfer& transfer = it->second;
+
+      // Everything after the header is payload.
+      constexpr size_t header_size = sizeof(MessageId) + sizeof(cid) + sizeof(offset);
+      const size_t length =
+          packet.getDataSize() > header_size ? packet.getDataSize() - header_size : 0;
+
+      // Ignore chunks which don't fit in the buffer announced by the start
+      // message; the byte count check will keep the transfer from completing.
+      if (length != 0 && length <= transfer.data.size() &&
+          offset <= transfer.data.size() - length)
       {
-        u8 byte;
-        packet >> byte;
-        m_chunked_data_receive_queue[cid] << byte;
+        std::memcpy(&transfer.data[static_cast<size_t>(offset)],
+                    static_cast<const u8*>(packet.getData()) + header_size, length);
+        transfer.received_bytes += length;
       }
 
-      m_dialog->SetChunkedProgress(m_local_player->pid,
-                                   m_chunked_data_receive_queue[cid].getDataSize());
+      m_dialog->SetChunkedProgress(m_local_player->pid, transfer.received_bytes);
 
       sf::Packet progress_packet;
       progress_packet << static_cast<MessageId>(NP_MSG_CHUNKED_DATA_PROGRESS);
       progress_packet << cid;
-      progress_packet << sf::Uint64{m_chunked_data_receive_queue[cid].getDataSize()};
+      progress_packet << sf::Uint64{transfer.received_bytes};
       Send(progress_packet, CHUNKED_DATA_CHANNEL);
+
+      // Chunks can arrive after the end marker, since the channels are
+      // ordered independently of each other.
+      TryCompleteChunkedData(cid);
     }
   }
   break;
@@ -482,10 +496,27 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
       packet >> map;
 
       GCPadStatus pad;
-      packet >> pad.button >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >>
-          pad.substickX >> pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
+      if (m_host_input_authority)
+      {
+        packet >> pad.button >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >>
+            pad.substickX >> pad.substickY >> pad.triggerLeft >> pad.triggerRight >>
+            pad.isConnected;
+      }
+      else
+      {
+        ReadDeltaPadState(packet, &pad, &m_recv_pad_delta_state.at(map));
+      }
 
       // Trusting server for good map value (>=0 && <4)
+      if (m_rollback_engine)
+      {
+        // The server only relays other players' pads, so everything received
+        // here is a remote input.
+        m_rollback_engine->AddRemoteInput(map, pad);
+        m_gc_pad_event.Set();
+        continue;
+      }
+
       // add to pad buffer
       m_pad_buffer.at(map).Push(pad);
       m_gc_pad_event.Set();
@@ -640,6 +671,11 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
   {
     {
       std::lock_guard lkg(m_crit.game);
+
+      // All pad data for the new game arrives after this message on the same
+      // connection, so this is the safe point to restart the delta streams.
+      m_recv_pad_delta_state.fill(GCPadStatus{});
+
       packet >> m_current_game;
       packet >> m_net_settings.m_CPUthread;
 
@@ -739,6 +775,7 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
 
       packet >> m_net_settings.m_GolfMode;
       packet >> m_net_settings.m_UseFMA;
+      packet >> m_net_settings.m_RollbackMode;
 
       m_net_settings.m_IsHosting = m_local_player->IsHost();
       m_net_settings.m_HostInputAuthority = m_host_input_authority;
@@ -1280,6 +1317,31 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
   return 0;
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayClient::TryCompleteChunkedData(const u32 cid)
+{
+  const auto it = m_chunked_data_receive_queue.find(cid);
+  if (it == m_chunked_data_receive_queue.end())
+    return;
+
+  ChunkedDataTransfer& transfer = it->second;
+  if (!transfer.end_received || transfer.received_bytes < transfer.data.size())
+    return;
+
+  sf::Packet data_packet = AcquirePacket();
+  data_packet.append(transfer.data.data(), transfer.data.size());
+  m_chunked_data_receive_queue.erase(it);
+
+  OnData(data_packet);
+  RecyclePacket(std::move(data_packet));
+  m_dialog->HideChunkedProgressDialog();
+
+  sf::Packet complete_packet;
+  complete_packet << static_cast<MessageId>(NP_MSG_CHUNKED_DATA_COMPLETE);
+  complete_packet << cid;
+  Send(complete_packet, CHUNKED_DATA_CHANNEL);
+}
+
 void NetPlayClient::Send(const sf::Packet& packet, const u8 channel_id)
 {
   ENetPacket* epac =
@@ -1373,20 +1435,24 @@ void NetPlayClient::ThreadFunc()
       {
         auto& e = m_async_queue.Front();
         Send(e.packet, e.channel_id);
+        RecyclePacket(std::move(e.packet));
       }
       m_async_queue.Pop();
     }
     if (net > 0)
     {
-      sf::Packet rpac;
       switch (netEvent.type)
       {
       case ENET_EVENT_TYPE_RECEIVE:
+      {
+        sf::Packet rpac = AcquirePacket();
         rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
         OnData(rpac);
+        RecyclePacket(std::move(rpac));
 
         enet_packet_destroy(netEvent.packet);
         break;
+      }
       case ENET_EVENT_TYPE_DISCONNECT:
         m_dialog->OnConnectionLost();
 
@@ -1492,14 +1558,23 @@ void NetPlayClient::AddPadStateToPacket(const int in_game_pad, const GCPadStatus
                                         sf::Packet& packet)
 {
   packet << static_cast<PadIndex>(in_game_pad);
-  packet << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
-         << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
+  if (m_host_input_authority)
+  {
+    // Host input authority chains can change receivers mid-game (golf mode),
+    // which would desync a delta stream, so the full state is always sent.
+    packet << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
+           << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
+  }
+  else
+  {
+    WriteDeltaPadState(packet, pad, &m_sent_pad_delta_state[in_game_pad]);
+  }
 }
 
 // called from ---CPU--- thread
 void NetPlayClient::SendWiimoteState(const int in_game_pad, const WiimoteInput& nw)
 {
-  sf::Packet packet;
+  sf::Packet packet = AcquirePacket();
   packet << static_cast<MessageId>(NP_MSG_WIIMOTE_DATA);
   packet << static_cast<PadIndex>(in_game_pad);
   packet << static_cast<u8>(nw.report_id);
@@ -1549,6 +1624,17 @@ bool NetPlayClient::StartGame(const std::string& path)
   ClearBuffers();
 
   m_first_pad_status_received.fill(false);
+  m_sent_pad_delta_state.fill(GCPadStatus{});
+
+  m_rollback_engine.reset();
+  if (m_net_settings.m_RollbackMode && !m_host_input_authority)
+  {
+    // Pads that are unmapped or our own never have to be waited on.
+    std::array<bool, 4> pad_is_local{};
+    for (size_t i = 0; i < m_pad_map.size(); i++)
+      pad_is_local[i] = m_pad_map[i] == 0 || m_pad_map[i] == m_local_player->pid;
+    m_rollback_engine = std::make_unique<RollbackEngine>(pad_is_local);
+  }
 
   if (m_dialog->IsRecording())
   {
@@ -1797,9 +1883,28 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     m_wait_on_input_event.Wait();
   }
 
-  if (IsFirstInGamePad(pad_nb) && batching)
+  if (m_rollback_engine && IsFirstInGamePad(pad_nb) && batching)
   {
-    sf::Packet packet;
+    // Stall like lockstep would if a remote pad has fallen further behind than
+    // the rollback window can correct for.
+    while (m_rollback_engine->TooFarAhead())
+    {
+      if (!m_is_running.IsSet())
+        return false;
+
+      m_gc_pad_event.Wait();
+    }
+
+    m_rollback_engine->AdvanceFrame();
+  }
+
+  // Re-simulated frames replay recorded inputs; polling and sending the local
+  // pads again would double them up.
+  const bool resimulating = m_rollback_engine && m_rollback_engine->IsResimulating();
+
+  if (IsFirstInGamePad(pad_nb) && batching && !resimulating)
+  {
+    sf::Packet packet = AcquirePacket();
     packet << static_cast<MessageId>(NP_MSG_PAD_DATA);
 
     bool send_packet = false;
@@ -1816,12 +1921,12 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
       SendPadHostPoll(-1);
   }
 
-  if (!batching)
+  if (!batching && !resimulating)
   {
     int local_pad = InGamePadToLocalPad(pad_nb);
     if (local_pad < 4)
     {
-      sf::Packet packet;
+      sf::Packet packet = AcquirePacket();
       packet << static_cast<MessageId>(NP_MSG_PAD_DATA);
       if (PollLocalPad(local_pad, packet))
         SendAsync(std::move(packet));
@@ -1858,21 +1963,34 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
     }
   }
 
-  // Now, we either use the data pushed earlier, or wait for the
-  // other clients to send it to us
-  while (m_pad_buffer[pad_nb].Size() == 0)
+  if (m_rollback_engine)
   {
-    if (!m_is_running.IsSet())
+    // No waiting: the engine returns the confirmed input when it has arrived,
+    // and a prediction (corrected later by a rollback) otherwise.
+    *pad_status = m_rollback_engine->GetInput(pad_nb);
+  }
+  else
+  {
+    // Now, we either use the data pushed earlier, or wait for the
+    // other clients to send it to us
+    while (m_pad_buffer[pad_nb].Size() == 0)
     {
-      return false;
+      if (!m_is_running.IsSet())
+      {
+        return false;
+      }
+
+      m_gc_pad_event.Wait();
     }
 
-    m_gc_pad_event.Wait();
+    m_pad_buffer[pad_nb].Pop(*pad_status);
   }
 
-  m_pad_buffer[pad_nb].Pop(*pad_status);
-
-  if (Movie::IsRecordingInput())
+  if (resimulating)
+  {
+    // Re-simulated inputs were already recorded the first time around.
+  }
+  else if (Movie::IsRecordingInput())
   {
     Movie::RecordInput(pad_status, pad_nb);
     Movie::InputUpdate();
@@ -1999,6 +2117,14 @@ bool NetPlayClient::PollLocalPad(const int local_pad, sf::Packet& packet)
       m_first_pad_status_received[ingame_pad] = true;
     }
   }
+  else if (m_rollback_engine)
+  {
+    // No buffering: the local input is confirmed for the current frame and
+    // sent to the other players right away.
+    m_rollback_engine->AddLocalInput(ingame_pad, pad_status);
+    AddPadStateToPacket(ingame_pad, pad_status, packet);
+    data_added = true;
+  }
   else
   {
     // adjust the buffer either up or down
@@ -2034,7 +2160,7 @@ void NetPlayClient::SendPadHostPoll(const PadIndex pad_num)
   if (m_local_player->pid != m_current_golfer)
     return;
 
-  sf::Packet packet;
+  sf::Packet packet = AcquirePacket();
   packet << static_cast<MessageId>(NP_MSG_PAD_HOST_DATA);
 
   if (pad_num < 0)
@@ -30,6 +30,8 @@ class GameFile;
 
 namespace NetPlay
 {
+class RollbackEngine;
+
 class NetPlayUI
 {
 public:
@@ -167,9 +169,20 @@ protected:
   std::array<Common::SPSCQueue<GCPadStatus>, 4> m_pad_buffer;
   std::array<Common::SPSCQueue<WiimoteInput>, 4> m_wiimote_buffer;
 
+  // Only allocated in rollback mode; replaces the pad buffer for GC pads.
+  // Recreated on every game start; kept alive at game end because the CPU
+  // thread may still be in a poll while the netplay thread handles the stop.
+  std::unique_ptr<RollbackEngine> m_rollback_engine;
+
   std::array<GCPadStatus, 4> m_last_pad_status{};
   std::array<bool, 4> m_first_pad_status_received{};
 
+  // Reference states for delta-encoded pad packets (not used with host input
+  // authority). Sent states are touched by the CPU thread, received states by
+  // the ENet thread.
+  std::array<GCPadStatus, 4> m_sent_pad_delta_state{};
+  std::array<GCPadStatus, 4> m_recv_pad_delta_state{};
+
   std::chrono::time_point<std::chrono::steady_clock> m_buffer_under_target_last;
 
   NetPlayUI* m_dialog = nullptr;
@@ -228,6 +241,7 @@ private:
   void AddPadStateToPacket(int in_game_pad, const GCPadStatus& np, sf::Packet& packet);
   void SendWiimoteState(int in_game_pad, const WiimoteInput& nw);
   unsigned int OnData(sf::Packet& packet);
+  void TryCompleteChunkedData(u32 cid);
   void Send(const sf::Packet& packet, u8 channel_id = DEFAULT_CHANNEL);
   void Disconnect();
   bool Connect();
@@ -259,7 +273,17 @@ private:
   u16 m_sync_ar_codes_count = 0;
   u16 m_sync_ar_codes_success_count = 0;
   bool m_sync_ar_codes_complete = false;
-  std::unordered_map<u32, sf::Packet> m_chunked_data_receive_queue;
+  // An in-flight chunked data transfer. Payload chunks are striped across
+  // several channels and carry explicit offsets, so they can arrive out of
+  // order; the transfer is complete once the end marker and all bytes have
+  // arrived.
+  struct ChunkedDataTransfer
+  {
+    std::vector<u8> data;
+    u64 received_bytes = 0;
+    bool end_received = false;
+  };
+  std::unordered_map<u32, ChunkedDataTransfer> m_chunked_data_receive_queue;
 
   u64 m_initial_rtc = 0;
   u32 m_timebase_frame = 0;
@@ -3,17 +3,54 @@
 
 #include "Core/NetPlayCommon.h"
 
-#include <lzo/lzo1x.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include <zstd.h>
 
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
+#include "Common/ThreadPool.h"
+#include "InputCommon/GCPadStatus.h"
 
 namespace NetPlay
 {
-constexpr u32 LZO_IN_LEN = 1024 * 64;
-constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
+// Payloads are cut into independently compressed chunks so the chunks can be
+// compressed on the thread pool in parallel. Larger chunks give zstd more
+// context (better ratio), at the cost of parallel granularity.
+constexpr u64 COMPRESSION_CHUNK_SIZE = 1024 * 1024;
+constexpr int COMPRESSION_LEVEL = 5;
+
+// Enough for every in-flight packet of a full lobby during an input storm;
+// anything beyond this just gets freed normally.
+constexpr size_t PACKET_POOL_MAX_SIZE = 32;
+
+static std::mutex s_packet_pool_mutex;
+static std::vector<sf::Packet> s_packet_pool;
+
+sf::Packet AcquirePacket()
+{
+  std::lock_guard lk(s_packet_pool_mutex);
+  if (s_packet_pool.empty())
+    return sf::Packet{};
+
+  sf::Packet packet = std::move(s_packet_pool.back());
+  s_packet_pool.pop_back();
+  return packet;
+}
+
+void RecyclePacket(sf::Packet&& packet)
+{
+  // clear() keeps the internal buffer's capacity.
+  packet.clear();
+
+  std::lock_guard lk(s_packet_pool_mutex);
+  if (s_packet_pool.size() < PACKET_POOL_MAX_SIZE)
+    s_packet_pool.push_back(std::move(packet));
+}
 
 bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
 {
@@ -24,64 +61,14 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
     return false;
   }
 
-  const sf::Uint64 size = file.GetSize();
-  packet << size;
-
-  if (size == 0)
-    return true;
-
-  std::vector<u8> in_buffer(LZO_IN_LEN);
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
-
-  lzo_uint i = 0;
-  while (true)
+  std::vector<u8> file_data(file.GetSize());
+  if (!file_data.empty() && !file.ReadBytes(file_data.data(), file_data.size()))
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
-
-    if (cur_len <= 0)
-      break;  // EOF
-
-    if (!file.ReadBytes(in_buffer.data(), cur_len))
-    {
-      PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
-      return false;
-    }
-
-    if (lzo1x_1_compress(in_buffer.data(), cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
-    }
-
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
-
-    if (cur_len != LZO_IN_LEN)
-      break;
-
-    i += cur_len;
+    PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
+    return false;
   }
 
-  // Mark end of data
-  packet << static_cast<u32>(0);
-
-  return true;
+  return CompressBufferIntoPacket(file_data, packet);
 }
 
 bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet)
@@ -92,45 +79,43 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
   if (size == 0)
     return true;
 
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+  const size_t num_chunks = static_cast<size_t>((size + COMPRESSION_CHUNK_SIZE - 1) /
+                                                COMPRESSION_CHUNK_SIZE);
+  std::vector<std::vector<u8>> compressed_chunks(num_chunks);
+  std::atomic<bool> error{false};
 
-  lzo_uint i = 0;
-  while (true)
+  Common::ThreadPool::WorkGroup group(Common::ThreadPool::GetInstance());
+  for (size_t chunk = 0; chunk < num_chunks; chunk++)
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
-
-    if (cur_len <= 0)
-      break;  // end of buffer
-
-    if (lzo1x_1_compress(&in_buffer[i], cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
-    }
-
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    group.Push([&, chunk] {
+      const u64 offset = chunk * COMPRESSION_CHUNK_SIZE;
+      const size_t chunk_len =
+          static_cast<size_t>(std::min<u64>(COMPRESSION_CHUNK_SIZE, size - offset));
+
+      std::vector<u8>& out_buffer = compressed_chunks[chunk];
+      out_buffer.resize(ZSTD_compressBound(chunk_len));
+      const size_t out_len = ZSTD_compress(out_buffer.data(), out_buffer.size(),
+                                           &in_buffer[offset], chunk_len, COMPRESSION_LEVEL);
+      if (ZSTD_isError(out_len))
+      {
+        error.store(true, std::memory_order_relaxed);
+        return;
+      }
+      out_buffer.resize(out_len);
+    });
+  }
+  group.Wait();
 
-    if (cur_len != LZO_IN_LEN)
-      break;
+  if (error.load(std::memory_order_relaxed))
+  {
+    PanicAlertFmtT("Internal zstd error - compression failed");
+    return false;
+  }
 
-    i += cur_len;
+  for (const std::vector<u8>& out_buffer : compressed_chunks)
+  {
+    packet << static_cast<u32>(out_buffer.size());
+    packet.append(out_buffer.data(), out_buffer.size());
   }
 
   // Mark end of data
@@ -153,27 +138,32 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
     return false;
   }
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-  std::vector<u8> out_buffer(LZO_IN_LEN);
+  std::vector<u8> in_buffer;
+  std::vector<u8> out_buffer(
+      static_cast<size_t>(std::min<u64>(COMPRESSION_CHUNK_SIZE, file_size)));
 
+  u64 i = 0;
   while (true)
   {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
+    u32 cur_len = 0;  // number of bytes to read
 
     packet >> cur_len;
     if (!cur_len)
       break;  // We reached the end of the data stream
 
+    in_buffer.resize(cur_len);
     for (size_t j = 0; j < cur_len; j++)
     {
       packet >> in_buffer[j];
     }
 
-    if (lzo1x_decompress(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
-        LZO_E_OK)
+    const size_t expected_len = static_cast<size_t>(
+        std::min<u64>(COMPRESSION_CHUNK_SIZE, i < file_size ? file_size - i : 0));
+    const size_t new_len =
+        ZSTD_decompress(out_buffer.data(), expected_len, in_buffer.data(), cur_len);
+    if (ZSTD_isError(new_len) || new_len != expected_len)
     {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
+      PanicAlertFmtT("Internal zstd error - decompression failed");
       return false;
     }
 
@@ -182,6 +172,8 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
       PanicAlertFmtT("Error writing file: {0}", file_path);
       return false;
     }
+
+    i += new_len;
   }
 
   return true;
@@ -196,26 +188,30 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
   if (size == 0)
     return out_buffer;
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
+  std::vector<u8> in_buffer;
 
-  lzo_uint i = 0;
+  u64 i = 0;
   while (true)
   {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
+    u32 cur_len = 0;  // number of bytes to read
 
     packet >> cur_len;
     if (!cur_len)
       break;  // We reached the end of the data stream
 
+    in_buffer.resize(cur_len);
     for (size_t j = 0; j < cur_len; j++)
     {
       packet >> in_buffer[j];
     }
 
-    if (lzo1x_decompress(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) != LZO_E_OK)
+    const size_t expected_len =
+        static_cast<size_t>(std::min<u64>(COMPRESSION_CHUNK_SIZE, i < size ? size - i : 0));
+    const size_t new_len =
+        ZSTD_decompress(out_buffer.data() + i, expected_len, in_buffer.data(), cur_len);
+    if (ZSTD_isError(new_len) || new_len != expected_len)
     {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
+      PanicAlertFmtT("Internal zstd error - decompression failed");
       return {};
     }
 
@@ -224,4 +220,101 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
 
   return out_buffer;
 }
+
+namespace
+{
+enum : u16
+{
+  DELTA_BUTTON = 0x001,
+  DELTA_ANALOG_A = 0x002,
+  DELTA_ANALOG_B = 0x004,
+  DELTA_STICK_X = 0x008,
+  DELTA_STICK_Y = 0x010,
+  DELTA_SUBSTICK_X = 0x020,
+  DELTA_SUBSTICK_Y = 0x040,
+  DELTA_TRIGGER_LEFT = 0x080,
+  DELTA_TRIGGER_RIGHT = 0x100,
+  DELTA_IS_CONNECTED = 0x200,
+};
+}  // namespace
+
+void WriteDeltaPadState(sf::Packet& packet, const GCPadStatus& pad, GCPadStatus* last)
+{
+  u16 flags = 0;
+  if (pad.button != last->button)
+    flags |= DELTA_BUTTON;
+  if (pad.analogA != last->analogA)
+    flags |= DELTA_ANALOG_A;
+  if (pad.analogB != last->analogB)
+    flags |= DELTA_ANALOG_B;
+  if (pad.stickX != last->stickX)
+    flags |= DELTA_STICK_X;
+  if (pad.stickY != last->stickY)
+    flags |= DELTA_STICK_Y;
+  if (pad.substickX != last->substickX)
+    flags |= DELTA_SUBSTICK_X;
+  if (pad.substickY != last->substickY)
+    flags |= DELTA_SUBSTICK_Y;
+  if (pad.triggerLeft != last->triggerLeft)
+    flags |= DELTA_TRIGGER_LEFT;
+  if (pad.triggerRight != last->triggerRight)
+    flags |= DELTA_TRIGGER_RIGHT;
+  if (pad.isConnected != last->isConnected)
+    flags |= DELTA_IS_CONNECTED;
+
+  packet << flags;
+  if (flags & DELTA_BUTTON)
+    packet << pad.button;
+  if (flags & DELTA_ANALOG_A)
+    packet << pad.analogA;
+  if (flags & DELTA_ANALOG_B)
+    packet << pad.analogB;
+  if (flags & DELTA_STICK_X)
+    packet << pad.stickX;
+  if (flags & DELTA_STICK_Y)
+    packet << pad.stickY;
+  if (flags & DELTA_SUBSTICK_X)
+    packet << pad.substickX;
+  if (flags & DELTA_SUBSTICK_Y)
+    packet << pad.substickY;
+  if (flags & DELTA_TRIGGER_LEFT)
+    packet << pad.triggerLeft;
+  if (flags & DELTA_TRIGGER_RIGHT)
+    packet << pad.triggerRight;
+  if (flags & DELTA_IS_CONNECTED)
+    packet << pad.isConnected;
+
+  *last = pad;
+}
+
+void ReadDeltaPadState(sf::Packet& packet, GCPadStatus* pad, GCPadStatus* last)
+{
+  u16 flags = 0;
+  packet >> flags;
+
+  GCPadStatus status = *last;
+  if (flags & DELTA_BUTTON)
+    packet >> status.button;
+  if (flags & DELTA_ANALOG_A)
+    packet >> status.analogA;
+  if (flags & DELTA_ANALOG_B)
+    packet >> status.analogB;
+  if (flags & DELTA_STICK_X)
+    packet >> status.stickX;
+  if (flags & DELTA_STICK_Y)
+    packet >> status.stickY;
+  if (flags & DELTA_SUBSTICK_X)
+    packet >> status.substickX;
+  if (flags & DELTA_SUBSTICK_Y)
+    packet >> status.substickY;
+  if (flags & DELTA_TRIGGER_LEFT)
+    packet >> status.triggerLeft;
+  if (flags & DELTA_TRIGGER_RIGHT)
+    packet >> status.triggerRight;
+  if (flags & DELTA_IS_CONNECTED)
+    packet >> status.isConnected;
+
+  *last = status;
+  *pad = status;
+}
 }  // namespace NetPlay
@@ -12,10 +12,27 @@
 
 #include "Common/CommonTypes.h"
 
+struct GCPadStatus;
+
 namespace NetPlay
 {
+// Reusable buffers for high-rate messages (pad data every poll, chunked data
+// transfers). sf::Packet keeps its buffer capacity across clear(), so cycling
+// packets through this pool avoids the per-message allocation churn that input
+// storms otherwise cause. Rare control messages can keep constructing
+// sf::Packet directly.
+sf::Packet AcquirePacket();
+void RecyclePacket(sf::Packet&& packet);
+
 bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet);
 bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet);
 bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
 std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+
+// Delta codec for pad status packets. Most polls repeat the previous state, so
+// only a field-change bitmask and the changed fields go on the wire. Both ends
+// of a connection must feed the same sequence of packets through the same
+// *last state (and reset it between games) for the deltas to stay in sync.
+void WriteDeltaPadState(sf::Packet& packet, const GCPadStatus& pad, GCPadStatus* last);
+void ReadDeltaPadState(sf::Packet& packet, GCPadStatus* pad, GCPadStatus* last);
 }  // namespace NetPlay
@@ -97,6 +97,7 @@ struct NetSettings
   std::array<int, 4> m_WiimoteExtension;
   bool m_GolfMode;
   bool m_UseFMA;
+  bool m_RollbackMode;
 
   // These aren't sent over the network directly
   bool m_IsHosting;
@@ -208,11 +209,18 @@ enum
 constexpr u32 MAX_NAME_LENGTH = 30;
 constexpr size_t CHUNKED_DATA_UNIT_SIZE = 16384;
 
+// Each ENet channel has an independent reliable window of at most 64 KiB, so
+// one channel caps chunked data throughput at roughly window/RTT. Payload
+// chunks carry their byte offset and are striped round-robin across this many
+// channels, multiplying the amount of data in flight on high-latency links.
+// ENet still handles retransmission and per-channel ordering.
+constexpr u8 CHUNKED_DATA_CHANNEL_COUNT = 4;
+
 enum : u8
 {
   DEFAULT_CHANNEL,
   CHUNKED_DATA_CHANNEL,
-  CHANNEL_COUNT
+  CHANNEL_COUNT = CHUNKED_DATA_CHANNEL + CHUNKED_DATA_CHANNEL_COUNT
 };
 
 struct WiimoteInput
@@ -0,0 +1,261 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/NetPlayRollback.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "AudioCommon/AudioCommon.h"
+#include "Common/Logging/Log.h"
+#include "Core/ConfigManager.h"
+#include "Core/State.h"
+
+namespace NetPlay
+{
+// Refreshing the delta base costs a full state serialization, so it only
+// happens every few frames; in between, deltas just grow slightly.
+constexpr u32 SNAPSHOT_BASE_INTERVAL = 16;
+
+constexpr u32 NO_MISPREDICTION = std::numeric_limits<u32>::max();
+
+static GCPadStatus NeutralPadStatus()
+{
+  GCPadStatus pad = {};
+  pad.stickX = GCPadStatus::MAIN_STICK_CENTER_X;
+  pad.stickY = GCPadStatus::MAIN_STICK_CENTER_Y;
+  pad.substickX = GCPadStatus::C_STICK_CENTER_X;
+  pad.substickY = GCPadStatus::C_STICK_CENTER_Y;
+  pad.isConnected = true;
+  return pad;
+}
+
+static bool PadStatusEqual(const GCPadStatus& a, const GCPadStatus& b)
+{
+  return a.button == b.button && a.stickX == b.stickX && a.stickY == b.stickY &&
+         a.substickX == b.substickX && a.substickY == b.substickY &&
+         a.triggerLeft == b.triggerLeft && a.triggerRight == b.triggerRight &&
+         a.analogA == b.analogA && a.analogB == b.analogB && a.isConnected == b.isConnected;
+}
+
+RollbackEngine::RollbackEngine(const std::array<bool, 4>& pad_is_local)
+    : m_pad_is_local(pad_is_local), m_first_mispredicted_frame(NO_MISPREDICTION)
+{
+  for (PadHistory& pad : m_pads)
+    pad.last_confirmed = NeutralPadStatus();
+}
+
+RollbackEngine::~RollbackEngine()
+{
+  if (m_resimulating)
+    EndResimulation();
+}
+
+void RollbackEngine::AdvanceFrame()
+{
+  if (!m_started)
+  {
+    m_started = true;
+    CaptureSnapshot();
+    return;
+  }
+
+  if (m_resimulating)
+  {
+    m_current_frame++;
+    if (m_current_frame >= m_resimulation_target)
+      EndResimulation();
+    CaptureSnapshot();
+    return;
+  }
+
+  const u32 first_bad_frame = TakeFirstMispredictedFrame();
+  if (first_bad_frame <= m_current_frame && RestoreSnapshot(first_bad_frame))
+    BeginResimulation(first_bad_frame);
+  else
+    m_current_frame++;
+
+  CaptureSnapshot();
+}
+
+bool RollbackEngine::TooFarAhead() const
+{
+  std::lock_guard lk(m_input_mutex);
+  for (size_t i = 0; i < m_pads.size(); i++)
+  {
+    if (m_pad_is_local[i])
+      continue;
+
+    const PadHistory& history = m_pads[i];
+    const u32 confirmed_end = history.first_frame + static_cast<u32>(history.confirmed.size());
+    if (m_current_frame + 1 >= confirmed_end + MAX_ROLLBACK_FRAMES)
+      return true;
+  }
+  return false;
+}
+
+GCPadStatus RollbackEngine::GetInput(const int pad)
+{
+  std::lock_guard lk(m_input_mutex);
+  PadHistory& history = m_pads[pad];
+
+  if (m_current_frame >= history.first_frame)
+  {
+    const size_t index = m_current_frame - history.first_frame;
+    if (index < history.confirmed.size())
+      return history.confirmed[index];
+  }
+
+  // Not confirmed yet: predict by repeating the last confirmed input. If this
+  // frame was already polled (e.g. an extra MMIO poll), repeat the recorded
+  // prediction instead of taking a new one.
+  if (!history.predictions.empty() && history.predictions.back().first == m_current_frame)
+    return history.predictions.back().second;
+
+  history.predictions.emplace_back(m_current_frame, history.last_confirmed);
+  return history.last_confirmed;
+}
+
+void RollbackEngine::AddLocalInput(const int pad, const GCPadStatus& status)
+{
+  std::lock_guard lk(m_input_mutex);
+  PadHistory& history = m_pads[pad];
+
+  // Re-simulated frames already have their local inputs.
+  const u32 next_frame = history.first_frame + static_cast<u32>(history.confirmed.size());
+  if (next_frame > m_current_frame)
+    return;
+
+  history.confirmed.push_back(status);
+  history.last_confirmed = status;
+}
+
+void RollbackEngine::AddRemoteInput(const int pad, const GCPadStatus& status)
+{
+  std::lock_guard lk(m_input_mutex);
+  PadHistory& history = m_pads[pad];
+
+  const u32 frame = history.first_frame + static_cast<u32>(history.confirmed.size());
+  history.confirmed.push_back(status);
+  history.last_confirmed = status;
+
+  while (!history.predictions.empty() && history.predictions.front().first < frame)
+    history.predictions.pop_front();
+  if (!history.predictions.empty() && history.predictions.front().first == frame)
+  {
+    if (!PadStatusEqual(history.predictions.front().second, status))
+      m_first_mispredicted_frame = std::min(m_first_mispredicted_frame, frame);
+    history.predictions.pop_front();
+  }
+}
+
+u32 RollbackEngine::TakeFirstMispredictedFrame()
+{
+  std::lock_guard lk(m_input_mutex);
+  const u32 frame = m_first_mispredicted_frame;
+  m_first_mispredicted_frame = NO_MISPREDICTION;
+  return frame;
+}
+
+void RollbackEngine::CaptureSnapshot()
+{
+  // After a rollback the snapshots past the restored frame describe a
+  // simulation that never happened; this frame's snapshot replaces them.
+  while (!m_snapshots.empty() && m_snapshots.back().frame >= m_current_frame)
+    m_snapshots.pop_back();
+
+  Snapshot snapshot;
+  snapshot.frame = m_current_frame;
+  if (!m_snapshot_base || m_frames_since_base >= SNAPSHOT_BASE_INTERVAL)
+  {
+    auto base = std::make_shared<std::vector<u8>>();
+    State::SaveToBuffer(*base);
+    m_snapshot_base = std::move(base);
+    m_frames_since_base = 0;
+  }
+  else
+  {
+    // The base does not have to belong to any particular frame: the delta is a
+    // plain page diff, so applying it to its base always reproduces this frame.
+    State::SaveDeltaToBuffer(*m_snapshot_base, snapshot.delta);
+    m_frames_since_base++;
+  }
+  snapshot.base = m_snapshot_base;
+  m_snapshots.push_back(std::move(snapshot));
+
+  while (!m_snapshots.empty() && m_snapshots.front().frame + MAX_ROLLBACK_FRAMES < m_current_frame)
+    m_snapshots.pop_front();
+
+  // Inputs older than any possible rollback target can go as well.
+  std::lock_guard lk(m_input_mutex);
+  for (PadHistory& history : m_pads)
+  {
+    while (!history.confirmed.empty() &&
+           history.first_frame + MAX_ROLLBACK_FRAMES * 2 < m_current_frame)
+    {
+      history.confirmed.pop_front();
+      history.first_frame++;
+    }
+  }
+}
+
+bool RollbackEngine::RestoreSnapshot(const u32 frame)
+{
+  const auto it = std::find_if(m_snapshots.begin(), m_snapshots.end(),
+                               [frame](const Snapshot& s) { return s.frame == frame; });
+  if (it == m_snapshots.end() || !it->base)
+  {
+    // The confirmed input is too old to roll back to. The simulation keeps the
+    // mispredicted input; the timebase check will report it if this desynced.
+    ERROR_LOG_FMT(NETPLAY, "Rollback to frame {} requested but its snapshot is gone", frame);
+    return false;
+  }
+
+  // The public load functions refuse to run during netplay; rollback restores
+  // happen in lockstep on every client, so they use the internal entry points.
+  if (it->delta.empty())
+  {
+    std::vector<u8> buffer = *it->base;
+    State::LoadFromBufferInternal(buffer);
+  }
+  else
+  {
+    State::LoadFromDeltaBufferInternal(*it->base, it->delta);
+  }
+  return true;
+}
+
+void RollbackEngine::BeginResimulation(const u32 first_frame)
+{
+  INFO_LOG_FMT(NETPLAY, "Rolling back {} frame(s) to frame {}",
+               m_current_frame + 1 - first_frame, first_frame);
+
+  m_resimulation_target = m_current_frame + 1;
+  m_current_frame = first_frame;
+  m_resimulating = true;
+
+  {
+    // Predictions from the undone frames are stale; the re-simulation records
+    // fresh ones for anything that is still unconfirmed.
+    std::lock_guard lk(m_input_mutex);
+    for (PadHistory& history : m_pads)
+    {
+      while (!history.predictions.empty() && history.predictions.back().first >= first_frame)
+        history.predictions.pop_back();
+    }
+  }
+
+  // Re-simulated frames should be invisible: run them at unlimited speed with
+  // the sound stream stopped.
+  m_saved_emulation_speed = SConfig::GetInstance().m_EmulationSpeed;
+  SConfig::GetInstance().m_EmulationSpeed = 0.0f;
+  AudioCommon::SetSoundStreamRunning(false);
+}
+
+void RollbackEngine::EndResimulation()
+{
+  SConfig::GetInstance().m_EmulationSpeed = m_saved_emulation_speed;
+  AudioCommon::SetSoundStreamRunning(true);
+  m_resimulating = false;
+}
+}  // namespace NetPlay
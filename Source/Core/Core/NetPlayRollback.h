@@ -0,0 +1,104 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "InputCommon/GCPadStatus.h"
+
+namespace NetPlay
+{
+// GGPO-style rollback session state for netplay.
+//
+// Instead of delaying every input by the pad buffer, frames run immediately with
+// predicted remote inputs (prediction: repeat the last confirmed input). Every
+// frame start is snapshotted as a delta savestate; when a confirmed remote input
+// turns out to differ from the prediction it was simulated with, the state of
+// the first mispredicted frame is restored and the frames since then are
+// re-simulated with the corrected input history -- at unlimited emulation speed
+// and with the sound stream stopped, so the replay is neither visible nor
+// audible for longer than a normal frame.
+//
+// Everything except AddRemoteInput runs on the CPU thread from the
+// frame-boundary SI poll, which is a CoreTiming event -- the same context
+// scheduled savestates run in. AddRemoteInput runs on the net thread.
+class RollbackEngine
+{
+public:
+  // How far back we are willing to re-simulate. If a remote input is further
+  // behind than this, the session stalls until it arrives, like lockstep would.
+  static constexpr u32 MAX_ROLLBACK_FRAMES = 8;
+
+  // pad_is_local should also be set for unmapped pads, so they are not waited on.
+  explicit RollbackEngine(const std::array<bool, 4>& pad_is_local);
+  ~RollbackEngine();
+
+  // Called at the first batched pad poll of every frame. Performs a pending
+  // rollback if a misprediction was detected, and snapshots the frame.
+  void AdvanceFrame();
+
+  // Whether the upcoming frame would run further ahead of a remote pad's
+  // confirmed inputs than MAX_ROLLBACK_FRAMES; the caller should wait.
+  bool TooFarAhead() const;
+
+  bool IsResimulating() const { return m_resimulating; }
+
+  // Input for the given pad on the current frame: the confirmed input when we
+  // have it (always the case while re-simulating), otherwise a prediction.
+  GCPadStatus GetInput(int pad);
+
+  // Local inputs are confirmed the moment they are polled.
+  void AddLocalInput(int pad, const GCPadStatus& status);
+
+  // Confirms the next unconfirmed frame of a remote pad, and flags a rollback
+  // if that frame was already simulated with a differing prediction.
+  void AddRemoteInput(int pad, const GCPadStatus& status);
+
+private:
+  struct PadHistory
+  {
+    // confirmed[i] is the input of frame first_frame + i.
+    u32 first_frame = 0;
+    std::deque<GCPadStatus> confirmed;
+    GCPadStatus last_confirmed{};
+    // (frame, input) predictions that frames were simulated with, oldest first.
+    std::deque<std::pair<u32, GCPadStatus>> predictions;
+  };
+
+  struct Snapshot
+  {
+    u32 frame = 0;
+    // Full serialized state the delta is against, shared between snapshots.
+    std::shared_ptr<const std::vector<u8>> base;
+    std::vector<u8> delta;  // empty when this snapshot is the base itself
+  };
+
+  void CaptureSnapshot();
+  bool RestoreSnapshot(u32 frame);
+  void BeginResimulation(u32 first_frame);
+  void EndResimulation();
+  u32 TakeFirstMispredictedFrame();
+
+  mutable std::mutex m_input_mutex;
+  std::array<PadHistory, 4> m_pads;
+  std::array<bool, 4> m_pad_is_local{};
+  u32 m_first_mispredicted_frame;
+
+  std::deque<Snapshot> m_snapshots;
+  std::shared_ptr<const std::vector<u8>> m_snapshot_base;
+  u32 m_frames_since_base = 0;
+
+  bool m_started = false;
+  bool m_resimulating = false;
+  u32 m_current_frame = 0;
+  u32 m_resimulation_target = 0;
+  float m_saved_emulation_speed = 1.0f;
+};
+}  // namespace NetPlay
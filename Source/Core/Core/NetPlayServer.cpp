@@ -270,6 +270,7 @@ void NetPlayServer::ThreadFunc()
         {
           SendToClients(e.packet, e.target_pid, e.channel_id);
         }
+        RecyclePacket(std::move(e.packet));
       }
       m_async_queue.Pop();
     }
@@ -287,7 +288,7 @@ void NetPlayServer::ThreadFunc()
       break;
       case ENET_EVENT_TYPE_RECEIVE:
       {
-        sf::Packet rpac;
+        sf::Packet rpac = AcquirePacket();
         rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
 
         if (!netEvent.peer->data)
@@ -323,6 +324,7 @@ void NetPlayServer::ThreadFunc()
             ClearPeerPlayerId(netEvent.peer);
           }
         }
+        RecyclePacket(std::move(rpac));
         enet_packet_destroy(netEvent.packet);
       }
       break;
@@ -735,7 +737,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (player.current_game != m_current_game)
       break;
 
-    sf::Packet spac;
+    sf::Packet spac = AcquirePacket();
     spac << static_cast<MessageId>(m_host_input_authority ? NP_MSG_PAD_HOST_DATA : NP_MSG_PAD_DATA);
 
     while (!packet.endOfPacket())
@@ -751,12 +753,23 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       }
 
       GCPadStatus pad;
-      packet >> pad.button >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >>
-          pad.substickX >> pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
+      if (m_host_input_authority)
+      {
+        packet >> pad.button >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >>
+            pad.substickX >> pad.substickY >> pad.triggerLeft >> pad.triggerRight >>
+            pad.isConnected;
 
-      spac << map << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY
-           << pad.substickX << pad.substickY << pad.triggerLeft << pad.triggerRight
-           << pad.isConnected;
+        spac << map << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY
+             << pad.substickX << pad.substickY << pad.triggerLeft << pad.triggerRight
+             << pad.isConnected;
+      }
+      else
+      {
+        ReadDeltaPadState(packet, &pad, &m_recv_pad_delta_state.at(map));
+
+        spac << map;
+        WriteDeltaPadState(spac, pad, &m_sent_pad_delta_state.at(map));
+      }
     }
 
     if (m_host_input_authority)
@@ -769,6 +782,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     {
       SendToClients(spac, player.pid);
     }
+    RecyclePacket(std::move(spac));
   }
   break;
 
@@ -778,7 +792,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     if (m_current_golfer != 0 && player.pid != m_current_golfer)
       return 1;
 
-    sf::Packet spac;
+    sf::Packet spac = AcquirePacket();
     spac << static_cast<MessageId>(NP_MSG_PAD_DATA);
 
     while (!packet.endOfPacket())
@@ -796,6 +810,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     }
 
     SendToClients(spac, player.pid);
+    RecyclePacket(std::move(spac));
   }
   break;
 
@@ -1316,6 +1331,7 @@ bool NetPlayServer::SetupNetSettings()
       Config::Get(Config::NETPLAY_SYNC_ALL_WII_SAVES) && Config::Get(Config::NETPLAY_SYNC_SAVES);
   settings.m_GolfMode = Config::Get(Config::NETPLAY_NETWORK_MODE) == "golf";
   settings.m_UseFMA = DoAllPlayersHaveHardwareFMA();
+  settings.m_RollbackMode = Config::Get(Config::NETPLAY_NETWORK_MODE) == "rollback";
 
   // Unload GameINI to restore things to normal
   Config::RemoveLayer(Config::LayerType::GlobalGame);
@@ -1387,6 +1403,11 @@ bool NetPlayServer::StartGame()
   std::lock_guard lkg(m_crit.game);
   m_current_game = Common::Timer::GetTimeMs();
 
+  // Pad data from the previous game is ignored (current_game mismatch), so the
+  // delta streams can be restarted here; clients do the same on NP_MSG_START_GAME.
+  m_recv_pad_delta_state.fill(GCPadStatus{});
+  m_sent_pad_delta_state.fill(GCPadStatus{});
+
   // no change, just update with clients
   if (!m_host_input_authority)
     AdjustPadBufferSize(m_target_buffer_size);
@@ -1501,6 +1522,7 @@ bool NetPlayServer::StartGame()
 
   spac << m_settings.m_GolfMode;
   spac << m_settings.m_UseFMA;
+  spac << m_settings.m_RollbackMode;
 
   SendAsyncToClients(std::move(spac));
 
@@ -2106,13 +2128,19 @@ void NetPlayServer::ChunkedDataThreadFunc()
 
         auto start = std::chrono::steady_clock::now();
 
-        sf::Packet pac;
+        sf::Packet pac = AcquirePacket();
         pac << static_cast<MessageId>(NP_MSG_CHUNKED_DATA_PAYLOAD);
         pac << id;
+        pac << sf::Uint64{index};
         size_t len = std::min(CHUNKED_DATA_UNIT_SIZE, e.packet.getDataSize() - index);
         pac.append(static_cast<const u8*>(e.packet.getData()) + index, len);
 
-        ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode);
+        // Stripe payloads round-robin across the chunked data channels; the
+        // offset written above lets the receiver reassemble them regardless
+        // of the order the channels deliver in.
+        const u8 channel = static_cast<u8>(CHUNKED_DATA_CHANNEL + (index / CHUNKED_DATA_UNIT_SIZE) %
+                                                                      CHUNKED_DATA_CHANNEL_COUNT);
+        ChunkedDataSend(std::move(pac), e.target_pid, e.target_mode, channel);
         index += CHUNKED_DATA_UNIT_SIZE;
 
         if (enable_limit)
@@ -2143,15 +2171,15 @@ void NetPlayServer::ChunkedDataThreadFunc()
 
 // called from ---Chunked Data--- thread
 void NetPlayServer::ChunkedDataSend(sf::Packet&& packet, const PlayerId pid,
-                                    const TargetMode target_mode)
+                                    const TargetMode target_mode, const u8 channel_id)
 {
   if (target_mode == TargetMode::Only)
   {
-    SendAsync(std::move(packet), pid, CHUNKED_DATA_CHANNEL);
+    SendAsync(std::move(packet), pid, channel_id);
   }
   else
   {
-    SendAsyncToClients(std::move(packet), pid, CHUNKED_DATA_CHANNEL);
+    SendAsyncToClients(std::move(packet), pid, channel_id);
   }
 }
 
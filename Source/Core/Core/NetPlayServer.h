@@ -137,7 +137,8 @@ private:
   void UpdateWiimoteMapping();
   std::vector<std::pair<std::string, std::string>> GetInterfaceListInternal() const;
   void ChunkedDataThreadFunc();
-  void ChunkedDataSend(sf::Packet&& packet, PlayerId pid, const TargetMode target_mode);
+  void ChunkedDataSend(sf::Packet&& packet, PlayerId pid, const TargetMode target_mode,
+                       u8 channel_id = CHUNKED_DATA_CHANNEL);
   void ChunkedDataAbort();
 
   void SetupIndex();
@@ -154,6 +155,12 @@ private:
   unsigned int m_target_buffer_size = 0;
   PadMappingArray m_pad_map;
   PadMappingArray m_wiimote_map;
+
+  // Reference states for delta-encoded pad packets (not used with host input
+  // authority): one stream per pad from the owning client, one per pad for
+  // the rebroadcast to everyone else. Only touched by the ENet thread.
+  std::array<GCPadStatus, 4> m_recv_pad_delta_state{};
+  std::array<GCPadStatus, 4> m_sent_pad_delta_state{};
   unsigned int m_save_data_synced_players = 0;
   unsigned int m_codes_synced_players = 0;
   bool m_saves_synced = true;
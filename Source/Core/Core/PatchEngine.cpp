@@ -36,6 +36,9 @@ constexpr std::array<const char*, 3> s_patch_type_strings{{
 }};
 
 static std::vector<Patch> s_on_frame;
+// The entries of every enabled patch in s_on_frame, flattened into one array so the
+// per-frame hook only walks what it will actually apply.
+static std::vector<PatchEntry> s_on_frame_active;
 static std::map<u32, int> s_speed_hacks;
 
 const char* PatchTypeAsString(PatchType type)
@@ -155,6 +158,18 @@ int GetSpeedhackCycles(const u32 addr)
   return iter->second;
 }
 
+static void RebuildActiveEntries()
+{
+  s_on_frame_active.clear();
+  for (const Patch& patch : s_on_frame)
+  {
+    if (!patch.enabled)
+      continue;
+
+    s_on_frame_active.insert(s_on_frame_active.end(), patch.entries.begin(), patch.entries.end());
+  }
+}
+
 void LoadPatches()
 {
   IniFile merged = SConfig::GetInstance().LoadGameIni();
@@ -162,6 +177,7 @@ void LoadPatches()
   IniFile localIni = SConfig::GetInstance().LoadLocalGameIni();
 
   LoadPatchSection("OnFrame", s_on_frame, globalIni, localIni);
+  RebuildActiveEntries();
 
   // Check if I'm syncing Codes
   if (Config::Get(Config::SESSION_CODE_SYNC_OVERRIDE))
@@ -178,36 +194,48 @@ void LoadPatches()
   LoadSpeedhacks("Speedhacks", merged);
 }
 
-static void ApplyPatches(const std::vector<Patch>& patches)
+static void ApplyEntries(const std::vector<PatchEntry>& entries)
 {
-  for (const Patch& patch : patches)
+  for (const PatchEntry& entry : entries)
   {
-    if (patch.enabled)
+    const u32 addr = entry.address;
+    const u32 value = entry.value;
+    const u32 comparand = entry.comparand;
+    // Reading the current value first lets us skip writes whose target already holds the
+    // patch value, which keeps the steady-state frame free of WriteToHardware round trips
+    // (and the JIT invalidation checks they imply) for large patch sets.
+    switch (entry.type)
     {
-      for (const PatchEntry& entry : patch.entries)
-      {
-        u32 addr = entry.address;
-        u32 value = entry.value;
-        u32 comparand = entry.comparand;
-        switch (entry.type)
-        {
-        case PatchType::Patch8Bit:
-          if (!entry.conditional || PowerPC::HostRead_U8(addr) == static_cast<u8>(comparand))
-            PowerPC::HostWrite_U8(static_cast<u8>(value), addr);
-          break;
-        case PatchType::Patch16Bit:
-          if (!entry.conditional || PowerPC::HostRead_U16(addr) == static_cast<u16>(comparand))
-            PowerPC::HostWrite_U16(static_cast<u16>(value), addr);
-          break;
-        case PatchType::Patch32Bit:
-          if (!entry.conditional || PowerPC::HostRead_U32(addr) == comparand)
-            PowerPC::HostWrite_U32(value, addr);
-          break;
-        default:
-          // unknown patchtype
-          break;
-        }
-      }
+    case PatchType::Patch8Bit:
+    {
+      const u8 current = PowerPC::HostRead_U8(addr);
+      if (entry.conditional && current != static_cast<u8>(comparand))
+        break;
+      if (current != static_cast<u8>(value))
+        PowerPC::HostWrite_U8(static_cast<u8>(value), addr);
+      break;
+    }
+    case PatchType::Patch16Bit:
+    {
+      const u16 current = PowerPC::HostRead_U16(addr);
+      if (entry.conditional && current != static_cast<u16>(comparand))
+        break;
+      if (current != static_cast<u16>(value))
+        PowerPC::HostWrite_U16(static_cast<u16>(value), addr);
+      break;
+    }
+    case PatchType::Patch32Bit:
+    {
+      const u32 current = PowerPC::HostRead_U32(addr);
+      if (entry.conditional && current != comparand)
+        break;
+      if (current != value)
+        PowerPC::HostWrite_U32(value, addr);
+      break;
+    }
+    default:
+      // unknown patchtype
+      break;
     }
   }
 }
@@ -251,7 +279,7 @@ bool ApplyFramePatches()
     return false;
   }
 
-  ApplyPatches(s_on_frame);
+  ApplyEntries(s_on_frame_active);
 
   // Run the Gecko code handler
   Gecko::RunCodeHandler();
@@ -263,6 +291,7 @@ bool ApplyFramePatches()
 void Shutdown()
 {
   s_on_frame.clear();
+  s_on_frame_active.clear();
   s_speed_hacks.clear();
   ActionReplay::ApplyCodes({});
   Gecko::Shutdown();
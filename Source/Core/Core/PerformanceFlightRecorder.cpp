@@ -0,0 +1,154 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PerformanceFlightRecorder.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <ctime>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+#include "Core/Config/MainSettings.h"
+
+namespace Core::FlightRecorder
+{
+namespace
+{
+struct FrameRecord
+{
+  u64 timestamp_us;
+  float frame_time_ms;
+  float speed_ratio;
+  u32 num_prims;
+  u32 num_draw_calls;
+  u32 jit_blocks_compiled;
+  u32 texture_uploads;
+  u32 savestate_events;
+  u32 savestate_max_us;
+};
+
+// ~68 seconds at 60 fps.
+constexpr size_t RING_SIZE = 4096;
+// A frame this far beyond the 60 Hz budget is treated as a severe spike.
+constexpr float AUTO_DUMP_THRESHOLD_MS = 100.0f;
+// Leave some post-spike context in the ring, and don't dump in a loop.
+constexpr u64 AUTO_DUMP_COOLDOWN_US = 30 * 1000000ull;
+
+std::array<FrameRecord, RING_SIZE> s_ring;
+// Total records ever written; the ring slot is s_head % RING_SIZE. Only the
+// video thread writes records, so a plain release store is enough for Dump()
+// on another thread to see completed entries.
+std::atomic<u64> s_head{0};
+
+std::atomic<u32> s_jit_blocks_compiled{0};
+std::atomic<u32> s_savestate_events{0};
+std::atomic<u32> s_savestate_max_us{0};
+
+u32 s_last_texture_uploads = 0;
+u64 s_last_auto_dump_us = 0;
+}  // namespace
+
+bool IsEnabled()
+{
+  return Config::Get(Config::MAIN_PERF_FLIGHT_RECORDER);
+}
+
+void RecordFrame(const double frame_time_secs, const double speed_ratio, const u32 num_prims,
+                 const u32 num_draw_calls, const u32 texture_uploads)
+{
+  if (!IsEnabled())
+    return;
+
+  const u64 head = s_head.load(std::memory_order_relaxed);
+  FrameRecord& record = s_ring[head % RING_SIZE];
+
+  record.timestamp_us = Common::Timer::GetTimeUs();
+  record.frame_time_ms = static_cast<float>(frame_time_secs * 1000.0);
+  record.speed_ratio = static_cast<float>(speed_ratio);
+  record.num_prims = num_prims;
+  record.num_draw_calls = num_draw_calls;
+  record.jit_blocks_compiled = s_jit_blocks_compiled.exchange(0, std::memory_order_relaxed);
+  record.texture_uploads = texture_uploads - s_last_texture_uploads;
+  s_last_texture_uploads = texture_uploads;
+  record.savestate_events = s_savestate_events.exchange(0, std::memory_order_relaxed);
+  record.savestate_max_us = s_savestate_max_us.exchange(0, std::memory_order_relaxed);
+
+  s_head.store(head + 1, std::memory_order_release);
+
+  if (record.frame_time_ms >= AUTO_DUMP_THRESHOLD_MS &&
+      record.timestamp_us - s_last_auto_dump_us >= AUTO_DUMP_COOLDOWN_US)
+  {
+    s_last_auto_dump_us = record.timestamp_us;
+    Dump("slow frame");
+  }
+}
+
+void CountJitBlockCompiled()
+{
+  s_jit_blocks_compiled.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RecordSavestateLatency(const u64 latency_us)
+{
+  const u32 clamped = static_cast<u32>(std::min<u64>(latency_us, 0xFFFFFFFF));
+  s_savestate_events.fetch_add(1, std::memory_order_relaxed);
+  u32 max = s_savestate_max_us.load(std::memory_order_relaxed);
+  while (clamped > max &&
+         !s_savestate_max_us.compare_exchange_weak(max, clamped, std::memory_order_relaxed))
+  {
+  }
+}
+
+void Dump(const char* reason)
+{
+  const u64 head = s_head.load(std::memory_order_acquire);
+  if (head == 0)
+    return;
+
+  const std::string filename = fmt::format("{}flight_recorder_{}.csv",
+                                           File::GetUserPath(D_DUMP_IDX), std::time(nullptr));
+  File::IOFile file(filename, "w");
+  if (!file)
+  {
+    ERROR_LOG_FMT(CORE, "FlightRecorder: could not open '{}'", filename);
+    return;
+  }
+
+  const auto write_line = [&file](const std::string& line) {
+    file.WriteBytes(line.data(), line.size());
+  };
+
+  write_line(fmt::format("# dumped on: {}\n", reason));
+  write_line("timestamp_us,frame_time_ms,speed_ratio,prims,draw_calls,jit_blocks_compiled,"
+             "texture_uploads,savestate_events,savestate_max_us\n");
+
+  const u64 first = head > RING_SIZE ? head - RING_SIZE : 0;
+  for (u64 i = first; i < head; i++)
+  {
+    const FrameRecord& r = s_ring[i % RING_SIZE];
+    write_line(fmt::format("{},{:.3f},{:.3f},{},{},{},{},{},{}\n", r.timestamp_us, r.frame_time_ms,
+                           r.speed_ratio, r.num_prims, r.num_draw_calls, r.jit_blocks_compiled,
+                           r.texture_uploads, r.savestate_events, r.savestate_max_us));
+  }
+
+  NOTICE_LOG_FMT(CORE, "FlightRecorder: wrote {} records to '{}' ({})",
+                 std::min<u64>(head, RING_SIZE), filename, reason);
+}
+
+void Reset()
+{
+  s_head.store(0, std::memory_order_release);
+  s_jit_blocks_compiled.store(0, std::memory_order_relaxed);
+  s_savestate_events.store(0, std::memory_order_relaxed);
+  s_savestate_max_us.store(0, std::memory_order_relaxed);
+  s_last_texture_uploads = 0;
+  s_last_auto_dump_us = 0;
+}
+}  // namespace Core::FlightRecorder
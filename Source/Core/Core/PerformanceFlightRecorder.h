@@ -0,0 +1,36 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// A low-overhead flight recorder for diagnosing performance problems after the
+// fact. While enabled (Core::PerformanceFlightRecorder in the ini) it keeps a
+// ring of one record per presented frame — frame time, estimated emulation
+// speed, primitive/draw-call counts, JIT compile and texture upload activity,
+// and the worst savestate latency seen since the previous frame — covering
+// roughly the last minute of emulation. The ring is dumped to a CSV in the
+// dump directory when a severe frame spike occurs and when emulation stops, so
+// a stutter report can be investigated without reproducing it under a
+// profiler.
+namespace Core::FlightRecorder
+{
+bool IsEnabled();
+
+// Called from the video thread once per presented frame. texture_uploads is
+// the cumulative g_stats counter; deltas are computed internally.
+void RecordFrame(double frame_time_secs, double speed_ratio, u32 num_prims, u32 num_draw_calls,
+                 u32 texture_uploads);
+
+// Cross-thread event counters, folded into the next frame record.
+void CountJitBlockCompiled();
+void RecordSavestateLatency(u64 latency_us);
+
+// Writes the ring to <dump dir>/FlightRecorder <timestamp>.csv, oldest record
+// first. Safe to call from any thread; no-op if the recorder never ran.
+void Dump(const char* reason);
+
+// Clears the ring (called when a new emulation session starts).
+void Reset();
+}  // namespace Core::FlightRecorder
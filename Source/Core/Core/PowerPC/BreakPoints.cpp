@@ -16,36 +16,86 @@
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 
+namespace
+{
+constexpr u32 PAGE_SHIFT = 12;
+constexpr size_t NUM_PAGE_WORDS = (size_t(1) << (32 - PAGE_SHIFT)) / 32;
+
+bool TestPage(const std::vector<u32>& page_bitmap, u32 page)
+{
+  return (page_bitmap[page / 32] & (1u << (page % 32))) != 0;
+}
+
+void MarkPages(std::vector<u32>& page_bitmap, u32 start_address, u32 end_address)
+{
+  for (u32 page = start_address >> PAGE_SHIFT;; page++)
+  {
+    page_bitmap[page / 32] |= 1u << (page % 32);
+    if (page == end_address >> PAGE_SHIFT)
+      break;
+  }
+}
+}  // namespace
+
+const TBreakPoint* BreakPoints::Find(u32 address) const
+{
+  if (m_page_bitmap.empty() || !TestPage(m_page_bitmap, address >> PAGE_SHIFT))
+    return nullptr;
+
+  const auto iter =
+      std::lower_bound(m_breakpoints.begin(), m_breakpoints.end(), address,
+                       [](const TBreakPoint& bp, u32 addr) { return bp.address < addr; });
+  if (iter == m_breakpoints.end() || iter->address != address)
+    return nullptr;
+
+  return &*iter;
+}
+
+TBreakPoint* BreakPoints::Find(u32 address)
+{
+  return const_cast<TBreakPoint*>(static_cast<const BreakPoints*>(this)->Find(address));
+}
+
+void BreakPoints::RebuildPageBitmap()
+{
+  if (m_breakpoints.empty())
+  {
+    std::vector<u32>().swap(m_page_bitmap);
+    return;
+  }
+
+  m_page_bitmap.assign(NUM_PAGE_WORDS, 0);
+  for (const TBreakPoint& bp : m_breakpoints)
+    MarkPages(m_page_bitmap, bp.address, bp.address);
+}
+
 bool BreakPoints::IsAddressBreakPoint(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(),
-                     [address](const auto& bp) { return bp.address == address; });
+  return Find(address) != nullptr;
 }
 
 bool BreakPoints::IsBreakPointEnable(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(),
-                     [address](const auto& bp) { return bp.is_enabled && bp.address == address; });
+  const TBreakPoint* bp = Find(address);
+  return bp != nullptr && bp->is_enabled;
 }
 
 bool BreakPoints::IsTempBreakPoint(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(), [address](const auto& bp) {
-    return bp.address == address && bp.is_temporary;
-  });
+  const TBreakPoint* bp = Find(address);
+  return bp != nullptr && bp->is_temporary;
 }
 
 bool BreakPoints::IsBreakPointBreakOnHit(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(), [address](const auto& bp) {
-    return bp.address == address && bp.break_on_hit;
-  });
+  const TBreakPoint* bp = Find(address);
+  return bp != nullptr && bp->break_on_hit;
 }
 
 bool BreakPoints::IsBreakPointLogOnHit(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(),
-                     [address](const auto& bp) { return bp.address == address && bp.log_on_hit; });
+  const TBreakPoint* bp = Find(address);
+  return bp != nullptr && bp->log_on_hit;
 }
 
 BreakPoints::TBreakPointsStr BreakPoints::GetStrings() const
@@ -91,7 +141,11 @@ void BreakPoints::Add(const TBreakPoint& bp)
   if (IsAddressBreakPoint(bp.address))
     return;
 
-  m_breakpoints.push_back(bp);
+  const auto iter =
+      std::lower_bound(m_breakpoints.begin(), m_breakpoints.end(), bp.address,
+                       [](const TBreakPoint& b, u32 addr) { return b.address < addr; });
+  m_breakpoints.insert(iter, bp);
+  RebuildPageBitmap();
 
   JitInterface::InvalidateICache(bp.address, 4, true);
 }
@@ -103,10 +157,6 @@ void BreakPoints::Add(u32 address, bool temp)
 
 void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit)
 {
-  // Only add new addresses
-  if (IsAddressBreakPoint(address))
-    return;
-
   TBreakPoint bp;  // breakpoint settings
   bp.is_enabled = true;
   bp.is_temporary = temp;
@@ -114,32 +164,27 @@ void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit
   bp.log_on_hit = log_on_hit;
   bp.address = address;
 
-  m_breakpoints.push_back(bp);
-
-  JitInterface::InvalidateICache(address, 4, true);
+  Add(bp);
 }
 
 bool BreakPoints::ToggleBreakPoint(u32 address)
 {
-  auto iter = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                           [address](const auto& bp) { return bp.address == address; });
-
-  if (iter == m_breakpoints.end())
+  TBreakPoint* bp = Find(address);
+  if (bp == nullptr)
     return false;
 
-  iter->is_enabled = !iter->is_enabled;
+  bp->is_enabled = !bp->is_enabled;
   return true;
 }
 
 void BreakPoints::Remove(u32 address)
 {
-  const auto iter = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                                 [address](const auto& bp) { return bp.address == address; });
-
-  if (iter == m_breakpoints.cend())
+  const TBreakPoint* bp = Find(address);
+  if (bp == nullptr)
     return;
 
-  m_breakpoints.erase(iter);
+  m_breakpoints.erase(m_breakpoints.begin() + (bp - m_breakpoints.data()));
+  RebuildPageBitmap();
   JitInterface::InvalidateICache(address, 4, true);
 }
 
@@ -151,6 +196,7 @@ void BreakPoints::Clear()
   }
 
   m_breakpoints.clear();
+  RebuildPageBitmap();
 }
 
 void BreakPoints::ClearAllTemporary()
@@ -168,6 +214,7 @@ void BreakPoints::ClearAllTemporary()
       ++bp;
     }
   }
+  RebuildPageBitmap();
 }
 
 MemChecks::TMemChecksStr MemChecks::GetStrings() const
@@ -214,13 +261,13 @@ void MemChecks::Add(const TMemCheck& memory_check)
   if (GetMemCheck(memory_check.start_address) != nullptr)
     return;
 
-  bool had_any = HasAny();
   Core::RunAsCPUThread([&] {
     m_mem_checks.push_back(memory_check);
-    // If this is the first one, clear the JIT cache so it can switch to
-    // watchpoint-compatible code.
-    if (!had_any)
-      JitInterface::ClearCache();
+    RebuildIndex();
+    // Clear the JIT cache so it can switch to watchpoint-compatible code, and
+    // so that code which baked in a compile-time "this address isn't watched"
+    // decision gets recompiled.
+    JitInterface::ClearCache();
     PowerPC::DBATUpdated();
   });
 }
@@ -248,8 +295,8 @@ void MemChecks::Remove(u32 address)
 
   Core::RunAsCPUThread([&] {
     m_mem_checks.erase(iter);
-    if (!HasAny())
-      JitInterface::ClearCache();
+    RebuildIndex();
+    JitInterface::ClearCache();
     PowerPC::DBATUpdated();
   });
 }
@@ -258,23 +305,76 @@ void MemChecks::Clear()
 {
   Core::RunAsCPUThread([&] {
     m_mem_checks.clear();
+    RebuildIndex();
     JitInterface::ClearCache();
     PowerPC::DBATUpdated();
   });
 }
 
+void MemChecks::RebuildIndex()
+{
+  std::sort(m_mem_checks.begin(), m_mem_checks.end(),
+            [](const TMemCheck& a, const TMemCheck& b) { return a.start_address < b.start_address; });
+
+  m_running_max_end.resize(m_mem_checks.size());
+  u32 max_end = 0;
+  for (size_t i = 0; i < m_mem_checks.size(); i++)
+  {
+    max_end = std::max(max_end, m_mem_checks[i].end_address);
+    m_running_max_end[i] = max_end;
+  }
+
+  if (m_mem_checks.empty())
+  {
+    std::vector<u32>().swap(m_page_bitmap);
+    return;
+  }
+
+  m_page_bitmap.assign(NUM_PAGE_WORDS, 0);
+  for (const TMemCheck& mc : m_mem_checks)
+    MarkPages(m_page_bitmap, mc.start_address, std::max(mc.start_address, mc.end_address));
+}
+
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
-  const auto iter =
-      std::find_if(m_mem_checks.begin(), m_mem_checks.end(), [address, size](const auto& mc) {
-        return mc.end_address >= address && address + size - 1 >= mc.start_address;
-      });
+  if (m_mem_checks.empty())
+    return nullptr;
 
-  // None found
-  if (iter == m_mem_checks.cend())
+  const u32 end_address = address + static_cast<u32>(size) - 1;
+
+  // Cheap first-level filter: a range overlapping the access must mark at least
+  // one of the pages the access touches.
+  bool page_hit = false;
+  for (u32 page = address >> PAGE_SHIFT;; page++)
+  {
+    if (TestPage(m_page_bitmap, page))
+    {
+      page_hit = true;
+      break;
+    }
+    if (page == end_address >> PAGE_SHIFT)
+      break;
+  }
+  if (!page_hit)
     return nullptr;
 
-  return &*iter;
+  // Everything from the first range starting beyond the access onwards cannot
+  // overlap it; scan backwards from there until the running maximum end address
+  // proves no earlier range can reach the access either.
+  const auto iter =
+      std::upper_bound(m_mem_checks.begin(), m_mem_checks.end(), end_address,
+                       [](u32 end, const TMemCheck& mc) { return end < mc.start_address; });
+  size_t i = static_cast<size_t>(iter - m_mem_checks.begin());
+  while (i > 0)
+  {
+    --i;
+    if (m_running_max_end[i] < address)
+      return nullptr;
+    if (m_mem_checks[i].end_address >= address)
+      return &m_mem_checks[i];
+  }
+
+  return nullptr;
 }
 
 bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
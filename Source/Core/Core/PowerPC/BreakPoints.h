@@ -76,7 +76,15 @@ public:
   void ClearAllTemporary();
 
 private:
+  const TBreakPoint* Find(u32 address) const;
+  TBreakPoint* Find(u32 address);
+  void RebuildPageBitmap();
+
+  // Kept sorted by address so queries can binary-search.
   TBreakPoints m_breakpoints;
+  // One bit per 4 KiB page containing a breakpoint, so the common miss case on
+  // the single-step path is one test. Empty when there are no breakpoints.
+  std::vector<u32> m_page_bitmap;
 };
 
 // Memory breakpoints
@@ -103,5 +111,15 @@ public:
   bool HasAny() const { return !m_mem_checks.empty(); }
 
 private:
+  void RebuildIndex();
+
+  // Kept sorted by start address. m_running_max_end[i] is the maximum end
+  // address of m_mem_checks[0..i], which lets GetMemCheck cut a backwards scan
+  // short even though watched ranges may overlap each other.
   TMemChecks m_mem_checks;
+  std::vector<u32> m_running_max_end;
+  // One bit per 4 KiB page overlapped by a watched range, so the common miss
+  // case on the per-access path is one test per touched page. Empty when there
+  // are no memory checks.
+  std::vector<u32> m_page_bitmap;
 };
@@ -0,0 +1,179 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/CPUBenchmark.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include "Common/PerformanceCounter.h"
+#endif
+
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+#include "Core/Host.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCTables.h"
+
+namespace CPUBenchmark
+{
+namespace
+{
+enum class State
+{
+  Inactive,
+  // Start() has been called; measurement begins on the next frame.
+  Armed,
+  Running,
+};
+
+State s_state = State::Inactive;
+u64 s_frames_total = 0;
+u64 s_frames_remaining = 0;
+Common::Timer s_timer;
+
+struct OpStat
+{
+  u64 retired = 0;
+  double est_time_ms = 0.0;
+};
+
+void WriteResults(u64 elapsed_ms)
+{
+  u64 countsPerSec;
+  QueryPerformanceFrequency((LARGE_INTEGER*)&countsPerSec);
+
+  u64 block_runs = 0;
+  u64 instructions = 0;
+  u64 tick_sum = 0;
+  std::map<const GekkoOPInfo*, OpStat> op_stats;
+
+  JitInterface::RunOnBlocks([&](const JitBlock& block) {
+    const auto& data = block.profile_data;
+    if (data.runCount == 0)
+      return;
+
+    block_runs += data.runCount;
+    instructions += static_cast<u64>(block.originalSize) * data.runCount;
+    tick_sum += data.ticCounter;
+
+    // Decode the block's guest instructions to attribute its counts and time to
+    // the opcode tables. The block's measured time is distributed over its
+    // instructions in proportion to their documented cycle counts, so the
+    // per-opcode times are an estimate, not a measurement.
+    std::vector<std::pair<const GekkoOPInfo*, int>> ops;
+    int cycle_sum = 0;
+    for (u32 i = 0; i < block.originalSize; i++)
+    {
+      const auto inst = PowerPC::HostTryReadInstruction(block.effectiveAddress + i * 4);
+      if (!inst)
+        return;
+      const GekkoOPInfo* info = PPCTables::GetOpInfo(UGeckoInstruction(inst.value));
+      if (!info)
+        return;
+      ops.emplace_back(info, info->numCycles);
+      cycle_sum += info->numCycles;
+    }
+
+    const double block_time_ms =
+        static_cast<double>(data.ticCounter) * 1000.0 / static_cast<double>(countsPerSec);
+    for (const auto& [info, cycles] : ops)
+    {
+      OpStat& stat = op_stats[info];
+      stat.retired += data.runCount;
+      if (cycle_sum > 0)
+        stat.est_time_ms += block_time_ms * cycles / cycle_sum;
+    }
+  });
+
+  const std::string filename = File::GetUserPath(D_LOGS_IDX) + "cpu_benchmark.txt";
+  File::IOFile f(filename, "w");
+  if (!f)
+  {
+    WARN_LOG_FMT(POWERPC, "CPU benchmark: failed to open {}", filename);
+    return;
+  }
+
+  const double seconds = static_cast<double>(elapsed_ms) / 1000.0;
+  const double mips =
+      seconds > 0.0 ? static_cast<double>(instructions) / seconds / 1000000.0 : 0.0;
+  f.WriteString(fmt::format("frames\t{}\n", s_frames_total));
+  f.WriteString(fmt::format("wallTime(ms)\t{}\n", elapsed_ms));
+  f.WriteString(fmt::format("blockRuns\t{}\n", block_runs));
+  f.WriteString(fmt::format("instructionsRetired\t{}\n", instructions));
+  f.WriteString(fmt::format("MIPS\t{:.2f}\n", mips));
+  f.WriteString(fmt::format(
+      "timeInBlocks(ms)\t{:.2f}\n",
+      static_cast<double>(tick_sum) * 1000.0 / static_cast<double>(countsPerSec)));
+
+  std::vector<std::pair<const GekkoOPInfo*, OpStat>> sorted_ops(op_stats.begin(), op_stats.end());
+  std::sort(sorted_ops.begin(), sorted_ops.end(),
+            [](const auto& a, const auto& b) { return a.second.est_time_ms > b.second.est_time_ms; });
+
+  f.WriteString("\nopName\tretired\testTime(ms)\n");
+  for (const auto& [info, stat] : sorted_ops)
+    f.WriteString(fmt::format("{}\t{}\t{:.2f}\n", info->opname, stat.retired, stat.est_time_ms));
+
+  NOTICE_LOG_FMT(POWERPC,
+                 "CPU benchmark: {} frames in {} ms ({:.2f} MIPS, {} block runs); results in {}",
+                 s_frames_total, elapsed_ms, mips, block_runs, filename);
+}
+}  // namespace
+
+void Start(u64 num_frames)
+{
+  if (num_frames == 0)
+    return;
+
+  s_frames_total = num_frames;
+  s_state = State::Armed;
+}
+
+void FrameUpdate()
+{
+  if (s_state == State::Inactive)
+    return;
+
+  if (s_state == State::Armed)
+  {
+    if (!JitInterface::GetCore())
+    {
+      WARN_LOG_FMT(POWERPC, "CPU benchmark requires a JIT core; disabling");
+      s_state = State::Inactive;
+      return;
+    }
+
+    // Recompile everything with the block profiler prologue and zeroed counters so
+    // the measured run starts from a clean slate.
+    JitInterface::SetProfilingState(JitInterface::ProfilingState::Enabled);
+    JitInterface::ClearCache();
+    s_frames_remaining = s_frames_total;
+    s_timer.Start();
+    s_state = State::Running;
+    NOTICE_LOG_FMT(POWERPC, "CPU benchmark: measuring {} frames", s_frames_total);
+    return;
+  }
+
+  if (--s_frames_remaining > 0)
+    return;
+
+  const u64 elapsed_ms = s_timer.GetTimeDifference();
+  JitInterface::SetProfilingState(JitInterface::ProfilingState::Disabled);
+  s_state = State::Inactive;
+  WriteResults(elapsed_ms);
+  Host_Message(HostMessageID::WMUserStop);
+}
+}  // namespace CPUBenchmark
@@ -0,0 +1,21 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// CPU-side analogue of FifoPlayer: measures a fixed number of emulated frames with
+// the JIT block profiler enabled and writes block- and opcode-level statistics
+// (retired block count, MIPS, estimated per-opcode time) to the logs directory,
+// then requests a core stop. Combined with movie playback, DSP HLE and the Null
+// video backend this gives a deterministic workload for comparing JIT changes.
+namespace CPUBenchmark
+{
+// Arms the benchmark. Measurement starts on the next emulated frame (so the
+// frontend can call this before booting) and ends num_frames frames later.
+void Start(u64 num_frames);
+
+// Called once per emulated frame by Movie::FrameUpdate.
+void FrameUpdate();
+}  // namespace CPUBenchmark
@@ -3,10 +3,18 @@
 
 // Originally written by Sven Peter <sven@fail0verflow.com> for anergistic.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <thread>
+
 #include <signal.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #ifdef _WIN32
 #include <WinSock2.h>
@@ -22,8 +30,12 @@ typedef SSIZE_T ssize_t;
 #include <unistd.h>
 #endif
 
+#include <fmt/format.h>
+
+#include "Common/Event.h"
 #include "Common/Logging/Log.h"
 #include "Common/SocketContext.h"
+#include "Common/Thread.h"
 #include "Core/HW/CPU.h"
 #include "Core/HW/Memmap.h"
 #include "Core/Host.h"
@@ -45,15 +57,22 @@ std::optional<Common::SocketContext> s_socket_context;
 #define GDB_STUB_ACK '+'
 #define GDB_STUB_NAK '-'
 
-static int tmpsock = -1;
-static int sock = -1;
+static std::atomic<int> tmpsock{-1};
+static std::atomic<int> sock{-1};
 
+// Only touched by the network thread.
 static u8 cmd_bfr[GDB_BFR_MAX];
 static u32 cmd_len;
 
-static u32 sig = 0;
-static u32 send_signal = 0;
-static u32 step_break = 0;
+static std::atomic<u32> sig{0};
+static std::atomic<u32> send_signal{0};
+static std::atomic<u32> step_break{0};
+
+// Services the client socket so that the CPU thread never has to wait on the network.
+static std::thread s_network_thread;
+// Stop packets are sent from the CPU thread while command replies are sent from the
+// network thread, so sends have to be serialized.
+static std::mutex s_send_mutex;
 
 typedef struct
 {
@@ -72,6 +91,8 @@ static const char* CommandBufferAsString()
   return reinterpret_cast<const char*>(cmd_bfr);
 }
 
+static void gdb_handle_signal();
+
 // private helpers
 static u8 hex2char(u8 hex)
 {
@@ -114,6 +135,23 @@ static void hex2mem(u8* dst, u8* src, u32 len)
   }
 }
 
+// Closes the connection without joining the network thread. Safe to call from any
+// thread; the network thread notices the closed socket and exits on its own, and the
+// final join happens in gdb_deinit when the core shuts down.
+static void gdb_close_sockets()
+{
+  if (tmpsock != -1)
+  {
+    shutdown(tmpsock, SHUT_RDWR);
+    tmpsock = -1;
+  }
+  if (sock != -1)
+  {
+    shutdown(sock, SHUT_RDWR);
+    sock = -1;
+  }
+}
+
 static u8 gdb_read_byte()
 {
   u8 c = '+';
@@ -229,6 +267,8 @@ static int gdb_bp_check(u32 addr, u32 type)
 
 static void gdb_nak()
 {
+  std::lock_guard lock(s_send_mutex);
+
   const char nak = GDB_STUB_NAK;
   const ssize_t res = send(sock, &nak, 1, 0);
 
@@ -238,6 +278,8 @@ static void gdb_nak()
 
 static void gdb_ack()
 {
+  std::lock_guard lock(s_send_mutex);
+
   const char ack = GDB_STUB_ACK;
   const ssize_t res = send(sock, &ack, 1, 0);
 
@@ -258,8 +300,16 @@ static void gdb_read_command()
   }
   else if (c == 0x03)
   {
+    // Park the CPU thread before replying so the registers in the stop packet are
+    // settled. If it was running, the breakpoint hook may have sent a stop packet
+    // concurrently; send_signal keeps us from sending a second one.
+    const bool was_running = CPU::GetState() == CPU::State::Running;
     CPU::Break();
-    gdb_signal(GDB_SIGTRAP);
+    for (int i = 0; i < 1000 && CPU::GetState() == CPU::State::Running; i++)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    sig = GDB_SIGTRAP;
+    if (send_signal.exchange(0) || !was_running)
+      gdb_handle_signal();
     return;
   }
   else if (c != GDB_STUB_START)
@@ -305,19 +355,25 @@ static int gdb_data_available()
   struct timeval t;
   fd_set _fds, *fds = &_fds;
 
+  const int fd = sock;
+  if (fd < 0)
+    return 0;
+
   FD_ZERO(fds);
-  FD_SET(sock, fds);
+  FD_SET(fd, fds);
 
+  // select returns as soon as data arrives; the timeout only bounds how quickly the
+  // network thread notices that gdb_deinit closed the socket.
   t.tv_sec = 0;
-  t.tv_usec = 20;
+  t.tv_usec = 50000;
 
-  if (select(sock + 1, fds, nullptr, nullptr, &t) < 0)
+  if (select(fd + 1, fds, nullptr, nullptr, &t) < 0)
   {
     ERROR_LOG_FMT(GDB_STUB, "select failed");
     return 0;
   }
 
-  if (FD_ISSET(sock, fds))
+  if (FD_ISSET(fd, fds))
     return 1;
   return 0;
 }
@@ -327,47 +383,126 @@ static void gdb_reply(const char* reply)
   if (!gdb_active())
     return;
 
-  memset(cmd_bfr, 0, sizeof cmd_bfr);
+  // Framed into a local buffer (not cmd_bfr, which belongs to the network thread's read
+  // path) so the CPU thread can send stop packets while a command is being parsed.
+  static thread_local u8 bfr[GDB_BFR_MAX];
+  memset(bfr, 0, sizeof bfr);
 
-  cmd_len = (u32)strlen(reply);
-  if (cmd_len + 4 > sizeof cmd_bfr)
-    ERROR_LOG_FMT(GDB_STUB, "cmd_bfr overflow in gdb_reply");
+  const u32 len = (u32)strlen(reply);
+  if (len + 4 > sizeof bfr)
+  {
+    ERROR_LOG_FMT(GDB_STUB, "reply buffer overflow in gdb_reply");
+    return;
+  }
 
-  memcpy(cmd_bfr + 1, reply, cmd_len);
+  u8 chk = 0;
+  for (u32 i = 0; i < len; i++)
+    chk += reply[i];
 
-  cmd_len++;
-  const u8 chk = gdb_calc_chksum();
-  cmd_len--;
-  cmd_bfr[0] = GDB_STUB_START;
-  cmd_bfr[cmd_len + 1] = GDB_STUB_END;
-  cmd_bfr[cmd_len + 2] = nibble2hex(chk >> 4);
-  cmd_bfr[cmd_len + 3] = nibble2hex(chk);
+  bfr[0] = GDB_STUB_START;
+  memcpy(bfr + 1, reply, len);
+  bfr[len + 1] = GDB_STUB_END;
+  bfr[len + 2] = nibble2hex(chk >> 4);
+  bfr[len + 3] = nibble2hex(chk);
 
-  DEBUG_LOG_FMT(GDB_STUB, "gdb: reply (len: {}): {}", cmd_len, CommandBufferAsString());
+  DEBUG_LOG_FMT(GDB_STUB, "gdb: reply (len: {}): {}", len, reinterpret_cast<const char*>(bfr));
 
-  const char* ptr = (const char*)cmd_bfr;
-  u32 left = cmd_len + 4;
+  std::lock_guard lock(s_send_mutex);
+  const char* ptr = (const char*)bfr;
+  u32 left = len + 4;
   while (left > 0)
   {
     const int n = send(sock, ptr, left, 0);
     if (n < 0)
     {
       ERROR_LOG_FMT(GDB_STUB, "gdb: send failed");
-      return gdb_deinit();
+      // Joining the network thread here could deadlock (this may be the CPU thread,
+      // which the network thread might be waiting on); just drop the connection.
+      return gdb_close_sockets();
     }
     left -= n;
     ptr += n;
   }
 }
 
+// Target description served through qXfer:features:read. The regnum attributes match the
+// numbering used by the 'p'/'P' handlers and the 'g'/'G' packet layout below, so clients
+// stop probing registers one packet at a time.
+static const std::string& gdb_target_xml()
+{
+  static const std::string xml = [] {
+    std::string s =
+        "<?xml version=\"1.0\"?>"
+        "<!DOCTYPE target SYSTEM \"gdb-target.dtd\">"
+        "<target version=\"1.0\">"
+        "<architecture>powerpc:750</architecture>"
+        "<feature name=\"org.gnu.gdb.power.core\">";
+    for (u32 i = 0; i < 32; i++)
+      s += fmt::format("<reg name=\"r{}\" bitsize=\"32\" type=\"uint32\" regnum=\"{}\"/>", i, i);
+    s += "<reg name=\"pc\" bitsize=\"32\" type=\"code_ptr\" regnum=\"64\"/>"
+         "<reg name=\"msr\" bitsize=\"32\" type=\"uint32\" regnum=\"65\"/>"
+         "<reg name=\"cr\" bitsize=\"32\" type=\"uint32\" regnum=\"66\"/>"
+         "<reg name=\"lr\" bitsize=\"32\" type=\"code_ptr\" regnum=\"67\"/>"
+         "<reg name=\"ctr\" bitsize=\"32\" type=\"uint32\" regnum=\"68\"/>"
+         "<reg name=\"xer\" bitsize=\"32\" type=\"uint32\" regnum=\"69\"/>"
+         "</feature>"
+         "<feature name=\"org.gnu.gdb.power.fpu\">";
+    for (u32 i = 0; i < 32; i++)
+    {
+      s += fmt::format("<reg name=\"f{}\" bitsize=\"64\" type=\"ieee_double\" regnum=\"{}\"/>", i,
+                       32 + i);
+    }
+    s += "<reg name=\"fpscr\" bitsize=\"32\" group=\"float\" regnum=\"71\"/>"
+         "</feature>"
+         "</target>";
+    return s;
+  }();
+  return xml;
+}
+
+static void gdb_handle_xfer_features(const char* args)
+{
+  // args is "OFFSET,LENGTH" in hex.
+  char* end = nullptr;
+  const u32 offset = strtoul(args, &end, 16);
+  if (end == nullptr || *end != ',')
+    return gdb_reply("E00");
+  u32 length = strtoul(end + 1, nullptr, 16);
+
+  const std::string& xml = gdb_target_xml();
+  if (offset >= xml.size())
+    return gdb_reply("l");
+
+  length = std::min<u32>(length, GDB_BFR_MAX - 5);
+  const u32 remaining = static_cast<u32>(xml.size()) - offset;
+  const u32 chunk = std::min(length, remaining);
+
+  // The XML contains none of the characters ($, #, }, *) that a qXfer reply would have
+  // to escape.
+  const std::string reply = (chunk == remaining ? "l" : "m") + xml.substr(offset, chunk);
+  gdb_reply(reply.c_str());
+}
+
 static void gdb_handle_query()
 {
   DEBUG_LOG_FMT(GDB_STUB, "gdb: query '{}'", CommandBufferAsString() + 1);
 
-  if (!strcmp((const char*)(cmd_bfr + 1), "TStatus"))
+  const char* query = CommandBufferAsString() + 1;
+
+  if (!strcmp(query, "TStatus"))
   {
     return gdb_reply("T0");
   }
+  if (!strncmp(query, "Supported", strlen("Supported")))
+  {
+    // Advertise a large packet size so clients batch memory transfers, and the target
+    // description so they can use full 'g' packets instead of per-register reads.
+    return gdb_reply("PacketSize=2000;qXfer:features:read+");
+  }
+  if (!strncmp(query, "Xfer:features:read:target.xml:", strlen("Xfer:features:read:target.xml:")))
+  {
+    return gdb_handle_xfer_features(query + strlen("Xfer:features:read:target.xml:"));
+  }
 
   gdb_reply("");
 }
@@ -384,7 +519,7 @@ static void gdb_handle_signal()
 {
   char bfr[128];
   memset(bfr, 0, sizeof bfr);
-  sprintf(bfr, "T%02x%02x:%08x;%02x:%08x;", sig, 64, PC, 1, GPR(1));
+  sprintf(bfr, "T%02x%02x:%08x;%02x:%08x;", sig.load(), 64, PC, 1, GPR(1));
   gdb_reply(bfr);
 }
 
@@ -482,6 +617,11 @@ static void gdb_read_register()
   gdb_reply((char*)reply);
 }
 
+// 'g'/'G' packets transfer all the registers described in the target XML in one round
+// trip, in increasing regnum order: r0-r31, f0-f31 (ps0), pc, msr, cr, lr, ctr, xer,
+// fpscr.
+#define GDB_REGS_HEX_LEN (32 * 8 + 32 * 16 + 7 * 8)
+
 static void gdb_read_registers()
 {
   static u8 bfr[GDB_BFR_MAX - 4];
@@ -496,13 +636,37 @@ static void gdb_read_registers()
   }
   bufptr += 32 * 8;
 
+  for (i = 0; i < 32; i++)
+  {
+    wbe64hex(bufptr + i * 16, rPS(i).PS0AsU64());
+  }
+  bufptr += 32 * 16;
+
+  wbe32hex(bufptr, PC);
+  bufptr += 8;
+  wbe32hex(bufptr, MSR.Hex);
+  bufptr += 8;
+  wbe32hex(bufptr, PowerPC::ppcState.cr.Get());
+  bufptr += 8;
+  wbe32hex(bufptr, LR);
+  bufptr += 8;
+  wbe32hex(bufptr, CTR);
+  bufptr += 8;
+  wbe32hex(bufptr, PowerPC::ppcState.spr[SPR_XER]);
+  bufptr += 8;
+  wbe32hex(bufptr, FPSCR.Hex);
+  bufptr += 8;
+
   gdb_reply((char*)bfr);
 }
 
 static void gdb_write_registers()
 {
   u32 i;
-  u8* bufptr = cmd_bfr;
+  u8* bufptr = cmd_bfr + 1;
+
+  if (cmd_len < 1 + GDB_REGS_HEX_LEN)
+    return gdb_reply("E01");
 
   for (i = 0; i < 32; i++)
   {
@@ -510,6 +674,27 @@ static void gdb_write_registers()
   }
   bufptr += 32 * 8;
 
+  for (i = 0; i < 32; i++)
+  {
+    rPS(i).SetPS0(re64hex(bufptr + i * 16));
+  }
+  bufptr += 32 * 16;
+
+  PC = re32hex(bufptr);
+  bufptr += 8;
+  MSR.Hex = re32hex(bufptr);
+  bufptr += 8;
+  PowerPC::ppcState.cr.Set(re32hex(bufptr));
+  bufptr += 8;
+  LR = re32hex(bufptr);
+  bufptr += 8;
+  CTR = re32hex(bufptr);
+  bufptr += 8;
+  PowerPC::ppcState.spr[SPR_XER] = re32hex(bufptr);
+  bufptr += 8;
+  FPSCR.Hex = re32hex(bufptr);
+  bufptr += 8;
+
   gdb_reply("OK");
 }
 
@@ -631,12 +816,23 @@ void gdb_break()
 
 static void gdb_step()
 {
-  gdb_break();
+  // Execute exactly one instruction on the CPU thread and report back once it has run.
+  // The reply is sent from here rather than through send_signal so that a breakpoint on
+  // the stepped-to instruction doesn't produce a duplicate stop packet.
+  sig = GDB_SIGTRAP;
+  send_signal = 0;
+
+  Common::Event done;
+  CPU::StepOpcode(&done);
+  done.Wait();
+
+  gdb_handle_signal();
 }
 
 static void gdb_continue()
 {
   send_signal = 1;
+  CPU::EnableStepping(false);
 }
 
 bool gdb_add_bp(u32 type, u32 addr, u32 len)
@@ -732,68 +928,95 @@ static void gdb_remove_bp()
   gdb_reply("OK");
 }
 
-void gdb_handle_exception()
+static void gdb_process_command()
+{
+  // Resume commands change the run state themselves; in the all-stop protocol they only
+  // arrive while the target is stopped.
+  switch (cmd_bfr[0])
+  {
+  case 's':
+    gdb_step();
+    return;
+  case 'C':
+  case 'c':
+    gdb_continue();
+    return;
+  case 'k':
+    gdb_deinit();
+    INFO_LOG_FMT(GDB_STUB, "killed by gdb");
+    return;
+  default:
+    break;
+  }
+
+  // Everything else reads or writes CPU state, so the CPU thread has to be parked. gdb
+  // only issues these while the target is stopped, but guard against clients that query
+  // a running target.
+  const bool pause = CPU::GetState() == CPU::State::Running;
+  if (pause)
+    CPU::PauseAndLock(true);
+
+  switch (cmd_bfr[0])
+  {
+  case 'q':
+    gdb_handle_query();
+    break;
+  case 'H':
+    gdb_handle_set_thread();
+    break;
+  case '?':
+    gdb_handle_signal();
+    break;
+  case 'g':
+    gdb_read_registers();
+    break;
+  case 'G':
+    gdb_write_registers();
+    break;
+  case 'p':
+    gdb_read_register();
+    break;
+  case 'P':
+    gdb_write_register();
+    break;
+  case 'm':
+    gdb_read_mem();
+    break;
+  case 'M':
+    gdb_write_mem();
+    PowerPC::ppcState.iCache.Reset();
+    Host_UpdateDisasmDialog();
+    break;
+  case 'z':
+    gdb_remove_bp();
+    break;
+  case 'Z':
+    _gdb_add_bp();
+    break;
+  default:
+    gdb_reply("");
+    break;
+  }
+
+  if (pause)
+    CPU::PauseAndLock(false);
+}
+
+// Services the client on its own thread. The old implementation serviced packets from
+// the CPU thread, busy-polling the socket with a 20us select per iteration while
+// stopped, and couldn't see ^C interrupt requests at all while the target was running.
+static void gdb_network_thread()
 {
-  while (gdb_active())
+  Common::SetCurrentThreadName("GDB stub");
+
+  while (sock != -1)
   {
     if (!gdb_data_available())
       continue;
     gdb_read_command();
     if (cmd_len == 0)
       continue;
-
-    switch (cmd_bfr[0])
-    {
-    case 'q':
-      gdb_handle_query();
-      break;
-    case 'H':
-      gdb_handle_set_thread();
-      break;
-    case '?':
-      gdb_handle_signal();
-      break;
-    case 'k':
-      gdb_deinit();
-      INFO_LOG_FMT(GDB_STUB, "killed by gdb");
-      return;
-    case 'g':
-      gdb_read_registers();
-      break;
-    case 'G':
-      gdb_write_registers();
-      break;
-    case 'p':
-      gdb_read_register();
-      break;
-    case 'P':
-      gdb_write_register();
-      break;
-    case 'm':
-      gdb_read_mem();
-      break;
-    case 'M':
-      gdb_write_mem();
-      PowerPC::ppcState.iCache.Reset();
-      Host_UpdateDisasmDialog();
-      break;
-    case 's':
-      gdb_step();
-      return;
-    case 'C':
-    case 'c':
-      gdb_continue();
-      return;
-    case 'z':
-      gdb_remove_bp();
-      break;
-    case 'Z':
-      _gdb_add_bp();
-      break;
-    default:
-      gdb_reply("");
-      break;
-    }
+    gdb_process_command();
   }
 }
 
@@ -841,47 +1064,49 @@ static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t
   memset(bp_w, 0, sizeof bp_w);
   memset(bp_a, 0, sizeof bp_a);
 
-  tmpsock = socket(domain, SOCK_STREAM, 0);
-  if (tmpsock == -1)
+  const int server_fd = socket(domain, SOCK_STREAM, 0);
+  tmpsock = server_fd;
+  if (server_fd == -1)
     ERROR_LOG_FMT(GDB_STUB, "Failed to create gdb socket");
 
   int on = 1;
-  if (setsockopt(tmpsock, SOL_SOCKET, SO_REUSEADDR, (const char*)&on, sizeof on) < 0)
+  if (setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, (const char*)&on, sizeof on) < 0)
     ERROR_LOG_FMT(GDB_STUB, "Failed to setsockopt");
 
-  if (bind(tmpsock, server_addr, server_addrlen) < 0)
+  if (bind(server_fd, server_addr, server_addrlen) < 0)
     ERROR_LOG_FMT(GDB_STUB, "Failed to bind gdb socket");
 
-  if (listen(tmpsock, 1) < 0)
+  if (listen(server_fd, 1) < 0)
     ERROR_LOG_FMT(GDB_STUB, "Failed to listen to gdb socket");
 
   INFO_LOG_FMT(GDB_STUB, "Waiting for gdb to connect...");
 
-  sock = accept(tmpsock, client_addr, client_addrlen);
+  sock = accept(server_fd, client_addr, client_addrlen);
   if (sock < 0)
     ERROR_LOG_FMT(GDB_STUB, "Failed to accept gdb client");
   INFO_LOG_FMT(GDB_STUB, "Client connected.");
 
 #ifdef _WIN32
-  closesocket(tmpsock);
+  closesocket(server_fd);
 #else
-  close(tmpsock);
+  close(server_fd);
 #endif
   tmpsock = -1;
+
+  if (s_network_thread.joinable())
+    s_network_thread.join();
+  s_network_thread = std::thread(gdb_network_thread);
 }
 
 void gdb_deinit()
 {
-  if (tmpsock != -1)
-  {
-    shutdown(tmpsock, SHUT_RDWR);
-    tmpsock = -1;
-  }
-  if (sock != -1)
-  {
-    shutdown(sock, SHUT_RDWR);
-    sock = -1;
-  }
+  gdb_close_sockets();
+
+  // Closing the socket wakes the network thread so it can exit. Errors on the network
+  // thread itself funnel through here too; it can't join itself, so the final join
+  // happens when the core shuts down.
+  if (s_network_thread.joinable() && s_network_thread.get_id() != std::this_thread::get_id())
+    s_network_thread.join();
 
   s_socket_context.reset();
 }
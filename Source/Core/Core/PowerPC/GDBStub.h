@@ -32,7 +32,6 @@ void gdb_deinit();
 bool gdb_active();
 void gdb_break();
 
-void gdb_handle_exception();
 int gdb_signal(u32 signal);
 
 int gdb_bp_x(u32 addr);
@@ -153,16 +153,6 @@ int Interpreter::SingleStepInner()
     return PPCTables::GetOpInfo(m_prev_inst)->numCycles;
   }
 
-#ifdef USE_GDBSTUB
-  if (gdb_active() && gdb_bp_x(PC))
-  {
-    Host_UpdateDisasmDialog();
-
-    gdb_signal(GDB_SIGTRAP);
-    gdb_handle_exception();
-  }
-#endif
-
   NPC = PC + sizeof(UGeckoInstruction);
   m_prev_inst.hex = PowerPC::Read_Opcode(PC);
 
@@ -242,6 +232,39 @@ void Interpreter::SingleStep()
   }
 }
 
+// Batched stepping for the debugger's "run until" operations, e.g. stepping over a subroutine
+// call during Step Out. Equivalent to calling SingleStep() in a loop until PC reaches
+// end_address or a breakpoint, but services CoreTiming once per slice instead of once per
+// instruction, which is what makes crossing millions of instructions feasible.
+void Interpreter::StepUntil(u32 end_address, std::chrono::steady_clock::time_point deadline)
+{
+  bool stop = false;
+  while (!stop && std::chrono::steady_clock::now() < deadline)
+  {
+    // SingleStep() leaves the downcount at zero, so this also opens the first slice.
+    CoreTiming::Advance();
+
+    while (!stop && PowerPC::ppcState.downcount > 0)
+    {
+      PowerPC::ppcState.downcount -= SingleStepInner();
+
+      if (PowerPC::ppcState.Exceptions)
+      {
+        PowerPC::CheckExceptions();
+        PC = NPC;
+      }
+
+      // Like the single-stepping loops this replaces, always execute at least one instruction
+      // so that a breakpoint on the current PC doesn't stop us before we've moved.
+      stop = PC == end_address || PowerPC::breakpoints.IsAddressBreakPoint(PC);
+    }
+  }
+
+  // Leave the timing state the way SingleStep() would, so subsequent steps behave the same.
+  CoreTiming::g.slice_length = 1;
+  PowerPC::ppcState.downcount = 0;
+}
+
 //#define SHOW_HISTORY
 #ifdef SHOW_HISTORY
 std::vector<int> PCVec;
@@ -283,6 +306,19 @@ void Interpreter::Run()
             PCVec.erase(PCVec.begin());
 #endif
 
+#ifdef USE_GDBSTUB
+          if (gdb_active() && gdb_bp_x(PC))
+          {
+            // The stop packet is sent before the breakpointed instruction runs, and the
+            // run loop is left so the CPU thread parks; the stub's network thread
+            // services the debugger from here on.
+            gdb_signal(GDB_SIGTRAP);
+            CPU::Break();
+            Host_UpdateDisasmDialog();
+            return;
+          }
+#endif
+
           // 2: check for breakpoint
           if (PowerPC::breakpoints.IsAddressBreakPoint(PC))
           {
@@ -328,6 +364,15 @@ void Interpreter::Run()
         int cycles = 0;
         while (!m_end_block)
         {
+#ifdef USE_GDBSTUB
+          if (gdb_active() && gdb_bp_x(PC))
+          {
+            gdb_signal(GDB_SIGTRAP);
+            CPU::Break();
+            Host_UpdateDisasmDialog();
+            return;
+          }
+#endif
           cycles += SingleStepInner();
         }
         PowerPC::ppcState.downcount -= cycles;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 
 #include "Common/CommonTypes.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -16,6 +17,7 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  void StepUntil(u32 end_address, std::chrono::steady_clock::time_point deadline);
 
   void Run() override;
   void ClearCache() override;
@@ -6,6 +6,10 @@
 #include <cmath>
 #include <limits>
 
+#ifdef _M_X86_64
+#include <immintrin.h>
+#endif
+
 #include "Common/BitUtils.h"
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
@@ -230,12 +234,50 @@ inline FPResult NI_sub(UReg_FPSCR* fpscr, double a, double b)
   return result;
 }
 
+#ifdef _M_X86_64
+#ifndef _MSC_VER
+[[gnu::target("fma")]]
+#endif
+inline void PairedFMA_FMA3(double a0, double c0, double b0, double a1, double c1, double b1,
+                           double* d0, double* d1)
+{
+  const __m128d result =
+      _mm_fmadd_pd(_mm_set_pd(a1, a0), _mm_set_pd(c1, c0), _mm_set_pd(b1, b0));
+  _mm_storel_pd(d0, result);
+  _mm_storeh_pd(d1, result);
+}
+#endif
+
+// Computes the fused multiply-adds of both lanes of a paired-single operation
+// at once. With FMA3 this is a single vfmaddpd, whereas std::fma typically
+// expands to one libm call per lane - by far the most expensive part of the
+// ps_madd family when force-interpreting FP-heavy code. Both variants are
+// correctly-rounded fused operations, so the results are identical; flag
+// emulation stays scalar and feeds them through the regular NI_madd/NI_msub
+// checks afterwards.
+inline void PairedFMA(double a0, double c0, double b0, double a1, double c1, double b1, double* d0,
+                      double* d1)
+{
+#ifdef _M_X86_64
+  if (cpu_info.bFMA)
+  {
+    PairedFMA_FMA3(a0, c0, b0, a1, c1, b1, d0, d1);
+    return;
+  }
+#endif
+  *d0 = std::fma(a0, c0, b0);
+  *d1 = std::fma(a1, c1, b1);
+}
+
 // FMA instructions on PowerPC are weird:
 // They calculate (a * c) + b, but the order in which
 // inputs are checked for NaN is still a, b, c.
-inline FPResult NI_madd(UReg_FPSCR* fpscr, double a, double c, double b)
+// The four-argument overloads take a precomputed fma(a, c, +/-b) so the
+// paired-single ops can batch both lanes' fused multiply-adds (see PairedFMA)
+// before any flag handling happens.
+inline FPResult NI_madd(UReg_FPSCR* fpscr, double a, double c, double b, double fused)
 {
-  FPResult result{std::fma(a, c, b)};
+  FPResult result{fused};
 
   if (std::isnan(result.value))
   {
@@ -271,9 +313,14 @@ inline FPResult NI_madd(UReg_FPSCR* fpscr, double a, double c, double b)
   return result;
 }
 
-inline FPResult NI_msub(UReg_FPSCR* fpscr, double a, double c, double b)
+inline FPResult NI_madd(UReg_FPSCR* fpscr, double a, double c, double b)
+{
+  return NI_madd(fpscr, a, c, b, std::fma(a, c, b));
+}
+
+inline FPResult NI_msub(UReg_FPSCR* fpscr, double a, double c, double b, double fused)
 {
-  FPResult result{std::fma(a, c, -b)};
+  FPResult result{fused};
 
   if (std::isnan(result.value))
   {
@@ -309,6 +356,11 @@ inline FPResult NI_msub(UReg_FPSCR* fpscr, double a, double c, double b)
   return result;
 }
 
+inline FPResult NI_msub(UReg_FPSCR* fpscr, double a, double c, double b)
+{
+  return NI_msub(fpscr, a, c, b, std::fma(a, c, -b));
+}
+
 // used by stfsXX instructions and ps_rsqrte
 inline u32 ConvertToSingle(u64 x)
 {
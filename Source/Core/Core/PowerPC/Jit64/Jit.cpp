@@ -3,9 +3,11 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <disasm.h>
 #include <fmt/format.h>
@@ -17,6 +19,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/GekkoDisassembler.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
@@ -42,6 +45,7 @@
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
+#include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/PowerPC/Profiler.h"
 #if defined(_DEBUG) || defined(DEBUGFAST)
@@ -229,11 +233,17 @@ bool Jit64::HandleFault(uintptr_t access_address, SContext* ctx)
   // TODO: do we properly handle off-the-end?
   const auto base_ptr = reinterpret_cast<uintptr_t>(Memory::physical_base);
   if (access_address >= base_ptr && access_address < base_ptr + 0x100010000)
+  {
+    m_physical_fault_count++;
     return BackPatch(static_cast<u32>(access_address - base_ptr), ctx);
+  }
 
   const auto logical_base_ptr = reinterpret_cast<uintptr_t>(Memory::logical_base);
   if (access_address >= logical_base_ptr && access_address < logical_base_ptr + 0x100010000)
+  {
+    m_logical_fault_count++;
     return BackPatch(static_cast<u32>(access_address - logical_base_ptr), ctx);
+  }
 
   return false;
 }
@@ -325,9 +335,61 @@ bool Jit64::BackPatch(u32 emAddress, SContext* ctx)
 
   ctx->CTX_PC = reinterpret_cast<u64>(trampoline);
 
+  // A site that keeps showing up here faults repeatedly — typically because its block keeps
+  // getting invalidated and recompiled — and is a candidate for slowmem fallback storms.
+  m_backpatch_fault_counts[info.pc]++;
+  if (m_physical_fault_count + m_logical_fault_count >= m_next_fault_report_threshold)
+  {
+    LogBackPatchFaultReport();
+    m_next_fault_report_threshold *= 2;
+  }
+
   return true;
 }
 
+void Jit64::LogBackPatchFaultReport()
+{
+  std::vector<std::pair<u32, u64>> sites(m_backpatch_fault_counts.begin(),
+                                         m_backpatch_fault_counts.end());
+  const size_t top = std::min<size_t>(sites.size(), 10);
+  std::partial_sort(sites.begin(), sites.begin() + top, sites.end(),
+                    [](const auto& a, const auto& b) { return a.second > b.second; });
+
+  WARN_LOG_FMT(DYNA_REC, "Fastmem faults: {} physical, {} logical across {} access sites",
+               m_physical_fault_count, m_logical_fault_count, sites.size());
+  for (size_t i = 0; i < top; i++)
+  {
+    WARN_LOG_FMT(DYNA_REC, "  PC {:08x} ({}): {} faults", sites[i].first,
+                 g_symbolDB.GetDescription(sites[i].first), sites[i].second);
+  }
+}
+
+// Invalidates one block whose tier-up was deferred by TierUpBlock. This runs
+// between blocks from CoreTiming::Advance, so no generated code is live.
+static void TierUpEvent(u64 userdata, s64 cycles_late)
+{
+  JitInterface::InvalidateICache(static_cast<u32>(userdata), 4, true);
+}
+
+static CoreTiming::EventType* s_tier_up_event = nullptr;
+
+// The set of addresses that earned hot-tier compilation is persisted per title,
+// so on the next boot those blocks compile with full optimizations the first
+// time they're encountered instead of replaying the cold-run-then-recompile
+// cycle. Only addresses are stored - block contents don't exist until the game
+// loads them, so nothing can be precompiled - and a stale address is merely an
+// optimization-level hint for whatever code now lives there.
+constexpr u32 TIER_UP_CACHE_MAGIC = 0x4A495431;  // "JIT1"
+constexpr u32 TIER_UP_CACHE_MAX_ENTRIES = 1 << 20;
+
+static std::string GetTierUpCacheFilename()
+{
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (game_id.empty())
+    return "";
+  return File::GetUserPath(D_CACHE_IDX) + game_id + ".jitprofile";
+}
+
 void Jit64::Init()
 {
   EnableBlockLink();
@@ -359,6 +421,11 @@ void Jit64::Init()
                               !SConfig::GetInstance().bEnableDebugging;
   m_cleanup_after_stackfault = false;
 
+  m_physical_fault_count = 0;
+  m_logical_fault_count = 0;
+  m_next_fault_report_threshold = 256;
+  m_backpatch_fault_counts.clear();
+
   m_stack = nullptr;
   if (m_enable_blr_optimization)
     AllocStack();
@@ -366,6 +433,11 @@ void Jit64::Init()
   blocks.Init();
   asm_routines.Init(m_stack ? (m_stack + STACK_SIZE) : nullptr);
 
+  s_tier_up_event = CoreTiming::RegisterEvent("JitTierUp", TierUpEvent);
+
+  if (SConfig::GetInstance().bJITTieredMode && !SConfig::GetInstance().bEnableDebugging)
+    LoadTierUpCache();
+
   // important: do this *after* generating the global asm routines, because we can't use farcode in
   // them.
   // it'll crash because the farcode functions get cleared on JIT clears.
@@ -391,6 +463,7 @@ void Jit64::ClearCache()
   Clear();
   UpdateMemoryOptions();
   ResetFreeMemoryRanges();
+  m_cold_reclaim_armed = false;
 }
 
 void Jit64::ResetFreeMemoryRanges()
@@ -402,8 +475,61 @@ void Jit64::ResetFreeMemoryRanges()
   m_free_ranges_far.insert(m_far_code.GetWritableCodePtr(), m_far_code.GetWritableCodeEnd());
 }
 
+void Jit64::LoadTierUpCache()
+{
+  const std::string filename = GetTierUpCacheFilename();
+  if (filename.empty())
+    return;
+
+  File::IOFile file(filename, "rb");
+  if (!file)
+    return;
+
+  u32 magic = 0;
+  u32 count = 0;
+  if (!file.ReadArray(&magic, 1) || magic != TIER_UP_CACHE_MAGIC || !file.ReadArray(&count, 1) ||
+      count > TIER_UP_CACHE_MAX_ENTRIES)
+  {
+    return;
+  }
+
+  std::vector<u32> addresses(count);
+  if (!file.ReadArray(addresses.data(), addresses.size()))
+    return;
+
+  m_tier_up_addresses.insert(addresses.begin(), addresses.end());
+  INFO_LOG_FMT(DYNA_REC, "Preseeded {} hot blocks from {}", count, filename);
+}
+
+void Jit64::SaveTierUpCache() const
+{
+  const std::string filename = GetTierUpCacheFilename();
+  if (filename.empty() || m_tier_up_addresses.empty())
+    return;
+
+  std::vector<u32> addresses(m_tier_up_addresses.begin(), m_tier_up_addresses.end());
+  if (addresses.size() > TIER_UP_CACHE_MAX_ENTRIES)
+    addresses.resize(TIER_UP_CACHE_MAX_ENTRIES);
+  // Deterministic file contents, and keeps related code nearby in the set's
+  // iteration order on the next boot.
+  std::sort(addresses.begin(), addresses.end());
+
+  File::IOFile file(filename, "wb");
+  if (!file)
+    return;
+
+  const u32 magic = TIER_UP_CACHE_MAGIC;
+  const u32 count = static_cast<u32>(addresses.size());
+  file.WriteArray(&magic, 1);
+  file.WriteArray(&count, 1);
+  file.WriteArray(addresses.data(), addresses.size());
+}
+
 void Jit64::Shutdown()
 {
+  if (SConfig::GetInstance().bJITTieredMode && !SConfig::GetInstance().bEnableDebugging)
+    SaveTierUpCache();
+
   FreeStack();
   FreeCodeSpace();
 
@@ -460,7 +586,9 @@ void Jit64::HLEFunction(u32 hook_index)
   gpr.Flush();
   fpr.Flush();
   ABI_PushRegistersAndAdjustStack({}, 0);
-  ABI_CallFunctionCC(HLE::Execute, js.compilerPC, hook_index);
+  // The hook index is a compile-time constant here, so call the hooked function
+  // directly rather than going through the table lookup in HLE::Execute.
+  ABI_CallFunction(HLE::GetHookFunctionByIndex(hook_index));
   ABI_PopRegistersAndAdjustStack({}, 0);
 }
 
@@ -742,6 +870,60 @@ void Jit64::Trace()
                 PC, SRR0, SRR1, FPSCR.Hex, MSR.Hex, PowerPC::ppcState.spr[8], regs, fregs);
 }
 
+void Jit64::TierUpBlock(Jit64& jit, u32 em_address)
+{
+  // Tier up the hot successor chain, not just the block that tripped the
+  // counter. All blocks in the chain are invalidated together and recompile on
+  // demand in execution order, and since SetEmitterStateToFreeCodeRegion hands
+  // consecutive compilations adjacent code space, the chain ends up laid out
+  // contiguously - which lets WriteLinkBlock replace the jump between
+  // fallthrough-linked blocks with nothing at all.
+  u32 address = em_address;
+  u32 msr = MSR.Hex;
+  for (size_t length = 0; length < TIER_UP_MAX_CHAIN_LENGTH; length++)
+  {
+    if (!jit.m_tier_up_addresses.insert(address).second)
+      break;
+
+    // Pick the hottest successor by run count before invalidating, since
+    // invalidation destroys the block along with its link data. Successors
+    // that haven't crossed half the threshold themselves stay at the cold
+    // tier; the rarely-taken side of a branch shouldn't ride along.
+    const JitBlock* block = jit.blocks.GetBlockFromStartAddress(address, msr);
+    u32 next_address = 0;
+    bool have_next = false;
+    if (block)
+    {
+      msr = block->msrBits;
+      u64 best_count = TIER_UP_THRESHOLD / 2;
+      for (const JitBlock::LinkData& e : block->linkData)
+      {
+        const JitBlock* dest = jit.blocks.GetBlockFromStartAddress(e.exitAddress, msr);
+        if (dest && dest->profile_data.runCount >= best_count)
+        {
+          best_count = dest->profile_data.runCount;
+          next_address = e.exitAddress;
+          have_next = true;
+        }
+      }
+    }
+
+    // Don't invalidate here: during scene transitions many blocks cross the
+    // threshold within the same frame, and invalidating whole chains at once
+    // means a burst of expensive hot-tier recompiles in a single frame. Each
+    // invalidation (and hence recompile) is instead scheduled a slice of
+    // emulated time apart; until it fires, the block keeps running at the cold
+    // tier. The stub that called us only fires once (it tests for equality
+    // with the threshold), so deferral can't retrigger it.
+    CoreTiming::ScheduleEvent(static_cast<s64>(length) * TIER_UP_SPACING_CYCLES, s_tier_up_event,
+                              address);
+
+    if (!have_next)
+      break;
+    address = next_address;
+  }
+}
+
 void Jit64::Jit(u32 em_address)
 {
   Jit(em_address, true);
@@ -776,6 +958,42 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     m_free_ranges_far.insert(range.first, range.second);
   blocks.ClearRangesToFree();
 
+  // Incremental code-space reclamation: once the largest free chunk of the near
+  // region runs low, open an observation epoch. Blocks stamp the epoch on every
+  // entry, so if codegen later runs out of space, the blocks that never executed
+  // during the observation window can be freed instead of wiping the whole cache.
+  if (!m_cold_reclaim_armed)
+  {
+    const auto largest_near = m_free_ranges_near.by_size_begin();
+    if (largest_near == m_free_ranges_near.by_size_end() ||
+        static_cast<size_t>(largest_near.to() - largest_near.from()) < COLD_RECLAIM_ARM_THRESHOLD)
+    {
+      blocks.StartColdBlockDetection();
+      m_cold_reclaim_armed = true;
+    }
+  }
+
+  // Tiered recompilation: cold blocks are analyzed with the expensive merge and
+  // branch-following passes disabled, and count their executions; once a block
+  // crosses TIER_UP_THRESHOLD it is invalidated and recompiled with full
+  // optimizations (see DoJit). Debugging and block profiling want consistent
+  // codegen, so they bypass the tiers.
+  m_tiered_compilation = SConfig::GetInstance().bJITTieredMode &&
+                         !SConfig::GetInstance().bEnableDebugging && !jo.profile_blocks;
+  if (!m_tiered_compilation ||
+      m_tier_up_addresses.find(em_address) != m_tier_up_addresses.end())
+  {
+    EnableOptimization();
+  }
+  else
+  {
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_RLWIMI_MERGE);
+  }
+
   std::size_t block_size = m_code_buffer.size();
 
   if (SConfig::GetInstance().bEnableDebugging)
@@ -798,6 +1016,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
         analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+        analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_RLWIMI_MERGE);
       }
       Trace();
     }
@@ -846,11 +1065,30 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
       return;
     }
+
+    // Code generation overflowed the free region; drop the half-built block before
+    // reclaiming space or clearing the cache.
+    blocks.EraseUnfinalizedBlock(*b);
   }
 
   if (clear_cache_and_retry_on_failure)
   {
-    // Code generation failed due to not enough free space in either the near or far code regions.
+    // Code generation failed due to not enough free space in either the near or far code
+    // regions. If an observation epoch is open, free the blocks that have not executed
+    // since it began and retry; hot blocks keep their code and only truly cold ones
+    // recompile on their next use.
+    if (m_cold_reclaim_armed)
+    {
+      m_cold_reclaim_armed = false;
+      if (blocks.ReclaimColdBlocks() != 0)
+      {
+        WARN_LOG_FMT(POWERPC, "reclaiming cold JIT blocks instead of a full cache clear");
+        Jit(em_address, true);
+        return;
+      }
+    }
+
+    // Nothing to reclaim (e.g. extreme fragmentation by blocks that are all still hot).
     // Clear the entire JIT cache and retry.
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
     ClearCache();
@@ -921,6 +1159,34 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     ADD(64, MDisp(ABI_PARAM1, offset), Imm8(1));
     ABI_CallFunction(QueryPerformanceCounter);
   }
+
+  // Stamp the block with the current code-space reclamation epoch on every entry,
+  // so ReclaimColdBlocks() can tell which blocks still execute. The register
+  // allocators haven't started yet, so the scratch registers are free here.
+  MOV(64, R(RSCRATCH2), ImmPtr(blocks.GetBlockEpochPointer()));
+  MOV(32, R(RSCRATCH), MatR(RSCRATCH2));
+  MOV(64, R(RSCRATCH2), ImmPtr(&b->last_used_epoch));
+  MOV(32, MatR(RSCRATCH2), R(RSCRATCH));
+
+  // Count executions of blocks compiled at the cold tier, and tier up once the
+  // count crosses the threshold. The register allocators haven't started yet,
+  // so no guest state is cached in host registers when the stub runs.
+  if (m_tiered_compilation &&
+      m_tier_up_addresses.find(em_address) == m_tier_up_addresses.end())
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&b->profile_data.runCount));
+    ADD(64, MatR(RSCRATCH), Imm8(1));
+    CMP(64, MatR(RSCRATCH), Imm32(TIER_UP_THRESHOLD));
+    FixupBranch tier_up = J_CC(CC_E, true);
+    SwitchToFarCode();
+    SetJumpTarget(tier_up);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPC(TierUpBlock, this, js.blockStart);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, true);
+    SwitchToNearCode();
+  }
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
@@ -1005,10 +1271,19 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     {
       js.fifoBytesSinceCheck = 0;
       js.mustCheckFifo = false;
+
+      // Inline the watermark check (as in Cleanup) so that in the common case of the
+      // pipe not holding a full burst yet, we only pay for a compare and an untaken
+      // branch instead of spilling every caller-saved register for the call.
+      MOV(64, R(RSCRATCH), PPCSTATE(gather_pipe_ptr));
+      SUB(64, R(RSCRATCH), PPCSTATE(gather_pipe_base_ptr));
+      CMP(64, R(RSCRATCH), Imm32(GPFifo::GATHER_PIPE_SIZE));
+      FixupBranch no_burst = J_CC(CC_L);
       BitSet32 registersInUse = CallerSavedRegistersInUse();
       ABI_PushRegistersAndAdjustStack(registersInUse, 0);
-      ABI_CallFunction(GPFifo::FastCheckGatherPipe);
+      ABI_CallFunction(GPFifo::UpdateGatherPipe);
       ABI_PopRegistersAndAdjustStack(registersInUse, 0);
+      SetJumpTarget(no_burst);
       gatherPipeIntCheck = true;
     }
 
@@ -1240,6 +1515,7 @@ void Jit64::EnableOptimization()
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
   analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  analyzer.SetOption(PPCAnalyst::PPCAnalyzer::OPTION_RLWIMI_MERGE);
 }
 
 void Jit64::IntializeSpeculativeConstants()
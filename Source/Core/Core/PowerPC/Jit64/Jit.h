@@ -17,6 +17,9 @@
 // ----------
 #pragma once
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <rangeset/rangesizeset.h>
 
 #include "Common/CommonTypes.h"
@@ -108,6 +111,7 @@ public:
   void DoMergedBranch();
   void DoMergedBranchCondition();
   void DoMergedBranchImmediate(s64 val);
+  bool TryFuseRlwinmRlwimi(UGeckoInstruction inst);
 
   // Reads a given bit of a given CR register part.
   void GetCRFieldBit(int field, int bit, Gen::X64Reg out, bool negate = false);
@@ -252,6 +256,17 @@ private:
 
   bool HandleFunctionHooking(u32 address);
 
+  // Called from generated code when a cold-tier block crosses TIER_UP_THRESHOLD.
+  static void TierUpBlock(Jit64& jit, u32 em_address);
+
+  // Persist the hot-tier address set per title so the next boot skips the
+  // cold-run-then-recompile cycle for blocks that are known to get hot.
+  void LoadTierUpCache();
+  void SaveTierUpCache() const;
+
+  // Logs a symbolized report of the guest access sites with the most fastmem faults.
+  void LogBackPatchFaultReport();
+
   void AllocStack();
   void FreeStack();
 
@@ -269,6 +284,36 @@ private:
   bool m_cleanup_after_stackfault;
   u8* m_stack;
 
+  // Tiered recompilation: cold blocks are compiled with the expensive analysis
+  // passes disabled and count their executions; once a block crosses the
+  // threshold, it is recompiled with full optimizations.
+  static constexpr u64 TIER_UP_THRESHOLD = 256;
+  // How many successor blocks TierUpBlock() will pull up along with the block
+  // that crossed the threshold, so hot chains recompile (and get placed)
+  // together.
+  static constexpr size_t TIER_UP_MAX_CHAIN_LENGTH = 8;
+  // Emulated cycles between the deferred invalidations of a tiered-up chain,
+  // spreading the hot-tier recompiles out instead of hitting them all in one
+  // frame (~0.4 ms of GameCube CPU time apiece).
+  static constexpr s64 TIER_UP_SPACING_CYCLES = 200000;
+  bool m_tiered_compilation = false;
+  std::unordered_set<u32> m_tier_up_addresses;
+
+  // Fastmem fault telemetry: faults reaching BackPatch are counted per memory region and per
+  // guest access site, and a top-site report is logged at exponentially spaced fault-count
+  // milestones, so slowmem fallback storms can be traced to the guest code responsible.
+  u64 m_physical_fault_count = 0;
+  u64 m_logical_fault_count = 0;
+  u64 m_next_fault_report_threshold = 256;
+  std::unordered_map<u32, u64> m_backpatch_fault_counts;
+
+  // Incremental code-space reclamation: when the largest free chunk of the near
+  // region drops below this, an observation epoch is opened so a later space
+  // failure can free the blocks that stopped executing instead of clearing the
+  // whole cache.
+  static constexpr size_t COLD_RECLAIM_ARM_THRESHOLD = 4 * 1024 * 1024;
+  bool m_cold_reclaim_armed = false;
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_near;
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_far;
 };
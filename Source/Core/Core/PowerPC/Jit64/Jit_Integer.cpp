@@ -1849,6 +1849,69 @@ void Jit64::arithcx(UGeckoInstruction inst)
     ComputeRC(d);
 }
 
+bool Jit64::TryFuseRlwinmRlwimi(UGeckoInstruction inst)
+{
+  // Games frequently pack bitfields with a rlwinm defining a register followed by a rlwimi
+  // inserting a second field into it. The pair collapses to
+  //   Ra = (rotl(Rs, SH) & mask & ~mask2) | (rotl(Rs2, SH2) & mask2)
+  // which skips materializing the intermediate value and one mask round-trip.
+  if (!analyzer.HasOption(PPCAnalyst::PPCAnalyzer::OPTION_RLWIMI_MERGE))
+    return false;
+
+  if (inst.Rc || !CanMergeNextInstructions(1))
+    return false;
+
+  const UGeckoInstruction next = js.op[1].inst;
+  if (next.OPCD != 20 /* rlwimix */ || next.RA != inst.RA || next.RS == inst.RA)
+    return false;
+
+  const u32 mask = MakeRotationMask(inst.MB, inst.ME);
+  const u32 mask2 = MakeRotationMask(next.MB, next.ME);
+  // Trivial insert masks are better served by the individual handlers, and a first field which
+  // is completely overwritten would need a separate zeroing path.
+  if (mask2 == 0 || mask2 == 0xFFFFFFFF || (mask & ~mask2) == 0)
+    return false;
+
+  const int a = inst.RA;
+  const int s = inst.RS;
+  const int s2 = next.RS;
+
+  if (gpr.IsImm(s2))
+  {
+    RCOpArg Rs = gpr.Use(s, RCMode::Read);
+    RCX64Reg Ra = gpr.Bind(a, RCMode::Write);
+    RegCache::Realize(Rs, Ra);
+
+    RotateLeft(32, Ra, Rs, inst.SH);
+    AndWithMask(Ra, mask & ~mask2);
+    const u32 insert = Common::RotateLeft(gpr.Imm32(s2), next.SH) & mask2;
+    if (insert != 0)
+      OR(32, Ra, Imm32(insert));
+  }
+  else
+  {
+    RCOpArg Rs = gpr.Use(s, RCMode::Read);
+    RCOpArg Rs2 = gpr.Use(s2, RCMode::Read);
+    RCX64Reg Ra = gpr.Bind(a, RCMode::Write);
+    RegCache::Realize(Rs, Rs2, Ra);
+
+    // Build the inserted field in RSCRATCH first, as Rs may alias Ra.
+    RotateLeft(32, RSCRATCH, Rs2, next.SH);
+    AndWithMask(RSCRATCH, mask2);
+    RotateLeft(32, Ra, Rs, inst.SH);
+    AndWithMask(Ra, mask & ~mask2);
+    OR(32, Ra, R(RSCRATCH));
+  }
+
+  if (next.Rc)
+    ComputeRC(a);
+
+  // Account for the consumed rlwimi.
+  js.downcountAmount++;
+  js.skipInstructions = 1;
+  return true;
+}
+
 void Jit64::rlwinmx(UGeckoInstruction inst)
 {
   INSTRUCTION_START
@@ -1868,6 +1931,9 @@ void Jit64::rlwinmx(UGeckoInstruction inst)
   }
   else
   {
+    if (TryFuseRlwinmRlwimi(inst))
+      return;
+
     const bool left_shift = inst.SH && inst.MB == 0 && inst.ME == 31 - inst.SH;
     const bool right_shift = inst.SH && inst.ME == 31 && inst.MB == 32 - inst.SH;
     const bool field_extract = inst.SH && inst.ME == 31 && inst.MB > 32 - inst.SH;
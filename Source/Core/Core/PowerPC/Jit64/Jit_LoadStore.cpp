@@ -171,11 +171,17 @@ void Jit64::lXXx(UGeckoInstruction inst)
     }
     else
     {
-      // If we're using reg+reg mode and b is an immediate, pretend we're using constant offset mode
-      const bool use_constant_offset = !indexed || gpr.IsImm(b);
+      // If we're using reg+reg mode and either operand is an immediate, pretend we're using
+      // constant offset mode so the immediate folds into the load's displacement. lis/ori-built
+      // bases feeding lXXx land here with the immediate in a; updating forms still write a, so
+      // they can't treat it as a plain offset.
+      const bool use_imm_a_as_offset = indexed && !update && gpr.IsImm(a) && !gpr.IsImm(b);
+      const bool use_constant_offset = !indexed || gpr.IsImm(b) || use_imm_a_as_offset;
 
       s32 offset = 0;
-      if (use_constant_offset)
+      if (use_imm_a_as_offset)
+        offset = gpr.SImm32(a);
+      else if (use_constant_offset)
         offset = indexed ? gpr.SImm32(b) : (s32)inst.SIMM_16;
 
       RCOpArg Rb = use_constant_offset ? RCOpArg{} : gpr.Use(b, RCMode::Read);
@@ -184,7 +190,7 @@ void Jit64::lXXx(UGeckoInstruction inst)
       // the load address.
       if ((update || use_constant_offset) && !jo.memcheck)
       {
-        opAddress = gpr.Bind(a, update ? RCMode::ReadWrite : RCMode::Read);
+        opAddress = gpr.Bind(use_imm_a_as_offset ? b : a, update ? RCMode::ReadWrite : RCMode::Read);
         RegCache::Realize(opAddress, Rb);
 
         if (!use_constant_offset)
@@ -199,7 +205,7 @@ void Jit64::lXXx(UGeckoInstruction inst)
         storeAddress = true;
         // In this case we need an extra temporary register.
         opAddress = RCOpArg::R(RSCRATCH2);
-        RCOpArg Ra = gpr.Use(a, RCMode::Read);
+        RCOpArg Ra = gpr.Use(use_imm_a_as_offset ? b : a, RCMode::Read);
         RegCache::Realize(opAddress, Ra, Rb);
 
         if (use_constant_offset)
@@ -718,9 +718,14 @@ void Jit64::mtfsb0x(UGeckoInstruction inst)
   else
   {
     MOV(32, R(RSCRATCH), PPCSTATE(fpscr));
+    MOV(32, R(RSCRATCH2), R(RSCRATCH));
     AND(32, R(RSCRATCH), Imm32(mask));
     MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
+    // Skip the expensive MXCSR reload when the bit was already clear.
+    TEST(32, R(RSCRATCH2), Imm32(~mask));
+    FixupBranch rounding_unchanged = J_CC(CC_Z);
     UpdateMXCSR();
+    SetJumpTarget(rounding_unchanged);
   }
 }
 
@@ -741,11 +746,19 @@ void Jit64::mtfsb1x(UGeckoInstruction inst)
   }
   else
   {
+    if (inst.CRBD >= 29)
+      MOV(32, R(RSCRATCH2), R(RSCRATCH));
     OR(32, R(RSCRATCH), Imm32(mask));
   }
   MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
   if (inst.CRBD >= 29)
+  {
+    // Skip the expensive MXCSR reload when the bit was already set.
+    TEST(32, R(RSCRATCH2), Imm32(mask));
+    FixupBranch rounding_unchanged = J_CC(CC_NZ);
     UpdateMXCSR();
+    SetJumpTarget(rounding_unchanged);
+  }
 }
 
 void Jit64::mtfsfix(UGeckoInstruction inst)
@@ -759,13 +772,22 @@ void Jit64::mtfsfix(UGeckoInstruction inst)
   u32 and_mask = ~(0xF0000000 >> (4 * inst.CRFD));
 
   MOV(32, R(RSCRATCH), PPCSTATE(fpscr));
+  if (inst.CRFD == 7)
+    MOV(32, R(RSCRATCH2), R(RSCRATCH));
   AND(32, R(RSCRATCH), Imm32(and_mask));
   OR(32, R(RSCRATCH), Imm32(or_mask));
   MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
 
-  // Field 7 contains NI and RN.
+  // Field 7 contains NI and RN. Most writes restore the value already in place, so check the
+  // rounding bits before paying for the MXCSR reload.
   if (inst.CRFD == 7)
+  {
+    XOR(32, R(RSCRATCH2), R(RSCRATCH));
+    TEST(32, R(RSCRATCH2), Imm32(7));
+    FixupBranch rounding_unchanged = J_CC(CC_Z);
     LDMXCSR(MConst(s_fpscr_to_mxcsr, imm & 7));
+    SetJumpTarget(rounding_unchanged);
+  }
 }
 
 void Jit64::mtfsfx(UGeckoInstruction inst)
@@ -798,8 +820,22 @@ void Jit64::mtfsfx(UGeckoInstruction inst)
     AND(32, R(RSCRATCH2), Imm32(~mask));
     OR(32, R(RSCRATCH), R(RSCRATCH2));
   }
-  MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
 
   if (inst.FM & 1)
+  {
+    // FPSCR writes rarely change NI/RN in practice (games commonly save and restore FPSCR
+    // around library calls), so skip the expensive MXCSR reload when the rounding bits are
+    // unchanged.
+    MOV(32, R(RSCRATCH2), R(RSCRATCH));
+    XOR(32, R(RSCRATCH2), PPCSTATE(fpscr));
+    MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
+    TEST(32, R(RSCRATCH2), Imm32(7));
+    FixupBranch rounding_unchanged = J_CC(CC_Z);
     UpdateMXCSR();
+    SetJumpTarget(rounding_unchanged);
+  }
+  else
+  {
+    MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
+  }
 }
@@ -43,17 +43,7 @@ BitSet32 FPURegCache::GetRegUtilization() const
   return m_jit.js.op->fprInXmm;
 }
 
-BitSet32 FPURegCache::CountRegsIn(preg_t preg, u32 lookahead) const
+BitSet32 FPURegCache::GetRegsIn(const PPCAnalyst::CodeOp& op) const
 {
-  BitSet32 regs_used;
-
-  for (u32 i = 1; i < lookahead; i++)
-  {
-    BitSet32 regs_in = m_jit.js.op[i].fregsIn;
-    regs_used |= regs_in;
-    if (regs_in[preg])
-      return regs_used;
-  }
-
-  return regs_used;
+  return op.fregsIn;
 }
@@ -19,5 +19,5 @@ protected:
   void LoadRegister(preg_t preg, Gen::X64Reg new_loc) override;
   const Gen::X64Reg* GetAllocationOrder(size_t* count) const override;
   BitSet32 GetRegUtilization() const override;
-  BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const override;
+  BitSet32 GetRegsIn(const PPCAnalyst::CodeOp& op) const override;
 };
@@ -294,6 +294,7 @@ RegCache::RegCache(Jit64& jit) : m_jit{jit}
 
 void RegCache::Start()
 {
+  m_lookahead_cache_op = nullptr;
   m_xregs.fill({});
   for (size_t i = 0; i < m_regs.size(); i++)
   {
@@ -657,12 +658,8 @@ float RegCache::ScoreRegister(X64Reg xreg) const
   // writing it back to the register file isn't quite as bad.
   if (GetRegUtilization()[preg])
   {
-    // Don't look too far ahead; we don't want to have quadratic compilation times for
-    // enormous block sizes!
-    // This actually improves register allocation a tiny bit; I'm not sure why.
-    u32 lookahead = std::min(m_jit.js.instructionsLeft, 64);
     // Count how many other registers are going to be used before we need this one again.
-    u32 regs_in_count = CountRegsIn(preg, lookahead).Count();
+    u32 regs_in_count = CountRegsInAhead(preg);
     // Totally ad-hoc heuristic to bias based on how many other registers we'll need
     // before this one gets used again.
     score += 1 + 2 * (5 - log2f(1 + (float)regs_in_count));
@@ -671,6 +668,44 @@ float RegCache::ScoreRegister(X64Reg xreg) const
   return score;
 }
 
+// Count how many other registers are read before preg is needed again. The
+// spill heuristic asks this for every candidate at the same compile position,
+// so the counts for all pregs are computed in a single pass over the lookahead
+// window and cached until the compiler moves to the next instruction.
+u32 RegCache::CountRegsInAhead(preg_t preg) const
+{
+  const PPCAnalyst::CodeOp* op = m_jit.js.op;
+  if (m_lookahead_cache_op != op)
+  {
+    m_lookahead_cache_op = op;
+
+    // Don't look too far ahead; we don't want to have quadratic compilation times for
+    // enormous block sizes!
+    // This actually improves register allocation a tiny bit; I'm not sure why.
+    const u32 lookahead = std::min(m_jit.js.instructionsLeft, 64);
+
+    BitSet32 regs_used;
+    BitSet32 seen;
+    for (u32 i = 1; i < lookahead; i++)
+    {
+      const BitSet32 regs_in = GetRegsIn(op[i]);
+      regs_used |= regs_in;
+      for (int reg : regs_in & ~seen)
+        m_lookahead_counts[reg] = static_cast<u8>(regs_used.Count());
+      seen |= regs_in;
+    }
+
+    // Registers not read within the window count everything that is.
+    const u8 total = static_cast<u8>(regs_used.Count());
+    for (size_t reg = 0; reg < m_lookahead_counts.size(); reg++)
+    {
+      if (!seen[static_cast<int>(reg)])
+        m_lookahead_counts[reg] = total;
+    }
+  }
+  return m_lookahead_counts[preg];
+}
+
 const OpArg& RegCache::R(preg_t preg) const
 {
   ASSERT_MSG(DYNA_REC, !m_regs[preg].IsDiscarded(), "Discarded register - %zu", preg);
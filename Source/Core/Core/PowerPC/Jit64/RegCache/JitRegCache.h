@@ -191,7 +191,7 @@ protected:
   virtual const Gen::X64Reg* GetAllocationOrder(size_t* count) const = 0;
 
   virtual BitSet32 GetRegUtilization() const = 0;
-  virtual BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const = 0;
+  virtual BitSet32 GetRegsIn(const PPCAnalyst::CodeOp& op) const = 0;
 
   void FlushX(Gen::X64Reg reg);
   void DiscardRegContentsIfCached(preg_t preg);
@@ -202,6 +202,7 @@ protected:
 
   int NumFreeRegisters() const;
   float ScoreRegister(Gen::X64Reg xreg) const;
+  u32 CountRegsInAhead(preg_t preg) const;
 
   const Gen::OpArg& R(preg_t preg) const;
   Gen::X64Reg RX(preg_t preg) const;
@@ -220,4 +221,8 @@ protected:
   std::array<X64CachedReg, NUM_XREGS> m_xregs;
   std::array<RCConstraint, 32> m_constraints;
   Gen::XEmitter* m_emitter = nullptr;
+
+  // Per-instruction cache for the spill heuristic; see CountRegsInAhead().
+  mutable const PPCAnalyst::CodeOp* m_lookahead_cache_op = nullptr;
+  mutable std::array<u8, 32> m_lookahead_counts{};
 };
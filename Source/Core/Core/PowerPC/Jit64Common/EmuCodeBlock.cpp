@@ -317,6 +317,94 @@ void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
   }
 }
 
+// Visitor that generates code to write a MMIO value.
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+  MMIOWriteCodeGenerator(Gen::X64CodeBlock* code, BitSet32 registers_in_use, const Gen::OpArg& src,
+                         u32 address)
+      : m_code(code), m_registers_in_use(registers_in_use), m_src(src), m_address(address)
+  {
+  }
+
+  void VisitNop() override
+  {
+    // Do nothing
+  }
+  void VisitDirect(T* addr, u32 mask) override { WriteToAddrMasked(8 * sizeof(T), addr, mask); }
+  void VisitComplex(const std::function<void(u32, T)>* lambda) override
+  {
+    CallLambda(8 * sizeof(T), lambda);
+  }
+
+private:
+  void WriteToAddrMasked(int sbits, void* ptr, u32 mask)
+  {
+    m_code->MOV(64, R(RSCRATCH2), ImmPtr(ptr));
+
+    const u32 all_ones = (1ULL << sbits) - 1;
+    if ((all_ones & mask) == all_ones)
+    {
+      m_code->MOV(sbits, MatR(RSCRATCH2), m_src);
+    }
+    else if (m_src.IsImm())
+    {
+      const u32 masked = m_src.Imm32() & mask;
+      if (sbits == 8)
+        m_code->MOV(sbits, MatR(RSCRATCH2), Gen::Imm8(masked));
+      else if (sbits == 16)
+        m_code->MOV(sbits, MatR(RSCRATCH2), Gen::Imm16(masked));
+      else
+        m_code->MOV(sbits, MatR(RSCRATCH2), Gen::Imm32(masked));
+    }
+    else
+    {
+      m_code->MOVZX(32, sbits, RSCRATCH, m_src);
+      m_code->AND(32, R(RSCRATCH), Gen::Imm32(mask));
+      m_code->MOV(sbits, MatR(RSCRATCH2), R(RSCRATCH));
+    }
+  }
+
+  void CallLambda(int sbits, const std::function<void(u32, T)>* lambda)
+  {
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    m_code->ABI_CallLambdaCA(sbits, lambda, m_address, m_src);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+  }
+
+  Gen::X64CodeBlock* m_code;
+  BitSet32 m_registers_in_use;
+  Gen::OpArg m_src;
+  u32 m_address;
+};
+
+void EmuCodeBlock::MMIOWriteRegToAddr(MMIO::Mapping* mmio, const Gen::OpArg& arg,
+                                      BitSet32 registers_in_use, u32 address, int access_size)
+{
+  switch (access_size)
+  {
+  case 8:
+  {
+    MMIOWriteCodeGenerator<u8> gen(this, registers_in_use, arg, address);
+    mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+    break;
+  }
+  case 16:
+  {
+    MMIOWriteCodeGenerator<u16> gen(this, registers_in_use, arg, address);
+    mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+    break;
+  }
+  case 32:
+  {
+    MMIOWriteCodeGenerator<u32> gen(this, registers_in_use, arg, address);
+    mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+    break;
+  }
+  }
+}
+
 void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize,
                                  s32 offset, BitSet32 registersInUse, bool signExtend, int flags)
 {
@@ -648,6 +736,15 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     WriteToConstRamAddress(accessSize, arg, address);
     return false;
   }
+
+  // If the address maps to an MMIO register, inline MMIO write code.
+  const u32 mmio_address =
+      accessSize == 64 ? 0 : PowerPC::IsOptimizableMMIOAccess(address, accessSize);
+  if (mmio_address)
+  {
+    MMIOWriteRegToAddr(Memory::mmio_mapping.get(), arg, registersInUse, mmio_address, accessSize);
+    return false;
+  }
   else
   {
     // Helps external systems know which instruction triggered the write
@@ -221,9 +221,9 @@ void JitArm64::HLEFunction(u32 hook_index)
   gpr.Flush(FlushMode::All);
   fpr.Flush(FlushMode::All);
 
-  MOVP2R(ARM64Reg::X8, &HLE::Execute);
-  MOVI2R(ARM64Reg::W0, js.compilerPC);
-  MOVI2R(ARM64Reg::W1, hook_index);
+  // The hook index is a compile-time constant here, so call the hooked function
+  // directly rather than going through the table lookup in HLE::Execute.
+  MOVP2R(ARM64Reg::X8, HLE::GetHookFunctionByIndex(hook_index));
   BLR(ARM64Reg::X8);
 }
 
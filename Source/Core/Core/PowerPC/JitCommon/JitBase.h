@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "Common/BitSet.h"
@@ -104,6 +105,10 @@ protected:
 
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
+    // How often a block's GQR constant guess turned out wrong. Blocks are only
+    // added to pairedQuantizeAddresses once this crosses a small threshold;
+    // until then they are recompiled specialized to the new GQR values.
+    std::unordered_map<u32, int> pairedQuantizeRetries;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
   };
 
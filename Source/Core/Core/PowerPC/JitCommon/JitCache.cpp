@@ -20,6 +20,7 @@
 #include "Common/JitRegister.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/PerformanceFlightRecorder.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
@@ -33,8 +34,8 @@ using namespace Gen;
 
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
-  return physical_addresses.lower_bound(address) !=
-         physical_addresses.lower_bound(address + length);
+  return std::lower_bound(physical_addresses.begin(), physical_addresses.end(), address) !=
+         std::lower_bound(physical_addresses.begin(), physical_addresses.end(), address + length);
 }
 
 JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
@@ -64,6 +65,7 @@ void JitBaseBlockCache::Clear()
 #endif
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
+  m_jit.js.pairedQuantizeRetries.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
@@ -75,6 +77,7 @@ void JitBaseBlockCache::Clear()
   valid_block.ClearAll();
 
   fast_block_map.fill(nullptr);
+  second_level_block_map.fill(nullptr);
 }
 
 void JitBaseBlockCache::Reset()
@@ -103,16 +106,23 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
   b.msrBits = MSR.Hex & JIT_CACHE_MSR_MASK;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+  // Freshly compiled blocks count as used in the current epoch, so a sweep right
+  // after compilation doesn't throw them away again.
+  b.last_used_epoch = m_block_epoch;
   return &b;
 }
 
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
-                                      const std::set<u32>& physical_addresses)
+                                      const std::vector<u32>& physical_addresses)
 {
+  Core::FlightRecorder::CountJitBlockCompiled();
+
   size_t index = FastLookupIndexForAddress(block.effectiveAddress);
   fast_block_map[index] = &block;
   block.fast_block_map_index = index;
 
+  InsertIntoSecondLevelMap(&block);
+
   block.physical_addresses = physical_addresses;
 
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
@@ -199,6 +209,22 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
     else
       valid_block.Clear(pAddr / 32);
   }
+  else
+  {
+    // A larger invalidation (e.g. a DVD read or DMA into RAM) only needs the
+    // expensive block_range_map walk if one of its cachelines actually
+    // overlaps a block, which valid_block answers with a bit test per line.
+    destroy_block = false;
+    const u32 last_line = (pAddr + length - 1) / 32;
+    for (u32 line = pAddr / 32; line <= last_line; line++)
+    {
+      if (valid_block.Test(line))
+      {
+        destroy_block = true;
+        break;
+      }
+    }
+  }
 
   if (destroy_block)
   {
@@ -269,6 +295,63 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
   }
 }
 
+const u32* JitBaseBlockCache::GetBlockEpochPointer() const
+{
+  return &m_block_epoch;
+}
+
+void JitBaseBlockCache::StartColdBlockDetection()
+{
+  m_block_epoch++;
+}
+
+u32 JitBaseBlockCache::ReclaimColdBlocks()
+{
+  const u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  u32 reclaimed = 0;
+  auto iter = block_map.begin();
+  while (iter != block_map.end())
+  {
+    JitBlock& block = iter->second;
+    if (block.last_used_epoch == m_block_epoch)
+    {
+      ++iter;
+      continue;
+    }
+
+    // Remove the block from all macro blocks it occupies.
+    for (u32 addr : block.physical_addresses)
+    {
+      auto range = block_range_map.find(addr & range_mask);
+      if (range != block_range_map.end())
+      {
+        range->second.erase(&block);
+        if (range->second.empty())
+          block_range_map.erase(range);
+      }
+    }
+
+    DestroyBlock(block);
+    iter = block_map.erase(iter);
+    reclaimed++;
+  }
+  return reclaimed;
+}
+
+void JitBaseBlockCache::EraseUnfinalizedBlock(const JitBlock& block)
+{
+  auto iter = block_map.equal_range(block.physicalAddress);
+  while (iter.first != iter.second)
+  {
+    if (&iter.first->second == &block)
+    {
+      block_map.erase(iter.first);
+      return;
+    }
+    iter.first++;
+  }
+}
+
 void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
 {
 }
@@ -342,6 +425,8 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
   if (fast_block_map[block.fast_block_map_index] == &block)
     fast_block_map[block.fast_block_map_index] = nullptr;
 
+  RemoveFromSecondLevelMap(block);
+
   UnlinkBlock(block);
 
   // Delete linking addresses
@@ -361,10 +446,19 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
 
 JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
 {
-  JitBlock* block = GetBlockFromStartAddress(addr, msr);
+  JitBlock* block = LookupSecondLevelMap(addr, msr);
 
   if (!block)
-    return nullptr;
+  {
+    block = GetBlockFromStartAddress(addr, msr);
+
+    if (!block)
+      return nullptr;
+
+    // The block was evicted from the second-level map at some point; put it
+    // back so the next miss on this address stays off the slow path.
+    InsertIntoSecondLevelMap(block);
+  }
 
   // Drop old fast block map entry
   if (fast_block_map[block->fast_block_map_index] == block)
@@ -382,3 +476,57 @@ size_t JitBaseBlockCache::FastLookupIndexForAddress(u32 address)
 {
   return (address >> 2) & FAST_BLOCK_MAP_MASK;
 }
+
+size_t JitBaseBlockCache::SecondLevelIndexForAddress(u32 address, u32 msr)
+{
+  // Multiplicative hash; the translation bits of the MSR are mixed in so the
+  // same address compiled under different translation modes doesn't collide.
+  const u32 hash = ((address >> 2) ^ ((msr & JIT_CACHE_MSR_MASK) << 16)) * 2654435761u;
+  return (hash >> 16) & SECOND_LEVEL_MAP_MASK;
+}
+
+JitBlock* JitBaseBlockCache::LookupSecondLevelMap(u32 addr, u32 msr)
+{
+  const size_t index = SecondLevelIndexForAddress(addr, msr);
+  for (size_t i = 0; i < SECOND_LEVEL_PROBE_LIMIT; i++)
+  {
+    JitBlock* block = second_level_block_map[(index + i) & SECOND_LEVEL_MAP_MASK];
+    if (block && block->effectiveAddress == addr && block->msrBits == (msr & JIT_CACHE_MSR_MASK))
+      return block;
+  }
+  return nullptr;
+}
+
+void JitBaseBlockCache::InsertIntoSecondLevelMap(JitBlock* block)
+{
+  const size_t index = SecondLevelIndexForAddress(block->effectiveAddress, block->msrBits);
+  size_t slot = index;
+  for (size_t i = 0; i < SECOND_LEVEL_PROBE_LIMIT; i++)
+  {
+    const size_t probe = (index + i) & SECOND_LEVEL_MAP_MASK;
+    if (second_level_block_map[probe] == block)
+      return;
+    if (!second_level_block_map[probe])
+    {
+      slot = probe;
+      break;
+    }
+  }
+  // If the whole probe window is occupied, the home slot is overwritten. The
+  // evicted block stays reachable through block_map; this is just a cache.
+  second_level_block_map[slot] = block;
+}
+
+void JitBaseBlockCache::RemoveFromSecondLevelMap(const JitBlock& block)
+{
+  const size_t index = SecondLevelIndexForAddress(block.effectiveAddress, block.msrBits);
+  for (size_t i = 0; i < SECOND_LEVEL_PROBE_LIMIT; i++)
+  {
+    const size_t probe = (index + i) & SECOND_LEVEL_MAP_MASK;
+    if (second_level_block_map[probe] == &block)
+    {
+      second_level_block_map[probe] = nullptr;
+      return;
+    }
+  }
+}
@@ -9,7 +9,6 @@
 #include <functional>
 #include <map>
 #include <memory>
-#include <set>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -78,8 +77,13 @@ struct JitBlock : public JitBlockData
   };
   std::vector<LinkData> linkData;
 
-  // This set stores all physical addresses of all occupied instructions.
-  std::set<u32> physical_addresses;
+  // All physical addresses of occupied instructions, sorted ascending.
+  std::vector<u32> physical_addresses;
+
+  // The code-space reclamation epoch the block last executed in. Generated code
+  // stores the current epoch here on every block entry; ReclaimColdBlocks() frees
+  // blocks whose stamp is behind the epoch opened by StartColdBlockDetection().
+  u32 last_used_epoch = 0;
 
   // Block profiling data, structure is inlined in Jit.cpp
   struct ProfileData
@@ -134,6 +138,11 @@ public:
   static constexpr u32 FAST_BLOCK_MAP_ELEMENTS = 0x10000;
   static constexpr u32 FAST_BLOCK_MAP_MASK = FAST_BLOCK_MAP_ELEMENTS - 1;
 
+  // Size of the second-level block lookup table, see second_level_block_map.
+  static constexpr size_t SECOND_LEVEL_MAP_ELEMENTS = 0x8000;
+  static constexpr size_t SECOND_LEVEL_MAP_MASK = SECOND_LEVEL_MAP_ELEMENTS - 1;
+  static constexpr size_t SECOND_LEVEL_PROBE_LIMIT = 4;
+
   explicit JitBaseBlockCache(JitBase& jit);
   virtual ~JitBaseBlockCache();
 
@@ -147,7 +156,7 @@ public:
   void RunOnBlocks(std::function<void(const JitBlock&)> f);
 
   JitBlock* AllocateBlock(u32 em_address);
-  void FinalizeBlock(JitBlock& block, bool block_link, const std::set<u32>& physical_addresses);
+  void FinalizeBlock(JitBlock& block, bool block_link, const std::vector<u32>& physical_addresses);
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -163,6 +172,24 @@ public:
   void InvalidateICache(u32 address, u32 length, bool forced);
   void ErasePhysicalRange(u32 address, u32 length);
 
+  // Address of the current reclamation epoch, for the epoch stamp that the JITs
+  // emit at every block entry.
+  const u32* GetBlockEpochPointer() const;
+
+  // Opens a new observation epoch. Blocks prove they are still live by stamping
+  // the new epoch value when they next execute.
+  void StartColdBlockDetection();
+
+  // Frees every block that has not executed since the last StartColdBlockDetection()
+  // call, returning how many blocks were destroyed. The freed code ranges are handed
+  // back through the same path as regular invalidations.
+  u32 ReclaimColdBlocks();
+
+  // Removes a block that was created with AllocateBlock() but never finalized, e.g.
+  // because code generation ran out of space. Such a block is not yet reachable from
+  // the lookup structures, so it only needs to leave the block map.
+  void EraseUnfinalizedBlock(const JitBlock& block);
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -181,6 +208,12 @@ private:
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address);
 
+  // Second-level block lookup based on second_level_block_map.
+  size_t SecondLevelIndexForAddress(u32 address, u32 msr);
+  JitBlock* LookupSecondLevelMap(u32 address, u32 msr);
+  void InsertIntoSecondLevelMap(JitBlock* block);
+  void RemoveFromSecondLevelMap(const JitBlock& block);
+
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
   std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
@@ -195,6 +228,10 @@ private:
   static constexpr u32 BLOCK_RANGE_MAP_ELEMENTS = 0x100;
   std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
 
+  // Current code-space reclamation epoch, bumped by StartColdBlockDetection().
+  // Starts at 1 so a default-initialized block stamp never matches it.
+  u32 m_block_epoch = 1;
+
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
   ValidBlockBitSet valid_block;
@@ -202,4 +239,10 @@ private:
   // This array is indexed with the masked PC and likely holds the correct block id.
   // This is used as a fast cache of block_map used in the assembly dispatcher.
   std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> fast_block_map;  // start_addr & mask -> number
+
+  // Open-addressed hash table probed when fast_block_map misses, e.g. after the
+  // entry was evicted by a colliding block. A hit here skips the address
+  // translation and the multimap walk of GetBlockFromStartAddress(), so hot
+  // loops whose blocks alias in fast_block_map keep cheap dispatch.
+  std::array<JitBlock*, SECOND_LEVEL_MAP_ELEMENTS> second_level_block_map;
 };
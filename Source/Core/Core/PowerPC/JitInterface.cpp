@@ -147,6 +147,14 @@ void GetProfileResults(Profiler::ProfileStats* prof_stats)
   });
 }
 
+void RunOnBlocks(std::function<void(const JitBlock&)> f)
+{
+  if (!g_jit)
+    return;
+
+  g_jit->GetBlockCache()->RunOnBlocks(std::move(f));
+}
+
 int GetHostCode(u32* address, const u8** code, u32* code_size)
 {
   if (!g_jit)
@@ -253,6 +261,19 @@ void CompileExceptionCheck(ExceptionType type)
       if (optype != OpType::Store && optype != OpType::StoreFP && optype != OpType::StorePS)
         return;
     }
+    if (type == ExceptionType::PairedQuantize)
+    {
+      // GQRs are effectively constant in almost all blocks, so a failed guard
+      // usually means the block was compiled before the game settled on its
+      // final GQR values. Recompile specialized to the current values a few
+      // times before giving up and dispatching through the generic routines.
+      constexpr int MAX_PAIRED_QUANTIZE_RETRIES = 4;
+      if (++g_jit->js.pairedQuantizeRetries[PC] <= MAX_PAIRED_QUANTIZE_RETRIES)
+      {
+        g_jit->GetBlockCache()->InvalidateICache(PC, 4, true);
+        return;
+      }
+    }
     exception_addresses->insert(PC);
 
     // Invalidate the JIT block so that it gets recompiled with the external exception check
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include "Common/CommonTypes.h"
@@ -11,6 +12,7 @@
 class CPUCoreBase;
 class PointerWrap;
 class JitBase;
+struct JitBlock;
 
 namespace PowerPC
 {
@@ -48,6 +50,10 @@ void WriteProfileResults(const std::string& filename);
 void GetProfileResults(Profiler::ProfileStats* prof_stats);
 int GetHostCode(u32* address, const u8** code, u32* code_size);
 
+// Calls f for every block in the cache. Only use this from the CPU thread.
+// Does nothing if no JIT core is active.
+void RunOnBlocks(std::function<void(const JitBlock&)> f);
+
 // Memory Utilities
 bool HandleFault(uintptr_t access_address, SContext* ctx);
 bool HandleStackFault();
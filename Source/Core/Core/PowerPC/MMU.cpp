@@ -817,18 +817,19 @@ TryReadResult<std::string> HostTryReadString(u32 address, size_t size, Requested
 
 bool IsOptimizableRAMAddress(const u32 address)
 {
-  if (PowerPC::memchecks.HasAny())
-    return false;
-
   if (!MSR.DR)
     return false;
 
   // TODO: This API needs to take an access size
   //
   // We store whether an access can be optimized to an unchecked access
-  // in dbat_table.
-  u32 bat_result = dbat_table[address >> BAT_INDEX_SHIFT];
-  return (bat_result & BAT_PHYSICAL_BIT) != 0;
+  // in dbat_table. This includes pages overlapping watchpoints, which
+  // UpdateBATs excludes from the fastmem arena. Since we don't know the
+  // access size, also require the page 8 bytes ahead to be optimizable,
+  // so an access straddling a page boundary can't slip past a watchpoint.
+  const u32 bat_result = dbat_table[address >> BAT_INDEX_SHIFT];
+  const u32 bat_result_next = dbat_table[(address + 8) >> BAT_INDEX_SHIFT];
+  return (bat_result & bat_result_next & BAT_PHYSICAL_BIT) != 0;
 }
 
 template <XCheckTLBFlag flag>
@@ -1006,7 +1007,10 @@ void ClearCacheLine(u32 address)
 
 u32 IsOptimizableMMIOAccess(u32 address, u32 access_size)
 {
-  if (PowerPC::memchecks.HasAny())
+  // Watchpoints match on effective addresses, so check the untranslated address.
+  // The JIT cache is cleared whenever the watchpoint set changes, so a compile-time
+  // check is enough here.
+  if (PowerPC::memchecks.OverlapsMemcheck(address, access_size >> 3))
     return 0;
 
   if (!MSR.DR)
@@ -1028,7 +1032,8 @@ u32 IsOptimizableMMIOAccess(u32 address, u32 access_size)
 
 bool IsOptimizableGatherPipeWrite(u32 address)
 {
-  if (PowerPC::memchecks.HasAny())
+  // As with IsOptimizableMMIOAccess, a compile-time watchpoint check suffices.
+  if (PowerPC::memchecks.OverlapsMemcheck(address, 8))
     return false;
 
   if (!MSR.DR)
@@ -1466,20 +1471,32 @@ static void UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr)
   }
 }
 
+// Scratch table so BAT updates which don't change the effective mapping can be
+// detected without touching the live table. Rebuilding into this and comparing
+// is cheap next to the logical memory remap and full JIT flush that a real
+// change requires - and OSes routinely disable a BAT, rewrite it, and
+// re-enable the same mapping, which yields several no-op rebuilds per context
+// switch on MMU titles.
+static BatTable s_scratch_bat_table;
+
 void DBATUpdated()
 {
-  dbat_table = {};
-  UpdateBATs(dbat_table, SPR_DBAT0U);
+  s_scratch_bat_table = {};
+  UpdateBATs(s_scratch_bat_table, SPR_DBAT0U);
   bool extended_bats = SConfig::GetInstance().bWii && HID4.SBE;
   if (extended_bats)
-    UpdateBATs(dbat_table, SPR_DBAT4U);
+    UpdateBATs(s_scratch_bat_table, SPR_DBAT4U);
   if (Memory::m_pFakeVMEM)
   {
     // In Fake-MMU mode, insert some extra entries into the BAT tables.
-    UpdateFakeMMUBat(dbat_table, 0x40000000);
-    UpdateFakeMMUBat(dbat_table, 0x70000000);
+    UpdateFakeMMUBat(s_scratch_bat_table, 0x40000000);
+    UpdateFakeMMUBat(s_scratch_bat_table, 0x70000000);
   }
 
+  if (s_scratch_bat_table == dbat_table)
+    return;
+  dbat_table = s_scratch_bat_table;
+
 #ifndef _ARCH_32
   Memory::UpdateLogicalMemory(dbat_table);
 #endif
@@ -1490,17 +1507,22 @@ void DBATUpdated()
 
 void IBATUpdated()
 {
-  ibat_table = {};
-  UpdateBATs(ibat_table, SPR_IBAT0U);
+  s_scratch_bat_table = {};
+  UpdateBATs(s_scratch_bat_table, SPR_IBAT0U);
   bool extended_bats = SConfig::GetInstance().bWii && HID4.SBE;
   if (extended_bats)
-    UpdateBATs(ibat_table, SPR_IBAT4U);
+    UpdateBATs(s_scratch_bat_table, SPR_IBAT4U);
   if (Memory::m_pFakeVMEM)
   {
     // In Fake-MMU mode, insert some extra entries into the BAT tables.
-    UpdateFakeMMUBat(ibat_table, 0x40000000);
-    UpdateFakeMMUBat(ibat_table, 0x70000000);
+    UpdateFakeMMUBat(s_scratch_bat_table, 0x40000000);
+    UpdateFakeMMUBat(s_scratch_bat_table, 0x70000000);
   }
+
+  if (s_scratch_bat_table == ibat_table)
+    return;
+  ibat_table = s_scratch_bat_table;
+
   JitInterface::ClearSafe();
 }
 
@@ -677,7 +677,7 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code, const Gekk
   }
 }
 
-bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions)
+bool PPCAnalyzer::IsBusyWaitLoop(CodeOp* code, size_t instructions)
 {
   // Very basic algorithm to detect busy wait loops:
   //   * It loops to itself and does not contain any other branches.
@@ -685,19 +685,46 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
   //   * It only reads from registers it wrote to earlier in the loop, or it
   //     does not write to these registers.
   //
+  // The loop does not have to span the whole block; when the final branch
+  // targets an instruction further into the block, only the looped-over
+  // instructions are examined. This catches blocks that set up a poll (e.g.
+  // load a mailbox or flag address) and then spin on a memory or MMIO read.
+  //
   // Would benefit a lot from basic inlining support - a lot of the most
   // used busy loops are DSP register interactions, which are bl/cmp/bne
   // (with the bl target a pure function that follows the above rules). We
   // don't detect these at the moment.
+
+  // Only bx/bcx have a branch target known at analysis time.
+  const UGeckoInstruction branch_inst = code[instructions].inst;
+  if (branch_inst.OPCD != 18 && branch_inst.OPCD != 16)
+    return false;
+
+  // Find the instruction the final branch loops back to. With branch
+  // following the addresses are not necessarily contiguous, so search for it
+  // instead of computing an offset from the block start.
+  const u32 branch_target = code[instructions].branchTo;
+  size_t loop_start = instructions + 1;
+  for (size_t i = 0; i <= instructions; ++i)
+  {
+    if (code[i].address == branch_target)
+    {
+      loop_start = i;
+      break;
+    }
+  }
+  if (loop_start > instructions)
+    return false;
+
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
-  for (size_t i = 0; i <= instructions; ++i)
+  for (size_t i = loop_start; i <= instructions; ++i)
   {
     if (code[i].opinfo->type == OpType::Branch)
     {
       if (code[i].branchUsesCtr)
         return false;
-      if (code[i].branchTo == block->m_address && i == instructions)
+      if (code[i].branchTo == branch_target && i == instructions)
         return true;
     }
     else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
@@ -782,7 +809,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
     code[i].inst = inst;
     code[i].skip = false;
     block->m_stats->numCycles += opinfo->numCycles;
-    block->m_physical_addresses.insert(result.physical_address);
+    block->m_physical_addresses.push_back(result.physical_address);
 
     SetInstructionStats(block, &code[i], opinfo, static_cast<u32>(i));
 
@@ -878,8 +905,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
       }
     }
 
-    code[i].branchIsIdleLoop =
-        code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+    code[i].branchIsIdleLoop = IsBusyWaitLoop(code, i);
 
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
@@ -905,6 +931,13 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
     }
   }
 
+  // Branch following can visit addresses out of order or twice, so bring the
+  // occupied addresses back into the sorted set form the block cache expects.
+  std::sort(block->m_physical_addresses.begin(), block->m_physical_addresses.end());
+  block->m_physical_addresses.erase(
+      std::unique(block->m_physical_addresses.begin(), block->m_physical_addresses.end()),
+      block->m_physical_addresses.end());
+
   block->m_num_instructions = num_inst;
 
   if (block->m_num_instructions > 1)
@@ -5,7 +5,6 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <set>
 #include <vector>
 
 #include "Common/BitSet.h"
@@ -165,8 +164,11 @@ struct CodeBlock
   // Which GPRs this block reads from before defining, if any.
   BitSet32 m_gpr_inputs;
 
-  // Which memory locations are occupied by this block.
-  std::set<u32> m_physical_addresses;
+  // Which memory locations are occupied by this block, sorted ascending.
+  // A sorted vector instead of a set: it is rebuilt for every compiled block,
+  // and per-node allocations showed up as malloc contention during block
+  // compilation storms. The capacity is reused across blocks.
+  std::vector<u32> m_physical_addresses;
 };
 
 class PPCAnalyzer
@@ -208,6 +210,10 @@ public:
 
     // Reorder cror instructions next to their associated fcmp.
     OPTION_CROR_MERGE = (1 << 6),
+
+    // Allow the JIT to fuse a rlwinm and a following rlwimi targeting the same register
+    // into a single host sequence.
+    OPTION_RLWIMI_MERGE = (1 << 7),
   };
 
   // Option setting/getting
@@ -227,7 +233,7 @@ private:
   void ReorderInstructionsCore(u32 instructions, CodeOp* code, bool reverse, ReorderType type);
   void ReorderInstructions(u32 instructions, CodeOp* code);
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo, u32 index);
-  bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions);
+  bool IsBusyWaitLoop(CodeOp* code, size_t instructions);
 
   // Options
   u32 m_options = 0;
@@ -95,6 +95,7 @@ void InstructionCache::Reset()
 {
   valid.fill(0);
   plru.fill(0);
+  last_block_addr = 0xffffffff;
   lookup_table.fill(0xFF);
   lookup_table_ex.fill(0xFF);
   lookup_table_vmem.fill(0xFF);
@@ -128,6 +129,7 @@ void InstructionCache::Invalidate(u32 addr)
     }
   }
   valid[set] = 0;
+  last_block_addr = 0xffffffff;
   JitInterface::InvalidateICache(addr & ~0x1f, 32, false);
 }
 
@@ -135,55 +137,73 @@ u32 InstructionCache::ReadInstruction(u32 addr)
 {
   if (!HID0.ICE || SConfig::GetInstance().bDisableICache)  // instruction cache is disabled
     return Memory::Read_U32(addr);
-  u32 set = (addr >> 5) & 0x7f;
-  u32 tag = addr >> 12;
 
+  const u32 block_addr = addr & ~0x1f;
+  u32 set;
   u32 t;
-  if (addr & ICACHE_VMEM_BIT)
+  if (block_addr == last_block_addr)
   {
-    t = lookup_table_vmem[(addr >> 5) & 0xfffff];
-  }
-  else if (addr & ICACHE_EXRAM_BIT)
-  {
-    t = lookup_table_ex[(addr >> 5) & 0x1fffff];
+    // Same block as the previous fetch (the common case for straight-line code). The lookup
+    // table would return the same way, and replaying the PLRU update would be a no-op, so both
+    // can be skipped.
+    set = last_set;
+    t = last_way;
   }
   else
   {
-    t = lookup_table[(addr >> 5) & 0xfffff];
-  }
+    set = (addr >> 5) & 0x7f;
+    const u32 tag = addr >> 12;
 
-  if (t == 0xff)  // load to the cache
-  {
-    if (HID0.ILOCK)  // instruction cache is locked
-      return Memory::Read_U32(addr);
-    // select a way
-    if (valid[set] != 0xff)
-      t = s_way_from_valid[valid[set]];
+    if (addr & ICACHE_VMEM_BIT)
+    {
+      t = lookup_table_vmem[(addr >> 5) & 0xfffff];
+    }
+    else if (addr & ICACHE_EXRAM_BIT)
+    {
+      t = lookup_table_ex[(addr >> 5) & 0x1fffff];
+    }
     else
-      t = s_way_from_plru[plru[set]];
-    // load
-    Memory::CopyFromEmu(reinterpret_cast<u8*>(data[set][t].data()), (addr & ~0x1f), 32);
-    if (valid[set] & (1 << t))
     {
-      if (tags[set][t] & (ICACHE_VMEM_BIT >> 12))
-        lookup_table_vmem[((tags[set][t] << 7) | set) & 0xfffff] = 0xff;
-      else if (tags[set][t] & (ICACHE_EXRAM_BIT >> 12))
-        lookup_table_ex[((tags[set][t] << 7) | set) & 0x1fffff] = 0xff;
+      t = lookup_table[(addr >> 5) & 0xfffff];
+    }
+
+    if (t == 0xff)  // load to the cache
+    {
+      if (HID0.ILOCK)  // instruction cache is locked
+        return Memory::Read_U32(addr);
+      // select a way
+      if (valid[set] != 0xff)
+        t = s_way_from_valid[valid[set]];
+      else
+        t = s_way_from_plru[plru[set]];
+      // load
+      Memory::CopyFromEmu(reinterpret_cast<u8*>(data[set][t].data()), (addr & ~0x1f), 32);
+      if (valid[set] & (1 << t))
+      {
+        if (tags[set][t] & (ICACHE_VMEM_BIT >> 12))
+          lookup_table_vmem[((tags[set][t] << 7) | set) & 0xfffff] = 0xff;
+        else if (tags[set][t] & (ICACHE_EXRAM_BIT >> 12))
+          lookup_table_ex[((tags[set][t] << 7) | set) & 0x1fffff] = 0xff;
+        else
+          lookup_table[((tags[set][t] << 7) | set) & 0xfffff] = 0xff;
+      }
+
+      if (addr & ICACHE_VMEM_BIT)
+        lookup_table_vmem[(addr >> 5) & 0xfffff] = t;
+      else if (addr & ICACHE_EXRAM_BIT)
+        lookup_table_ex[(addr >> 5) & 0x1fffff] = t;
       else
-        lookup_table[((tags[set][t] << 7) | set) & 0xfffff] = 0xff;
+        lookup_table[(addr >> 5) & 0xfffff] = t;
+      tags[set][t] = tag;
+      valid[set] |= (1 << t);
     }
+    // update plru
+    plru[set] = (plru[set] & ~s_plru_mask[t]) | s_plru_value[t];
 
-    if (addr & ICACHE_VMEM_BIT)
-      lookup_table_vmem[(addr >> 5) & 0xfffff] = t;
-    else if (addr & ICACHE_EXRAM_BIT)
-      lookup_table_ex[(addr >> 5) & 0x1fffff] = t;
-    else
-      lookup_table[(addr >> 5) & 0xfffff] = t;
-    tags[set][t] = tag;
-    valid[set] |= (1 << t);
+    last_block_addr = block_addr;
+    last_set = set;
+    last_way = t;
   }
-  // update plru
-  plru[set] = (plru[set] & ~s_plru_mask[t]) | s_plru_value[t];
   const u32 res = Common::swap32(data[set][t][(addr >> 2) & 7]);
   const u32 inmem = Memory::Read_U32(addr);
   if (res != inmem)
@@ -205,5 +225,7 @@ void InstructionCache::DoState(PointerWrap& p)
   p.DoArray(lookup_table);
   p.DoArray(lookup_table_ex);
   p.DoArray(lookup_table_vmem);
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    last_block_addr = 0xffffffff;
 }
 }  // namespace PowerPC
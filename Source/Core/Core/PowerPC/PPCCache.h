@@ -30,6 +30,13 @@ struct InstructionCache
   std::array<u8, 1 << 21> lookup_table_ex;
   std::array<u8, 1 << 20> lookup_table_vmem;
 
+  // One-entry MRU fast path: the cache block the previous fetch hit. Consecutive fetches from
+  // the same block (straight-line code) can skip the lookup table and the PLRU update, which is
+  // idempotent per block. Not saved to the savestate; reset on load.
+  u32 last_block_addr = 0xffffffff;
+  u32 last_set = 0;
+  u32 last_way = 0;
+
   InstructionCache();
   u32 ReadInstruction(u32 addr);
   void Invalidate(u32 addr);
@@ -51,8 +51,8 @@ Common::Symbol* PPCSymbolDB::AddFunction(u32 start_addr)
 void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& name,
                                  Common::Symbol::Type type)
 {
-  auto iter = m_functions.find(startAddr);
-  if (iter != m_functions.end())
+  auto iter = m_functions.lower_bound(startAddr);
+  if (iter != m_functions.end() && iter->first == startAddr)
   {
     // already got it, let's just update name, checksum & size to be sure.
     Common::Symbol* tempfunc = &iter->second;
@@ -63,13 +63,17 @@ void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& nam
   }
   else
   {
-    // new symbol. run analyze.
-    Common::Symbol tf;
+    // New symbol: construct it in place, reusing the lower_bound iterator as an insertion hint.
+    // Map files are sorted by address, so bulk loads insert in amortized constant time instead
+    // of paying for a second lookup and a full Symbol copy per entry.
+    iter = m_functions.emplace_hint(iter, startAddr, Common::Symbol{});
+    Common::Symbol& tf = iter->second;
     tf.Rename(name);
     tf.type = type;
     tf.address = startAddr;
     if (tf.type == Common::Symbol::Type::Function)
     {
+      // run analyze.
       PPCAnalyst::AnalyzeFunction(startAddr, tf, size);
       // Do not truncate symbol when a size is expected
       if (size != 0 && tf.size != size)
@@ -78,13 +82,12 @@ void PPCSymbolDB::AddKnownSymbol(u32 startAddr, u32 size, const std::string& nam
                      name, size, tf.size);
         tf.size = size;
       }
-      m_checksum_to_function[tf.hash].insert(&m_functions[startAddr]);
+      m_checksum_to_function[tf.hash].insert(&tf);
     }
     else
     {
       tf.size = size;
     }
-    m_functions[startAddr] = tf;
   }
 }
 
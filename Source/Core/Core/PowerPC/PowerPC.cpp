@@ -359,6 +359,16 @@ void SingleStep()
   s_cpu_core_base->SingleStep();
 }
 
+void StepUntil(u32 end_address, std::chrono::steady_clock::time_point deadline)
+{
+  // The debugger switches to CoreMode::Interpreter before stepping, so in practice the fast
+  // path is always taken; the fallback just keeps the caller's loop correct in other modes.
+  if (s_cpu_core_base == s_interpreter)
+    s_interpreter->StepUntil(end_address, deadline);
+  else
+    s_cpu_core_base->SingleStep();
+}
+
 void RunLoop()
 {
   s_cpu_core_base->Run();
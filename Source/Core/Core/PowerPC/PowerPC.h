@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <iosfwd>
 #include <tuple>
@@ -212,6 +213,10 @@ void InjectExternalCPUCore(CPUCoreBase* core);
 // Stepping requires the CPU Execution lock (CPU::PauseAndLock or CPU Thread)
 // It's not threadsafe otherwise.
 void SingleStep();
+// Steps until PC reaches end_address, a breakpoint is hit, or the deadline passes, servicing
+// timing slices in batches rather than per instruction. Only the interpreter implements this;
+// in other modes it falls back to a single step. Same locking requirements as SingleStep().
+void StepUntil(u32 end_address, std::chrono::steady_clock::time_point deadline);
 void CheckExceptions();
 void CheckExternalExceptions();
 void CheckBreakPoints();
@@ -0,0 +1,197 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/ResumeSnapshot.h"
+
+#include <string>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Common/Version.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigLoaders/GameConfigLoader.h"
+#include "Core/ConfigManager.h"
+#include "Core/Movie.h"
+#include "Core/NetPlayProto.h"
+#include "Core/State.h"
+
+namespace ResumeSnapshot
+{
+static bool s_capture_armed = false;
+static u64 s_fields_until_capture = 0;
+
+// Fields per second is 50 on PAL consoles, but the capture point doesn't have to be
+// exact -- it only needs to land comfortably past the title's boot sequence.
+constexpr u64 APPROXIMATE_FIELDS_PER_SECOND = 60;
+
+static std::string GetSnapshotDirectory()
+{
+  return File::GetUserPath(D_STATESAVES_IDX) + "Resume" DIR_SEP;
+}
+
+static void HashFileIdentity(XXH64_state_t* state, const std::string& path)
+{
+  const File::FileInfo info(path);
+  if (!info.IsFile())
+    return;
+
+  const u64 size = info.GetSize();
+  const u64 mtime = info.GetModificationTime();
+  XXH64_update(state, path.data(), path.size());
+  XXH64_update(state, &size, sizeof(size));
+  XXH64_update(state, &mtime, sizeof(mtime));
+}
+
+static void HashDirectoryIdentity(XXH64_state_t* state, const File::FSTEntry& entry)
+{
+  for (const File::FSTEntry& child : entry.children)
+  {
+    if (child.isDirectory)
+      HashDirectoryIdentity(state, child);
+    else
+      HashFileIdentity(state, child.physicalName);
+  }
+}
+
+// Snapshots serialize the full GameCube memory card image, so resuming one captured
+// before the user's latest save would write the stale image back over it on the next
+// flush. Hashing the identity (path, size, mtime) of everything that can back a memory
+// card invalidates the snapshot whenever save data changes; the title then cold-boots
+// once and a fresh snapshot is captured.
+static void HashSaveDataIdentity(XXH64_state_t* state)
+{
+  HashDirectoryIdentity(state,
+                        File::ScanDirectoryTree(File::GetUserPath(D_GCUSER_IDX), true));
+
+  // Raw cards and GCI folders configured outside the GC user directory. A raw card
+  // sized under 2043 Mb gets a free-block suffix inserted before its extension, so
+  // hash every sibling sharing the configured card's stem rather than the exact path.
+  for (const auto* info : {&Config::MAIN_MEMCARD_A_PATH, &Config::MAIN_MEMCARD_B_PATH})
+  {
+    const std::string configured_path = Config::Get(*info);
+    if (configured_path.empty())
+      continue;
+
+    std::string directory, filename, extension;
+    SplitPath(configured_path, &directory, &filename, &extension);
+    for (const File::FSTEntry& child : File::ScanDirectoryTree(directory, false).children)
+    {
+      if (!child.isDirectory && StringBeginsWith(child.virtualName, filename))
+        HashFileIdentity(state, child.physicalName);
+    }
+  }
+  for (const auto* info :
+       {&Config::MAIN_GCI_FOLDER_A_PATH_OVERRIDE, &Config::MAIN_GCI_FOLDER_B_PATH_OVERRIDE})
+  {
+    const std::string configured_path = Config::Get(*info);
+    if (!configured_path.empty())
+      HashDirectoryIdentity(state, File::ScanDirectoryTree(configured_path, true));
+  }
+}
+
+// Hashes everything that invalidates a snapshot: the Dolphin build, the contents of
+// every game INI that applies to this title (from both the shipped and the user
+// GameSettings directories), and the identity of the title's save data.
+static u64 ComputeConfigKey()
+{
+  const SConfig& sconfig = SConfig::GetInstance();
+
+  XXH64_state_t* state = XXH64_createState();
+  XXH64_reset(state, 0);
+
+  const std::string& version = Common::scm_rev_str;
+  XXH64_update(state, version.data(), version.size());
+
+  const std::string directories[] = {File::GetSysDirectory() + GAMESETTINGS_DIR DIR_SEP,
+                                     File::GetUserPath(D_GAMESETTINGS_IDX)};
+  for (const std::string& filename :
+       ConfigLoaders::GetGameIniFilenames(sconfig.GetGameID(), sconfig.GetRevision()))
+  {
+    for (const std::string& directory : directories)
+    {
+      std::string contents;
+      if (File::ReadFileToString(directory + filename, contents))
+      {
+        XXH64_update(state, filename.data(), filename.size());
+        XXH64_update(state, contents.data(), contents.size());
+      }
+    }
+  }
+
+  HashSaveDataIdentity(state);
+
+  const u64 key = XXH64_digest(state);
+  XXH64_freeState(state);
+  return key;
+}
+
+static std::string SnapshotPathForCurrentGame()
+{
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (game_id.empty())
+    return {};
+  return GetSnapshotDirectory() + fmt::format("{}-{:016x}.sav", game_id, ComputeConfigKey());
+}
+
+std::string FindSnapshot()
+{
+  if (!Config::Get(Config::MAIN_RESUME_SNAPSHOTS))
+    return {};
+
+  std::string path = SnapshotPathForCurrentGame();
+  if (path.empty() || !File::Exists(path))
+    return {};
+  return path;
+}
+
+void OnBoot(bool snapshot_exists)
+{
+  s_capture_armed = Config::Get(Config::MAIN_RESUME_SNAPSHOTS) && !snapshot_exists;
+  s_fields_until_capture = APPROXIMATE_FIELDS_PER_SECOND *
+                           Config::Get(Config::MAIN_RESUME_SNAPSHOT_DELAY_SECS);
+}
+
+void OnFieldEnd()
+{
+  if (!s_capture_armed)
+    return;
+
+  if (s_fields_until_capture > 0)
+  {
+    s_fields_until_capture--;
+    return;
+  }
+  s_capture_armed = false;
+
+  // Movies and netplay embed their own state in savestates; a snapshot captured there
+  // would not make sense for a regular boot.
+  if (Movie::IsMovieActive() || NetPlay::IsNetPlayRunning())
+    return;
+
+  const std::string path = SnapshotPathForCurrentGame();
+  if (path.empty())
+    return;
+
+  // Drop snapshots of this game captured with a different build or configuration.
+  const std::string prefix = SConfig::GetInstance().GetGameID() + "-";
+  const File::FSTEntry dir = File::ScanDirectoryTree(GetSnapshotDirectory(), false);
+  for (const File::FSTEntry& entry : dir.children)
+  {
+    if (!entry.isDirectory && StringBeginsWith(entry.virtualName, prefix) &&
+        entry.physicalName != path)
+    {
+      File::Delete(entry.physicalName);
+    }
+  }
+
+  File::CreateFullPath(path);
+  NOTICE_LOG_FMT(BOOT, "Capturing resume snapshot to {}", path);
+  State::SaveAs(path);
+}
+}  // namespace ResumeSnapshot
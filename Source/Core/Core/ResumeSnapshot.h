@@ -0,0 +1,29 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+
+// Savestate-backed fast relaunch. Once a title has been running for a configurable
+// amount of time, a snapshot keyed by game ID, Dolphin build, game-INI contents and
+// save data identity is captured automatically; later boots of the same title resume
+// from it instead of cold-booting. Changing the INIs, updating Dolphin or saving in
+// the game changes the key, so stale snapshots are never loaded (a snapshot carries
+// the full memory card image, and resuming one captured before the latest save would
+// roll that save back).
+namespace ResumeSnapshot
+{
+// Returns the snapshot file for the current game and configuration, or an empty string
+// if the feature is disabled or no matching snapshot exists. Must be called after
+// SConfig::SetPathsAndGameMetadata so the game ID and revision are known.
+std::string FindSnapshot();
+
+// Called from BootManager before the core starts. Arms the automatic capture unless a
+// snapshot already exists or the boot uses an explicit savestate.
+void OnBoot(bool snapshot_exists);
+
+// Called once per emulated field on the CPU thread; captures the snapshot once the
+// title has been running long enough.
+void OnFieldEnd();
+}  // namespace ResumeSnapshot
@@ -3,8 +3,12 @@
 
 #include "Core/State.h"
 
+#include <algorithm>
+#include <cstring>
+#include <deque>
 #include <lzo/lzo1x.h>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -12,6 +16,7 @@
 #include <vector>
 
 #include <fmt/format.h>
+#include <zstd.h>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
@@ -34,8 +39,11 @@
 #include "Core/Host.h"
 #include "Core/Movie.h"
 #include "Core/NetPlayClient.h"
+#include "Core/PerformanceFlightRecorder.h"
 #include "Core/PowerPC/PowerPC.h"
 
+#include "DiscIO/MultithreadedCompressor.h"
+
 #include "VideoCommon/FrameDump.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -59,6 +67,14 @@ static unsigned char __LZO_MMODEL out[OUT_LEN];
 
 static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
 
+// New savestates are compressed with zstd in independent frames of this size,
+// so that the frames can be compressed in parallel. LZO is kept for loading old states only.
+static constexpr size_t ZSTD_CHUNK_SIZE = 1024 * 1024;
+// Written right after the StateHeader of zstd-compressed states. Old LZO states start with the
+// compressed length of the first 128 KiB chunk instead, which is always far smaller than this.
+static constexpr u32 ZSTD_STATE_COOKIE = 0x5A535444;  // "ZSTD"
+static constexpr int ZSTD_COMPRESSION_LEVEL = 3;
+
 static AfterLoadCallbackFunc s_on_after_load_callback;
 
 // Temporary undo state buffer
@@ -66,6 +82,9 @@ static std::vector<u8> g_undo_load_buffer;
 static std::vector<u8> g_current_buffer;
 static bool s_load_or_save_in_progress;
 
+// Size of the last successfully serialized state; lets SaveAs skip the measure pass.
+static size_t s_state_size_estimate;
+
 static std::mutex g_cs_undo_load_buffer;
 static std::mutex g_cs_current_buffer;
 static Common::Event g_compressAndDumpStateSyncEvent;
@@ -73,7 +92,7 @@ static Common::Event g_compressAndDumpStateSyncEvent;
 static std::thread g_save_thread;
 
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 132;  // Last changed in PR 9532
+constexpr u32 STATE_VERSION = 136;  // Last changed: DTK reads deliver decoded PCM
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -222,6 +241,11 @@ void LoadFromBuffer(std::vector<u8>& buffer)
     return;
   }
 
+  LoadFromBufferInternal(buffer);
+}
+
+void LoadFromBufferInternal(std::vector<u8>& buffer)
+{
   Core::RunOnCPUThread(
       [&] {
         u8* ptr = &buffer[0];
@@ -249,6 +273,286 @@ void SaveToBuffer(std::vector<u8>& buffer)
       true);
 }
 
+// Delta states store only the pages that differ from a base state, so per-frame snapshots
+// for rewind and rollback don't have to copy the full ~200MB serialized machine state.
+static constexpr size_t DELTA_PAGE_SIZE = 4096;
+
+static void MakeDelta(const std::vector<u8>& base, const std::vector<u8>& current,
+                      std::vector<u8>* delta)
+{
+  delta->clear();
+  delta->reserve(DELTA_PAGE_SIZE);
+
+  const auto append = [delta](const void* data, size_t size) {
+    const u8* begin = static_cast<const u8*>(data);
+    delta->insert(delta->end(), begin, begin + size);
+  };
+
+  const u64 current_size = current.size();
+  append(&current_size, sizeof(current_size));
+
+  const size_t page_count = (current.size() + DELTA_PAGE_SIZE - 1) / DELTA_PAGE_SIZE;
+  for (size_t page = 0; page < page_count; ++page)
+  {
+    const size_t offset = page * DELTA_PAGE_SIZE;
+    const size_t size = std::min(DELTA_PAGE_SIZE, current.size() - offset);
+
+    // Pages past the end of the base state, or differing from it, are stored verbatim.
+    if (offset + size > base.size() || memcmp(&current[offset], &base[offset], size) != 0)
+    {
+      const u32 page_index = static_cast<u32>(page);
+      append(&page_index, sizeof(page_index));
+      append(&current[offset], size);
+    }
+  }
+}
+
+static void ApplyDelta(const std::vector<u8>& base, const std::vector<u8>& delta,
+                       std::vector<u8>* buffer)
+{
+  buffer->clear();
+  if (delta.size() < sizeof(u64))
+    return;
+
+  size_t read_offset = 0;
+  const auto read = [&delta, &read_offset](void* data, size_t size) {
+    memcpy(data, &delta[read_offset], size);
+    read_offset += size;
+  };
+
+  u64 current_size = 0;
+  read(&current_size, sizeof(current_size));
+
+  buffer->assign(base.begin(), base.begin() + std::min<size_t>(base.size(), current_size));
+  buffer->resize(current_size);
+
+  while (read_offset + sizeof(u32) <= delta.size())
+  {
+    u32 page_index = 0;
+    read(&page_index, sizeof(page_index));
+
+    // A malformed or truncated delta must not be able to write outside the target
+    // buffer or read past the end of the delta; treat it as unusable instead.
+    const size_t offset = static_cast<size_t>(page_index) * DELTA_PAGE_SIZE;
+    if (offset >= buffer->size())
+    {
+      Core::DisplayMessage("Unable to load: Corrupted delta state", 4000);
+      buffer->clear();
+      return;
+    }
+
+    const size_t size = std::min(DELTA_PAGE_SIZE, buffer->size() - offset);
+    if (delta.size() - read_offset < size)
+    {
+      Core::DisplayMessage("Unable to load: Corrupted delta state", 4000);
+      buffer->clear();
+      return;
+    }
+
+    read(&(*buffer)[offset], size);
+  }
+}
+
+void SaveDeltaToBuffer(const std::vector<u8>& base, std::vector<u8>& delta)
+{
+  Core::RunOnCPUThread(
+      [&] {
+        std::vector<u8> current;
+        SaveToBuffer(current);
+        MakeDelta(base, current, &delta);
+      },
+      true);
+}
+
+void LoadFromDeltaBuffer(const std::vector<u8>& base, std::vector<u8>& delta)
+{
+  if (NetPlay::IsNetPlayRunning())
+  {
+    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
+    return;
+  }
+
+  LoadFromDeltaBufferInternal(base, delta);
+}
+
+void LoadFromDeltaBufferInternal(const std::vector<u8>& base, std::vector<u8>& delta)
+{
+  Core::RunOnCPUThread(
+      [&] {
+        std::vector<u8> buffer;
+        ApplyDelta(base, delta, &buffer);
+        if (!buffer.empty())
+          LoadFromBufferInternal(buffer);
+      },
+      true);
+}
+
+// The rewind ring keeps a fixed-budget in-memory history of recent states. Every
+// REWIND_KEYFRAME_INTERVAL-th frame is a full state (keyframe); the frames in
+// between are page deltas against the preceding keyframe, so loading the newest
+// frame never has to replay a chain of deltas. Frames are zstd-compressed at the
+// fastest level, as rewind captures happen while the game is running.
+static constexpr size_t REWIND_MEMORY_BUDGET = 256 * 1024 * 1024;
+static constexpr u32 REWIND_KEYFRAME_INTERVAL = 60;
+static constexpr int REWIND_COMPRESSION_LEVEL = 1;
+
+struct RewindFrame
+{
+  bool is_keyframe = false;
+  std::vector<u8> data;  // zstd-compressed full state (keyframe) or delta
+};
+
+// All rewind state is only touched from the CPU thread (via RunOnCPUThread),
+// or from Init/Shutdown while the CPU thread does not exist.
+static std::deque<RewindFrame> s_rewind_frames;
+static std::vector<u8> s_rewind_base;  // uncompressed keyframe the newest deltas are against
+static size_t s_rewind_memory_usage = 0;
+static u32 s_rewind_frames_since_keyframe = 0;
+
+static std::vector<u8> CompressRewindData(const std::vector<u8>& in)
+{
+  std::vector<u8> out(ZSTD_compressBound(in.size()));
+  const size_t len =
+      ZSTD_compress(out.data(), out.size(), in.data(), in.size(), REWIND_COMPRESSION_LEVEL);
+  if (ZSTD_isError(len))
+    return {};
+  out.resize(len);
+  out.shrink_to_fit();
+  return out;
+}
+
+static std::vector<u8> DecompressRewindData(const std::vector<u8>& in)
+{
+  const unsigned long long size = ZSTD_getFrameContentSize(in.data(), in.size());
+  if (size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR)
+    return {};
+
+  std::vector<u8> out(static_cast<size_t>(size));
+  const size_t len = ZSTD_decompress(out.data(), out.size(), in.data(), in.size());
+  if (ZSTD_isError(len) || len != out.size())
+    return {};
+  return out;
+}
+
+void SaveRewindState()
+{
+  Core::RunOnCPUThread(
+      [] {
+        std::vector<u8> current;
+        SaveToBuffer(current);
+
+        RewindFrame frame;
+        if (s_rewind_base.empty() || s_rewind_frames.empty() ||
+            s_rewind_frames_since_keyframe >= REWIND_KEYFRAME_INTERVAL)
+        {
+          frame.is_keyframe = true;
+          frame.data = CompressRewindData(current);
+        }
+        else
+        {
+          std::vector<u8> delta;
+          MakeDelta(s_rewind_base, current, &delta);
+          frame.data = CompressRewindData(delta);
+        }
+        if (frame.data.empty())
+          return;
+
+        if (frame.is_keyframe)
+        {
+          s_rewind_base = std::move(current);
+          s_rewind_frames_since_keyframe = 0;
+        }
+        else
+        {
+          s_rewind_frames_since_keyframe++;
+        }
+        s_rewind_memory_usage += frame.data.size();
+        s_rewind_frames.push_back(std::move(frame));
+
+        // Evict the oldest keyframe group(s) to stay within the budget. Deltas
+        // are useless without their keyframe, so whole groups go at once; the
+        // newest group always stays as the newest deltas depend on its keyframe.
+        while (s_rewind_memory_usage > REWIND_MEMORY_BUDGET)
+        {
+          size_t group_end = 1;
+          while (group_end < s_rewind_frames.size() && !s_rewind_frames[group_end].is_keyframe)
+            group_end++;
+          if (group_end >= s_rewind_frames.size())
+            break;
+
+          for (size_t i = 0; i < group_end; i++)
+          {
+            s_rewind_memory_usage -= s_rewind_frames.front().data.size();
+            s_rewind_frames.pop_front();
+          }
+        }
+      },
+      true);
+}
+
+bool LoadRewindState()
+{
+  if (NetPlay::IsNetPlayRunning())
+  {
+    OSD::AddMessage("Loading savestates is disabled in Netplay to prevent desyncs");
+    return false;
+  }
+
+  bool loaded = false;
+  Core::RunOnCPUThread(
+      [&loaded] {
+        if (s_rewind_frames.empty())
+          return;
+
+        const RewindFrame frame = std::move(s_rewind_frames.back());
+        s_rewind_frames.pop_back();
+        s_rewind_memory_usage -= frame.data.size();
+
+        std::vector<u8> buffer;
+        if (frame.is_keyframe)
+        {
+          buffer = DecompressRewindData(frame.data);
+
+          // The frames that are now newest belong to the previous group, so
+          // restore that group's keyframe as the delta base.
+          const auto it = std::find_if(s_rewind_frames.rbegin(), s_rewind_frames.rend(),
+                                       [](const RewindFrame& f) { return f.is_keyframe; });
+          if (it != s_rewind_frames.rend())
+          {
+            s_rewind_base = DecompressRewindData(it->data);
+            s_rewind_frames_since_keyframe = static_cast<u32>(it - s_rewind_frames.rbegin());
+          }
+          else
+          {
+            s_rewind_base.clear();
+            s_rewind_frames_since_keyframe = 0;
+          }
+        }
+        else
+        {
+          const std::vector<u8> delta = DecompressRewindData(frame.data);
+          ApplyDelta(s_rewind_base, delta, &buffer);
+          s_rewind_frames_since_keyframe--;
+        }
+
+        if (buffer.empty())
+          return;
+
+        LoadFromBuffer(buffer);
+        loaded = true;
+      },
+      true);
+  return loaded;
+}
+
+void ClearRewindStates()
+{
+  std::deque<RewindFrame>().swap(s_rewind_frames);
+  std::vector<u8>().swap(s_rewind_base);
+  s_rewind_memory_usage = 0;
+  s_rewind_frames_since_keyframe = 0;
+}
+
 // return state number not in map
 static int GetEmptySlot(std::map<double, int> m)
 {
@@ -364,32 +668,69 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
   if (header.size != 0)  // non-zero header size means the state is compressed
   {
-    lzo_uint i = 0;
-    while (true)
-    {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
+    const u32 cookie = ZSTD_STATE_COOKIE;
+    f.WriteArray(&cookie, 1);
 
-      if ((i + IN_LEN) >= buffer_size)
-      {
-        cur_len = (lzo_uint32)(buffer_size - i);
-      }
-      else
-      {
-        cur_len = IN_LEN;
-      }
+    struct CompressThreadState
+    {
+      using CCtxPtr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
+      CCtxPtr cctx{nullptr, ZSTD_freeCCtx};
+    };
 
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertFmtT("Internal LZO Error - compression failed");
+    struct CompressParameters
+    {
+      const u8* data = nullptr;
+      size_t size = 0;
+    };
 
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
+    struct OutputParameters
+    {
+      std::vector<u8> data;
+    };
+
+    DiscIO::MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters>
+        compressor(
+            [](CompressThreadState* state) {
+              state->cctx = CompressThreadState::CCtxPtr(ZSTD_createCCtx(), ZSTD_freeCCtx);
+              return state->cctx ? DiscIO::ConversionResultCode::Success :
+                                   DiscIO::ConversionResultCode::InternalError;
+            },
+            [](CompressThreadState* state, CompressParameters parameters)
+                -> DiscIO::ConversionResult<OutputParameters> {
+              OutputParameters output;
+              output.data.resize(ZSTD_compressBound(parameters.size));
+              const size_t result =
+                  ZSTD_compressCCtx(state->cctx.get(), output.data.data(), output.data.size(),
+                                    parameters.data, parameters.size, ZSTD_COMPRESSION_LEVEL);
+              if (ZSTD_isError(result))
+                return DiscIO::ConversionResultCode::InternalError;
+              output.data.resize(result);
+              return output;
+            },
+            [&f](OutputParameters parameters) {
+              const u32 compressed_size = static_cast<u32>(parameters.data.size());
+              if (!f.WriteArray(&compressed_size, 1) ||
+                  !f.WriteBytes(parameters.data.data(), parameters.data.size()))
+              {
+                return DiscIO::ConversionResultCode::WriteFailed;
+              }
+              return DiscIO::ConversionResultCode::Success;
+            });
+
+    for (size_t i = 0; i < buffer_size; i += ZSTD_CHUNK_SIZE)
+    {
+      CompressParameters parameters;
+      parameters.data = buffer_data + i;
+      parameters.size = std::min(ZSTD_CHUNK_SIZE, buffer_size - i);
+      compressor.CompressAndWrite(parameters);
+    }
 
-      if (cur_len != IN_LEN)
-        break;
+    compressor.Shutdown();
 
-      i += cur_len;
+    if (compressor.GetStatus() != DiscIO::ConversionResultCode::Success)
+    {
+      Core::DisplayMessage("Could not save state", 2000);
+      return;
     }
   }
   else  // uncompressed
@@ -410,21 +751,52 @@ void SaveAs(const std::string& filename, bool wait)
 
   Core::RunOnCPUThread(
       [&] {
-        // Measure the size of the buffer.
+        const u64 start_us = Common::Timer::GetTimeUs();
         u8* ptr = nullptr;
-        PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
-        DoState(p);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+        PointerWrap p(&ptr, PointerWrap::MODE_WRITE);
 
-        // Then actually do the write.
         {
           std::lock_guard lk(g_cs_current_buffer);
-          g_current_buffer.resize(buffer_size);
-          ptr = &g_current_buffer[0];
-          p.SetMode(PointerWrap::MODE_WRITE);
-          DoState(p);
+
+          // If we know the size of the previous state, serialize directly into a buffer with
+          // some headroom, skipping the measure pass. This halves the time the CPU thread is
+          // blocked on every (auto)save. SetBufferEnd makes an undersized buffer abort the
+          // write instead of overrunning, in which case we fall back to measuring.
+          bool wrote = false;
+          if (s_state_size_estimate != 0)
+          {
+            g_current_buffer.resize(s_state_size_estimate + s_state_size_estimate / 16 + 65536);
+            ptr = &g_current_buffer[0];
+            p.SetBufferEnd(&g_current_buffer[0] + g_current_buffer.size());
+            DoState(p);
+            if (p.GetMode() == PointerWrap::MODE_WRITE)
+            {
+              const size_t written = static_cast<size_t>(ptr - &g_current_buffer[0]);
+              s_state_size_estimate = written;
+              g_current_buffer.resize(written);
+              wrote = true;
+            }
+          }
+
+          if (!wrote)
+          {
+            ptr = nullptr;
+            p.SetMode(PointerWrap::MODE_MEASURE);
+            p.SetBufferEnd(nullptr);
+            DoState(p);
+            const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+
+            g_current_buffer.resize(buffer_size);
+            ptr = &g_current_buffer[0];
+            p.SetMode(PointerWrap::MODE_WRITE);
+            DoState(p);
+            if (p.GetMode() == PointerWrap::MODE_WRITE)
+              s_state_size_estimate = buffer_size;
+          }
         }
 
+        Core::FlightRecorder::RecordSavestateLatency(Common::Timer::GetTimeUs() - start_us);
+
         if (p.GetMode() == PointerWrap::MODE_WRITE)
         {
           Core::DisplayMessage("Saving State...", 1000);
@@ -509,27 +881,65 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     buffer.resize(header.size);
 
-    lzo_uint i = 0;
-    while (true)
+    // The first u32 tells the two compressed formats apart: zstd states start with
+    // ZSTD_STATE_COOKIE, old LZO states with the length of their first compressed chunk.
+    u32 first_word = 0;
+    if (!f.ReadArray(&first_word, 1))
     {
-      lzo_uint32 cur_len = 0;  // number of bytes to read
-      lzo_uint new_len = 0;    // number of bytes to write
-
-      if (!f.ReadArray(&cur_len, 1))
-        break;
+      PanicAlertFmt("Failed to read the compressed state stream");
+      return;
+    }
 
-      f.ReadBytes(out, cur_len);
-      const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
-      if (res != LZO_E_OK)
+    if (first_word == ZSTD_STATE_COOKIE)
+    {
+      std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(),
+                                                                ZSTD_freeDCtx);
+      std::vector<u8> compressed;
+      size_t i = 0;
+      u32 compressed_size = 0;
+      while (f.ReadArray(&compressed_size, 1))
       {
-        // This doesn't seem to happen anymore.
-        PanicAlertFmtT("Internal LZO Error - decompression failed ({0}) ({1}, {2}) \n"
-                       "Try loading the state again",
-                       res, i, new_len);
-        return;
+        compressed.resize(compressed_size);
+        if (!f.ReadBytes(compressed.data(), compressed_size))
+        {
+          PanicAlertFmt("Failed to read the compressed state stream");
+          return;
+        }
+
+        const size_t res = ZSTD_decompressDCtx(dctx.get(), &buffer[i], buffer.size() - i,
+                                               compressed.data(), compressed.size());
+        if (ZSTD_isError(res))
+        {
+          PanicAlertFmtT("Internal zstd error - decompression failed ({0}) \n"
+                         "Try loading the state again",
+                         ZSTD_getErrorName(res));
+          return;
+        }
+
+        i += res;
       }
+    }
+    else
+    {
+      lzo_uint i = 0;
+      lzo_uint32 cur_len = first_word;  // number of bytes to read
+      do
+      {
+        lzo_uint new_len = 0;  // number of bytes to write
+
+        f.ReadBytes(out, cur_len);
+        const int res = lzo1x_decompress(out, cur_len, &buffer[i], &new_len, nullptr);
+        if (res != LZO_E_OK)
+        {
+          // This doesn't seem to happen anymore.
+          PanicAlertFmtT("Internal LZO Error - decompression failed ({0}) ({1}, {2}) \n"
+                         "Try loading the state again",
+                         res, i, new_len);
+          return;
+        }
 
-      i += new_len;
+        i += new_len;
+      } while (f.ReadArray(&cur_len, 1));
     }
   }
   else  // uncompressed
@@ -580,6 +990,7 @@ void LoadAs(const std::string& filename)
 
         // brackets here are so buffer gets freed ASAP
         {
+          const u64 start_us = Common::Timer::GetTimeUs();
           std::vector<u8> buffer;
           LoadFileStateData(filename, buffer);
 
@@ -590,6 +1001,7 @@ void LoadAs(const std::string& filename)
             DoState(p);
             loaded = true;
             loadedSuccessfully = (p.GetMode() == PointerWrap::MODE_READ);
+            Core::FlightRecorder::RecordSavestateLatency(Common::Timer::GetTimeUs() - start_us);
           }
         }
 
@@ -630,12 +1042,17 @@ void Init()
 {
   if (lzo_init() != LZO_E_OK)
     PanicAlertFmtT("Internal LZO Error - lzo_init() failed");
+
+  // States from a previous emulation session must not be rewound into.
+  ClearRewindStates();
 }
 
 void Shutdown()
 {
   Flush();
 
+  s_state_size_estimate = 0;
+
   // swapping with an empty vector, rather than clear()ing
   // this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
   // never)
@@ -648,6 +1065,8 @@ void Shutdown()
     std::lock_guard lk(g_cs_undo_load_buffer);
     std::vector<u8>().swap(g_undo_load_buffer);
   }
+
+  ClearRewindStates();
 }
 
 static std::string MakeStateFilename(int number)
@@ -52,6 +52,26 @@ void LoadAs(const std::string& filename);
 void SaveToBuffer(std::vector<u8>& buffer);
 void LoadFromBuffer(std::vector<u8>& buffer);
 
+// Delta states contain only the 4 KiB pages of the serialized state that differ from the
+// given base state (as produced by SaveToBuffer). They are much cheaper to create and store,
+// which makes per-frame snapshots for rewind and rollback feasible.
+void SaveDeltaToBuffer(const std::vector<u8>& base, std::vector<u8>& delta);
+void LoadFromDeltaBuffer(const std::vector<u8>& base, std::vector<u8>& delta);
+
+// Internal load entry points for the netplay rollback engine. The public load functions
+// refuse to run during netplay, because a user-initiated load would desync the session;
+// rollback restores happen in lockstep on every client and must bypass that guard.
+void LoadFromBufferInternal(std::vector<u8>& buffer);
+void LoadFromDeltaBufferInternal(const std::vector<u8>& base, std::vector<u8>& delta);
+
+// Rewind ring: a fixed-memory-budget, compressed in-memory history of recent states.
+// Call SaveRewindState once per frame (or at whatever granularity rewinding should
+// have); LoadRewindState loads and removes the newest frame, so pressing the rewind
+// hotkey repeatedly steps further back. The ring is cleared on Init/Shutdown.
+void SaveRewindState();
+bool LoadRewindState();
+void ClearRewindStates();
+
 void LoadLastSaved(int i = 1);
 void SaveFirstSaved();
 void UndoSaveState();
@@ -180,8 +180,8 @@ void InitializeWiiRoot(bool use_temporary)
     // If directory exists, make a backup
     if (File::Exists(s_temp_wii_root))
     {
-      const std::string backup_path =
-          s_temp_wii_root.substr(0, s_temp_wii_root.size() - 1) + ".backup" DIR_SEP;
+      const std::string session_path = s_temp_wii_root.substr(0, s_temp_wii_root.size() - 1);
+      const std::string backup_path = session_path + ".backup";
       WARN_LOG_FMT(IOS_FS, "Temporary Wii FS directory exists, moving to backup...");
 
       // If backup exists, delete it as we don't want a mess
@@ -191,7 +191,15 @@ void InitializeWiiRoot(bool use_temporary)
         File::DeleteDirRecursively(backup_path);
       }
 
-      File::CopyDir(s_temp_wii_root, backup_path, true);
+      // A leftover session NAND can only exist if the previous session did not shut
+      // down cleanly. Renaming it aside is instant regardless of its size (a recursive
+      // copy can take seconds and gigabytes worth of I/O), and it leaves the new
+      // session with the blank NAND that the deterministic save setup expects.
+      if (!File::Rename(session_path, backup_path))
+      {
+        WARN_LOG_FMT(IOS_FS, "Failed to move temporary Wii FS directory to backup, copying...");
+        File::CopyDir(s_temp_wii_root, backup_path + DIR_SEP, true);
+      }
     }
 
     File::SetUserPath(D_SESSION_WIIROOT_IDX, s_temp_wii_root);
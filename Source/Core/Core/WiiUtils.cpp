@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <bitset>
 #include <cstddef>
+#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -83,9 +84,25 @@ static bool ImportWAD(IOS::HLE::Kernel& ios, const DiscIO::VolumeWAD& wad,
 
   const bool contents_imported = [&]() {
     const u64 title_id = tmd.GetTitleId();
-    for (const IOS::ES::Content& content : tmd.GetContents())
+    const std::vector<IOS::ES::Content> contents = tmd.GetContents();
+
+    // Overlap reading the next content out of the WAD with the decrypt/hash/NAND write that ES
+    // performs for the current one. Only a single read is in flight at a time, since the
+    // underlying blob reader is not safe for concurrent access.
+    const auto read_content = [&wad](const IOS::ES::Content& content) {
+      return std::async(std::launch::async,
+                        [&wad, index = content.index] { return wad.GetContent(index); });
+    };
+    std::future<std::vector<u8>> next_data;
+    if (!contents.empty())
+      next_data = read_content(contents[0]);
+
+    for (size_t i = 0; i < contents.size(); ++i)
     {
-      const std::vector<u8> data = wad.GetContent(content.index);
+      const IOS::ES::Content& content = contents[i];
+      const std::vector<u8> data = next_data.get();
+      if (i + 1 < contents.size())
+        next_data = read_content(contents[i + 1]);
 
       if (es->ImportContentBegin(context, title_id, content.id) < 0 ||
           es->ImportContentData(context, 0, data.data(), static_cast<u32>(data.size())) < 0 ||
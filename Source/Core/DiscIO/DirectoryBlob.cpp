@@ -24,6 +24,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 #include "Core/Boot/DolReader.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/Blob.h"
@@ -43,6 +44,7 @@ static void Write32(u32 data, u32 offset, std::vector<u8>* buffer);
 static u32 ComputeNameSize(const File::FSTEntry& parent_entry);
 static std::string ASCIIToUppercase(std::string str);
 static void ConvertUTF8NamesToSHIFTJIS(File::FSTEntry* parent_entry);
+static File::FSTEntry ScanDirectoryTreeParallel(const std::string& directory);
 
 enum class PartitionType : u32
 {
@@ -724,11 +726,59 @@ u64 DirectoryBlobPartition::SetDOL(u64 dol_address)
   return Common::AlignUp(dol_address + dol_size + 0x20, 0x20ull);
 }
 
+// Equivalent to File::ScanDirectoryTree(directory, true), but fans the recursive scan out
+// across the shared thread pool. Extracted games contain thousands of files and the
+// per-file stat calls dominate the time it takes to open a directory blob.
+static File::FSTEntry ScanDirectoryTreeParallel(const std::string& directory)
+{
+  File::FSTEntry root = File::ScanDirectoryTree(directory, false);
+
+  // Expand two levels sequentially before fanning out, so a root with one large
+  // subdirectory still spreads its contents across the pool.
+  Common::ThreadPool::WorkGroup group(Common::ThreadPool::GetInstance());
+  for (File::FSTEntry& child : root.children)
+  {
+    if (!child.isDirectory)
+      continue;
+    std::string virtual_name = std::move(child.virtualName);
+    const std::string physical_name = child.physicalName;
+    child = File::ScanDirectoryTree(physical_name, false);
+    child.virtualName = std::move(virtual_name);
+
+    for (File::FSTEntry& grandchild : child.children)
+    {
+      if (!grandchild.isDirectory)
+        continue;
+      group.Push([&grandchild] {
+        std::string name = std::move(grandchild.virtualName);
+        const std::string path = grandchild.physicalName;
+        grandchild = File::ScanDirectoryTree(path, true);
+        grandchild.virtualName = std::move(name);
+      });
+    }
+  }
+  group.Wait();
+
+  // The non-recursive scans left the directory sizes (recursive child counts) unset.
+  root.size = 0;
+  for (File::FSTEntry& child : root.children)
+  {
+    if (child.isDirectory)
+    {
+      child.size = 0;
+      for (const File::FSTEntry& grandchild : child.children)
+        child.size += 1 + (grandchild.isDirectory ? grandchild.size : 0);
+    }
+    root.size += 1 + (child.isDirectory ? child.size : 0);
+  }
+  return root;
+}
+
 void DirectoryBlobPartition::BuildFST(u64 fst_address)
 {
   m_fst_data.clear();
 
-  File::FSTEntry rootEntry = File::ScanDirectoryTree(m_root_directory + "files/", true);
+  File::FSTEntry rootEntry = ScanDirectoryTreeParallel(m_root_directory + "files/");
 
   ConvertUTF8NamesToSHIFTJIS(&rootEntry);
 
@@ -18,6 +18,8 @@ class PlainFileReader : public BlobReader
 public:
   static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
 
+  ~PlainFileReader() override;
+
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
 
   u64 GetRawSize() const override { return m_size; }
@@ -35,6 +37,9 @@ private:
 
   File::IOFile m_file;
   s64 m_size;
+  // Read-only mapping of the file, or nullptr if mapping isn't supported or
+  // failed; reads then go through m_file instead.
+  u8* m_map = nullptr;
 };
 
 }  // namespace DiscIO
@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonFuncs.h"
@@ -299,45 +300,74 @@ const FileInfo& FileSystemGCWii::GetRoot() const
   return m_root;
 }
 
+// We need case insensitive comparison since some games have OPENING.BNR instead of opening.bnr.
+// Only ASCII is lowercased, matching FileInfoGCWii::NameCaseInsensitiveEquals.
+static void ToLowerASCII(std::string* str)
+{
+  for (char& c : *str)
+    c = std::tolower(c, std::locale::classic());
+}
+
 std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(std::string_view path) const
 {
   if (!IsValid())
     return nullptr;
 
-  return FindFileInfo(path, m_root);
-}
+  // Build a cache that maps lowercased paths to FST indexes (unless there already is one).
+  // Walking the tree and comparing names entry by entry for every lookup adds up
+  // when many paths are searched for, e.g. when extracting a disc's contents.
+  if (m_path_file_info_cache.empty())
+  {
+    const u32 fst_entries = m_root.GetSize();
+    // Pairs of the first FST index past a directory and the path prefix to restore there
+    std::vector<std::pair<u32, std::string>> directory_stack;
+    std::string prefix;
+    for (u32 i = 1; i < fst_entries; i++)
+    {
+      while (!directory_stack.empty() && i >= directory_stack.back().first)
+      {
+        prefix = std::move(directory_stack.back().second);
+        directory_stack.pop_back();
+      }
 
-std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(std::string_view path,
-                                                        const FileInfo& file_info) const
-{
-  // Given a path like "directory1/directory2/fileA.bin", this function will
-  // find directory1 and then call itself to search for "directory2/fileA.bin".
+      const FileInfoGCWii file_info(m_root, i);
+      std::string path_of_entry = prefix + file_info.GetName();
+      ToLowerASCII(&path_of_entry);
 
-  const size_t name_start = path.find_first_not_of('/');
-  if (name_start == std::string::npos)
-    return file_info.clone();  // We're done
+      if (file_info.IsDirectory())
+      {
+        directory_stack.emplace_back(file_info.GetSize(), std::move(prefix));
+        prefix = path_of_entry + '/';
+      }
 
-  const size_t name_end = path.find('/', name_start);
-  const std::string_view name = path.substr(name_start, name_end - name_start);
-  const std::string_view rest_of_path =
-      (name_end != std::string::npos) ? path.substr(name_end + 1) : "";
+      // If two entries have the same path, keep the first one,
+      // matching the search order of the old tree walk
+      m_path_file_info_cache.emplace(std::move(path_of_entry), i);
+    }
+  }
 
-  for (const FileInfo& child : file_info)
+  // Normalize the given path the same way the cache keys are stored:
+  // lowercased, with leading, trailing and repeated slashes removed
+  std::string lookup_path;
+  lookup_path.reserve(path.size());
+  size_t name_start = path.find_first_not_of('/');
+  while (name_start != std::string::npos)
   {
-    // We need case insensitive comparison since some games have OPENING.BNR instead of opening.bnr
-    if (child.NameCaseInsensitiveEquals(name))
-    {
-      // A match is found. The rest of the path is passed on to finish the search.
-      std::unique_ptr<FileInfo> result = FindFileInfo(rest_of_path, child);
-
-      // If the search wasn't successful, the loop continues, just in case there's a second
-      // file info that matches searching_for (which probably won't happen in practice)
-      if (result)
-        return result;
-    }
+    const size_t name_end = path.find('/', name_start);
+    if (!lookup_path.empty())
+      lookup_path += '/';
+    lookup_path += path.substr(name_start, name_end - name_start);
+    name_start = path.find_first_not_of('/', name_end);
   }
+  ToLowerASCII(&lookup_path);
 
-  return nullptr;
+  if (lookup_path.empty())
+    return m_root.clone();
+
+  const auto it = m_path_file_info_cache.find(lookup_path);
+  if (it == m_path_file_info_cache.end())
+    return nullptr;
+  return std::make_unique<FileInfoGCWii>(m_root, it->second);
 }
 
 std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(u64 disc_offset) const
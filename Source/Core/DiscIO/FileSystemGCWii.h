@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -101,8 +102,8 @@ private:
   FileInfoGCWii m_root;
   // Maps the end offset of files to FST indexes
   mutable std::map<u64, u32> m_offset_file_info_cache;
-
-  std::unique_ptr<FileInfo> FindFileInfo(std::string_view path, const FileInfo& file_info) const;
+  // Maps lowercased full paths to FST indexes
+  mutable std::unordered_map<std::string, u32> m_path_file_info_cache;
 };
 
 }  // namespace DiscIO
@@ -5,12 +5,17 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstring>
+#include <future>
+#include <thread>
 
 #include <fmt/format.h>
 
 #include "Common/Crypto/AES.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
@@ -41,6 +46,7 @@ void NANDImporter::ImportNANDBin(const std::string& path_to_bin,
 
   FindSuperblock();
   ProcessEntry(0, nand_root);
+  ExtractQueuedFiles();
   ExportKeys(nand_root);
   ExtractCertificates(nand_root);
 }
@@ -171,30 +177,91 @@ void NANDImporter::ProcessDirectory(const NANDFSTEntry& entry, const std::string
 
 void NANDImporter::ProcessFile(const NANDFSTEntry& entry, const std::string& parent_path)
 {
-  constexpr size_t NAND_AES_KEY_OFFSET = 0x158;
-  constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
-
   m_update_callback();
   INFO_LOG_FMT(DISCIO, "File: {}", FormatDebugString(entry));
 
-  const std::string path = GetPath(entry, parent_path);
-  File::IOFile file(path, "wb");
+  // Decryption and writing is deferred so it can be spread across worker threads once the
+  // entire FST has been walked (and all parent directories exist).
+  m_queued_files.push_back({entry, GetPath(entry, parent_path)});
+}
+
+void NANDImporter::ExtractQueuedFiles()
+{
+  if (m_queued_files.empty())
+    return;
+
+  const size_t worker_count = std::max<size_t>(
+      1, std::min<size_t>(std::thread::hardware_concurrency(), m_queued_files.size()));
+
+  std::atomic<size_t> next_file{0};
+  std::vector<std::future<void>> workers;
+  workers.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; i++)
+  {
+    workers.emplace_back(std::async(std::launch::async, [this, &next_file] {
+      while (true)
+      {
+        const size_t file_index = next_file.fetch_add(1);
+        if (file_index >= m_queued_files.size())
+          return;
+        ExtractFile(m_queued_files[file_index]);
+      }
+    }));
+  }
+
+  // Keep pumping the update callback on this thread; it is not safe to call from workers.
+  for (std::future<void>& worker : workers)
+  {
+    while (worker.wait_for(std::chrono::milliseconds(50)) != std::future_status::ready)
+      m_update_callback();
+  }
+
+  m_queued_files.clear();
+}
+
+void NANDImporter::ExtractFile(const QueuedFile& file)
+{
+  constexpr size_t NAND_AES_KEY_OFFSET = 0x158;
+  constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
+
   std::array<u8, 16> key{};
   std::copy(&m_nand_keys[NAND_AES_KEY_OFFSET], &m_nand_keys[NAND_AES_KEY_OFFSET + key.size()],
             key.begin());
-  u16 sub = Common::swap16(entry.sub);
-  u32 remaining_bytes = Common::swap32(entry.size);
+  u16 sub = Common::swap16(file.entry.sub);
+  u32 remaining_bytes = Common::swap32(file.entry.size);
+
+  std::vector<u8> data;
+  data.reserve(remaining_bytes);
 
   while (remaining_bytes > 0)
   {
     std::array<u8, 16> iv{};
-    std::vector<u8> block = Common::AES::Decrypt(
+    const std::vector<u8> block = Common::AES::Decrypt(
         key.data(), iv.data(), &m_nand[NAND_FAT_BLOCK_SIZE * sub], NAND_FAT_BLOCK_SIZE);
-    u32 size = remaining_bytes < NAND_FAT_BLOCK_SIZE ? remaining_bytes : NAND_FAT_BLOCK_SIZE;
-    file.WriteBytes(block.data(), size);
+    const u32 size = remaining_bytes < NAND_FAT_BLOCK_SIZE ? remaining_bytes : NAND_FAT_BLOCK_SIZE;
+    data.insert(data.end(), block.begin(), block.begin() + size);
     remaining_bytes -= size;
     sub = Common::swap16(&m_nand[m_nand_fat_offset + 2 * sub]);
   }
+
+  // When reimporting over an existing NAND root, skip rewriting files whose contents have not
+  // changed so only the differing ones cost a write.
+  File::IOFile existing_file(file.path, "rb");
+  if (existing_file.IsOpen() && existing_file.GetSize() == data.size())
+  {
+    std::vector<u8> existing_data(data.size());
+    if (existing_file.ReadBytes(existing_data.data(), existing_data.size()) &&
+        Common::GetHash64(existing_data.data(), static_cast<u32>(existing_data.size()), 0) ==
+            Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0))
+    {
+      INFO_LOG_FMT(DISCIO, "File {} is unchanged, skipping", file.path);
+      return;
+    }
+  }
+  existing_file.Close();
+
+  File::IOFile out_file(file.path, "wb");
+  out_file.WriteBytes(data.data(), data.size());
 }
 
 bool NANDImporter::ExtractCertificates(const std::string& nand_root)
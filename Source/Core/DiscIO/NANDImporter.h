@@ -41,6 +41,12 @@ private:
   };
 #pragma pack(pop)
 
+  struct QueuedFile
+  {
+    NANDFSTEntry entry;
+    std::string path;
+  };
+
   bool ReadNANDBin(const std::string& path_to_bin, std::function<std::string()> get_otp_dump_path);
   void FindSuperblock();
   std::string GetPath(const NANDFSTEntry& entry, const std::string& parent_path);
@@ -48,9 +54,12 @@ private:
   void ProcessEntry(u16 entry_number, const std::string& parent_path);
   void ProcessFile(const NANDFSTEntry& entry, const std::string& parent_path);
   void ProcessDirectory(const NANDFSTEntry& entry, const std::string& parent_path);
+  void ExtractQueuedFiles();
+  void ExtractFile(const QueuedFile& file);
   void ExportKeys(const std::string& nand_root);
 
   std::vector<u8> m_nand;
+  std::vector<QueuedFile> m_queued_files;
   std::vector<u8> m_nand_keys;
   size_t m_nand_fat_offset = 0;
   size_t m_nand_fst_offset = 0;
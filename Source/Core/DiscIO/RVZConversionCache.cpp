@@ -0,0 +1,136 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/RVZConversionCache.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+#include "Common/Thread.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/WIABlob.h"
+
+namespace DiscIO
+{
+namespace
+{
+// Same defaults the converter dialog suggests for RVZ.
+constexpr WIARVZCompressionType CACHE_COMPRESSION_TYPE = WIARVZCompressionType::Zstd;
+constexpr int CACHE_COMPRESSION_LEVEL = 5;
+constexpr int CACHE_CHUNK_SIZE = 0x20000;
+
+std::mutex s_running_mutex;
+bool s_conversion_running = false;
+
+bool IsLegacyFormat(BlobType type)
+{
+  return type == BlobType::WBFS || type == BlobType::CISO;
+}
+
+// FNV-1a, only used to derive a stable cache file name from the original path.
+u64 HashPath(const std::string& path)
+{
+  u64 hash = 0xcbf29ce484222325;
+  for (const char c : path)
+    hash = (hash ^ static_cast<u8>(c)) * 0x100000001b3;
+  return hash;
+}
+
+// The key includes the original file's size, so replacing an image with a different version
+// leaves any stale conversion unused (its name no longer matches) rather than booting it.
+std::string GetCachePath(const std::string& path, u64 size)
+{
+  std::string filename;
+  SplitPath(path, nullptr, &filename, nullptr);
+  return fmt::format("{}{}_{:016x}_{:x}.rvz", File::GetUserPath(D_RVZCACHE_IDX), filename,
+                     HashPath(path), size);
+}
+
+void ConvertToCache(const std::string& path, const std::string& cache_path)
+{
+  Common::SetCurrentThreadName("RVZ cache convert");
+
+  const std::unique_ptr<BlobReader> blob = CreateBlobReader(path);
+  const std::unique_ptr<VolumeDisc> volume = CreateDisc(path);
+  // Write to a temporary name and only rename on success, so an interrupted conversion (e.g.
+  // the emulator exiting) is never mistaken for a finished one. A leftover temporary file is
+  // simply overwritten by the next attempt.
+  const std::string temp_path = cache_path + ".tmp";
+
+  bool success = false;
+  if (blob && File::CreateFullPath(temp_path))
+  {
+    File::IOFile outfile(temp_path, "wb");
+    if (outfile)
+    {
+      const ConversionResultCode result = RVZFileReader::Convert(
+          blob.get(), volume.get(), &outfile, CACHE_COMPRESSION_TYPE, CACHE_COMPRESSION_LEVEL,
+          CACHE_CHUNK_SIZE, [](const std::string&, float) { return true; });
+      success = result == ConversionResultCode::Success && outfile.Close() &&
+                File::Rename(temp_path, cache_path);
+    }
+  }
+
+  if (success)
+    NOTICE_LOG_FMT(DISCIO, "Cached RVZ conversion of {} as {}", path, cache_path);
+  else
+    WARN_LOG_FMT(DISCIO, "Failed to cache RVZ conversion of {}", path);
+
+  if (!success)
+    File::Delete(temp_path);
+
+  std::lock_guard lk(s_running_mutex);
+  s_conversion_running = false;
+}
+}  // namespace
+
+std::optional<std::string> FindCachedRVZ(const std::string& path)
+{
+  const u64 size = File::GetSize(path);
+  if (size == 0)
+    return std::nullopt;
+
+  std::string cache_path = GetCachePath(path, size);
+  if (!File::Exists(cache_path))
+    return std::nullopt;
+
+  return cache_path;
+}
+
+void QueueRVZConversion(const std::string& path)
+{
+  const u64 size = File::GetSize(path);
+  if (size == 0)
+    return;
+
+  const std::string cache_path = GetCachePath(path, size);
+  if (File::Exists(cache_path))
+    return;
+
+  {
+    const std::unique_ptr<BlobReader> blob = CreateBlobReader(path);
+    if (!blob || !IsLegacyFormat(blob->GetBlobType()))
+      return;
+  }
+
+  {
+    std::lock_guard lk(s_running_mutex);
+    if (s_conversion_running)
+      return;
+    s_conversion_running = true;
+  }
+
+  std::thread(ConvertToCache, path, cache_path).detach();
+}
+}  // namespace DiscIO
@@ -0,0 +1,22 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+namespace DiscIO
+{
+// Cache of automatic RVZ conversions of legacy disc image formats (WBFS/CISO), so that old
+// libraries get the RVZ read path without the user converting every file by hand. Whether the
+// cache is used at all is decided by the caller; this module only provides the mechanism.
+
+// Returns the path of an up-to-date cached conversion of path, or nullopt if there is none.
+std::optional<std::string> FindCachedRVZ(const std::string& path);
+
+// Starts converting path into the cache on a background thread if it is a legacy-format image
+// without an up-to-date cached conversion. At most one conversion runs at a time; further
+// requests while one is running are dropped and will be retried on a later boot.
+void QueueRVZConversion(const std::string& path);
+}  // namespace DiscIO
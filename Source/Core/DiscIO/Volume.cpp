@@ -87,10 +87,15 @@ std::map<Language, std::string> Volume::ReadWiiNames(const std::vector<char16_t>
 
 static std::unique_ptr<VolumeDisc> CreateDisc(std::unique_ptr<BlobReader>& reader)
 {
-  if (reader->ReadSwapped<u32>(0x18) == WII_DISC_MAGIC)
+  // Both magic words in one read, so misdetections don't cost a second seek
+  u32 magics[2];
+  if (!reader->Read(0x18, sizeof(magics), reinterpret_cast<u8*>(magics)))
+    return nullptr;
+
+  if (Common::swap32(magics[0]) == WII_DISC_MAGIC)
     return std::make_unique<VolumeWii>(std::move(reader));
 
-  if (reader->ReadSwapped<u32>(0x1C) == GAMECUBE_DISC_MAGIC)
+  if (Common::swap32(magics[1]) == GAMECUBE_DISC_MAGIC)
     return std::make_unique<VolumeGC>(std::move(reader));
 
   // No known magic words found
@@ -3,6 +3,7 @@
 
 #include "DiscIO/VolumeDisc.h"
 
+#include <cstring>
 #include <memory>
 #include <optional>
 #include <string>
@@ -11,17 +12,41 @@
 #include <mbedtls/sha1.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/Swap.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Filesystem.h"
 
 namespace DiscIO
 {
+bool VolumeDisc::CachedHeaderRead(u64 offset, u64 length, u8* buffer,
+                                  const Partition& partition) const
+{
+  // Partition reads go through decryption and can't share a cache with the unencrypted area.
+  if (partition != PARTITION_NONE || offset + length > HEADER_CACHE_SIZE)
+    return Read(offset, length, buffer, partition);
+
+  if (!m_header_cache)
+  {
+    std::vector<u8> header(HEADER_CACHE_SIZE);
+    if (!Read(0, header.size(), header.data(), PARTITION_NONE))
+    {
+      // Images smaller than the cache exist (e.g. truncated dumps); don't let them lose
+      // access to the fields that are present.
+      return Read(offset, length, buffer, partition);
+    }
+    m_header_cache = std::move(header);
+  }
+
+  std::memcpy(buffer, m_header_cache->data() + offset, length);
+  return true;
+}
+
 std::string VolumeDisc::GetGameID(const Partition& partition) const
 {
   char id[6];
 
-  if (!Read(0, sizeof(id), reinterpret_cast<u8*>(id), partition))
+  if (!CachedHeaderRead(0, sizeof(id), reinterpret_cast<u8*>(id), partition))
     return std::string();
 
   return DecodeString(id);
@@ -30,7 +55,9 @@ std::string VolumeDisc::GetGameID(const Partition& partition) const
 Country VolumeDisc::GetCountry(const Partition& partition) const
 {
   // The 0 that we use as a default value is mapped to Country::Unknown and Region::Unknown
-  const u8 country_byte = ReadSwapped<u8>(3, partition).value_or(0);
+  u8 country_byte;
+  if (!CachedHeaderRead(3, sizeof(country_byte), &country_byte, partition))
+    country_byte = 0;
   const Region region = GetRegion();
   const std::optional<u16> revision = GetRevision();
 
@@ -53,7 +80,7 @@ std::string VolumeDisc::GetMakerID(const Partition& partition) const
 {
   char maker_id[2];
 
-  if (!Read(0x4, sizeof(maker_id), reinterpret_cast<u8*>(&maker_id), partition))
+  if (!CachedHeaderRead(0x4, sizeof(maker_id), reinterpret_cast<u8*>(&maker_id), partition))
     return std::string();
 
   return DecodeString(maker_id);
@@ -61,14 +88,16 @@ std::string VolumeDisc::GetMakerID(const Partition& partition) const
 
 std::optional<u16> VolumeDisc::GetRevision(const Partition& partition) const
 {
-  std::optional<u8> revision = ReadSwapped<u8>(7, partition);
-  return revision ? *revision : std::optional<u16>();
+  u8 revision;
+  if (!CachedHeaderRead(7, sizeof(revision), &revision, partition))
+    return std::nullopt;
+  return revision;
 }
 
 std::string VolumeDisc::GetInternalName(const Partition& partition) const
 {
   char name[0x60];
-  if (!Read(0x20, sizeof(name), reinterpret_cast<u8*>(&name), partition))
+  if (!CachedHeaderRead(0x20, sizeof(name), reinterpret_cast<u8*>(&name), partition))
     return std::string();
 
   return DecodeString(name);
@@ -78,7 +107,7 @@ std::string VolumeDisc::GetApploaderDate(const Partition& partition) const
 {
   char date[16];
 
-  if (!Read(0x2440, sizeof(date), reinterpret_cast<u8*>(&date), partition))
+  if (!CachedHeaderRead(0x2440, sizeof(date), reinterpret_cast<u8*>(&date), partition))
     return std::string();
 
   return DecodeString(date);
@@ -86,13 +115,19 @@ std::string VolumeDisc::GetApploaderDate(const Partition& partition) const
 
 std::optional<u8> VolumeDisc::GetDiscNumber(const Partition& partition) const
 {
-  return ReadSwapped<u8>(6, partition);
+  u8 disc_number;
+  if (!CachedHeaderRead(6, sizeof(disc_number), &disc_number, partition))
+    return std::nullopt;
+  return disc_number;
 }
 
 bool VolumeDisc::IsNKit() const
 {
   constexpr u32 NKIT_MAGIC = 0x4E4B4954;  // "NKIT"
-  return ReadSwapped<u32>(0x200, PARTITION_NONE) == NKIT_MAGIC;
+  u32 magic;
+  if (!CachedHeaderRead(0x200, sizeof(magic), reinterpret_cast<u8*>(&magic), PARTITION_NONE))
+    return false;
+  return Common::swap32(magic) == NKIT_MAGIC;
 }
 
 void VolumeDisc::AddGamePartitionToSyncHash(mbedtls_sha1_context* context) const
@@ -5,6 +5,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <mbedtls/sha1.h>
 
@@ -28,6 +29,19 @@ public:
 protected:
   Region RegionCodeToRegion(std::optional<u32> region_code) const;
   void AddGamePartitionToSyncHash(mbedtls_sha1_context* context) const;
+
+  // Like Read, but serves reads that fall within the beginning of the unencrypted area from a
+  // cache that is filled with a single blob read on first use. The game list reads the game ID,
+  // maker ID, revision, disc number, internal name, region and apploader date one field at a
+  // time; without the cache, each of those is a separate small read (and for compressed formats,
+  // a separate trip into the decompressor), which adds up when scanning thousands of images.
+  bool CachedHeaderRead(u64 offset, u64 length, u8* buffer, const Partition& partition) const;
+
+private:
+  // The GC/Wii disc header and, for unencrypted discs, the apploader date at 0x2440.
+  static constexpr u64 HEADER_CACHE_SIZE = 0x2450;
+
+  mutable std::optional<std::vector<u8>> m_header_cache;
 };
 
 }  // namespace DiscIO
@@ -19,6 +19,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscExtractor.h"
@@ -69,7 +70,13 @@ std::string VolumeGC::GetGameTDBID(const Partition& partition) const
 
 Region VolumeGC::GetRegion() const
 {
-  return RegionCodeToRegion(m_reader->ReadSwapped<u32>(0x458));
+  u32 region_code;
+  if (!CachedHeaderRead(0x458, sizeof(region_code), reinterpret_cast<u8*>(&region_code),
+                        PARTITION_NONE))
+  {
+    return Region::Unknown;
+  }
+  return RegionCodeToRegion(Common::swap32(region_code));
 }
 
 std::map<Language, std::string> VolumeGC::GetShortNames() const
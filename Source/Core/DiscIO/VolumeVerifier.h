@@ -5,6 +5,7 @@
 
 #include <future>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -182,7 +183,9 @@ private:
   std::future<void> m_md5_future;
   std::future<void> m_sha1_future;
   std::future<void> m_content_future;
-  std::future<void> m_group_future;
+  std::vector<std::future<void>> m_group_futures;
+  // Guards the result members below that the group futures write to.
+  std::mutex m_group_mutex;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
@@ -36,8 +36,7 @@
 namespace DiscIO
 {
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
-    : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE),
-      m_last_decrypted_block(UINT64_MAX)
+    : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE)
 {
   ASSERT(m_reader);
 
@@ -183,7 +182,7 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   if (!aes_context)
     return false;
 
-  std::vector<u8> read_buffer(BLOCK_TOTAL_SIZE);
+  std::vector<u8> read_buffer(BLOCK_TOTAL_SIZE * MAX_DECRYPT_BATCH_BLOCKS);
   while (length > 0)
   {
     // Calculate offsets
@@ -191,21 +190,42 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
                                offset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = offset % BLOCK_DATA_SIZE;
 
-    if (m_last_decrypted_block != block_offset_on_disc)
+    DecryptedBlock& block =
+        m_decrypted_block_cache[block_offset_on_disc / BLOCK_TOTAL_SIZE %
+                                DECRYPTED_BLOCK_CACHE_BLOCKS];
+    if (block.offset_on_disc != block_offset_on_disc)
     {
-      // Read the current block
-      if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.data()))
-        return false;
+      // Read and decrypt as many upcoming blocks as this read needs in one
+      // batch, so the blob is read once per run instead of once per block.
+      // Consecutive blocks map to distinct cache slots, so the whole batch
+      // stays cached until the copy loop below has consumed it.
+      u64 blocks_to_read = std::min(
+          MAX_DECRYPT_BATCH_BLOCKS, (data_offset_in_block + length + BLOCK_DATA_SIZE - 1) /
+                                        BLOCK_DATA_SIZE);
+      if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE * blocks_to_read,
+                          read_buffer.data()))
+      {
+        // Probably the end of the partition; retry with just the needed block
+        blocks_to_read = 1;
+        if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.data()))
+          return false;
+      }
 
-      // Decrypt the block's data
-      DecryptBlockData(read_buffer.data(), m_last_decrypted_block_data, aes_context);
-      m_last_decrypted_block = block_offset_on_disc;
+      for (u64 i = 0; i < blocks_to_read; ++i)
+      {
+        const u64 decrypted_block_offset = block_offset_on_disc + i * BLOCK_TOTAL_SIZE;
+        DecryptedBlock& cache_entry =
+            m_decrypted_block_cache[decrypted_block_offset / BLOCK_TOTAL_SIZE %
+                                    DECRYPTED_BLOCK_CACHE_BLOCKS];
+        DecryptBlockData(read_buffer.data() + i * BLOCK_TOTAL_SIZE, cache_entry.data.data(),
+                         aes_context);
+        cache_entry.offset_on_disc = decrypted_block_offset;
+      }
     }
 
     // Copy the decrypted data
     u64 copy_size = std::min(length, BLOCK_DATA_SIZE - data_offset_in_block);
-    memcpy(buffer, &m_last_decrypted_block_data[data_offset_in_block],
-           static_cast<size_t>(copy_size));
+    memcpy(buffer, &block.data[data_offset_in_block], static_cast<size_t>(copy_size));
 
     // Update offsets
     length -= copy_size;
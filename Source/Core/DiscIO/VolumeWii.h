@@ -131,8 +131,19 @@ private:
   Partition m_game_partition;
   bool m_encrypted;
 
-  mutable u64 m_last_decrypted_block;
-  mutable u8 m_last_decrypted_block_data[BLOCK_DATA_SIZE];
+  // Direct-mapped cache of decrypted blocks, indexed by block number on disc.
+  // Sized so that a whole decrypted batch survives until the read that
+  // requested it has consumed it, with room for nearby seek-back patterns.
+  static constexpr size_t DECRYPTED_BLOCK_CACHE_BLOCKS = 16;
+  static constexpr u64 MAX_DECRYPT_BATCH_BLOCKS = 8;
+
+  struct DecryptedBlock
+  {
+    u64 offset_on_disc = UINT64_MAX;
+    std::array<u8, BLOCK_DATA_SIZE> data{};
+  };
+
+  mutable std::array<DecryptedBlock, DECRYPTED_BLOCK_CACHE_BLOCKS> m_decrypted_block_cache;
 };
 
 }  // namespace DiscIO
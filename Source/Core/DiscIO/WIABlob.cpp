@@ -5,12 +5,16 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -537,7 +541,7 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        m_chunk_cache.pop_front();  // Invalidate the failed chunk
         return false;
       }
 
@@ -567,8 +571,14 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  const auto cached_chunk =
+      std::find_if(m_chunk_cache.begin(), m_chunk_cache.end(),
+                   [offset_in_file](const auto& entry) { return entry.first == offset_in_file; });
+  if (cached_chunk != m_chunk_cache.end())
+  {
+    m_chunk_cache.splice(m_chunk_cache.begin(), m_chunk_cache, cached_chunk);
+    return m_chunk_cache.front().second;
+  }
 
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
@@ -598,11 +608,13 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  m_chunk_cache.emplace_front(
+      offset_in_file, Chunk(&m_file, offset_in_file, compressed_size, decompressed_size,
+                            exception_lists, compressed_exception_lists, rvz_packed_size,
+                            data_offset, std::move(decompressor)));
+  if (m_chunk_cache.size() > CHUNK_CACHE_MAX_SIZE)
+    m_chunk_cache.pop_back();
+  return m_chunk_cache.front().second;
 }
 
 template <bool RVZ>
@@ -1840,98 +1852,177 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
       set_up_compress_thread_state, process_and_compress, output);
 
-  for (const DataEntry& data_entry : data_entries)
+  // Reading the input file used to alternate with feeding the compressor on this thread,
+  // which left the compressor threads idle whenever we were waiting for the disk. Instead,
+  // run the read loop on a separate thread which keeps a small number of chunks buffered
+  // ahead of the compressor.
+  struct ReadChunk
   {
-    u32 first_group;
-    u32 last_group;
-
-    u64 data_offset;
-    u64 data_size;
-
+    std::vector<u8> data;
+    const DataEntry* data_entry;
     u64 data_offset_in_partition;
+    u64 bytes_read;
+    size_t group_index;
+  };
 
-    if (data_entry.is_partition)
+  constexpr size_t MAX_BUFFERED_CHUNKS = 4;
+  std::deque<ReadChunk> read_queue;
+  std::mutex read_mutex;
+  std::condition_variable read_queue_not_empty;
+  std::condition_variable read_queue_not_full;
+  bool read_finished = false;
+  bool read_failed = false;
+  std::atomic<bool> stop_reading{false};
+
+  std::thread read_thread([&] {
+    const auto push_chunk = [&](ReadChunk chunk) {
+      std::unique_lock lock(read_mutex);
+      read_queue_not_full.wait(
+          lock, [&] { return read_queue.size() < MAX_BUFFERED_CHUNKS || stop_reading.load(); });
+      if (stop_reading.load())
+        return false;
+      read_queue.push_back(std::move(chunk));
+      lock.unlock();
+      read_queue_not_empty.notify_one();
+      return true;
+    };
+
+    for (const DataEntry& data_entry : data_entries)
     {
-      const PartitionEntry& partition_entry = partition_entries[data_entry.index];
-      const PartitionDataEntry& partition_data_entry =
-          partition_entry.data_entries[data_entry.partition_data_index];
+      u32 first_group;
+      u32 last_group;
 
-      first_group = Common::swap32(partition_data_entry.group_index);
-      last_group = first_group + Common::swap32(partition_data_entry.number_of_groups);
+      u64 data_offset;
+      u64 data_size;
 
-      const u32 first_sector = Common::swap32(partition_data_entry.first_sector);
-      data_offset = first_sector * VolumeWii::BLOCK_TOTAL_SIZE;
-      data_size =
-          Common::swap32(partition_data_entry.number_of_sectors) * VolumeWii::BLOCK_TOTAL_SIZE;
+      u64 data_offset_in_partition;
 
-      const u32 block_in_partition =
-          first_sector - Common::swap32(partition_entry.data_entries[0].first_sector);
-      data_offset_in_partition = block_in_partition * VolumeWii::BLOCK_DATA_SIZE;
-    }
-    else
-    {
-      const RawDataEntry& raw_data_entry = raw_data_entries[data_entry.index];
+      if (data_entry.is_partition)
+      {
+        const PartitionEntry& partition_entry = partition_entries[data_entry.index];
+        const PartitionDataEntry& partition_data_entry =
+            partition_entry.data_entries[data_entry.partition_data_index];
 
-      first_group = Common::swap32(raw_data_entry.group_index);
-      last_group = first_group + Common::swap32(raw_data_entry.number_of_groups);
+        first_group = Common::swap32(partition_data_entry.group_index);
+        last_group = first_group + Common::swap32(partition_data_entry.number_of_groups);
 
-      data_offset = Common::swap64(raw_data_entry.data_offset);
-      data_size = Common::swap64(raw_data_entry.data_size);
+        const u32 first_sector = Common::swap32(partition_data_entry.first_sector);
+        data_offset = first_sector * VolumeWii::BLOCK_TOTAL_SIZE;
+        data_size =
+            Common::swap32(partition_data_entry.number_of_sectors) * VolumeWii::BLOCK_TOTAL_SIZE;
 
-      const u64 skipped_data = data_offset % VolumeWii::BLOCK_TOTAL_SIZE;
-      data_offset -= skipped_data;
-      data_size += skipped_data;
+        const u32 block_in_partition =
+            first_sector - Common::swap32(partition_entry.data_entries[0].first_sector);
+        data_offset_in_partition = block_in_partition * VolumeWii::BLOCK_DATA_SIZE;
+      }
+      else
+      {
+        const RawDataEntry& raw_data_entry = raw_data_entries[data_entry.index];
 
-      data_offset_in_partition = data_offset;
-    }
+        first_group = Common::swap32(raw_data_entry.group_index);
+        last_group = first_group + Common::swap32(raw_data_entry.number_of_groups);
 
-    ASSERT(groups_processed == first_group);
-    ASSERT(bytes_read == data_offset);
+        data_offset = Common::swap64(raw_data_entry.data_offset);
+        data_size = Common::swap64(raw_data_entry.data_size);
 
-    while (groups_processed < last_group)
-    {
-      const ConversionResultCode status = mt_compressor.GetStatus();
-      if (status != ConversionResultCode::Success)
-        return status;
+        const u64 skipped_data = data_offset % VolumeWii::BLOCK_TOTAL_SIZE;
+        data_offset -= skipped_data;
+        data_size += skipped_data;
 
-      u64 bytes_to_read = chunk_size;
-      if (data_entry.is_partition)
-        bytes_to_read = std::max<u64>(bytes_to_read, VolumeWii::GROUP_TOTAL_SIZE);
-      bytes_to_read = std::min<u64>(bytes_to_read, data_offset + data_size - bytes_read);
+        data_offset_in_partition = data_offset;
+      }
 
-      buffer.resize(bytes_to_read);
-      if (!infile->Read(bytes_read, bytes_to_read, buffer.data()))
-        return ConversionResultCode::ReadFailed;
-      bytes_read += bytes_to_read;
+      ASSERT(groups_processed == first_group);
+      ASSERT(bytes_read == data_offset);
 
-      mt_compressor.CompressAndWrite(CompressParameters{
-          buffer, &data_entry, data_offset_in_partition, bytes_read, groups_processed});
+      while (groups_processed < last_group)
+      {
+        u64 bytes_to_read = chunk_size;
+        if (data_entry.is_partition)
+          bytes_to_read = std::max<u64>(bytes_to_read, VolumeWii::GROUP_TOTAL_SIZE);
+        bytes_to_read = std::min<u64>(bytes_to_read, data_offset + data_size - bytes_read);
 
-      data_offset += bytes_to_read;
-      data_size -= bytes_to_read;
+        std::vector<u8> chunk_data(bytes_to_read);
+        if (!infile->Read(bytes_read, bytes_to_read, chunk_data.data()))
+        {
+          std::lock_guard lock(read_mutex);
+          read_failed = true;
+          read_finished = true;
+          read_queue_not_empty.notify_one();
+          return;
+        }
+        bytes_read += bytes_to_read;
 
-      if (data_entry.is_partition)
-      {
-        data_offset_in_partition +=
-            bytes_to_read / VolumeWii::BLOCK_TOTAL_SIZE * VolumeWii::BLOCK_DATA_SIZE;
-      }
-      else
-      {
-        data_offset_in_partition += bytes_to_read;
+        if (!push_chunk(ReadChunk{std::move(chunk_data), &data_entry, data_offset_in_partition,
+                                  bytes_read, groups_processed}))
+        {
+          return;
+        }
+
+        data_offset += bytes_to_read;
+        data_size -= bytes_to_read;
+
+        if (data_entry.is_partition)
+        {
+          data_offset_in_partition +=
+              bytes_to_read / VolumeWii::BLOCK_TOTAL_SIZE * VolumeWii::BLOCK_DATA_SIZE;
+        }
+        else
+        {
+          data_offset_in_partition += bytes_to_read;
+        }
+
+        groups_processed += Common::AlignUp(bytes_to_read, chunk_size) / chunk_size;
       }
 
-      groups_processed += Common::AlignUp(bytes_to_read, chunk_size) / chunk_size;
+      ASSERT(data_size == 0);
     }
 
-    ASSERT(data_size == 0);
+    ASSERT(groups_processed == total_groups);
+    ASSERT(bytes_read == iso_size);
+
+    {
+      std::lock_guard lock(read_mutex);
+      read_finished = true;
+    }
+    read_queue_not_empty.notify_one();
+  });
+
+  ConversionResultCode status = ConversionResultCode::Success;
+  while (true)
+  {
+    status = mt_compressor.GetStatus();
+    if (status != ConversionResultCode::Success)
+      break;
+
+    ReadChunk chunk;
+    {
+      std::unique_lock lock(read_mutex);
+      read_queue_not_empty.wait(lock, [&] { return !read_queue.empty() || read_finished; });
+      if (read_queue.empty())
+        break;
+      chunk = std::move(read_queue.front());
+      read_queue.pop_front();
+    }
+    read_queue_not_full.notify_one();
+
+    mt_compressor.CompressAndWrite(CompressParameters{std::move(chunk.data), chunk.data_entry,
+                                                      chunk.data_offset_in_partition,
+                                                      chunk.bytes_read, chunk.group_index});
   }
 
-  ASSERT(groups_processed == total_groups);
-  ASSERT(bytes_read == iso_size);
+  stop_reading.store(true);
+  read_queue_not_full.notify_one();
+  read_thread.join();
+
+  if (status != ConversionResultCode::Success)
+    return status;
+  if (read_failed)
+    return ConversionResultCode::ReadFailed;
 
   mt_compressor.Shutdown();
 
-  const ConversionResultCode status = mt_compressor.GetStatus();
+  status = mt_compressor.GetStatus();
   if (status != ConversionResultCode::Success)
     return status;
 
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <limits>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -355,8 +356,11 @@ private:
   WIARVZCompressionType m_compression_type;
 
   File::IOFile m_file;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  // Decompressed chunks in most recently used order, keyed by offset in the
+  // file, so reads that revisit a chunk or straddle a chunk boundary across
+  // calls don't have to decompress it again.
+  static constexpr size_t CHUNK_CACHE_MAX_SIZE = 4;
+  std::list<std::pair<u64, Chunk>> m_chunk_cache;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
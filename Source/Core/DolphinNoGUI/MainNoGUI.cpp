@@ -6,6 +6,7 @@
 #include <OptionParser.h>
 #include <cstddef>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <signal.h>
 #include <string>
@@ -23,6 +24,8 @@
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
+#include "Core/PowerPC/CPUBenchmark.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -165,6 +168,11 @@ int main(int argc, char* argv[])
             "win32"
 #endif
       });
+  parser->add_option("--benchmark_frames")
+      .action("store")
+      .help("Run a CPU benchmark for the given number of frames, write the results to the logs "
+            "directory and exit (combine with --movie and the Null video backend for a "
+            "deterministic workload)");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -229,6 +237,32 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  if (options.is_set("movie"))
+  {
+    if (!game_specified)
+    {
+      fprintf(stderr, "A movie cannot be played back without specifying a game to launch.\n");
+      return 1;
+    }
+    if (!Movie::PlayInput(static_cast<const char*>(options.get("movie")), &boot->savestate_path))
+    {
+      fprintf(stderr, "Failed to load the specified movie file.\n");
+      return 1;
+    }
+  }
+
+  if (options.is_set("benchmark_frames"))
+  {
+    const unsigned long frames =
+        strtoul(static_cast<const char*>(options.get("benchmark_frames")), nullptr, 10);
+    if (frames == 0)
+    {
+      fprintf(stderr, "Invalid number of benchmark frames.\n");
+      return 1;
+    }
+    CPUBenchmark::Start(frames);
+  }
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
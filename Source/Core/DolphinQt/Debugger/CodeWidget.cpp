@@ -459,13 +459,9 @@ void CodeWidget::StepOut()
 
     if (inst.LK)
     {
-      // Step over branches
-      u32 next_pc = PC + 4;
-      do
-      {
-        PowerPC::SingleStep();
-      } while (PC != next_pc && clock::now() < timeout &&
-               !PowerPC::breakpoints.IsAddressBreakPoint(PC));
+      // Step over branches, running the callee in batches instead of per-instruction steps
+      const u32 next_pc = PC + 4;
+      PowerPC::StepUntil(next_pc, timeout);
     }
     else
     {
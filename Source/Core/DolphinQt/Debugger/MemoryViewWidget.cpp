@@ -10,9 +10,11 @@
 #include <QMouseEvent>
 #include <QScrollBar>
 
+#include <algorithm>
 #include <cctype>
 #include <cmath>
 
+#include "Common/BitUtils.h"
 #include "Common/StringUtil.h"
 #include "Core/Core.h"
 #include "Core/HW/AddressSpace.h"
@@ -35,12 +37,18 @@ MemoryViewWidget::MemoryViewWidget(QWidget* parent) : QTableWidget(parent)
 
   setFont(Settings::Instance().GetDebugFont());
 
-  connect(&Settings::Instance(), &Settings::DebugFontChanged, this, &QWidget::setFont);
+  connect(&Settings::Instance(), &Settings::DebugFontChanged, this, [this](const QFont& font) {
+    setFont(font);
+    m_table_dirty = true;
+  });
   connect(&Settings::Instance(), &Settings::EmulationStateChanged, this, [this] { Update(); });
   connect(Host::GetInstance(), &Host::UpdateDisasmDialog, this, &MemoryViewWidget::Update);
   connect(this, &MemoryViewWidget::customContextMenuRequested, this,
           &MemoryViewWidget::OnContextMenu);
-  connect(&Settings::Instance(), &Settings::ThemeChanged, this, &MemoryViewWidget::Update);
+  connect(&Settings::Instance(), &Settings::ThemeChanged, this, [this] {
+    m_table_dirty = true;
+    Update();
+  });
 
   setContextMenuPolicy(Qt::CustomContextMenu);
 
@@ -66,8 +74,6 @@ static int GetColumnCount(MemoryViewWidget::Type type)
 
 void MemoryViewWidget::Update()
 {
-  clearSelection();
-
   setColumnCount(3 + GetColumnCount(m_type));
 
   if (rowCount() == 0)
@@ -78,79 +84,193 @@ void MemoryViewWidget::Update()
   const AddressSpace::Accessors* accessors = AddressSpace::GetAccessors(m_address_space);
 
   // Calculate (roughly) how many rows will fit in our table
-  int rows = std::round((height() / static_cast<float>(rowHeight(0))) - 0.25);
+  const int rows = std::round((height() / static_cast<float>(rowHeight(0))) - 0.25);
+
+  const int value_columns = GetColumnCount(m_type);
+  const int bytes_per_cell = 16 / value_columns;
+  const u32 start_addr = m_address - ((rows / 2) * 16);
+  const bool values_visible = Core::GetState() == Core::State::Paused;
+
+  // Snapshot the visible range with one bulk read instead of per-byte accessor calls, and keep
+  // it around so the next refresh only touches the rows whose bytes actually changed.
+  AddressSpace::Accessors::RangeSnapshot snapshot;
+  if (values_visible)
+    snapshot = accessors->ReadRange(start_addr, static_cast<u32>(rows) * 16);
+
+  // Memcheck overlap is tracked per cell so rows with unchanged bytes still refresh when a
+  // breakpoint on them is toggled.
+  std::vector<u8> memchecks(static_cast<size_t>(rows) * value_columns, 0);
+  if (values_visible && m_address_space == AddressSpace::Type::Effective)
+  {
+    for (int i = 0; i < rows; i++)
+    {
+      for (int c = 0; c < value_columns; c++)
+      {
+        const u32 address = start_addr + i * 16 + c * bytes_per_cell;
+        if (PowerPC::memchecks.OverlapsMemcheck(address, bytes_per_cell))
+          memchecks[static_cast<size_t>(i) * value_columns + c] = 1;
+      }
+    }
+  }
 
-  setRowCount(rows);
+  const auto cell_value = [&snapshot, start_addr](u32 address, int bytes) {
+    u64 value = 0;
+    for (int i = 0; i < bytes; i++)
+      value = value << 8 | snapshot.data[address - start_addr + i];
+    return value;
+  };
+  const auto cell_text = [&](u32 address) {
+    switch (m_type)
+    {
+    case Type::U8:
+      return QStringLiteral("%1").arg(cell_value(address, 1), 2, 16, QLatin1Char('0'));
+    case Type::ASCII:
+    {
+      const char value = static_cast<char>(cell_value(address, 1));
+      return IsPrintableCharacter(value) ? QString{QChar::fromLatin1(value)} :
+                                           QString{QChar::fromLatin1('.')};
+    }
+    case Type::U16:
+      return QStringLiteral("%1").arg(cell_value(address, 2), 4, 16, QLatin1Char('0'));
+    case Type::U32:
+      return QStringLiteral("%1").arg(cell_value(address, 4), 8, 16, QLatin1Char('0'));
+    case Type::Float32:
+      return QString::number(Common::BitCast<float>(static_cast<u32>(cell_value(address, 4))));
+    }
+    return QString{};
+  };
+
+  // The item grid can be updated in place when nothing structural changed since the last
+  // refresh. Validity changes (e.g. the MMU remapping a page while stepping) also force a
+  // rebuild, since validity decides which cells exist.
+  const bool incremental = !m_table_dirty && rows == m_last_rows && m_type == m_last_type &&
+                           m_address_space == m_last_address_space &&
+                           start_addr == m_last_start_addr &&
+                           values_visible == m_last_values_visible &&
+                           snapshot.valid == m_last_snapshot.valid;
+
+  if (incremental)
+  {
+    for (int i = 0; i < rows; i++)
+    {
+      const size_t row_offset = static_cast<size_t>(i) * 16;
+      const size_t memcheck_offset = static_cast<size_t>(i) * value_columns;
+      const bool row_changed =
+          values_visible && !std::equal(snapshot.data.begin() + row_offset,
+                                        snapshot.data.begin() + row_offset + 16,
+                                        m_last_snapshot.data.begin() + row_offset);
+      const bool memchecks_changed =
+          !std::equal(memchecks.begin() + memcheck_offset,
+                      memchecks.begin() + memcheck_offset + value_columns,
+                      m_last_memchecks.begin() + memcheck_offset);
+      if (!row_changed && !memchecks_changed)
+        continue;
+      if (!values_visible || !snapshot.valid[row_offset])
+        continue;
+
+      bool row_breakpoint = true;
+      for (int c = 0; c < value_columns; c++)
+      {
+        auto* hex_item = item(i, 2 + c);
+        if (hex_item == nullptr)
+          continue;
+
+        if (memchecks[memcheck_offset + c])
+        {
+          hex_item->setBackground(Qt::red);
+        }
+        else
+        {
+          hex_item->setBackground({});
+          row_breakpoint = false;
+        }
+
+        const u32 address = start_addr + i * 16 + c * bytes_per_cell;
+        if (snapshot.valid[row_offset + static_cast<size_t>(c) * bytes_per_cell])
+          hex_item->setText(cell_text(address));
+      }
 
-  for (int i = 0; i < rows; i++)
+      if (auto* bp_item = item(i, 0))
+      {
+        bp_item->setData(Qt::DecorationRole,
+                         row_breakpoint ?
+                             QVariant{Resources::GetScaledThemeIcon("debugger_breakpoint")
+                                          .pixmap(QSize(24, 24))} :
+                             QVariant{});
+      }
+    }
+  }
+  else
   {
-    setRowHeight(i, 24);
+    clearSelection();
 
-    u32 addr = m_address - ((rowCount() / 2) * 16) + i * 16;
+    setRowCount(rows);
 
-    auto* bp_item = new QTableWidgetItem;
-    bp_item->setFlags(Qt::ItemIsEnabled);
-    bp_item->setData(Qt::UserRole, addr);
+    for (int i = 0; i < rows; i++)
+    {
+      setRowHeight(i, 24);
 
-    setItem(i, 0, bp_item);
+      const u32 addr = start_addr + i * 16;
+      const size_t row_offset = static_cast<size_t>(i) * 16;
 
-    auto* addr_item = new QTableWidgetItem(QStringLiteral("%1").arg(addr, 8, 16, QLatin1Char('0')));
+      auto* bp_item = new QTableWidgetItem;
+      bp_item->setFlags(Qt::ItemIsEnabled);
+      bp_item->setData(Qt::UserRole, addr);
 
-    addr_item->setData(Qt::UserRole, addr);
-    addr_item->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
+      setItem(i, 0, bp_item);
 
-    setItem(i, 1, addr_item);
+      auto* addr_item =
+          new QTableWidgetItem(QStringLiteral("%1").arg(addr, 8, 16, QLatin1Char('0')));
 
-    if (addr == m_address)
-      addr_item->setSelected(true);
+      addr_item->setData(Qt::UserRole, addr);
+      addr_item->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
 
-    if (Core::GetState() != Core::State::Paused || !accessors->IsValidAddress(addr))
-    {
-      for (int c = 2; c < columnCount(); c++)
+      setItem(i, 1, addr_item);
+
+      if (addr == m_address)
+        addr_item->setSelected(true);
+
+      if (!values_visible || !snapshot.valid[row_offset])
       {
-        auto* item = new QTableWidgetItem(QStringLiteral("-"));
-        item->setFlags(Qt::ItemIsEnabled);
-        item->setData(Qt::UserRole, addr);
+        for (int c = 2; c < columnCount(); c++)
+        {
+          auto* item = new QTableWidgetItem(QStringLiteral("-"));
+          item->setFlags(Qt::ItemIsEnabled);
+          item->setData(Qt::UserRole, addr);
 
-        setItem(i, c, item);
-      }
+          setItem(i, c, item);
+        }
 
-      continue;
-    }
+        continue;
+      }
 
-    if (m_address_space == AddressSpace::Type::Effective)
-    {
-      auto* description_item = new QTableWidgetItem(
-          QString::fromStdString(PowerPC::debug_interface.GetDescription(addr)));
+      if (m_address_space == AddressSpace::Type::Effective)
+      {
+        auto* description_item = new QTableWidgetItem(
+            QString::fromStdString(PowerPC::debug_interface.GetDescription(addr)));
 
-      description_item->setForeground(Qt::blue);
-      description_item->setFlags(Qt::ItemIsEnabled);
+        description_item->setForeground(Qt::blue);
+        description_item->setFlags(Qt::ItemIsEnabled);
 
-      setItem(i, columnCount() - 1, description_item);
-    }
-    bool row_breakpoint = true;
+        setItem(i, columnCount() - 1, description_item);
+      }
+      bool row_breakpoint = true;
 
-    auto update_values = [&](auto value_to_string) {
-      for (int c = 0; c < GetColumnCount(m_type); c++)
+      for (int c = 0; c < value_columns; c++)
       {
         auto* hex_item = new QTableWidgetItem;
         hex_item->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
-        const u32 address = addr + c * (16 / GetColumnCount(m_type));
+        const u32 address = addr + c * bytes_per_cell;
 
-        if (m_address_space == AddressSpace::Type::Effective &&
-            PowerPC::memchecks.OverlapsMemcheck(address, 16 / GetColumnCount(m_type)))
-        {
+        if (memchecks[static_cast<size_t>(i) * value_columns + c])
           hex_item->setBackground(Qt::red);
-        }
         else
-        {
           row_breakpoint = false;
-        }
         setItem(i, 2 + c, hex_item);
 
-        if (accessors->IsValidAddress(address))
+        if (snapshot.valid[row_offset + static_cast<size_t>(c) * bytes_per_cell])
         {
-          hex_item->setText(value_to_string(address));
+          hex_item->setText(cell_text(address));
           hex_item->setData(Qt::UserRole, address);
         }
         else
@@ -159,54 +279,31 @@ void MemoryViewWidget::Update()
           hex_item->setText(QStringLiteral("-"));
         }
       }
-    };
-    switch (m_type)
-    {
-    case Type::U8:
-      update_values([&accessors](u32 address) {
-        const u8 value = accessors->ReadU8(address);
-        return QStringLiteral("%1").arg(value, 2, 16, QLatin1Char('0'));
-      });
-      break;
-    case Type::ASCII:
-      update_values([&accessors](u32 address) {
-        const char value = accessors->ReadU8(address);
-        return IsPrintableCharacter(value) ? QString{QChar::fromLatin1(value)} :
-                                             QString{QChar::fromLatin1('.')};
-      });
-      break;
-    case Type::U16:
-      update_values([&accessors](u32 address) {
-        const u16 value = accessors->ReadU16(address);
-        return QStringLiteral("%1").arg(value, 4, 16, QLatin1Char('0'));
-      });
-      break;
-    case Type::U32:
-      update_values([&accessors](u32 address) {
-        const u32 value = accessors->ReadU32(address);
-        return QStringLiteral("%1").arg(value, 8, 16, QLatin1Char('0'));
-      });
-      break;
-    case Type::Float32:
-      update_values(
-          [&accessors](u32 address) { return QString::number(accessors->ReadF32(address)); });
-      break;
+
+      if (row_breakpoint)
+      {
+        bp_item->setData(Qt::DecorationRole, Resources::GetScaledThemeIcon("debugger_breakpoint")
+                                                 .pixmap(QSize(24, 24)));
+      }
     }
 
-    if (row_breakpoint)
+    setColumnWidth(0, 24 + 5);
+    for (int i = 1; i < columnCount(); i++)
     {
-      bp_item->setData(Qt::DecorationRole,
-                       Resources::GetScaledThemeIcon("debugger_breakpoint").pixmap(QSize(24, 24)));
+      resizeColumnToContents(i);
+      // Add some extra spacing because the default width is too small in most cases
+      setColumnWidth(i, columnWidth(i) * 1.1);
     }
   }
 
-  setColumnWidth(0, 24 + 5);
-  for (int i = 1; i < columnCount(); i++)
-  {
-    resizeColumnToContents(i);
-    // Add some extra spacing because the default width is too small in most cases
-    setColumnWidth(i, columnWidth(i) * 1.1);
-  }
+  m_last_snapshot = std::move(snapshot);
+  m_last_memchecks = std::move(memchecks);
+  m_last_start_addr = start_addr;
+  m_last_rows = rows;
+  m_last_type = m_type;
+  m_last_address_space = m_address_space;
+  m_last_values_visible = values_visible;
+  m_table_dirty = false;
 
   viewport()->update();
   update();
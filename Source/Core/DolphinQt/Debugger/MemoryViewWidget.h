@@ -5,12 +5,10 @@
 
 #include <QTableWidget>
 
-#include "Common/CommonTypes.h"
+#include <vector>
 
-namespace AddressSpace
-{
-enum class Type;
-}
+#include "Common/CommonTypes.h"
+#include "Core/HW/AddressSpace.h"
 
 class MemoryViewWidget : public QTableWidget
 {
@@ -69,4 +67,16 @@ private:
   bool m_do_log = true;
   u32 m_context_address;
   u32 m_address = 0;
+
+  // State of the previous Update() call, used to refresh only the rows that changed. When
+  // anything structural (layout, address space, theme, ...) changes, m_table_dirty forces a
+  // full rebuild of the table instead.
+  AddressSpace::Accessors::RangeSnapshot m_last_snapshot;
+  std::vector<u8> m_last_memchecks;
+  u32 m_last_start_addr = 0;
+  int m_last_rows = 0;
+  Type m_last_type = Type::U8;
+  AddressSpace::Type m_last_address_space{};
+  bool m_last_values_visible = false;
+  bool m_table_dirty = true;
 };
@@ -6,6 +6,7 @@
 #include <QImage>
 #include <QPainter>
 #include <QPixmap>
+#include <QPixmapCache>
 #include <QSize>
 
 #include "DolphinQt/GameList/GameListModel.h"
@@ -20,6 +21,11 @@ GridProxyModel::GridProxyModel(QObject* parent) : QSortFilterProxyModel(parent)
 {
   setSortCaseSensitivity(Qt::CaseInsensitive);
   sort(static_cast<int>(GameListModel::Column::Title));
+
+  // Decoded and scaled covers are kept in QPixmapCache so scrolling doesn't
+  // decode PNGs again on every repaint. The default limit only fits a handful
+  // of grid-sized covers, so raise it enough for a few screenfuls.
+  QPixmapCache::setCacheLimit(64 * 1024);
 }
 
 QVariant GridProxyModel::data(const QModelIndex& i, int role) const
@@ -35,11 +41,25 @@ QVariant GridProxyModel::data(const QModelIndex& i, int role) const
   {
     auto* model = static_cast<GameListModel*>(sourceModel());
 
-    const auto& buffer = model->GetGameFile(source_index.row())->GetCoverImage().buffer;
+    const auto& game = model->GetGameFile(source_index.row());
+    const auto& buffer = game->GetCoverImage().buffer;
 
     QSize size = Config::Get(Config::MAIN_USE_GAME_COVERS) ? QSize(160, 224) : LARGE_BANNER_SIZE;
     QPixmap pixmap(size * model->GetScale() * QPixmap().devicePixelRatio());
 
+    // The cache key includes the GameFile instance: when the tracker updates
+    // a game (e.g. a newly downloaded cover), the model stores a new instance,
+    // so the stale pixmap simply stops being referenced and ages out.
+    const QString cache_key =
+        QStringLiteral("gamelist_%1_%2_%3x%4")
+            .arg(QString::fromStdString(game->GetFilePath()),
+                 QString::number(reinterpret_cast<quintptr>(game.get()), 16),
+                 QString::number(pixmap.width()), QString::number(pixmap.height()));
+
+    QPixmap cached_pixmap;
+    if (QPixmapCache::find(cache_key, &cached_pixmap))
+      return cached_pixmap;
+
     if (buffer.empty() || !Config::Get(Config::MAIN_USE_GAME_COVERS))
     {
       QPixmap banner = model
@@ -57,6 +77,7 @@ QVariant GridProxyModel::data(const QModelIndex& i, int role) const
       painter.drawPixmap(0, pixmap.height() / 2 - banner.height() / 2, banner.width(),
                          banner.height(), banner);
 
+      QPixmapCache::insert(cache_key, pixmap);
       return pixmap;
     }
     else
@@ -64,8 +85,11 @@ QVariant GridProxyModel::data(const QModelIndex& i, int role) const
       pixmap = QPixmap::fromImage(QImage::fromData(
           reinterpret_cast<const unsigned char*>(&buffer[0]), static_cast<int>(buffer.size())));
 
-      return pixmap.scaled(QSize(160, 224) * model->GetScale() * pixmap.devicePixelRatio(),
-                           Qt::KeepAspectRatio, Qt::SmoothTransformation);
+      const QPixmap scaled =
+          pixmap.scaled(QSize(160, 224) * model->GetScale() * pixmap.devicePixelRatio(),
+                        Qt::KeepAspectRatio, Qt::SmoothTransformation);
+      QPixmapCache::insert(cache_key, scaled);
+      return scaled;
     }
   }
   return QVariant();
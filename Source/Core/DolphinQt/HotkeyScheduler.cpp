@@ -13,6 +13,7 @@
 
 #include "Common/Config/Config.h"
 #include "Common/Thread.h"
+#include "Common/Tracing.h"
 
 #include "Core/Config/FreeLookSettings.h"
 #include "Core/Config/GraphicsSettings.h"
@@ -225,6 +226,24 @@ void HotkeyScheduler::Run()
       if (IsHotkey(HK_REQUEST_GOLF_CONTROL))
         emit RequestGolfControl();
 
+      // Performance tracing
+      if (IsHotkey(HK_TOGGLE_TRACING))
+      {
+        if (Common::Tracing::IsEnabled())
+        {
+          const std::string path = Common::Tracing::Stop();
+          if (!path.empty())
+            OSD::AddMessage("Performance trace written to " + path);
+          else
+            OSD::AddMessage("Failed to write performance trace");
+        }
+        else
+        {
+          Common::Tracing::Start();
+          OSD::AddMessage("Performance tracing started");
+        }
+      }
+
       // Recording
       if (IsHotkey(HK_START_RECORDING))
         emit StartRecording();
@@ -578,6 +597,11 @@ void HotkeyScheduler::Run()
 
     if (IsHotkey(HK_SAVE_STATE_FILE))
       emit StateSaveFile();
+
+    // Repeats while held, stepping one rewind frame further back each poll.
+    // This doesn't need any main-window bookkeeping, so no signal round trip.
+    if (IsHotkey(HK_LOAD_REWIND_STATE, true))
+      State::LoadRewindState();
   }
 }
 
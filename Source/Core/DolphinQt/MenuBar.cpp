@@ -832,6 +832,14 @@ void MenuBar::AddJITMenu()
     ClearCache();
   });
 
+  m_jit_tiered_mode = m_jit->addAction(tr("Tiered JIT Recompilation"));
+  m_jit_tiered_mode->setCheckable(true);
+  m_jit_tiered_mode->setChecked(SConfig::GetInstance().bJITTieredMode);
+  connect(m_jit_tiered_mode, &QAction::toggled, [this](bool enabled) {
+    SConfig::GetInstance().bJITTieredMode = enabled;
+    ClearCache();
+  });
+
   m_jit_disable_fastmem = m_jit->addAction(tr("Disable Fastmem"));
   m_jit_disable_fastmem->setCheckable(true);
   m_jit_disable_fastmem->setChecked(!SConfig::GetInstance().bFastmem);
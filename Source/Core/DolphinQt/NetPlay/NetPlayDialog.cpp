@@ -142,12 +142,19 @@ void NetPlayDialog::CreateMainLayout()
          "switched at any time.\nSuitable for turn-based games with timing-sensitive controls, "
          "such as golf."));
   m_golf_mode_action->setCheckable(true);
+  m_rollback_mode_action = m_network_menu->addAction(tr("Rollback (experimental)"));
+  m_rollback_mode_action->setToolTip(
+      tr("Inputs apply immediately; mispredicted remote inputs are corrected by rolling the "
+         "emulation back and re-simulating.\nSuitable for fast-paced two-player games such as "
+         "fighting games. GameCube controllers only; requires deterministic settings."));
+  m_rollback_mode_action->setCheckable(true);
 
   m_network_mode_group = new QActionGroup(this);
   m_network_mode_group->setExclusive(true);
   m_network_mode_group->addAction(m_fixed_delay_action);
   m_network_mode_group->addAction(m_host_input_authority_action);
   m_network_mode_group->addAction(m_golf_mode_action);
+  m_network_mode_group->addAction(m_rollback_mode_action);
   m_fixed_delay_action->setChecked(true);
 
   m_md5_menu = m_menu_bar->addMenu(tr("Checksum"));
@@ -314,6 +321,7 @@ void NetPlayDialog::ConnectWidgets()
           [hia_function] { hia_function(true); });
   connect(m_golf_mode_action, &QAction::toggled, this, [hia_function] { hia_function(true); });
   connect(m_fixed_delay_action, &QAction::toggled, this, [hia_function] { hia_function(false); });
+  connect(m_rollback_mode_action, &QAction::toggled, this, [hia_function] { hia_function(false); });
 
   connect(m_start_button, &QPushButton::clicked, this, &NetPlayDialog::OnStart);
   connect(m_quit_button, &QPushButton::clicked, this, &NetPlayDialog::reject);
@@ -365,6 +373,7 @@ void NetPlayDialog::ConnectWidgets()
   connect(m_golf_mode_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_golf_mode_overlay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
   connect(m_fixed_delay_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
+  connect(m_rollback_mode_action, &QAction::toggled, this, &NetPlayDialog::SaveSettings);
 }
 
 void NetPlayDialog::SendMessage(const std::string& msg)
@@ -1012,6 +1021,10 @@ void NetPlayDialog::LoadSettings()
   {
     m_golf_mode_action->setChecked(true);
   }
+  else if (network_mode == "rollback")
+  {
+    m_rollback_mode_action->setChecked(true);
+  }
   else
   {
     WARN_LOG_FMT(NETPLAY, "Unknown network mode '{}', using 'fixeddelay'", network_mode);
@@ -1050,6 +1063,10 @@ void NetPlayDialog::SaveSettings()
   {
     network_mode = "golf";
   }
+  else if (m_rollback_mode_action->isChecked())
+  {
+    network_mode = "rollback";
+  }
 
   Config::SetBase(Config::NETPLAY_NETWORK_MODE, network_mode);
 }
@@ -136,6 +136,7 @@ private:
   QAction* m_host_input_authority_action;
   QAction* m_sync_all_wii_saves_action;
   QAction* m_golf_mode_action;
+  QAction* m_rollback_mode_action;
   QAction* m_golf_mode_overlay_action;
   QAction* m_fixed_delay_action;
   QPushButton* m_quit_button;
@@ -446,6 +446,47 @@ private:
   const ControlState m_value{};
 };
 
+// Pure operators with two literal operands are folded at parse time, so the
+// constant arithmetic in mappings like `Axis * (2 / 3)` costs nothing per
+// poll. Folding happens bottom-up as the parser builds the tree, so chains
+// of constants collapse to a single literal. Assignment and the comma
+// operator are excluded (they have side effects), as are variables,
+// controls and function calls (which may be stateful).
+static bool IsConstantFoldableOperator(TokenType op)
+{
+  switch (op)
+  {
+  case TOK_AND:
+  case TOK_OR:
+  case TOK_ADD:
+  case TOK_SUB:
+  case TOK_MUL:
+  case TOK_DIV:
+  case TOK_MOD:
+  case TOK_LTHAN:
+  case TOK_GTHAN:
+  case TOK_XOR:
+    return true;
+  default:
+    return false;
+  }
+}
+
+static std::unique_ptr<Expression> MakeBinaryExpression(TokenType op,
+                                                        std::unique_ptr<Expression>&& lhs,
+                                                        std::unique_ptr<Expression>&& rhs)
+{
+  auto expr = std::make_unique<BinaryExpression>(op, std::move(lhs), std::move(rhs));
+
+  if (IsConstantFoldableOperator(op) && dynamic_cast<LiteralExpression*>(expr->lhs.get()) &&
+      dynamic_cast<LiteralExpression*>(expr->rhs.get()))
+  {
+    return std::make_unique<LiteralReal>(expr->GetValue());
+  }
+
+  return expr;
+}
+
 static ParseResult MakeLiteralExpression(Token token)
 {
   ControlState val{};
@@ -884,7 +925,7 @@ private:
         return rhs;
       }
 
-      expr = std::make_unique<BinaryExpression>(tok.type, std::move(expr), std::move(rhs.expr));
+      expr = MakeBinaryExpression(tok.type, std::move(expr), std::move(rhs.expr));
     }
 
     return ParseResult::MakeSuccessfulResult(std::move(expr));
@@ -297,8 +297,13 @@ void ControllerInterface::ClearDevices()
     // Devices will still be alive after this: there are shared ptrs around the code holding them,
     // but InvokeDevicesChangedCallbacks() will clean all of them.
     m_devices.clear();
+    PublishDeviceSnapshot();
   }
 
+  // Callers tear down backend state after clearing, so make sure no thread
+  // is still iterating a snapshot containing the old devices.
+  WaitForDeviceSnapshotReaders();
+
   InvokeDevicesChangedCallbacks();
 }
 
@@ -351,6 +356,8 @@ bool ControllerInterface::AddDevice(std::shared_ptr<ciface::Core::Device> device
                        // the order on other platforms that are less tested.
                        return a->GetSortPriority() > b->GetSortPriority();
                      });
+
+    PublishDeviceSnapshot();
   }
 
   if (!m_populating_devices_counter)
@@ -381,13 +388,21 @@ void ControllerInterface::RemoveDevice(std::function<bool(const ciface::Core::De
     const size_t prev_size = m_devices.size();
     m_devices.erase(it, m_devices.end());
     any_removed = m_devices.size() != prev_size;
+    if (any_removed)
+      PublishDeviceSnapshot();
   }
 
+  // Backends often destroy internal state for a removed device right after this
+  // returns; wait out any in-flight snapshot iteration first.
+  if (any_removed)
+    WaitForDeviceSnapshotReaders();
+
   if (any_removed && (!m_populating_devices_counter || force_devices_release))
     InvokeDevicesChangedCallbacks();
 }
 
-// Update input for all devices if lock can be acquired without waiting.
+// Update input for all devices. Iterates the published device snapshot so it
+// never contends with (or gets skipped during) hotplug population.
 void ControllerInterface::UpdateInput()
 {
   // This should never happen
@@ -395,18 +410,25 @@ void ControllerInterface::UpdateInput()
   if (!m_is_init)
     return;
 
-  // TODO: if we are an emulation input channel, we should probably always lock
-  // Prefer outdated values over blocking UI or CPU thread (avoids short but noticeable frame drop)
-  if (m_devices_mutex.try_lock())
+  m_snapshot_readers.fetch_add(1, std::memory_order_acquire);
+
+  if (const auto devices = GetDeviceSnapshot())
   {
-    std::lock_guard lk(m_devices_mutex, std::adopt_lock);
-    for (const auto& d : m_devices)
+    for (const auto& d : *devices)
     {
-      // Theoretically we could avoid updating input on devices that don't have any references to
-      // them, but in practice a few devices types could break in different ways, so we don't
-      d->UpdateInput();
+      // Devices referenced by a mapping are kept alive through extra
+      // shared_ptr references (control expressions hold their device), so a
+      // use count of two (m_devices plus the snapshot) means nothing can
+      // observe this device's input and its (often syscall-heavy) poll can
+      // be skipped. Backends whose update has side effects opt out of the
+      // skip. During hotplug churn a device may momentarily be in only one
+      // of the two lists; misclassifying it for a single poll is harmless.
+      if (d.use_count() > 2 || d->NeedsUpdateWithoutReferences())
+        d->UpdateInput();
     }
   }
+
+  m_snapshot_readers.fetch_sub(1, std::memory_order_release);
 }
 
 void ControllerInterface::SetCurrentInputChannel(ciface::InputChannel input_channel)
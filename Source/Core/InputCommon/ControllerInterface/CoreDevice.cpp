@@ -230,6 +230,22 @@ bool DeviceQualifier::operator!=(const DeviceQualifier& devq) const
   return !operator==(devq);
 }
 
+void DeviceContainer::PublishDeviceSnapshot()
+{
+  std::atomic_store(&m_devices_snapshot, std::make_shared<const DeviceSnapshot>(m_devices));
+}
+
+std::shared_ptr<const DeviceContainer::DeviceSnapshot> DeviceContainer::GetDeviceSnapshot() const
+{
+  return std::atomic_load(&m_devices_snapshot);
+}
+
+void DeviceContainer::WaitForDeviceSnapshotReaders() const
+{
+  while (m_snapshot_readers.load(std::memory_order_acquire) != 0)
+    Common::YieldCPU();
+}
+
 std::shared_ptr<Device> DeviceContainer::FindDevice(const DeviceQualifier& devq) const
 {
   std::lock_guard lk(m_devices_mutex);
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -120,6 +121,12 @@ public:
   std::string GetQualifiedName() const;
   virtual void UpdateInput() {}
 
+  // Whether UpdateInput must be called even while no control reference
+  // points at this device. Backends whose update has side effects beyond
+  // refreshing input state (draining pipes/sockets, pumping reports)
+  // override this so they are never skipped.
+  virtual bool NeedsUpdateWithoutReferences() const { return false; }
+
   // May be overridden to implement hotplug removal.
   // Currently handled on a per-backend basis but this could change.
   virtual bool IsValid() const { return true; }
@@ -237,9 +244,31 @@ public:
                                           std::chrono::milliseconds maximum_wait) const;
 
 protected:
+  using DeviceSnapshot = std::vector<std::shared_ptr<Device>>;
+
+  // Republishes the read-side snapshot of m_devices.
+  // Must be called with m_devices_mutex held, after every mutation of m_devices.
+  void PublishDeviceSnapshot();
+  // Returns the most recently published snapshot without taking any lock.
+  // Devices in it stay alive for as long as the snapshot is held.
+  std::shared_ptr<const DeviceSnapshot> GetDeviceSnapshot() const;
+  // Blocks until no thread is iterating a previously published snapshot.
+  // Call after publishing a snapshot with devices removed and before tearing
+  // down the backend state those devices depend on. Snapshot readers never
+  // block, so this terminates quickly.
+  void WaitForDeviceSnapshotReaders() const;
+
   // Exclusively needed when reading/writing "m_devices"
   mutable std::recursive_mutex m_devices_mutex;
   std::vector<std::shared_ptr<Device>> m_devices;
+
+  // Incremented around snapshot iteration; see WaitForDeviceSnapshotReaders().
+  mutable std::atomic<int> m_snapshot_readers{0};
+
+private:
+  // Read-mostly copy of m_devices, swapped atomically so input polling never
+  // contends with hotplug population.
+  std::shared_ptr<const DeviceSnapshot> m_devices_snapshot;
 };
 }  // namespace Core
 }  // namespace ciface
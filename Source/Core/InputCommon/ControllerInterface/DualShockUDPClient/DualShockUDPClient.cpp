@@ -129,6 +129,9 @@ private:
 
 public:
   void UpdateInput() override;
+  // The server registration must be refreshed and the socket drained even
+  // while nothing is mapped to this pad.
+  bool NeedsUpdateWithoutReferences() const override { return true; }
 
   Device(std::string name, int index, std::string server_address, u16 server_port);
 
@@ -28,6 +28,8 @@ public:
   ~PipeDevice();
 
   void UpdateInput() override;
+  // The pipe must be drained even when nothing is mapped to it.
+  bool NeedsUpdateWithoutReferences() const override { return true; }
   std::string GetName() const override { return m_name; }
   std::string GetSource() const override { return "Pipe"; }
 
@@ -36,6 +36,9 @@ public:
   int GetSortPriority() const override;
 
   void UpdateInput() override;
+  // Report pumping (rumble, battery, extension handling) must continue even
+  // while nothing is mapped to the remote.
+  bool NeedsUpdateWithoutReferences() const override { return true; }
 
 private:
   using Clock = std::chrono::steady_clock;
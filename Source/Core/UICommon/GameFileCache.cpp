@@ -4,6 +4,7 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <list>
@@ -19,6 +20,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -131,20 +133,47 @@ bool GameFileCache::Update(
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // Reading the metadata of a game file requires opening the volume, which is
+  // the slow part of a cold scan, so it's spread across the shared thread pool.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  std::vector<std::shared_ptr<GameFile>> new_files(new_paths.size());
+  std::atomic<size_t> next_path{0};
+
+  const auto load_game_files = [&] {
+    while (!processing_halted)
+    {
+      const size_t index = next_path.fetch_add(1);
+      if (index >= new_paths.size())
+        return;
+
+      auto file = std::make_shared<GameFile>(new_paths[index]);
+      if (file->IsValid())
+        new_files[index] = std::move(file);
+    }
+  };
+
+  Common::ThreadPool& pool = Common::ThreadPool::GetInstance();
+  Common::ThreadPool::WorkGroup work_group(pool);
+  const size_t job_count = std::min(pool.GetWorkerCount(), new_paths.size());
+  for (size_t i = 0; i < job_count; ++i)
+    work_group.Push(load_game_files);
+  load_game_files();  // The calling thread joins in
+  work_group.Wait();
+
+  // The callbacks are only ever run on the calling thread.
+  for (std::shared_ptr<GameFile>& file : new_files)
   {
     if (processing_halted)
       break;
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
-    {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+    if (!file)
+      continue;
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
-    }
+    if (game_added_to_cache)
+      game_added_to_cache(file);
+
+    cache_changed = true;
+    m_cached_files.push_back(std::move(file));
   }
 
   return cache_changed;
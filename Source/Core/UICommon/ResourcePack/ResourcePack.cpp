@@ -4,12 +4,15 @@
 #include "UICommon/ResourcePack/ResourcePack.h"
 
 #include <algorithm>
+#include <map>
+#include <utility>
 
 #include <unzip.h>
 
 #include "Common/CommonPaths.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/MinizipUtil.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
@@ -21,6 +24,65 @@ namespace ResourcePack
 {
 constexpr char TEXTURE_PATH[] = HIRES_TEXTURES_DIR DIR_SEP;
 
+namespace
+{
+// Walks the local file headers of a zip sequentially and records the data offset and size of
+// every stored (uncompressed) entry. Returns false when the offsets can't be known up front
+// (data descriptors, zip64), in which case the caller falls back to extraction.
+bool BuildStoredEntryIndex(const std::string& zip_path,
+                           std::map<std::string, std::pair<u64, u64>>* entries)
+{
+  File::IOFile file(zip_path, "rb");
+  if (!file)
+    return false;
+
+  const u64 file_size = file.GetSize();
+  u64 pos = 0;
+  while (pos + 30 <= file_size)
+  {
+    u8 header[30];
+    if (!file.Seek(pos, SEEK_SET) || !file.ReadBytes(header, sizeof(header)))
+      return false;
+
+    const auto read_u16 = [&header](size_t offset) {
+      return static_cast<u16>(header[offset] | (header[offset + 1] << 8));
+    };
+    const auto read_u32 = [&header](size_t offset) {
+      return static_cast<u32>(header[offset] | (header[offset + 1] << 8) |
+                              (header[offset + 2] << 16) | (header[offset + 3] << 24));
+    };
+
+    const u32 signature = read_u32(0);
+    if (signature == 0x02014b50 || signature == 0x06054b50)  // central directory reached
+      break;
+    if (signature != 0x04034b50)  // not a local file header
+      return false;
+
+    const u16 flags = read_u16(6);
+    const u16 method = read_u16(8);
+    const u32 compressed_size = read_u32(18);
+    const u16 name_length = read_u16(26);
+    const u16 extra_length = read_u16(28);
+
+    // Data descriptors mean the sizes follow the data; zip64 sizes don't fit the local header.
+    if ((flags & 0x8) != 0 || compressed_size == 0xFFFFFFFF)
+      return false;
+
+    std::string name(name_length, '\0');
+    if (!file.ReadBytes(name.data(), name_length))
+      return false;
+
+    const u64 data_offset = pos + sizeof(header) + name_length + extra_length;
+    if (method == 0)
+      entries->emplace(std::move(name), std::make_pair(data_offset, u64(compressed_size)));
+
+    pos = data_offset + compressed_size;
+  }
+
+  return true;
+}
+}  // namespace
+
 ResourcePack::ResourcePack(const std::string& path) : m_path(path)
 {
   auto file = unzOpen(path.c_str());
@@ -131,6 +193,58 @@ const std::vector<std::string>& ResourcePack::GetTextures() const
   return m_textures;
 }
 
+std::string ResourcePack::GetIndexPath(const std::string& path) const
+{
+  std::string filename;
+  SplitPath(m_path, nullptr, &filename, nullptr);
+  return path + TEXTURE_PATH + filename + ".texpack";
+}
+
+bool ResourcePack::InstallAsIndex(const std::string& path)
+{
+  std::map<std::string, std::pair<u64, u64>> entries;
+  if (!BuildStoredEntryIndex(m_path, &entries))
+    return false;
+
+  std::string index_contents = "DTP1 " + m_path + "\n";
+  for (const auto& texture : m_textures)
+  {
+    bool provided_by_other_pack = false;
+
+    // Check if a higher priority pack already provides a given texture, don't overwrite it
+    for (const auto& pack : GetHigherPriorityPacks(*this))
+    {
+      if (std::find(pack->GetTextures().begin(), pack->GetTextures().end(), texture) !=
+          pack->GetTextures().end())
+      {
+        provided_by_other_pack = true;
+        break;
+      }
+    }
+
+    if (provided_by_other_pack)
+      continue;
+
+    const auto it = entries.find("textures/" + texture);
+    if (it == entries.end())
+      return false;
+
+    index_contents += std::to_string(it->second.first) + " " + std::to_string(it->second.second) +
+                      " " + texture + "\n";
+  }
+
+  if (!File::CreateFullPath(path + TEXTURE_PATH))
+    return false;
+
+  std::ofstream out(GetIndexPath(path), std::ios::trunc | std::ios::binary);
+  if (!out.good())
+    return false;
+
+  out << index_contents;
+  out.flush();
+  return out.good();
+}
+
 bool ResourcePack::Install(const std::string& path)
 {
   if (!IsValid())
@@ -139,6 +253,15 @@ bool ResourcePack::Install(const std::string& path)
     return false;
   }
 
+  // Uncompressed packs can be consumed in place: install is reduced to writing an index of
+  // entry offsets, and the textures are read from the pack itself at runtime. No bytes are
+  // copied and nothing is duplicated on disk. Failures fall through to the extracting path.
+  if (!m_manifest->IsCompressed() && InstallAsIndex(path))
+  {
+    SetInstalled(*this, true);
+    return true;
+  }
+
   auto file = unzOpen(m_path.c_str());
   Common::ScopeGuard file_guard{[&] { unzClose(file); }};
 
@@ -214,6 +337,15 @@ bool ResourcePack::Uninstall(const std::string& path)
 
   SetInstalled(*this, false);
 
+  // Index-based installs only wrote a pack index; removing it is enough. Extracted files, if
+  // any (e.g. from an install with an older version), are still cleaned up below.
+  const std::string index_path = GetIndexPath(path);
+  if (File::Exists(index_path) && !File::Delete(index_path))
+  {
+    m_error = "Failed to delete pack index " + index_path;
+    return false;
+  }
+
   for (const auto& texture : m_textures)
   {
     bool provided_by_other_pack = false;
@@ -33,6 +33,12 @@ public:
   bool operator!=(const ResourcePack& pack) const;
 
 private:
+  // Installs the pack without extracting it: writes an index of stored entry offsets which
+  // HiresTexture serves straight out of the memory-mapped pack file. Only possible for
+  // uncompressed packs; returns false to fall back to extraction.
+  bool InstallAsIndex(const std::string& path);
+  std::string GetIndexPath(const std::string& path) const;
+
   bool m_valid = true;
 
   std::string m_path;
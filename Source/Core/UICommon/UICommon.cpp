@@ -20,6 +20,7 @@
 #include "Common/Logging/LogManager.h"
 #include "Common/MathUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/SharedMemoryExport.h"
 #include "Common/StringUtil.h"
 
 #include "Core/Config/MainSettings.h"
@@ -105,6 +106,7 @@ void Init()
 
 void Shutdown()
 {
+  Common::SharedMemoryExport::Shutdown();
   GCAdapter::Shutdown();
   WiimoteReal::Shutdown();
   Common::Log::LogManager::Shutdown();
@@ -411,7 +411,11 @@ bool DXContext::CreateCommandLists()
   static constexpr size_t MAX_DRAWS_PER_FRAME = 8192;
   static constexpr size_t TEMPORARY_SLOTS = MAX_DRAWS_PER_FRAME * 8;
 
-  for (u32 i = 0; i < NUM_COMMAND_LISTS; i++)
+  // One list being recorded plus however many the GPU is allowed to lag behind by.
+  m_num_command_lists = static_cast<u32>(std::clamp(g_ActiveConfig.iCommandListsInFlight + 1, 2,
+                                                    static_cast<int>(MAX_COMMAND_LISTS)));
+
+  for (u32 i = 0; i < m_num_command_lists; i++)
   {
     CommandListResources& res = m_command_lists[i];
     HRESULT hr = m_device->CreateCommandAllocator(
@@ -442,13 +446,15 @@ bool DXContext::CreateCommandLists()
     }
   }
 
+  // Start recording in the first list.
+  m_current_command_list = m_num_command_lists - 1;
   MoveToNextCommandList();
   return true;
 }
 
 void DXContext::MoveToNextCommandList()
 {
-  m_current_command_list = (m_current_command_list + 1) % NUM_COMMAND_LISTS;
+  m_current_command_list = (m_current_command_list + 1) % m_num_command_lists;
   m_current_fence_value++;
 
   // We may have to wait if this command list hasn't finished on the GPU.
@@ -499,8 +505,8 @@ void DXContext::DeferDescriptorDestruction(DescriptorHeapManager& manager, u32 i
 
 void DXContext::ResetSamplerAllocators()
 {
-  for (CommandListResources& res : m_command_lists)
-    res.sampler_allocator.Reset();
+  for (u32 i = 0; i < m_num_command_lists; i++)
+    m_command_lists[i].sampler_allocator.Reset();
 }
 
 void DXContext::RecreateGXRootSignature()
@@ -538,15 +544,15 @@ void DXContext::WaitForFence(u64 fence)
   }
 
   // Release resources for as many command lists which have completed.
-  u32 index = (m_current_command_list + 1) % NUM_COMMAND_LISTS;
-  for (u32 i = 0; i < NUM_COMMAND_LISTS; i++)
+  u32 index = (m_current_command_list + 1) % m_num_command_lists;
+  for (u32 i = 0; i < m_num_command_lists; i++)
   {
     CommandListResources& res = m_command_lists[index];
     if (m_completed_fence_value < res.ready_fence_value)
       break;
 
     DestroyPendingResources(res);
-    index = (index + 1) % NUM_COMMAND_LISTS;
+    index = (index + 1) % m_num_command_lists;
   }
 }
 }  // namespace DX12
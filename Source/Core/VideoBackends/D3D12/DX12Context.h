@@ -124,8 +124,9 @@ public:
   void RecreateGXRootSignature();
 
 private:
-  // Number of command lists. One is being built while the other(s) are executed.
-  static const u32 NUM_COMMAND_LISTS = 3;
+  // Maximum number of command lists. One is being built while the other(s) are executed; the
+  // actual ring depth is taken from the CommandListsInFlight config value at device creation.
+  static const u32 MAX_COMMAND_LISTS = 5;
 
   // Textures that don't fit into this buffer will be uploaded with a staging buffer.
   static const u32 TEXTURE_UPLOAD_BUFFER_SIZE = 32 * 1024 * 1024;
@@ -164,11 +165,12 @@ private:
 
   ComPtr<ID3D12Fence> m_fence = nullptr;
   HANDLE m_fence_event = {};
-  u32 m_current_fence_value = 0;
+  u64 m_current_fence_value = 0;
   u64 m_completed_fence_value = 0;
 
-  std::array<CommandListResources, NUM_COMMAND_LISTS> m_command_lists;
-  u32 m_current_command_list = NUM_COMMAND_LISTS - 1;
+  std::array<CommandListResources, MAX_COMMAND_LISTS> m_command_lists;
+  u32 m_num_command_lists = 0;
+  u32 m_current_command_list = 0;
 
   DescriptorHeapManager m_descriptor_heap_manager;
   DescriptorHeapManager m_rtv_heap_manager;
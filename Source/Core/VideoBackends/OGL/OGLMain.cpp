@@ -33,6 +33,7 @@ Make AA apply instantly during gameplay if possible
 
 */
 
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <vector>
@@ -168,6 +169,18 @@ bool VideoBackend::FillBackendInfo()
 
 bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
 {
+#if defined(__linux__) || defined(__FreeBSD__)
+  // Routing every GL call through our own submission thread would require wrapping the direct GL
+  // usage spread across the whole backend, but Mesa already ships that layer as glthread: calls
+  // are recorded into a ring and replayed by a driver thread, which synchronizes at swap and
+  // readback boundaries. Drivers only enable it for whitelisted applications, so opt in
+  // explicitly (it is read at context creation). Overlaps opcode decoding with driver overhead;
+  // the existing BackendMultithreading setting acts as the switch, and an explicit
+  // mesa_glthread=false in the environment still wins.
+  if (Config::Get(Config::GFX_BACKEND_MULTITHREADING))
+    setenv("mesa_glthread", "true", 0);
+#endif
+
   std::unique_ptr<GLContext> main_gl_context =
       GLContext::Create(wsi, g_Config.stereo_mode == StereoMode::QuadBuffer, true, false,
                         Config::Get(Config::GFX_PREFER_GLES));
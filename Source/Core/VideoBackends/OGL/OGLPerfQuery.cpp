@@ -12,6 +12,10 @@
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+
 namespace OGL
 {
 std::unique_ptr<PerfQueryBase> GetPerfQuery()
@@ -27,9 +31,73 @@ std::unique_ptr<PerfQueryBase> GetPerfQuery()
 
 PerfQuery::PerfQuery() : m_query_read_pos()
 {
+  const bool is_gles = static_cast<Renderer*>(g_renderer.get())->IsGLES();
+  m_gpu_timing_supported = !is_gles && GLExtensions::Supports("GL_ARB_timer_query");
+  if (m_gpu_timing_supported)
+  {
+    for (TimingQuery& timing_query : m_timing_queries)
+      glGenQueries(2, timing_query.query_ids.data());
+  }
+
   ResetQuery();
 }
 
+PerfQuery::~PerfQuery()
+{
+  if (m_gpu_timing_supported)
+  {
+    for (TimingQuery& timing_query : m_timing_queries)
+      glDeleteQueries(2, timing_query.query_ids.data());
+  }
+}
+
+void PerfQuery::BeginGPUTiming(GPUTimingPass pass)
+{
+  if (!m_gpu_timing_supported)
+    return;
+
+  TimingQuery& timing_query = m_timing_queries[pass];
+  const u32 index = timing_query.write_index;
+
+  // Collect the result this query object produced last time around, if it's
+  // ready. If it isn't, the sample is dropped - reusing the query resets it.
+  if (timing_query.pending[index])
+  {
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(timing_query.query_ids[index], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_TRUE)
+    {
+      // 32 bits of nanoseconds is plenty for a single pass (wraps at ~4.3s).
+      GLuint result = 0;
+      glGetQueryObjectuiv(timing_query.query_ids[index], GL_QUERY_RESULT, &result);
+
+      // Smooth over recent samples so the overlay doesn't flicker.
+      const u64 prev = m_pass_time_ns[pass].load(std::memory_order_relaxed);
+      const u64 smoothed = prev == 0 ? result : (prev * 7 + result) / 8;
+      m_pass_time_ns[pass].store(smoothed, std::memory_order_relaxed);
+    }
+    timing_query.pending[index] = false;
+  }
+
+  glBeginQuery(GL_TIME_ELAPSED, timing_query.query_ids[index]);
+}
+
+void PerfQuery::EndGPUTiming(GPUTimingPass pass)
+{
+  if (!m_gpu_timing_supported)
+    return;
+
+  TimingQuery& timing_query = m_timing_queries[pass];
+  glEndQuery(GL_TIME_ELAPSED);
+  timing_query.pending[timing_query.write_index] = true;
+  timing_query.write_index ^= 1;
+}
+
+u64 PerfQuery::GetGPUPassTimeNs(GPUTimingPass pass)
+{
+  return m_pass_time_ns[pass].load(std::memory_order_relaxed);
+}
+
 void PerfQuery::EnableQuery(PerfQueryGroup type)
 {
   m_query->EnableQuery(type);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include "Common/GL/GLExtensions/GLExtensions.h"
@@ -18,7 +19,7 @@ class PerfQuery : public PerfQueryBase
 {
 public:
   PerfQuery();
-  ~PerfQuery() {}
+  ~PerfQuery();
   void EnableQuery(PerfQueryGroup type) override;
   void DisableQuery(PerfQueryGroup type) override;
   void ResetQuery() override;
@@ -26,6 +27,11 @@ public:
   void FlushResults() override;
   bool IsFlushed() const override;
 
+  bool SupportsGPUTiming() const override { return m_gpu_timing_supported; }
+  void BeginGPUTiming(GPUTimingPass pass) override;
+  void EndGPUTiming(GPUTimingPass pass) override;
+  u64 GetGPUPassTimeNs(GPUTimingPass pass) override;
+
 protected:
   struct ActiveQuery
   {
@@ -41,6 +47,19 @@ protected:
   u32 m_query_read_pos;
 
 private:
+  // Each pass double-buffers its GL_TIME_ELAPSED query so the previous
+  // frame's result can be collected without stalling when the query is reused.
+  struct TimingQuery
+  {
+    std::array<GLuint, 2> query_ids{};
+    std::array<bool, 2> pending{};
+    u32 write_index = 0;
+  };
+
+  bool m_gpu_timing_supported = false;
+  std::array<TimingQuery, GPU_TIMING_NUM_PASSES> m_timing_queries;
+  std::array<std::atomic<u64>, GPU_TIMING_NUM_PASSES> m_pass_time_ns{};
+
   // Implementation
   std::unique_ptr<PerfQuery> m_query;
 };
@@ -977,6 +977,8 @@ void Renderer::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
   m_post_processor->BlitFromTexture(target_rc, source_rc, source_texture, 1);
 
   glDrawBuffer(GL_BACK);
+
+  m_post_processor->UpdatePreviousFrame(source_texture);
 }
 
 void Renderer::SetFramebuffer(AbstractFramebuffer* framebuffer)
@@ -63,6 +63,15 @@ StreamBuffer::~StreamBuffer()
  * As ring buffers have an ugly behavior on rollover, have fun to read this code ;)
  */
 
+// Waiting with GL_SYNC_FLUSH_COMMANDS_BIT performs an implicit glFlush, so check
+// without it first: the fence is usually several frames old and long signaled,
+// and then the wait costs no driver work at all.
+static void ClientWaitFence(GLsync fence)
+{
+  if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+    glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+}
+
 void StreamBuffer::CreateFences()
 {
   for (int i = 0; i < SYNC_POINTS; i++)
@@ -93,7 +102,7 @@ void StreamBuffer::AllocMemory(u32 size)
   // wait for new slots to end of buffer
   for (int i = Slot(m_free_iterator) + 1; i <= Slot(m_iterator + size) && i < SYNC_POINTS; i++)
   {
-    glClientWaitSync(m_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    ClientWaitFence(m_fences[i]);
     glDeleteSync(m_fences[i]);
   }
 
@@ -119,7 +128,7 @@ void StreamBuffer::AllocMemory(u32 size)
     // wait for space at the start
     for (int i = 0; i <= Slot(m_iterator + size); i++)
     {
-      glClientWaitSync(m_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+      ClientWaitFence(m_fences[i]);
       glDeleteSync(m_fences[i]);
     }
     m_free_iterator = m_iterator + size;
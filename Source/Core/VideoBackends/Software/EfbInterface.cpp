@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <vector>
@@ -22,7 +23,8 @@ namespace EfbInterface
 {
 static std::array<u8, EFB_WIDTH * EFB_HEIGHT * 6> efb;
 
-static std::array<u32, PQ_NUM_MEMBERS> perf_values;
+// Atomic, as the rasterizer increments these from its worker threads.
+static std::array<std::atomic<u32>, PQ_NUM_MEMBERS> perf_values;
 
 static inline u32 GetColorOffset(u16 x, u16 y)
 {
@@ -691,12 +693,13 @@ bool ZCompare(u16 x, u16 y, u32 z)
 
 u32 GetPerfQueryResult(PerfQueryType type)
 {
-  return perf_values[type];
+  return perf_values[type].load(std::memory_order_relaxed);
 }
 
 void ResetPerfQuery()
 {
-  perf_values = {};
+  for (auto& value : perf_values)
+    value.store(0, std::memory_order_relaxed);
 }
 
 void IncPerfCounterQuadCount(PerfQueryType type)
@@ -705,10 +708,11 @@ void IncPerfCounterQuadCount(PerfQueryType type)
   // Current software renderer architecture works on pixels though, so
   // we have this "quad" hack here to only increment the registers on
   // every fourth rendered pixel
-  static u32 quad[PQ_NUM_MEMBERS];
-  if (++quad[type] != 3)
+  // Relaxed ordering is sufficient; the rasterizer joins its worker threads before
+  // query results are read back.
+  static std::array<std::atomic<u32>, PQ_NUM_MEMBERS> quad;
+  if (quad[type].fetch_add(1, std::memory_order_relaxed) % 3 != 2)
     return;
-  quad[type] = 0;
-  ++perf_values[type];
+  perf_values[type].fetch_add(1, std::memory_order_relaxed);
 }
 }  // namespace EfbInterface
@@ -5,11 +5,15 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/ThreadPool.h"
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/NativeVertexFormat.h"
 #include "VideoBackends/Software/Tev.h"
+#include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
@@ -20,6 +24,10 @@ namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
 
+// Triangles whose bounding rectangle covers fewer pixels than this are scanned on the
+// calling thread only, as the cost of dispatching to the pool would outweigh the work.
+static constexpr s32 MIN_PARALLEL_PIXELS = 1024;
+
 static Slope ZSlope;
 static Slope WSlope;
 static Slope ColorSlopes[2][4];
@@ -30,12 +38,41 @@ static s32 vertex0Y;
 static float vertexOffsetX;
 static float vertexOffsetY;
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// State used while scanning one triangle. One context exists per pool worker plus one
+// for the calling thread, so block rows can be rasterized in parallel; pixels written by
+// different contexts never overlap. Heap-allocated because Tev holds pointers into itself
+// and must not be copied or moved.
+struct DrawContext
+{
+  Tev tev;
+  RasterBlock raster_block;
+  s32 rasterized_pixels = 0;
+};
+static std::vector<std::unique_ptr<DrawContext>> s_contexts;
+
+// The half-edge constants of the triangle currently being scanned, read-only while the
+// worker threads are running.
+struct TriangleEdges
+{
+  s32 C1, C2, C3;
+  s32 DX12, DX23, DX31;
+  s32 DY12, DY23, DY31;
+  s32 FDX12, FDX23, FDX31;
+  s32 FDY12, FDY23, FDY31;
+  s32 minx, maxx, maxy;
+};
 
 void Init()
 {
-  tev.Init();
+  const size_t num_contexts = Common::ThreadPool::GetInstance().GetWorkerCount() + 1;
+  s_contexts.clear();
+  s_contexts.reserve(num_contexts);
+  for (size_t i = 0; i < num_contexts; i++)
+  {
+    auto context = std::make_unique<DrawContext>();
+    context->tev.Init();
+    s_contexts.push_back(std::move(context));
+  }
 
   // Set initial z reference plane in the unlikely case that zfreeze is enabled when drawing the
   // first primitive.
@@ -68,12 +105,13 @@ static inline int iround(float x)
 
 void SetTevReg(int reg, int comp, s16 color)
 {
-  tev.SetRegColor(reg, comp, color);
+  for (auto& context : s_contexts)
+    context->tev.SetRegColor(reg, comp, color);
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(DrawContext& context, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  context.rasterized_pixels++;
 
   float dx = vertexOffsetX + (float)(x - vertex0X);
   float dy = vertexOffsetY + (float)(y - vertex0Y);
@@ -93,11 +131,11 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
     EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  RasterBlockPixel& pixel = context.raster_block.Pixel[xi][yi];
 
-  tev.Position[0] = x;
-  tev.Position[1] = y;
-  tev.Position[2] = z;
+  context.tev.Position[0] = x;
+  context.tev.Position[1] = y;
+  context.tev.Position[2] = z;
 
   //  colors
   for (unsigned int i = 0; i < bpmem.genMode.numcolchans; i++)
@@ -109,7 +147,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
       // clamp color value to 0
       u16 mask = ~(color >> 8);
 
-      tev.Color[i][comp] = color & mask;
+      context.tev.Color[i][comp] = color & mask;
     }
   }
 
@@ -117,23 +155,23 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   for (unsigned int i = 0; i < bpmem.genMode.numtexgens; i++)
   {
     // multiply by 128 because TEV stores UVs as s17.7
-    tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
-    tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
+    context.tev.Uv[i].s = (s32)(pixel.Uv[i][0] * 128);
+    context.tev.Uv[i].t = (s32)(pixel.Uv[i][1] * 128);
   }
 
   for (unsigned int i = 0; i < bpmem.genMode.numindstages; i++)
   {
-    tev.IndirectLod[i] = rasterBlock.IndirectLod[i];
-    tev.IndirectLinear[i] = rasterBlock.IndirectLinear[i];
+    context.tev.IndirectLod[i] = context.raster_block.IndirectLod[i];
+    context.tev.IndirectLinear[i] = context.raster_block.IndirectLinear[i];
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
   {
-    tev.TextureLod[i] = rasterBlock.TextureLod[i];
-    tev.TextureLinear[i] = rasterBlock.TextureLinear[i];
+    context.tev.TextureLod[i] = context.raster_block.TextureLod[i];
+    context.tev.TextureLinear[i] = context.raster_block.TextureLinear[i];
   }
 
-  tev.Draw();
+  context.tev.Draw();
 }
 
 static void InitTriangle(float X1, float Y1, s32 xi, s32 yi)
@@ -161,7 +199,8 @@ static void InitSlope(Slope* slope, float f1, float f2, float f3, float DX31, fl
   slope->f0 = f1;
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& raster_block, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   const FourTexUnits& texUnit = bpmem.tex[(texmap >> 2) & 1];
   const u8 subTexmap = texmap & 3;
@@ -174,17 +213,17 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   float sDelta, tDelta;
   if (tm0.diag_lod == LODType::Diagonal)
   {
-    float* uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-    float* uv1 = rasterBlock.Pixel[1][1].Uv[texcoord];
+    const float* uv0 = raster_block.Pixel[0][0].Uv[texcoord];
+    const float* uv1 = raster_block.Pixel[1][1].Uv[texcoord];
 
     sDelta = fabsf(uv0[0] - uv1[0]);
     tDelta = fabsf(uv0[1] - uv1[1]);
   }
   else
   {
-    float* uv0 = rasterBlock.Pixel[0][0].Uv[texcoord];
-    float* uv1 = rasterBlock.Pixel[1][0].Uv[texcoord];
-    float* uv2 = rasterBlock.Pixel[0][1].Uv[texcoord];
+    const float* uv0 = raster_block.Pixel[0][0].Uv[texcoord];
+    const float* uv1 = raster_block.Pixel[1][0].Uv[texcoord];
+    const float* uv2 = raster_block.Pixel[0][1].Uv[texcoord];
 
     sDelta = std::max(fabsf(uv0[0] - uv1[0]), fabsf(uv0[0] - uv2[0]));
     tDelta = std::max(fabsf(uv0[1] - uv1[1]), fabsf(uv0[1] - uv2[1]));
@@ -210,13 +249,13 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(DrawContext& context, s32 blockX, s32 blockY)
 {
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
     {
-      RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+      RasterBlockPixel& pixel = context.raster_block.Pixel[xi][yi];
 
       float dx = vertexOffsetX + (float)(xi + blockX - vertex0X);
       float dy = vertexOffsetY + (float)(yi + blockY - vertex0Y);
@@ -246,7 +285,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texcoord = indref & 3;
     indref >>= 3;
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(context.raster_block, &context.raster_block.IndirectLod[i],
+                 &context.raster_block.IndirectLinear[i], texmap, texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -258,11 +298,119 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(context.raster_block, &context.raster_block.TextureLod[i],
+                   &context.raster_block.TextureLinear[i], texmap, texcoord);
+    }
+  }
+}
+
+// Scans every BLOCK_SIZE-tall row of blocks starting at first_row and stepping by row_step,
+// so several contexts can scan the same triangle on interleaved rows without their pixels
+// ever overlapping.
+static void ScanBlockRows(DrawContext& context, const TriangleEdges& e, s32 first_row,
+                          s32 row_step)
+{
+  for (s32 y = first_row; y < e.maxy; y += row_step)
+  {
+    for (s32 x = e.minx; x < e.maxx; x += BLOCK_SIZE)
+    {
+      // Corners of block
+      s32 x0 = x << 4;
+      s32 x1 = (x + BLOCK_SIZE - 1) << 4;
+      s32 y0 = y << 4;
+      s32 y1 = (y + BLOCK_SIZE - 1) << 4;
+
+      // Evaluate half-space functions
+      bool a00 = e.C1 + e.DX12 * y0 - e.DY12 * x0 > 0;
+      bool a10 = e.C1 + e.DX12 * y0 - e.DY12 * x1 > 0;
+      bool a01 = e.C1 + e.DX12 * y1 - e.DY12 * x0 > 0;
+      bool a11 = e.C1 + e.DX12 * y1 - e.DY12 * x1 > 0;
+      int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
+
+      bool b00 = e.C2 + e.DX23 * y0 - e.DY23 * x0 > 0;
+      bool b10 = e.C2 + e.DX23 * y0 - e.DY23 * x1 > 0;
+      bool b01 = e.C2 + e.DX23 * y1 - e.DY23 * x0 > 0;
+      bool b11 = e.C2 + e.DX23 * y1 - e.DY23 * x1 > 0;
+      int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
+
+      bool c00 = e.C3 + e.DX31 * y0 - e.DY31 * x0 > 0;
+      bool c10 = e.C3 + e.DX31 * y0 - e.DY31 * x1 > 0;
+      bool c01 = e.C3 + e.DX31 * y1 - e.DY31 * x0 > 0;
+      bool c11 = e.C3 + e.DX31 * y1 - e.DY31 * x1 > 0;
+      int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
+
+      // Skip block when outside an edge
+      if (a == 0x0 || b == 0x0 || c == 0x0)
+        continue;
+
+      BuildBlock(context, x, y);
+
+      // Accept whole block when totally covered
+      if (a == 0xF && b == 0xF && c == 0xF)
+      {
+        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        {
+          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          {
+            Draw(context, x + ix, y + iy, ix, iy);
+          }
+        }
+      }
+      else  // Partially covered block
+      {
+        s32 CY1 = e.C1 + e.DX12 * y0 - e.DY12 * x0;
+        s32 CY2 = e.C2 + e.DX23 * y0 - e.DY23 * x0;
+        s32 CY3 = e.C3 + e.DX31 * y0 - e.DY31 * x0;
+
+        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        {
+          s32 CX1 = CY1;
+          s32 CX2 = CY2;
+          s32 CX3 = CY3;
+
+          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          {
+            if (CX1 > 0 && CX2 > 0 && CX3 > 0)
+            {
+              Draw(context, x + ix, y + iy, ix, iy);
+            }
+
+            CX1 -= e.FDY12;
+            CX2 -= e.FDY23;
+            CX3 -= e.FDY31;
+          }
+
+          CY1 += e.FDX12;
+          CY2 += e.FDX23;
+          CY3 += e.FDX31;
+        }
+      }
     }
   }
 }
 
+// Folds the pixels a context drew into the shared statistics and bounding box, and readies
+// the context for the next triangle. Only called once its worker is done.
+static void MergeContextState(DrawContext& context)
+{
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, context.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, context.tev.PixelsIn);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, context.tev.PixelsOut);
+  if (context.tev.PixelsOut != 0)
+  {
+    BoundingBox::Update(context.tev.BoundingBoxLeft, context.tev.BoundingBoxRight,
+                        context.tev.BoundingBoxTop, context.tev.BoundingBoxBottom);
+  }
+
+  context.rasterized_pixels = 0;
+  context.tev.PixelsIn = 0;
+  context.tev.PixelsOut = 0;
+  context.tev.BoundingBoxLeft = 0xffff;
+  context.tev.BoundingBoxRight = 0;
+  context.tev.BoundingBoxTop = 0xffff;
+  context.tev.BoundingBoxBottom = 0;
+}
+
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
                            const OutputVertexData* v2)
 {
@@ -387,83 +535,43 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
   minx &= ~(BLOCK_SIZE - 1);
   miny &= ~(BLOCK_SIZE - 1);
 
-  // Loop through blocks
-  for (s32 y = miny; y < maxy; y += BLOCK_SIZE)
-  {
-    for (s32 x = minx; x < maxx; x += BLOCK_SIZE)
-    {
-      // Corners of block
-      s32 x0 = x << 4;
-      s32 x1 = (x + BLOCK_SIZE - 1) << 4;
-      s32 y0 = y << 4;
-      s32 y1 = (y + BLOCK_SIZE - 1) << 4;
-
-      // Evaluate half-space functions
-      bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
-      bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
-      bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
-      bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
-      int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
-
-      bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
-      bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
-      bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
-      bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
-      int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
-
-      bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
-      bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
-      bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
-      bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
-      int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
+  const TriangleEdges edges{C1,    C2,    C3,    DX12,  DX23,  DX31,  DY12,  DY23, DY31,
+                            FDX12, FDX23, FDX31, FDY12, FDY23, FDY31, minx,  maxx, maxy};
 
-      // Skip block when outside an edge
-      if (a == 0x0 || b == 0x0 || c == 0x0)
-        continue;
+  const s32 num_block_rows = (maxy - miny + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  size_t job_count = std::min(s_contexts.size(), static_cast<size_t>(num_block_rows));
 
-      BuildBlock(x, y);
-
-      // Accept whole block when totally covered
-      if (a == 0xF && b == 0xF && c == 0xF)
-      {
-        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-        {
-          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-          {
-            Draw(x + ix, y + iy, ix, iy);
-          }
-        }
-      }
-      else  // Partially covered block
-      {
-        s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
-        s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
-        s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
-
-        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
-        {
-          s32 CX1 = CY1;
-          s32 CX2 = CY2;
-          s32 CX3 = CY3;
-
-          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
-          {
-            if (CX1 > 0 && CX2 > 0 && CX3 > 0)
-            {
-              Draw(x + ix, y + iy, ix, iy);
-            }
+  // The TEV stage dumps write to shared temporary buffers and have to stay deterministic,
+  // so don't spread the triangle across threads while they're active.
+  if ((maxx - minx) * (maxy - miny) < MIN_PARALLEL_PIXELS || g_ActiveConfig.bDumpTevStages ||
+      g_ActiveConfig.bDumpTevTextureFetches)
+  {
+    job_count = 1;
+  }
 
-            CX1 -= FDY12;
-            CX2 -= FDY23;
-            CX3 -= FDY31;
-          }
+  if (job_count <= 1)
+  {
+    ScanBlockRows(*s_contexts[0], edges, miny, BLOCK_SIZE);
+    MergeContextState(*s_contexts[0]);
+    return;
+  }
 
-          CY1 += FDX12;
-          CY2 += FDX23;
-          CY3 += FDX31;
-        }
-      }
-    }
+  // Hand each context every job_count'th row of blocks. Interleaving balances the load
+  // better than contiguous strips, as triangle rows vary in width.
+  const s32 row_step = static_cast<s32>(job_count) * BLOCK_SIZE;
+  Common::ThreadPool::WorkGroup work_group(Common::ThreadPool::GetInstance());
+  for (size_t i = 1; i < job_count; i++)
+  {
+    DrawContext* context = s_contexts[i].get();
+    const s32 first_row = miny + static_cast<s32>(i) * BLOCK_SIZE;
+    work_group.Push([context, &edges, first_row, row_step] {
+      ScanBlockRows(*context, edges, first_row, row_step);
+    });
   }
+  ScanBlockRows(*s_contexts[0], edges, miny, row_step);
+  work_group.Wait();
+
+  for (size_t i = 0; i < job_count; i++)
+    MergeContextState(*s_contexts[i]);
 }
 }  // namespace Rasterizer
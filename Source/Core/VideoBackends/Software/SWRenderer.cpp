@@ -5,8 +5,11 @@
 
 #include <string>
 
+#include <xxhash.h>
+
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLContext.h"
+#include "Common/Logging/Log.h"
 
 #include "Core/HW/Memmap.h"
 
@@ -22,6 +25,7 @@
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace SW
 {
@@ -108,6 +112,28 @@ void SWRenderer::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
                                    const AbstractTexture* source_texture,
                                    const MathUtil::Rectangle<int>& source_rc)
 {
+  // Every frame the software backend presents already lives in CPU memory, so a
+  // fingerprint of the XFB region is just a hash over the rows. Accuracy runs compare
+  // these between builds instead of dumping and diffing full frames; headless runs
+  // skip all remaining presentation work.
+  if (g_ActiveConfig.bFrameFingerprint)
+  {
+    const SWTexture* texture = static_cast<const SWTexture*>(source_texture);
+    const u32 stride = texture->GetConfig().width * sizeof(u32);
+
+    XXH64_state_t* state = XXH64_createState();
+    XXH64_reset(state, 0);
+    for (int y = source_rc.top; y < source_rc.bottom; y++)
+    {
+      const u8* row = texture->GetData() + y * stride + source_rc.left * sizeof(u32);
+      XXH64_update(state, row, source_rc.GetWidth() * sizeof(u32));
+    }
+    const u64 hash = XXH64_digest(state);
+    XXH64_freeState(state);
+
+    NOTICE_LOG_FMT(VIDEO, "Frame {} fingerprint: {:016x}", m_frame_count, hash);
+  }
+
   if (!IsHeadless())
     m_window->ShowImage(source_texture, source_rc);
 }
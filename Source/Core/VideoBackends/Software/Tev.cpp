@@ -9,14 +9,13 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "VideoBackends/Software/DebugUtil.h"
 #include "VideoBackends/Software/EfbInterface.h"
 #include "VideoBackends/Software/TextureSampler.h"
 
-#include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderManager.h"
-#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
@@ -229,6 +228,42 @@ void Tev::SetRasColor(RasColorChan colorChan, int swaptable)
 
 void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
 {
+#ifdef _M_X86
+  // The combiner parameters are uniform across the three color lanes, so the lerp and
+  // scale can be evaluated for all of them at once. Every operation below is exact
+  // integer arithmetic, matching the scalar path bit for bit. Only needs SSE2, which is
+  // part of the x86 baseline.
+  const s32 lshift = m_ScaleLShiftLUT[u32(cc.scale.Value())];
+  const s32 rshift = m_ScaleRShiftLUT[u32(cc.scale.Value())];
+  const s32 rounding = (cc.scale == TevScale::Divide2) ? 0 : (cc.op == TevOp::Sub) ? 127 : 128;
+  const s32 bias = m_BiasLUT[u32(cc.bias.Value())];
+
+  const u16 cb = inputs[BLU_C].c + (inputs[BLU_C].c >> 7);
+  const u16 cg = inputs[GRN_C].c + (inputs[GRN_C].c >> 7);
+  const u16 cr = inputs[RED_C].c + (inputs[RED_C].c >> 7);
+
+  // Interleave a/b with (256 - c)/c, so that one multiply-add computes
+  // a * (256 - c) + b * c in each 32-bit lane.
+  const __m128i ab = _mm_setr_epi16(inputs[BLU_C].a, inputs[BLU_C].b, inputs[GRN_C].a,
+                                    inputs[GRN_C].b, inputs[RED_C].a, inputs[RED_C].b, 0, 0);
+  const __m128i cw = _mm_setr_epi16(256 - cb, cb, 256 - cg, cg, 256 - cr, cr, 0, 0);
+  __m128i temp = _mm_madd_epi16(ab, cw);
+  temp = _mm_slli_epi32(temp, lshift);
+  temp = _mm_srai_epi32(_mm_add_epi32(temp, _mm_set1_epi32(rounding)), 8);
+  if (cc.op == TevOp::Sub)
+    temp = _mm_sub_epi32(_mm_setzero_si128(), temp);
+
+  const __m128i d = _mm_setr_epi32(inputs[BLU_C].d, inputs[GRN_C].d, inputs[RED_C].d, 0);
+  __m128i result =
+      _mm_add_epi32(_mm_slli_epi32(_mm_add_epi32(d, _mm_set1_epi32(bias)), lshift), temp);
+  result = _mm_srai_epi32(result, rshift);
+
+  alignas(16) s32 out[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(out), result);
+  Reg[u32(cc.dest.Value())][BLU_C] = out[0];
+  Reg[u32(cc.dest.Value())][GRN_C] = out[1];
+  Reg[u32(cc.dest.Value())][RED_C] = out[2];
+#else
   for (int i = BLU_C; i <= RED_C; i++)
   {
     const InputRegType& InputReg = inputs[i];
@@ -248,6 +283,7 @@ void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const Inpu
 
     Reg[u32(cc.dest.Value())][i] = result;
   }
+#endif
 }
 
 void Tev::DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
@@ -543,7 +579,7 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
+  PixelsIn++;
 
   // initial color values
   for (int i = 0; i < 4; i++)
@@ -839,8 +875,10 @@ void Tev::Draw()
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BoundingBox::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  BoundingBoxLeft = std::min(BoundingBoxLeft, static_cast<u16>(Position[0] & ~1));
+  BoundingBoxRight = std::max(BoundingBoxRight, static_cast<u16>(Position[0] | 1));
+  BoundingBoxTop = std::min(BoundingBoxTop, static_cast<u16>(Position[1] & ~1));
+  BoundingBoxBottom = std::max(BoundingBoxBottom, static_cast<u16>(Position[1] | 1));
 
 #if ALLOW_TEV_DUMPS
   if (g_ActiveConfig.bDumpTevStages)
@@ -862,7 +900,7 @@ void Tev::Draw()
   }
 #endif
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
+  PixelsOut++;
   EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
@@ -74,6 +74,16 @@ public:
   s32 TextureLod[16];
   bool TextureLinear[16];
 
+  // Statistics and bounding box extents are accumulated per instance and merged by the
+  // rasterizer once a triangle has been scanned, so that several Tev instances can draw
+  // on worker threads without racing on the shared counters.
+  s32 PixelsIn = 0;
+  s32 PixelsOut = 0;
+  u16 BoundingBoxLeft = 0xffff;
+  u16 BoundingBoxRight = 0;
+  u16 BoundingBoxTop = 0xffff;
+  u16 BoundingBoxBottom = 0;
+
   enum
   {
     ALP_C,
@@ -5,8 +5,10 @@
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 
@@ -265,6 +267,166 @@ static void SetSpans(int sBlkSize, int tBlkSize, s32* tSpan, s32* sBlkSpan, s32*
   dstBlockStart += writeStride;                                                                    \
   }
 
+// Variants of the loops above with the innermost per-texel loop stripped, for encoders that
+// process a whole row of a block (sBlkSize texels) at once. The body is responsible for
+// advancing src and dst across the row.
+#define ENCODE_LOOP_ROWS                                                                           \
+  for (int tBlk = 0; tBlk < tBlkCount; tBlk++)                                                     \
+  {                                                                                                \
+    dst = dstBlockStart;                                                                           \
+    for (int sBlk = 0; sBlk < sBlkCount; sBlk++)                                                   \
+    {                                                                                              \
+      for (int t = 0; t < tBlkSize; t++)                                                           \
+      {
+#define ENCODE_LOOP_ROWS_END                                                                       \
+  src += tSpan;                                                                                    \
+  }                                                                                                \
+  src += sBlkSpan;                                                                                 \
+  }                                                                                                \
+  src += tBlkSpan;                                                                                 \
+  dstBlockStart += writeStride;                                                                    \
+  }
+#define ENCODE_LOOP_ROWS_END2                                                                      \
+  src += tSpan;                                                                                    \
+  }                                                                                                \
+  src += sBlkSpan;                                                                                 \
+  dst += 32;                                                                                       \
+  }                                                                                                \
+  src += tBlkSpan;                                                                                 \
+  dstBlockStart += writeStride;                                                                    \
+  }
+
+#if defined(_M_X86)
+// SSSE3 row encoders for the most common non-filtered copies. The EFB stores three bytes per
+// pixel, so a row of four texels is exactly twelve bytes; LoadTexels4 widens them to one texel
+// per 32-bit lane without reading past the row. The scalar loops remain as the fallback (and
+// as the reference for the boxfiltered and YUV paths, which stay scalar).
+
+FUNCTION_TARGET_SSSE3
+static inline __m128i LoadTexels4(const u8* src)
+{
+  const __m128i lo = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+  const __m128i hi = _mm_cvtsi32_si128(*reinterpret_cast<const u32*>(src + 8));
+  const __m128i bytes = _mm_or_si128(lo, _mm_slli_si128(hi, 8));
+  const __m128i widen = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+  return _mm_shuffle_epi8(bytes, widen);
+}
+
+// Packs the low 16 bits of each 32-bit lane to four big-endian u16s.
+FUNCTION_TARGET_SSSE3
+static inline void StoreSwapped16(u8* dst, __m128i val)
+{
+  const __m128i pack = _mm_setr_epi8(1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(val, pack));
+}
+
+// Widens 6-bit values in 32-bit lanes to 8 bits, matching Convert6To8.
+FUNCTION_TARGET_SSSE3
+static inline __m128i Convert6To8x4(__m128i c6)
+{
+  return _mm_or_si128(_mm_slli_epi32(c6, 2), _mm_srli_epi32(c6, 4));
+}
+
+// Extracts one byte of every texel from a row of eight (R8/G8/B8 copies).
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRow8_Component(u8* dst, const u8* src, int comp)
+{
+  alignas(16) static const s8 lo_masks[3][16] = {
+      {0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+      {1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+      {2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+  };
+  alignas(16) static const s8 hi_masks[3][16] = {
+      {-1, -1, -1, -1, -1, -1, 2, 5, -1, -1, -1, -1, -1, -1, -1, -1},
+      {-1, -1, -1, -1, -1, 0, 3, 6, -1, -1, -1, -1, -1, -1, -1, -1},
+      {-1, -1, -1, -1, -1, 1, 4, 7, -1, -1, -1, -1, -1, -1, -1, -1},
+  };
+  const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i v1 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + 16));
+  const __m128i out = _mm_or_si128(
+      _mm_shuffle_epi8(v0, *reinterpret_cast<const __m128i*>(lo_masks[comp])),
+      _mm_shuffle_epi8(v1, *reinterpret_cast<const __m128i*>(hi_masks[comp])));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), out);
+}
+
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRow4_RGB8ToRGB565(u8* dst, const u8* src)
+{
+  const __m128i c = LoadTexels4(src);
+  const __m128i val =
+      _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(c, 8), _mm_set1_epi32(0xf800)),
+                                _mm_and_si128(_mm_srli_epi32(c, 5), _mm_set1_epi32(0x07e0))),
+                   _mm_and_si128(_mm_srli_epi32(c, 3), _mm_set1_epi32(0x001f)));
+  StoreSwapped16(dst, val);
+}
+
+// The RGB8 EFB has no alpha, so this is always the opaque 555 encoding.
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRow4_RGB8ToRGB5A3(u8* dst, const u8* src)
+{
+  const __m128i c = LoadTexels4(src);
+  const __m128i val = _mm_or_si128(
+      _mm_or_si128(_mm_and_si128(_mm_srli_epi32(c, 9), _mm_set1_epi32(0x7c00)),
+                   _mm_and_si128(_mm_srli_epi32(c, 6), _mm_set1_epi32(0x03e0))),
+      _mm_or_si128(_mm_and_si128(_mm_srli_epi32(c, 3), _mm_set1_epi32(0x001f)),
+                   _mm_set1_epi32(0x8000)));
+  StoreSwapped16(dst, val);
+}
+
+// Writes the AR half of the tile to dst and the GB half to dst + 32, alpha forced opaque.
+// Also used for Z24, where the byte layout happens to match (dst[1] = src[2], etc).
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRow4_RGB8ToRGBA8(u8* dst, const u8* src)
+{
+  const __m128i c = LoadTexels4(src);
+  const __m128i ar_shuffle = _mm_setr_epi8(-1, 2, -1, 6, -1, 10, -1, 14, -1, -1, -1, -1, -1, -1,
+                                           -1, -1);
+  const __m128i gb_shuffle = _mm_setr_epi8(1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1,
+                                           -1);
+  const __m128i ar = _mm_or_si128(_mm_shuffle_epi8(c, ar_shuffle), _mm_set1_epi16(0x00ff));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), ar);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 32), _mm_shuffle_epi8(c, gb_shuffle));
+}
+
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRow8_RGBA6ToR8(u8* dst, const u8* src)
+{
+  const __m128i six = _mm_set1_epi32(0x3f);
+  const __m128i r0 = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(LoadTexels4(src), 18), six));
+  const __m128i r1 = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(LoadTexels4(src + 12), 18), six));
+  const __m128i lo = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i hi = _mm_setr_epi8(-1, -1, -1, -1, 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i out = _mm_or_si128(_mm_shuffle_epi8(r0, lo), _mm_shuffle_epi8(r1, hi));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), out);
+}
+
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRow4_RGBA6ToRGB565(u8* dst, const u8* src)
+{
+  const __m128i c = LoadTexels4(src);
+  const __m128i t7 = _mm_srli_epi32(c, 7);
+  const __m128i val = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(c, 8), _mm_set1_epi32(0xf800)),
+                                   _mm_and_si128(t7, _mm_set1_epi32(0x07ff)));
+  StoreSwapped16(dst, val);
+}
+
+FUNCTION_TARGET_SSSE3
+static inline void EncodeRow4_RGBA6ToRGBA8(u8* dst, const u8* src)
+{
+  const __m128i c = LoadTexels4(src);
+  const __m128i six = _mm_set1_epi32(0x3f);
+  const __m128i a = Convert6To8x4(_mm_and_si128(c, six));
+  const __m128i b = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(c, 6), six));
+  const __m128i g = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(c, 12), six));
+  const __m128i r = Convert6To8x4(_mm_and_si128(_mm_srli_epi32(c, 18), six));
+  const __m128i ar = _mm_or_si128(a, _mm_slli_epi32(r, 8));
+  const __m128i gb = _mm_or_si128(g, _mm_slli_epi32(b, 8));
+  const __m128i pack = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(ar, pack));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 32), _mm_shuffle_epi8(gb, pack));
+}
+#endif
+
 static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
 {
   u16 sBlkCount, tBlkCount, sBlkSize, tBlkSize;
@@ -315,6 +477,19 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (!yuv && cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow8_RGBA6ToR8(dst, src);
+        src += 8 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -392,6 +567,19 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::RGB565:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow4_RGBA6ToRGB565(dst, src);
+        src += 4 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       u32 srcColor = *(u32*)src;
@@ -431,6 +619,19 @@ static void EncodeRGBA6(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow4_RGBA6ToRGBA8(dst, src);
+        src += 4 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END2
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       RGBA_to_RGBA8(src, &dst[1], &dst[32], &dst[33], &dst[0]);
@@ -793,6 +994,19 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (!yuv && cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow8_Component(dst, src, 2);
+        src += 8 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     if (yuv)
     {
       ENCODE_LOOP_BLOCKS
@@ -865,6 +1079,19 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::RGB565:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow4_RGB8ToRGB565(dst, src);
+        src += 4 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       u16 val = ((src[2] << 8) & 0xf800) | ((src[1] << 3) & 0x07e0) | ((src[0] >> 3) & 0x001f);
@@ -878,6 +1105,19 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::RGB5A3:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow4_RGB8ToRGB5A3(dst, src);
+        src += 4 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       u16 val =
@@ -892,6 +1132,19 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow4_RGB8ToRGBA8(dst, src);
+        src += 4 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END2
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       dst[0] = 0xff;
@@ -914,6 +1167,19 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::G8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow8_Component(dst, src, 1);
+        src += 8 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[1];
@@ -925,6 +1191,19 @@ static void EncodeRGB8(u8* dst, const u8* src, EFBCopyFormat format, bool yuv)
   case EFBCopyFormat::B8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow8_Component(dst, src, 0);
+        src += 8 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[0];
@@ -1209,6 +1488,19 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
   case EFBCopyFormat::R8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow8_Component(dst, src, 2);
+        src += 8 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[2];
@@ -1222,6 +1514,19 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
   case EFBCopyFormat::RGBA8:
     SetBlockDimensions(2, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow4_RGB8ToRGBA8(dst, src);
+        src += 4 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END2
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       dst[0] = 0xff;
@@ -1254,6 +1559,19 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
   case EFBCopyFormat::G8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow8_Component(dst, src, 1);
+        src += 8 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[1];
@@ -1265,6 +1583,19 @@ static void EncodeZ24(u8* dst, const u8* src, EFBCopyFormat format)
   case EFBCopyFormat::B8:
     SetBlockDimensions(3, 2, &sBlkCount, &tBlkCount, &sBlkSize, &tBlkSize);
     SetSpans(sBlkSize, tBlkSize, &tSpan, &sBlkSpan, &tBlkSpan, &writeStride);
+#if defined(_M_X86)
+    if (cpu_info.bSSSE3)
+    {
+      ENCODE_LOOP_ROWS
+      {
+        EncodeRow8_Component(dst, src, 0);
+        src += 8 * readStride;
+        dst += 8;
+      }
+      ENCODE_LOOP_ROWS_END
+      break;
+    }
+#endif
     ENCODE_LOOP_BLOCKS
     {
       *dst++ = src[0];
@@ -357,6 +357,7 @@ void Renderer::PresentBackbuffer()
   // Because this final command buffer is rendering to the swap chain, we need to wait for
   // the available semaphore to be signaled before executing the buffer. This final submission
   // can happen off-thread in the background while we're preparing the next frame.
+  VKTexture::FlushPendingTransitions();
   g_command_buffer_mgr->SubmitCommandBuffer(true, false, m_swap_chain->GetSwapChain(),
                                             m_swap_chain->GetCurrentImageIndex());
 
@@ -381,6 +382,7 @@ void Renderer::ExecuteCommandBuffer(bool submit_off_thread, bool wait_for_comple
 {
   StateTracker::GetInstance()->EndRenderPass();
 
+  VKTexture::FlushPendingTransitions();
   g_command_buffer_mgr->SubmitCommandBuffer(submit_off_thread, wait_for_completion);
 
   StateTracker::GetInstance()->InvalidateCachedState();
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <vector>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
@@ -22,6 +23,10 @@
 
 namespace Vulkan
 {
+// Post-upload layout transitions deferred by Load(), flushed as one pipeline barrier.
+static std::vector<const VKTexture*> s_deferred_transition_textures;
+static std::vector<VkImageMemoryBarrier> s_deferred_transition_barriers;
+
 VKTexture::VKTexture(const TextureConfig& tex_config, VkDeviceMemory device_memory, VkImage image,
                      VkImageLayout layout /* = VK_IMAGE_LAYOUT_UNDEFINED */,
                      ComputeImageLayout compute_layout /* = ComputeImageLayout::Undefined */)
@@ -32,6 +37,20 @@ VKTexture::VKTexture(const TextureConfig& tex_config, VkDeviceMemory device_memo
 
 VKTexture::~VKTexture()
 {
+  // Drop any transition still pending for this texture; nothing can sample it any more, and the
+  // image itself is kept alive by deferred destruction until the command buffer completes.
+  if (m_transition_pending)
+  {
+    const auto it = std::find(s_deferred_transition_textures.begin(),
+                              s_deferred_transition_textures.end(), this);
+    if (it != s_deferred_transition_textures.end())
+    {
+      s_deferred_transition_barriers.erase(s_deferred_transition_barriers.begin() +
+                                           (it - s_deferred_transition_textures.begin()));
+      s_deferred_transition_textures.erase(it);
+    }
+  }
+
   StateTracker::GetInstance()->UnbindTexture(m_view);
   g_command_buffer_mgr->DeferImageViewDestruction(m_view);
 
@@ -331,6 +350,11 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   width = std::max(1u, std::min(width, GetWidth() >> level));
   height = std::max(1u, std::min(height, GetHeight() >> level));
 
+  // If this texture still has a deferred transition from a previous upload, that barrier must be
+  // recorded before the new TRANSFER_DST transition below, or the layouts would run backwards.
+  if (m_transition_pending)
+    FlushPendingTransitions();
+
   // We don't care about the existing contents of the texture, so we could the image layout to
   // VK_IMAGE_LAYOUT_UNDEFINED here. However, under section 2.2.1, Queue Operation of the Vulkan
   // specification, it states:
@@ -415,11 +439,57 @@ void VKTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8*
   // likely finished with writes to this texture for now. We can't do this in common with a
   // FinishedRendering() call because the upload happens in the init command buffer, and we
   // don't want to interrupt the render pass with calls which were executed ages before.
+  // The transition is deferred and batched with those of every other texture uploaded this
+  // frame, so scene loads pay for one barrier instead of one per texture.
   if (level == (m_config.levels - 1))
-  {
-    TransitionToLayout(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
-                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-  }
+    DeferTransitionToShaderReadOnly();
+}
+
+void VKTexture::DeferTransitionToShaderReadOnly() const
+{
+  if (m_layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    return;
+
+  // Load() leaves the image in TRANSFER_DST, so the source masks are always the same and all
+  // deferred transitions can share a single barrier; see FlushPendingTransitions().
+  ASSERT(m_layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+  const VkImageMemoryBarrier barrier = {
+      VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,    // VkStructureType            sType
+      nullptr,                                   // const void*                pNext
+      VK_ACCESS_TRANSFER_WRITE_BIT,              // VkAccessFlags              srcAccessMask
+      VK_ACCESS_SHADER_READ_BIT,                 // VkAccessFlags              dstAccessMask
+      m_layout,                                  // VkImageLayout              oldLayout
+      VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,  // VkImageLayout              newLayout
+      VK_QUEUE_FAMILY_IGNORED,                   // uint32_t                   srcQueueFamilyIndex
+      VK_QUEUE_FAMILY_IGNORED,                   // uint32_t                   dstQueueFamilyIndex
+      m_image,                                   // VkImage                    image
+      {GetImageAspectForFormat(GetFormat()), 0, GetLevels(), 0,
+       GetLayers()}  // VkImageSubresourceRange    subresourceRange
+  };
+  s_deferred_transition_textures.push_back(this);
+  s_deferred_transition_barriers.push_back(barrier);
+
+  // The logical layout changes immediately; the barrier is recorded into the init command
+  // buffer, which executes before anything that could sample the texture.
+  m_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  m_transition_pending = true;
+}
+
+void VKTexture::FlushPendingTransitions()
+{
+  if (s_deferred_transition_barriers.empty())
+    return;
+
+  vkCmdPipelineBarrier(g_command_buffer_mgr->GetCurrentInitCommandBuffer(),
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0,
+                       nullptr, 0, nullptr,
+                       static_cast<u32>(s_deferred_transition_barriers.size()),
+                       s_deferred_transition_barriers.data());
+
+  for (const VKTexture* texture : s_deferred_transition_textures)
+    texture->m_transition_pending = false;
+  s_deferred_transition_textures.clear();
+  s_deferred_transition_barriers.clear();
 }
 
 void VKTexture::FinishedRendering()
@@ -55,6 +55,10 @@ public:
   VkFormat GetVkFormat() const { return GetVkFormatForHostTextureFormat(m_config.format); }
   bool IsAdopted() const { return m_device_memory != VkDeviceMemory(VK_NULL_HANDLE); }
 
+  // Issues a single pipeline barrier covering all post-upload layout transitions deferred by
+  // Load(). Must be called before the current command buffers are submitted.
+  static void FlushPendingTransitions();
+
   static std::unique_ptr<VKTexture> Create(const TextureConfig& tex_config);
   static std::unique_ptr<VKTexture>
   CreateAdopted(const TextureConfig& tex_config, VkImage image,
@@ -72,11 +76,16 @@ public:
 private:
   bool CreateView(VkImageViewType type);
 
+  // Queues the TRANSFER_DST -> SHADER_READ_ONLY transition after the last mip upload into the
+  // pending batch instead of issuing a barrier immediately.
+  void DeferTransitionToShaderReadOnly() const;
+
   VkDeviceMemory m_device_memory;
   VkImage m_image;
   VkImageView m_view = VK_NULL_HANDLE;
   mutable VkImageLayout m_layout = VK_IMAGE_LAYOUT_UNDEFINED;
   mutable ComputeImageLayout m_compute_layout = ComputeImageLayout::Undefined;
+  mutable bool m_transition_pending = false;
 };
 
 class VKStagingTexture final : public AbstractStagingTexture
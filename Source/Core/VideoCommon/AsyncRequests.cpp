@@ -22,96 +22,112 @@ void AsyncRequests::PullEventsInternal()
   // So just flush the pipeline to get accurate results.
   g_vertex_manager->Flush();
 
-  std::unique_lock<std::mutex> lock(m_mutex);
   m_empty.Set();
 
-  while (!m_queue.empty())
+  while (true)
   {
-    Event e = m_queue.front();
-
-    // try to merge as many efb pokes as possible
-    // it's a bit hacky, but some games render a complete frame in this way
-    if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
+    // The queue is drained without taking the mutex; only the CPU thread pushes.
+    while (m_queue.Size() != 0)
     {
-      m_merged_efb_pokes.clear();
-      Event first_event = m_queue.front();
-      const auto t = first_event.type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor :
-                                                                 EFBAccessType::PokeZ;
+      Event e = m_queue.Front();
 
-      do
+      // try to merge as many efb pokes as possible
+      // it's a bit hacky, but some games render a complete frame in this way
+      if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
       {
-        e = m_queue.front();
-
-        EfbPokeData d;
-        d.data = e.efb_poke.data;
-        d.x = e.efb_poke.x;
-        d.y = e.efb_poke.y;
-        m_merged_efb_pokes.push_back(d);
-
-        m_queue.pop();
-      } while (!m_queue.empty() && m_queue.front().type == first_event.type);
-
-      lock.unlock();
-      g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
-      lock.lock();
-      continue;
+        m_merged_efb_pokes.clear();
+        const Event::Type first_type = e.type;
+        const auto t =
+            first_type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor : EFBAccessType::PokeZ;
+
+        do
+        {
+          e = m_queue.Front();
+
+          EfbPokeData d;
+          d.data = e.efb_poke.data;
+          d.x = e.efb_poke.x;
+          d.y = e.efb_poke.y;
+          m_merged_efb_pokes.push_back(d);
+
+          m_queue.Pop();
+        } while (m_queue.Size() != 0 && m_queue.Front().type == first_type);
+
+        g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
+        continue;
+      }
+
+      // The event is popped only after it has been handled, so a blocking producer
+      // is never woken before its results have been written.
+      HandleEvent(e);
+      m_queue.Pop();
     }
 
-    lock.unlock();
-    HandleEvent(e);
-    lock.lock();
-
-    m_queue.pop();
-  }
+    // Blocking producers push under the mutex before sleeping, so the queue has to be
+    // re-checked under the mutex before deciding whether to wake (or skip waking) them.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_queue.Size() != 0)
+      continue;
 
-  if (m_wake_me_up_again)
-  {
-    m_wake_me_up_again = false;
-    m_cond.notify_all();
+    if (m_wake_me_up_again)
+    {
+      m_wake_me_up_again = false;
+      m_cond.notify_all();
+    }
+    return;
   }
 }
 
 void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-
-  if (m_passthrough)
+  if (m_passthrough.load(std::memory_order_relaxed))
   {
     HandleEvent(event);
     return;
   }
 
-  m_empty.Clear();
-  m_wake_me_up_again |= blocking;
-
-  if (!m_enable)
+  if (!m_enable.load(std::memory_order_relaxed))
     return;
 
-  m_queue.push(event);
-
-  Fifo::RunGpu();
   if (blocking)
   {
-    m_cond.wait(lock, [this] { return m_queue.empty(); });
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_empty.Clear();
+    m_wake_me_up_again = true;
+    m_queue.Push(event);
+    Fifo::RunGpu();
+    m_cond.wait(lock, [this] { return m_queue.Size() == 0; });
+  }
+  else
+  {
+    // Lock-free fast path; per-sprite EFB pokes land here thousands of times per frame.
+    // The event must be visible in the queue before m_empty is cleared: if the GPU
+    // thread's drain (which sets m_empty, empties the queue and re-checks it) ran in
+    // between, the event would be stranded behind a set m_empty flag until some later
+    // push clears it again.
+    m_queue.Push(event);
+    m_empty.Clear();
+    Fifo::RunGpu();
   }
 }
 
 void AsyncRequests::WaitForEmptyQueue()
 {
   std::unique_lock<std::mutex> lock(m_mutex);
-  m_cond.wait(lock, [this] { return m_queue.empty(); });
+  m_cond.wait(lock, [this] { return m_queue.Size() == 0; });
 }
 
 void AsyncRequests::SetEnable(bool enable)
 {
+  // Only toggled while the CPU thread is quiescent, so no events can race the flush below.
   std::unique_lock<std::mutex> lock(m_mutex);
-  m_enable = enable;
+  m_enable.store(enable, std::memory_order_relaxed);
 
   if (!enable)
   {
     // flush the queue on disabling
-    while (!m_queue.empty())
-      m_queue.pop();
+    while (m_queue.Size() != 0)
+      m_queue.Pop();
     if (m_wake_me_up_again)
       m_cond.notify_all();
   }
@@ -170,5 +186,5 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 void AsyncRequests::SetPassthrough(bool enable)
 {
   std::unique_lock<std::mutex> lock(m_mutex);
-  m_passthrough = enable;
+  m_passthrough.store(enable, std::memory_order_relaxed);
 }
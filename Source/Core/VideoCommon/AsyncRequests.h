@@ -3,13 +3,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 struct EfbPokeData;
 class PointerWrap;
@@ -94,13 +95,16 @@ private:
   static AsyncRequests s_singleton;
 
   Common::Flag m_empty;
-  std::queue<Event> m_queue;
+  // All events are pushed by the CPU thread and drained by the GPU thread, so the common
+  // (non-blocking) path is a lock-free queue push. The mutex only guards the rendezvous
+  // for blocking events and the rare enable/passthrough transitions.
+  Common::SPSCQueue<Event> m_queue;
   std::mutex m_mutex;
   std::condition_variable m_cond;
 
   bool m_wake_me_up_again = false;
-  bool m_enable = false;
-  bool m_passthrough = true;
+  std::atomic<bool> m_enable{false};
+  std::atomic<bool> m_passthrough{true};
 
   std::vector<EfbPokeData> m_merged_efb_pokes;
 };
@@ -215,6 +215,10 @@ void ClearScreen(const MathUtil::Rectangle<int>& rc)
       z = Z24ToZ16ToZ24(z);
     }
     g_renderer->ClearScreen(rc, colorEnable, alphaEnable, zEnable, color, z);
+
+    // Not every backend's clear path goes through the framebuffer manager,
+    // so make sure the cached EFB resolves are dropped here.
+    g_framebuffer_manager->InvalidateResolvedTextures();
   }
 }
 
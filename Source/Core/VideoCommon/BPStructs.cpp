@@ -33,6 +33,7 @@
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
@@ -97,7 +98,10 @@ static void BPWritten(const BPCmd& bp)
              bpmem.genMode.zfreeze);
 
     if (bp.changes)
+    {
       PixelShaderManager::SetGenModeChanged();
+      g_vertex_manager->SetPixelShaderUidChanged();
+    }
 
     // Only call SetGenerationMode when cull mode changes.
     if (bp.changes & 0xC000)
@@ -142,6 +146,7 @@ static void BPWritten(const BPCmd& bp)
              bpmem.zmode.updateenable);
     SetDepthMode();
     PixelShaderManager::SetZModeControl();
+    g_vertex_manager->SetPixelShaderUidChanged();
     return;
   case BPMEM_BLENDMODE:  // Blending Control
     if (bp.changes & 0xFFFF)
@@ -154,6 +159,7 @@ static void BPWritten(const BPCmd& bp)
       SetBlendMode();
 
       PixelShaderManager::SetBlendModeChanged();
+      g_vertex_manager->SetPixelShaderUidChanged();
     }
     return;
   case BPMEM_CONSTANTALPHA:  // Set Destination Alpha
@@ -164,7 +170,10 @@ static void BPWritten(const BPCmd& bp)
       PixelShaderManager::SetDestAlphaChanged();
     }
     if (bp.changes & 0x100)
+    {
       SetBlendMode();
+      g_vertex_manager->SetPixelShaderUidChanged();
+    }
     return;
 
   // This is called when the game is done drawing the new frame (eg: like in DX: Begin(); Draw();
@@ -354,14 +363,24 @@ static void BPWritten(const BPCmd& bp)
   case BPMEM_FOGRANGE + 4:
   case BPMEM_FOGRANGE + 5:
     if (bp.changes)
+    {
       PixelShaderManager::SetFogRangeAdjustChanged();
+      // Only the base register's enable bit is baked into the pixel shader UID.
+      if (bp.address == BPMEM_FOGRANGE)
+        g_vertex_manager->SetPixelShaderUidChanged();
+    }
     return;
   case BPMEM_FOGPARAM0:
   case BPMEM_FOGBMAGNITUDE:
   case BPMEM_FOGBEXPONENT:
   case BPMEM_FOGPARAM3:
     if (bp.changes)
+    {
       PixelShaderManager::SetFogParamChanged();
+      // Only the fog function select and projection bits are baked into the pixel shader UID.
+      if (bp.address == BPMEM_FOGPARAM3)
+        g_vertex_manager->SetPixelShaderUidChanged();
+    }
     return;
   case BPMEM_FOGCOLOR:  // Fog Color
     if (bp.changes)
@@ -377,6 +396,7 @@ static void BPWritten(const BPCmd& bp)
     {
       PixelShaderManager::SetAlphaTestChanged();
       SetBlendMode();
+      g_vertex_manager->SetPixelShaderUidChanged();
     }
     return;
   case BPMEM_BIAS:  // BIAS
@@ -389,7 +409,10 @@ static void BPWritten(const BPCmd& bp)
     if (bp.changes & 3)
       PixelShaderManager::SetZTextureTypeChanged();
     if (bp.changes & 12)
+    {
       PixelShaderManager::SetZTextureOpChanged();
+      g_vertex_manager->SetPixelShaderUidChanged();
+    }
     PRIM_LOG("ztex op={}, type={}", bpmem.ztex2.op, bpmem.ztex2.type);
   }
     return;
@@ -458,6 +481,7 @@ static void BPWritten(const BPCmd& bp)
     if (bp.changes & 7)
       SetBlendMode();  // dual source could be activated by changing to PIXELFMT_RGBA6_Z24
     PixelShaderManager::SetZModeControl();
+    g_vertex_manager->SetPixelShaderUidChanged();
     return;
 
   case BPMEM_MIPMAP_STRIDE:  // MipMap Stride Channel
@@ -475,7 +499,10 @@ static void BPWritten(const BPCmd& bp)
   case BPMEM_IREF:
   {
     if (bp.changes)
+    {
       PixelShaderManager::SetTevIndirectChanged();
+      g_vertex_manager->SetPixelShaderUidChanged();
+    }
     return;
   }
 
@@ -488,6 +515,7 @@ static void BPWritten(const BPCmd& bp)
   case BPMEM_TEV_KSEL + 6:  // Texture Environment Swap Mode Table 6
   case BPMEM_TEV_KSEL + 7:  // Texture Environment Swap Mode Table 7
     PixelShaderManager::SetTevKSel(bp.address - BPMEM_TEV_KSEL, bp.newvalue);
+    g_vertex_manager->SetPixelShaderUidChanged();
     return;
 
   /* This Register can be used to limit to which bits of BP registers is
@@ -622,6 +650,7 @@ static void BPWritten(const BPCmd& bp)
   case BPMEM_TREF:
   case BPMEM_TREF + 4:
     PixelShaderManager::SetTevOrder(bp.address - BPMEM_TREF, bp.newvalue);
+    g_vertex_manager->SetPixelShaderUidChanged();
     return;
   // ----------------------
   // Set wrap size
@@ -687,6 +716,7 @@ static void BPWritten(const BPCmd& bp)
   // --------------
   case BPMEM_IND_CMD:
     PixelShaderManager::SetTevIndirectChanged();
+    g_vertex_manager->SetPixelShaderUidChanged();
     return;
   // --------------------------------------------------
   // Set Color/Alpha of a Tev
@@ -697,6 +727,7 @@ static void BPWritten(const BPCmd& bp)
   case BPMEM_TEV_COLOR_ENV + 16:
     PixelShaderManager::SetTevCombiner((bp.address - BPMEM_TEV_COLOR_ENV) >> 1,
                                        (bp.address - BPMEM_TEV_COLOR_ENV) & 1, bp.newvalue);
+    g_vertex_manager->SetPixelShaderUidChanged();
     return;
   default:
     break;
@@ -9,6 +9,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/VertexManagerBase.h"
 
 namespace BoundingBox
 {
@@ -30,12 +31,14 @@ void Enable()
 {
   s_is_active = true;
   PixelShaderManager::SetBoundingBoxActive(s_is_active);
+  g_vertex_manager->SetPixelShaderUidChanged();
 }
 
 void Disable()
 {
   s_is_active = false;
   PixelShaderManager::SetBoundingBoxActive(s_is_active);
+  g_vertex_manager->SetPixelShaderUidChanged();
 }
 
 bool IsEnabled()
@@ -1,6 +1,8 @@
 // Copyright 2012 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 
@@ -51,13 +53,21 @@ void FPSCounter::Update()
 
   m_frame_counter++;
   m_time_since_update += diff;
+  m_squared_diff_sum += diff * diff;
   m_last_time = time;
 
   if (m_time_since_update >= FPS_REFRESH_INTERVAL)
   {
     m_fps = m_frame_counter / (m_time_since_update / 1000000.0);
+
+    // Standard deviation of the frame times in this interval, as a frame pacing metric.
+    const double mean_us = static_cast<double>(m_time_since_update) / m_frame_counter;
+    const double mean_square_us = static_cast<double>(m_squared_diff_sum) / m_frame_counter;
+    m_frame_time_jitter_ms = std::sqrt(std::max(mean_square_us - mean_us * mean_us, 0.0)) / 1000.0;
+
     m_frame_counter = 0;
     m_time_since_update = 0;
+    m_squared_diff_sum = 0;
   }
 }
 
@@ -23,6 +23,10 @@ public:
   float GetFPS() const { return m_fps; }
   double GetDeltaTime() const { return m_time_diff_secs; }
 
+  // Pacing quality: standard deviation of the frame times over the last refresh interval, in
+  // milliseconds. Well-paced output on a matching display should stay well under a millisecond.
+  double GetFrameTimeJitter() const { return m_frame_time_jitter_ms; }
+
 private:
   void SetPaused(bool paused);
 
@@ -34,6 +38,8 @@ private:
   float m_fps = 0.f;
   std::ofstream m_bench_file;
   double m_time_diff_secs = 0.0;
+  u64 m_squared_diff_sum = 0;
+  double m_frame_time_jitter_ms = 0.0;
 
   void LogRenderTimeToFile(u64 val);
 };
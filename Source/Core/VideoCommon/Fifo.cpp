@@ -3,7 +3,9 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
+#include <climits>
 #include <cstring>
 
 #include "Common/Assert.h"
@@ -11,10 +13,16 @@
 #include "Common/ChunkFile.h"
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
+#include "Common/FileUtil.h"
+#include "Common/IniFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Thread.h"
+#include "Common/Tracing.h"
 
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/Memmap.h"
 #include "Core/Host.h"
@@ -33,6 +41,11 @@ namespace Fifo
 static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// How much the GPU thread copies out of the emulated fifo in one go. Larger
+// batches mean fewer CopyFromEmu calls and CP pointer updates, but coarser
+// breakpoint/interrupt granularity as seen by the CPU thread.
+static constexpr u32 GPU_READ_BATCH_SIZE = 16 * 32;
+
 static Common::BlockingLoop s_gpu_mainloop;
 
 static Common::Flag s_emu_running_state;
@@ -51,8 +64,10 @@ static CoreTiming::EventType* s_event_sync_gpu;
 // STATE_TO_SAVE
 static u8* s_video_buffer;
 static u8* s_video_buffer_read_ptr;
-static std::atomic<u8*> s_video_buffer_write_ptr;
-static std::atomic<u8*> s_video_buffer_seen_ptr;
+// The write_ptr and seen_ptr are written by different threads in
+// deterministic GPU thread mode, so keep them on separate cache lines.
+alignas(64) static std::atomic<u8*> s_video_buffer_write_ptr;
+alignas(64) static std::atomic<u8*> s_video_buffer_seen_ptr;
 static u8* s_video_buffer_pp_read_ptr;
 // The read_ptr is always owned by the GPU thread.  In normal mode, so is the
 // write_ptr, despite it being atomic.  In deterministic GPU thread mode,
@@ -70,6 +85,124 @@ static std::atomic<int> s_sync_ticks;
 static bool s_syncing_suspended;
 static Common::Event s_sync_wakeup_event;
 
+// Hybrid SyncGPU mode (SyncGPUOnEFBCopies): the tick accounting runs exactly
+// as with bSyncGPU, but the CPU thread only blocks on the distance limit for
+// a short window after the GPU wrote an EFB copy back to emulated RAM. That
+// keeps reads of copied-back data consistent on titles which poll RAM, while
+// the rest of the frame runs at free dual core speed.
+static constexpr int HYBRID_SYNC_WINDOW = 500 * GPU_TIME_SLOT_SIZE;
+static std::atomic<bool> s_efb_copy_occurred;
+static int s_hybrid_sync_remaining;  // CPU thread only
+
+// Single core: upper bound on the tick budget a single SyncGPUCallback slice
+// may hand to RunGpuOnCpu. The callback often fires very late (the CPU thread
+// runs long timeslices), and granting the whole lateness at once makes the
+// GPU catch up in one host-milliseconds-long burst, which shows up directly
+// as frame pacing jitter. Budget beyond the cap is carried over and granted
+// in promptly rescheduled slices instead, so throughput is unchanged.
+static constexpr int MAX_GPU_SLICE_TICKS = 32 * GPU_TIME_SLOT_SIZE;
+static int s_deferred_gpu_ticks;  // CPU thread only, not saved (reset on state load)
+
+static bool SyncGpuEnabled(const SConfig& param)
+{
+  return param.bSyncGPU || param.bSyncGPUOnEFBCopies;
+}
+
+// SyncGPU auto-tuning (SyncGpuAutoTune): adjusts the sync window at runtime within safe bounds
+// instead of relying on hand-tuned per-title distances. Overflow events (the CPU thread parking
+// at the max distance) widen the window on the CPU side, starvation events (the GPU thread
+// having stopped below the min distance) widen it on the GPU side, and while emulation runs at
+// full speed the window decays back towards the configured values to keep CPU-GPU latency low.
+// A window that stays stable long enough is persisted to the local game INI on shutdown so the
+// next boot of the same title starts from the converged values.
+static constexpr int TUNE_INTERVAL_TICKS = 100000000;  // ~0.2 emulated seconds
+static constexpr int TUNE_EVENT_THRESHOLD = 4;
+static constexpr int TUNE_MAX_GROWTH = 8;
+static constexpr int TUNE_STABLE_INTERVALS_TO_SAVE = 5;
+static bool s_tune_active = false;
+// All tuning state is only accessed by the CPU thread.
+static int s_tune_interval_ticks;
+static int s_tune_overflow_events;
+static int s_tune_starve_events;
+static int s_tune_base_max_distance;
+static int s_tune_base_min_distance;
+static int s_tune_stable_intervals;
+
+static void UpdateSyncGpuAutoTune(int ticks)
+{
+  s_tune_interval_ticks += ticks;
+  if (s_tune_interval_ticks < TUNE_INTERVAL_TICKS)
+    return;
+
+  const int overflows = s_tune_overflow_events;
+  const int starves = s_tune_starve_events;
+  s_tune_interval_ticks = 0;
+  s_tune_overflow_events = 0;
+  s_tune_starve_events = 0;
+
+  // The emulation speed swings a lot, so it only gates the direction of adjustment; the event
+  // counts decide whether the window is actually too tight.
+  const bool struggling = Core::GetActualEmulationSpeed() < 0.98;
+
+  SConfig& param = SConfig::GetInstance();
+  int max_distance = param.iSyncGpuMaxDistance;
+  int min_distance = param.iSyncGpuMinDistance;
+
+  if (struggling && overflows >= TUNE_EVENT_THRESHOLD)
+  {
+    max_distance =
+        std::min(max_distance + max_distance / 4, s_tune_base_max_distance * TUNE_MAX_GROWTH);
+  }
+  else if (struggling && starves >= TUNE_EVENT_THRESHOLD)
+  {
+    // The min distance is negative, so growing the window makes it more negative.
+    min_distance =
+        std::max(min_distance + min_distance / 4, s_tune_base_min_distance * TUNE_MAX_GROWTH);
+  }
+  else if (!struggling && overflows == 0 && starves == 0)
+  {
+    max_distance = std::max(max_distance - max_distance / 8, s_tune_base_max_distance);
+    min_distance = std::min(min_distance - min_distance / 8, s_tune_base_min_distance);
+  }
+
+  if (max_distance == param.iSyncGpuMaxDistance && min_distance == param.iSyncGpuMinDistance)
+  {
+    s_tune_stable_intervals++;
+    return;
+  }
+
+  s_tune_stable_intervals = 0;
+  INFO_LOG_FMT(COMMANDPROCESSOR, "SyncGPU auto-tune: max distance {} -> {}, min distance {} -> {}",
+               param.iSyncGpuMaxDistance, max_distance, param.iSyncGpuMinDistance, min_distance);
+  param.iSyncGpuMaxDistance = max_distance;
+  param.iSyncGpuMinDistance = min_distance;
+}
+
+static void SaveAutoTunedSyncWindow()
+{
+  // Only persist a window that both moved away from the configured values and then stayed put;
+  // a window still being adjusted has not converged and would just be noise in the INI.
+  if (!s_tune_active || s_tune_stable_intervals < TUNE_STABLE_INTERVALS_TO_SAVE)
+    return;
+
+  const SConfig& param = SConfig::GetInstance();
+  if (param.iSyncGpuMaxDistance == s_tune_base_max_distance &&
+      param.iSyncGpuMinDistance == s_tune_base_min_distance)
+  {
+    return;
+  }
+
+  const std::string ini_path =
+      File::GetUserPath(D_GAMESETTINGS_IDX) + param.GetGameID() + ".ini";
+  IniFile game_ini;
+  game_ini.Load(ini_path, true);
+  IniFile::Section* core_section = game_ini.GetOrCreateSection("Core");
+  core_section->Set("SyncGpuMaxDistance", param.iSyncGpuMaxDistance);
+  core_section->Set("SyncGpuMinDistance", param.iSyncGpuMinDistance);
+  game_ini.Save(ini_path);
+  INFO_LOG_FMT(COMMANDPROCESSOR, "SyncGPU auto-tune: saved converged sync window to {}", ini_path);
+}
+
 void DoState(PointerWrap& p)
 {
   p.DoArray(s_video_buffer, FIFO_SIZE);
@@ -85,6 +218,11 @@ void DoState(PointerWrap& p)
 
   p.Do(s_sync_ticks);
   p.Do(s_syncing_suspended);
+
+  // Not serialized: dropping carried-over budget only delays pending GPU work
+  // by a few slices after loading a state.
+  if (p.GetMode() == PointerWrap::MODE_READ)
+    s_deferred_gpu_ticks = 0;
 }
 
 void PauseAndLock(bool doLock, bool unpauseOnUnlock)
@@ -116,6 +254,17 @@ void Init()
   if (SConfig::GetInstance().bCPUThread)
     s_gpu_mainloop.Prepare();
   s_sync_ticks.store(0);
+  s_efb_copy_occurred.store(false);
+  s_hybrid_sync_remaining = 0;
+
+  const SConfig& param = SConfig::GetInstance();
+  s_tune_active = param.bSyncGpuAutoTune && param.bCPUThread && SyncGpuEnabled(param);
+  s_tune_base_max_distance = param.iSyncGpuMaxDistance;
+  s_tune_base_min_distance = param.iSyncGpuMinDistance;
+  s_tune_interval_ticks = 0;
+  s_tune_overflow_events = 0;
+  s_tune_starve_events = 0;
+  s_tune_stable_intervals = 0;
 }
 
 void Shutdown()
@@ -123,6 +272,8 @@ void Shutdown()
   if (s_gpu_mainloop.IsRunning())
     PanicAlertFmt("FIFO shutting down while active");
 
+  SaveAutoTunedSyncWindow();
+
   Common::FreeMemoryPages(s_video_buffer, FIFO_SIZE + 4);
   s_video_buffer = nullptr;
   s_video_buffer_write_ptr = nullptr;
@@ -223,9 +374,8 @@ void* PopFifoAuxBuffer(size_t size)
 }
 
 // Description: RunGpuLoop() sends data through this function.
-static void ReadDataFromFifo(u32 readPtr)
+static void ReadDataFromFifo(u32 readPtr, size_t len)
 {
-  constexpr size_t len = 32;
   if (len > static_cast<size_t>(s_video_buffer + FIFO_SIZE - s_video_buffer_write_ptr))
   {
     const size_t existing_len = s_video_buffer_write_ptr - s_video_buffer_read_ptr;
@@ -315,6 +465,7 @@ void RunGpuLoop()
           // See comment in SyncGPU
           if (write_ptr > seen_ptr)
           {
+            TRACE_ZONE("Fifo: OpcodeDecoder");
             s_video_buffer_read_ptr =
                 OpcodeDecoder::Run(DataReader(s_video_buffer_read_ptr, write_ptr), nullptr, false);
             s_video_buffer_seen_ptr = write_ptr;
@@ -325,35 +476,56 @@ void RunGpuLoop()
           CommandProcessor::SCPFifoStruct& fifo = CommandProcessor::fifo;
           CommandProcessor::SetCPStatusFromGPU();
 
+          TRACE_ZONE("Fifo: process GP fifo");
+
           // check if we are able to run this buffer
           while (!CommandProcessor::IsInterruptWaiting() &&
                  fifo.bFF_GPReadEnable.load(std::memory_order_relaxed) &&
                  fifo.CPReadWriteDistance.load(std::memory_order_relaxed) && !AtBreakpoint())
           {
-            if (param.bSyncGPU && s_sync_ticks.load() < param.iSyncGpuMinDistance)
+            if (SyncGpuEnabled(param) && s_sync_ticks.load() < param.iSyncGpuMinDistance)
               break;
 
             u32 cyclesExecuted = 0;
             u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
-            ReadDataFromFifo(readPtr);
+            const u32 cp_end = fifo.CPEnd.load(std::memory_order_relaxed);
+
+            // Work out how many 32 byte blocks can be copied in one go.  The
+            // fifo contents are contiguous up to and including the block at
+            // CPEnd, and we must stop right at a breakpoint so the check at
+            // the top of the loop sees it before we read past it.
+            u32 len = std::min(fifo.CPReadWriteDistance.load(std::memory_order_relaxed),
+                               GPU_READ_BATCH_SIZE);
+            len = std::min(len, cp_end - readPtr + 32);
+            if (fifo.bFF_BPEnable.load(std::memory_order_relaxed))
+            {
+              const u32 breakpoint = fifo.CPBreakpoint.load(std::memory_order_relaxed);
+              // Unsigned arithmetic: also false when the breakpoint is behind
+              // the read pointer (it's only reached after wrapping at CPEnd).
+              if (breakpoint - readPtr < len)
+                len = breakpoint - readPtr;
+            }
 
-            if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
+            ReadDataFromFifo(readPtr, len);
+
+            if (readPtr + len - 32 == cp_end)
               readPtr = fifo.CPBase.load(std::memory_order_relaxed);
             else
-              readPtr += 32;
+              readPtr += len;
 
             ASSERT_MSG(COMMANDPROCESSOR,
-                       (s32)fifo.CPReadWriteDistance.load(std::memory_order_relaxed) - 32 >= 0,
+                       (s32)fifo.CPReadWriteDistance.load(std::memory_order_relaxed) -
+                               (s32)len >= 0,
                        "Negative fifo.CPReadWriteDistance = %i in FIFO Loop !\nThat can produce "
                        "instability in the game. Please report it.",
-                       fifo.CPReadWriteDistance.load(std::memory_order_relaxed) - 32);
+                       fifo.CPReadWriteDistance.load(std::memory_order_relaxed) - len);
 
             u8* write_ptr = s_video_buffer_write_ptr;
             s_video_buffer_read_ptr = OpcodeDecoder::Run(
                 DataReader(s_video_buffer_read_ptr, write_ptr), &cyclesExecuted, false);
 
             fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
-            fifo.CPReadWriteDistance.fetch_sub(32, std::memory_order_seq_cst);
+            fifo.CPReadWriteDistance.fetch_sub(len, std::memory_order_seq_cst);
             if ((write_ptr - s_video_buffer_read_ptr) == 0)
             {
               fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
@@ -362,7 +534,7 @@ void RunGpuLoop()
 
             CommandProcessor::SetCPStatusFromGPU();
 
-            if (param.bSyncGPU)
+            if (SyncGpuEnabled(param))
             {
               cyclesExecuted = (int)(cyclesExecuted / param.fSyncGpuOverclock);
               int old = s_sync_ticks.fetch_sub(cyclesExecuted);
@@ -412,6 +584,12 @@ void GpuMaySleep()
   s_gpu_mainloop.AllowSleep();
 }
 
+void NotifyEFBCopyToRAM()
+{
+  if (SConfig::GetInstance().bSyncGPUOnEFBCopies)
+    s_efb_copy_occurred.store(true, std::memory_order_relaxed);
+}
+
 bool AtBreakpoint()
 {
   CommandProcessor::SCPFifoStruct& fifo = CommandProcessor::fifo;
@@ -432,7 +610,7 @@ void RunGpu()
 
   // if the sync GPU callback is suspended, wake it up.
   if (!SConfig::GetInstance().bCPUThread || s_use_deterministic_gpu_thread ||
-      SConfig::GetInstance().bSyncGPU)
+      SyncGpuEnabled(SConfig::GetInstance()))
   {
     if (s_syncing_suspended)
     {
@@ -464,7 +642,7 @@ static int RunGpuOnCpu(int ticks)
         FPURoundMode::LoadDefaultSIMDState();
         reset_simd_state = true;
       }
-      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed));
+      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed), 32);
       u32 cycles = 0;
       s_video_buffer_read_ptr = OpcodeDecoder::Run(
           DataReader(s_video_buffer_read_ptr, s_video_buffer_write_ptr), &cycles, false);
@@ -560,15 +738,60 @@ static int WaitForGpuThread(int ticks)
 
   // Wakeup GPU
   if (old < param.iSyncGpuMinDistance && now >= param.iSyncGpuMinDistance)
+  {
+    // The GPU thread had stopped below the min distance, i.e. it ran out of budget.
+    if (s_tune_active)
+      s_tune_starve_events++;
     RunGpu();
+  }
 
   // If the GPU is still sleeping, wait for a longer time
   if (now < param.iSyncGpuMinDistance)
+  {
+    if (s_tune_active)
+      UpdateSyncGpuAutoTune(ticks);
     return GPU_TIME_SLOT_SIZE + param.iSyncGpuMinDistance - now;
+  }
+
+  // In hybrid mode the distance limit is only enforced while the sync window
+  // opened by the last EFB copy to RAM is active.
+  bool enforce_limit = param.bSyncGPU;
+  if (!enforce_limit)
+  {
+    if (s_efb_copy_occurred.exchange(false, std::memory_order_relaxed))
+      s_hybrid_sync_remaining = HYBRID_SYNC_WINDOW;
+    else if (s_hybrid_sync_remaining > 0)
+      s_hybrid_sync_remaining -= ticks;
+    enforce_limit = s_hybrid_sync_remaining > 0;
+  }
 
-  // Wait for GPU
   if (now >= param.iSyncGpuMaxDistance)
-    s_sync_wakeup_event.Wait();
+  {
+    if (enforce_limit)
+    {
+      // Spin briefly before parking.  A busy GPU thread usually brings the
+      // distance back under the limit within microseconds, which is cheaper
+      // than the futex round trip of a blocking wait.
+      for (int i = 0; i < 1000 && s_sync_ticks.load() >= param.iSyncGpuMaxDistance; i++)
+        Common::YieldCPU();
+
+      if (s_sync_ticks.load() >= param.iSyncGpuMaxDistance)
+      {
+        if (s_tune_active)
+          s_tune_overflow_events++;
+        s_sync_wakeup_event.Wait();
+      }
+    }
+    else
+    {
+      // Hand the ticks back so the count doesn't run away while the limit is
+      // not being enforced; the GPU keeps its full budget either way.
+      s_sync_ticks.fetch_sub(ticks);
+    }
+  }
+
+  if (s_tune_active)
+    UpdateSyncGpuAutoTune(ticks);
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -580,9 +803,27 @@ static void SyncGPUCallback(u64 ticks, s64 cyclesLate)
 
   if (!SConfig::GetInstance().bCPUThread || s_use_deterministic_gpu_thread)
   {
-    next = RunGpuOnCpu((int)ticks);
+    // Grant at most MAX_GPU_SLICE_TICKS per slice and carry the rest over, so
+    // a late callback drains its backlog interleaved with CPU slices instead
+    // of in one long burst.
+    const int total_ticks = int(std::min<u64>(ticks + s_deferred_gpu_ticks, INT_MAX));
+    const int granted_ticks = std::min(total_ticks, MAX_GPU_SLICE_TICKS);
+    s_deferred_gpu_ticks = total_ticks - granted_ticks;
+
+    next = RunGpuOnCpu(granted_ticks);
+    if (next < 0)
+    {
+      // The FIFO is drained; any leftover budget has nothing to run.
+      s_deferred_gpu_ticks = 0;
+    }
+    else if (s_deferred_gpu_ticks > 0)
+    {
+      // Backlog remains and the budget for it is already earned, so run the
+      // next slice as soon as possible.
+      next = GPU_TIME_SLOT_SIZE;
+    }
   }
-  else if (SConfig::GetInstance().bSyncGPU)
+  else if (SyncGpuEnabled(SConfig::GetInstance()))
   {
     next = WaitForGpuThread((int)ticks);
   }
@@ -598,7 +839,7 @@ void SyncGPUForRegisterAccess()
 
   if (!SConfig::GetInstance().bCPUThread || s_use_deterministic_gpu_thread)
     RunGpuOnCpu(GPU_TIME_SLOT_SIZE);
-  else if (SConfig::GetInstance().bSyncGPU)
+  else if (SyncGpuEnabled(SConfig::GetInstance()))
     WaitForGpuThread(GPU_TIME_SLOT_SIZE);
 }
 
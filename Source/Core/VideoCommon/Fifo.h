@@ -41,6 +41,10 @@ void* PopFifoAuxBuffer(size_t size);
 
 void FlushGpu();
 void RunGpu();
+// Called by the video backend whenever an EFB copy is written back to emulated
+// RAM. Used by the hybrid SyncGPU mode (SyncGPUOnEFBCopies) to decide when the
+// CPU-GPU distance limit needs to be enforced.
+void NotifyEFBCopyToRAM();
 void GpuMaySleep();
 void RunGpuLoop();
 void ExitGpuLoop();
@@ -243,6 +243,17 @@ AbstractTexture* FramebufferManager::ResolveEFBColorTexture(const MathUtil::Rect
   MathUtil::Rectangle<int> clamped_region = region;
   clamped_region.ClampUL(0, 0, GetEFBWidth(), GetEFBHeight());
 
+  // Games often perform a burst of EFB copies without rendering in between,
+  // and each copy would resolve the same contents again. Reuse the last
+  // resolve if it already covers the requested region.
+  if (clamped_region.left >= m_efb_color_resolved_region.left &&
+      clamped_region.top >= m_efb_color_resolved_region.top &&
+      clamped_region.right <= m_efb_color_resolved_region.right &&
+      clamped_region.bottom <= m_efb_color_resolved_region.bottom)
+  {
+    return m_efb_resolve_color_texture.get();
+  }
+
   // Resolve to our already-created texture.
   for (u32 layer = 0; layer < GetEFBLayers(); layer++)
   {
@@ -251,6 +262,7 @@ AbstractTexture* FramebufferManager::ResolveEFBColorTexture(const MathUtil::Rect
   }
 
   m_efb_resolve_color_texture->FinishedRendering();
+  m_efb_color_resolved_region = clamped_region;
   return m_efb_resolve_color_texture.get();
 }
 
@@ -267,6 +279,17 @@ AbstractTexture* FramebufferManager::ResolveEFBDepthTexture(const MathUtil::Rect
   MathUtil::Rectangle<int> clamped_region = region;
   clamped_region.ClampUL(0, 0, GetEFBWidth(), GetEFBHeight());
 
+  // See ResolveEFBColorTexture for why the last resolve is reused. The R32F
+  // conversion shares the resolve texture, so it participates in the cache too.
+  if (m_efb_depth_resolved_r32f == force_r32f &&
+      clamped_region.left >= m_efb_depth_resolved_region.left &&
+      clamped_region.top >= m_efb_depth_resolved_region.top &&
+      clamped_region.right <= m_efb_depth_resolved_region.right &&
+      clamped_region.bottom <= m_efb_depth_resolved_region.bottom)
+  {
+    return m_efb_depth_resolve_texture.get();
+  }
+
   m_efb_depth_texture->FinishedRendering();
   g_renderer->BeginUtilityDrawing();
   g_renderer->SetAndDiscardFramebuffer(m_efb_depth_resolve_framebuffer.get());
@@ -279,14 +302,24 @@ AbstractTexture* FramebufferManager::ResolveEFBDepthTexture(const MathUtil::Rect
   m_efb_depth_resolve_texture->FinishedRendering();
   g_renderer->EndUtilityDrawing();
 
+  m_efb_depth_resolved_region = clamped_region;
+  m_efb_depth_resolved_r32f = force_r32f;
   return m_efb_depth_resolve_texture.get();
 }
 
+void FramebufferManager::InvalidateResolvedTextures()
+{
+  m_efb_color_resolved_region = {};
+  m_efb_depth_resolved_region = {};
+}
+
 bool FramebufferManager::ReinterpretPixelData(EFBReinterpretType convtype)
 {
   if (!m_format_conversion_pipelines[static_cast<u32>(convtype)])
     return false;
 
+  InvalidateResolvedTextures();
+
   // Draw to the secondary framebuffer.
   // We don't discard here because discarding the framebuffer also throws away the depth
   // buffer, which we want to preserve. If we find this to be hindering performance in the
@@ -357,7 +390,7 @@ bool FramebufferManager::IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* ti
   {
     *tile_index =
         ((y / m_efb_cache_tile_size) * m_efb_cache_tiles_wide) + (x / m_efb_cache_tile_size);
-    return data.valid && data.tiles[*tile_index];
+    return data.valid && data.tiles[*tile_index].present;
   }
 }
 
@@ -385,6 +418,10 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
     PopulateEFBCache(false, tile_index);
 
+  if (IsUsingTiledEFBCache())
+    m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
+  FlushEFBCacheCopies(m_efb_color_cache);
+
   u32 value;
   m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
   return value;
@@ -400,6 +437,10 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
     PopulateEFBCache(true, tile_index);
 
+  if (IsUsingTiledEFBCache())
+    m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
+  FlushEFBCacheCopies(m_efb_depth_cache);
+
   float value;
   m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
   return value;
@@ -419,10 +460,15 @@ void FramebufferManager::SetEFBCacheTileSize(u32 size)
 
 void FramebufferManager::InvalidatePeekCache(bool forced)
 {
+  // The frame access masks are deliberately kept; they drive the prefetch of
+  // recently-peeked tiles in EndOfFrame().
   if (forced || m_efb_color_cache.out_of_date)
   {
     if (m_efb_color_cache.valid)
-      std::fill(m_efb_color_cache.tiles.begin(), m_efb_color_cache.tiles.end(), false);
+    {
+      for (EFBCacheTile& tile : m_efb_color_cache.tiles)
+        tile.present = false;
+    }
 
     m_efb_color_cache.valid = false;
     m_efb_color_cache.out_of_date = false;
@@ -430,7 +476,10 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
   if (forced || m_efb_depth_cache.out_of_date)
   {
     if (m_efb_depth_cache.valid)
-      std::fill(m_efb_depth_cache.tiles.begin(), m_efb_depth_cache.tiles.end(), false);
+    {
+      for (EFBCacheTile& tile : m_efb_depth_cache.tiles)
+        tile.present = false;
+    }
 
     m_efb_depth_cache.valid = false;
     m_efb_depth_cache.out_of_date = false;
@@ -439,6 +488,8 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
 {
+  InvalidateResolvedTextures();
+
   if (m_efb_color_cache.valid)
     m_efb_color_cache.out_of_date = true;
   if (m_efb_depth_cache.valid)
@@ -561,10 +612,8 @@ bool FramebufferManager::CreateReadbackFramebuffer()
     const u32 tiles_wide = ((EFB_WIDTH + (m_efb_cache_tile_size - 1)) / m_efb_cache_tile_size);
     const u32 tiles_high = ((EFB_HEIGHT + (m_efb_cache_tile_size - 1)) / m_efb_cache_tile_size);
     const u32 total_tiles = tiles_wide * tiles_high;
-    m_efb_color_cache.tiles.resize(total_tiles);
-    std::fill(m_efb_color_cache.tiles.begin(), m_efb_color_cache.tiles.end(), false);
-    m_efb_depth_cache.tiles.resize(total_tiles);
-    std::fill(m_efb_depth_cache.tiles.begin(), m_efb_depth_cache.tiles.end(), false);
+    m_efb_color_cache.tiles.assign(total_tiles, EFBCacheTile{});
+    m_efb_depth_cache.tiles.assign(total_tiles, EFBCacheTile{});
     m_efb_cache_tiles_wide = tiles_wide;
   }
 
@@ -583,9 +632,11 @@ void FramebufferManager::DestroyReadbackFramebuffer()
   DestroyCache(m_efb_depth_cache);
 }
 
-void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
+void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async)
 {
-  g_vertex_manager->OnCPUEFBAccess();
+  // Prefetches are initiated by the GPU side, not by a CPU EFB access.
+  if (!async)
+    g_vertex_manager->OnCPUEFBAccess();
 
   // Force the path through the intermediate texture, as we can't do an image copy from a depth
   // buffer directly to a staging texture (must be the whole resource).
@@ -641,12 +692,56 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
     data.readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
   }
 
-  // Wait until the copy is complete.
-  data.readback_texture->Flush();
+  // A prefetch only queues the copy; the flush (and any wait) is deferred
+  // until a peek or poke actually needs the data.
+  if (async)
+  {
+    data.needs_flush = true;
+  }
+  else
+  {
+    // Wait until the copy is complete.
+    data.readback_texture->Flush();
+    data.needs_flush = false;
+  }
+
   data.valid = true;
   data.out_of_date = false;
   if (IsUsingTiledEFBCache())
-    data.tiles[tile_index] = true;
+    data.tiles[tile_index].present = true;
+}
+
+void FramebufferManager::FlushEFBCacheCopies(EFBCacheData& data)
+{
+  if (!data.needs_flush)
+    return;
+
+  data.readback_texture->Flush();
+  data.needs_flush = false;
+}
+
+void FramebufferManager::EndOfFrame()
+{
+  // Age the access masks, then issue (but don't wait for) the readback copies
+  // for any tiles which were peeked recently but are no longer valid. By the
+  // time the CPU peeks them again next frame, the copies will usually have
+  // completed, so the peek only pays for a flush instead of a full GPU round
+  // trip. Prefetching is limited to the tiled cache so a stray peek can't
+  // cause repeated full-EFB readbacks.
+  if (!IsUsingTiledEFBCache())
+    return;
+
+  const auto prefetch_tiles = [this](bool depth, EFBCacheData& data) {
+    for (u32 i = 0; i < static_cast<u32>(data.tiles.size()); i++)
+    {
+      EFBCacheTile& tile = data.tiles[i];
+      tile.frame_access_mask <<= 1;
+      if (tile.frame_access_mask != 0 && !(data.valid && tile.present))
+        PopulateEFBCache(depth, i, true);
+    }
+  };
+  prefetch_tiles(false, m_efb_color_cache);
+  prefetch_tiles(true, m_efb_depth_cache);
 }
 
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool clear_color,
@@ -748,9 +843,14 @@ void FramebufferManager::PokeEFBColor(u32 x, u32 y, u32 color)
     y = EFB_HEIGHT - 1 - y;
 
   // Update the peek cache if it's valid, since we know the color of the pixel now.
+  // Any in-flight prefetch copies have to complete first, or they would
+  // overwrite the value we're writing.
   u32 tile_index;
   if (IsEFBCacheTilePresent(false, x, y, &tile_index))
+  {
+    FlushEFBCacheCopies(m_efb_color_cache);
     m_efb_color_cache.readback_texture->WriteTexel(x, y, &color);
+  }
 }
 
 void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
@@ -766,9 +866,14 @@ void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
     y = EFB_HEIGHT - 1 - y;
 
   // Update the peek cache if it's valid, since we know the color of the pixel now.
+  // Any in-flight prefetch copies have to complete first, or they would
+  // overwrite the value we're writing.
   u32 tile_index;
   if (IsEFBCacheTilePresent(true, x, y, &tile_index))
+  {
+    FlushEFBCacheCopies(m_efb_depth_cache);
     m_efb_depth_cache.readback_texture->WriteTexel(x, y, &depth);
+  }
 }
 
 void FramebufferManager::CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x,
@@ -801,6 +906,9 @@ void FramebufferManager::CreatePokeVertices(std::vector<EFBPokeVertex>* destinat
 
 void FramebufferManager::FlushEFBPokes()
 {
+  if (!m_color_poke_vertices.empty() || !m_depth_poke_vertices.empty())
+    InvalidateResolvedTextures();
+
   if (!m_color_poke_vertices.empty())
   {
     DrawPokeVertices(m_color_poke_vertices.data(), static_cast<u32>(m_color_poke_vertices.size()),
@@ -929,6 +1037,7 @@ void FramebufferManager::DoLoadState(PointerWrap& p)
 {
   // Invalidate any peek cache tiles.
   InvalidatePeekCache(true);
+  InvalidateResolvedTextures();
 
   // Deserialize the color and depth textures. This could fail.
   auto color_tex = g_texture_cache->DeserializeTexture(p);
@@ -92,6 +92,15 @@ public:
   void InvalidatePeekCache(bool forced = true);
   void FlagPeekCacheAsOutOfDate();
 
+  // Called at the end of a frame. Issues the readback copies for any tiles that
+  // were peeked during recent frames but invalidated again, so that by the time
+  // the CPU peeks them next frame only the (usually already complete) flush is
+  // left to wait for, rather than a full copy + GPU round trip.
+  void EndOfFrame();
+
+  // Marks the MSAA resolve textures as no longer matching the EFB contents.
+  void InvalidateResolvedTextures();
+
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
   void PokeEFBColor(u32 x, u32 y, u32 color);
   void PokeEFBDepth(u32 x, u32 y, float depth);
@@ -110,13 +119,26 @@ protected:
 
   // EFB cache - for CPU EFB access
   // Tiles are ordered left-to-right, then top-to-bottom
+  struct EFBCacheTile
+  {
+    bool present;
+
+    // One bit per recent frame, bit 0 being the current one; shifted up at the
+    // end of every frame. A non-zero mask means the tile was peeked recently
+    // and is worth prefetching after the cache is invalidated.
+    u8 frame_access_mask;
+  };
   struct EFBCacheData
   {
     std::unique_ptr<AbstractTexture> texture;
     std::unique_ptr<AbstractFramebuffer> framebuffer;
     std::unique_ptr<AbstractStagingTexture> readback_texture;
     std::unique_ptr<AbstractPipeline> copy_pipeline;
-    std::vector<bool> tiles;
+    std::vector<EFBCacheTile> tiles;
+
+    // Set when copies have been issued to the readback texture without waiting
+    // for them; the flush is deferred until the data is actually needed.
+    bool needs_flush;
     bool out_of_date;
     bool valid;
   };
@@ -142,7 +164,8 @@ protected:
   bool IsUsingTiledEFBCache() const;
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
-  void PopulateEFBCache(bool depth, u32 tile_index);
+  void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void FlushEFBCacheCopies(EFBCacheData& data);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -159,6 +182,13 @@ protected:
   std::unique_ptr<AbstractTexture> m_efb_resolve_color_texture;
   std::unique_ptr<AbstractTexture> m_efb_depth_resolve_texture;
 
+  // The regions of the EFB that the resolve textures are known to match, so that a
+  // burst of EFB copies without rendering in between doesn't resolve repeatedly.
+  // Empty when the resolve textures are out of date.
+  MathUtil::Rectangle<int> m_efb_color_resolved_region = {};
+  MathUtil::Rectangle<int> m_efb_depth_resolved_region = {};
+  bool m_efb_depth_resolved_r32f = false;
+
   std::unique_ptr<AbstractFramebuffer> m_efb_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_convert_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_depth_resolve_framebuffer;
@@ -219,11 +219,18 @@ void FreeLookCamera::SetControlType(FreeLook::ControlType type)
   }
 
   m_current_type = type;
+  m_dirty = true;
+  m_view_dirty = true;
 }
 
 Common::Matrix44 FreeLookCamera::GetView()
 {
-  return m_camera_controller->GetView();
+  if (m_view_dirty)
+  {
+    m_view_mat = m_camera_controller->GetView();
+    m_view_dirty = false;
+  }
+  return m_view_mat;
 }
 
 Common::Vec2 FreeLookCamera::GetFieldOfView() const
@@ -235,42 +242,49 @@ void FreeLookCamera::MoveVertical(float amt)
 {
   m_camera_controller->MoveVertical(amt);
   m_dirty = true;
+  m_view_dirty = true;
 }
 
 void FreeLookCamera::MoveHorizontal(float amt)
 {
   m_camera_controller->MoveHorizontal(amt);
   m_dirty = true;
+  m_view_dirty = true;
 }
 
 void FreeLookCamera::MoveForward(float amt)
 {
   m_camera_controller->MoveForward(amt);
   m_dirty = true;
+  m_view_dirty = true;
 }
 
 void FreeLookCamera::Rotate(const Common::Vec3& amt)
 {
   m_camera_controller->Rotate(amt);
   m_dirty = true;
+  m_view_dirty = true;
 }
 
 void FreeLookCamera::Rotate(const Common::Quaternion& amt)
 {
   m_camera_controller->Rotate(amt);
   m_dirty = true;
+  m_view_dirty = true;
 }
 
 void FreeLookCamera::IncreaseFovX(float fov)
 {
   m_fov_x += fov;
   m_fov_x = std::clamp(m_fov_x, m_min_fov_multiplier, m_fov_x);
+  m_dirty = true;
 }
 
 void FreeLookCamera::IncreaseFovY(float fov)
 {
   m_fov_y += fov;
   m_fov_y = std::clamp(m_fov_y, m_min_fov_multiplier, m_fov_y);
+  m_dirty = true;
 }
 
 float FreeLookCamera::GetFovStepSize() const
@@ -284,6 +298,7 @@ void FreeLookCamera::Reset()
   m_fov_x = 1.0f;
   m_fov_y = 1.0f;
   m_dirty = true;
+  m_view_dirty = true;
 }
 
 void FreeLookCamera::ModifySpeed(float amt)
@@ -338,6 +353,12 @@ void FreeLookCamera::DoState(PointerWrap& p)
       p.SetMode(PointerWrap::MODE_VERIFY);
     }
   }
+
+  if (p.GetMode() == PointerWrap::MODE_READ)
+  {
+    m_dirty = true;
+    m_view_dirty = true;
+  }
 }
 
 bool FreeLookCamera::IsDirty() const
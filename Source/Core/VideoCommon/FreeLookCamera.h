@@ -72,6 +72,10 @@ public:
 
 private:
   bool m_dirty = false;
+  // The composed view matrix is cached so that idle frames don't recompose it on
+  // every projection change; m_view_dirty is set whenever the camera moves.
+  bool m_view_dirty = true;
+  Common::Matrix44 m_view_mat = Common::Matrix44::Identity();
   float m_fov_x = 1.0f;
   float m_fov_y = 1.0f;
   std::optional<FreeLook::ControlType> m_current_type;
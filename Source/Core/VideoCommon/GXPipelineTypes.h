@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstring>
+#include <functional>  // for hash
+
+#include "Common/Hash.h"
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
@@ -84,6 +88,32 @@ struct GXUberPipelineUid
   }
   bool operator!=(const GXUberPipelineUid& rhs) const { return !operator==(rhs); }
 };
+}  // namespace VideoCommon
+
+// As with the comparison operators, hashing the raw bytes is only safe because the
+// constructors zero the entire object, padding included.
+namespace std
+{
+template <>
+struct hash<VideoCommon::GXPipelineUid>
+{
+  size_t operator()(const VideoCommon::GXPipelineUid& uid) const
+  {
+    return Common::HashFletcher(reinterpret_cast<const u8*>(&uid), sizeof(uid));
+  }
+};
+template <>
+struct hash<VideoCommon::GXUberPipelineUid>
+{
+  size_t operator()(const VideoCommon::GXUberPipelineUid& uid) const
+  {
+    return Common::HashFletcher(reinterpret_cast<const u8*>(&uid), sizeof(uid));
+  }
+};
+}  // namespace std
+
+namespace VideoCommon
+{
 
 // Disk cache of pipeline UIDs. We can't use the whole UID as a type as it contains pointers.
 // This structure is safe to save to disk, and should be compiler/platform independent.
@@ -105,10 +105,12 @@ void GeometryShaderManager::SetTexCoordChanged(u8 texmapid)
 
 void GeometryShaderManager::DoState(PointerWrap& p)
 {
-  p.Do(s_projection_changed);
-  p.Do(s_viewport_changed);
-
-  p.Do(constants);
+  static const std::array<PointerWrap::StateRegion, 3> regions{
+      PointerWrap::MakeStateRegion(s_projection_changed),
+      PointerWrap::MakeStateRegion(s_viewport_changed),
+      PointerWrap::MakeStateRegion(constants),
+  };
+  p.DoRegions(regions);
 
   if (p.GetMode() == PointerWrap::MODE_READ)
   {
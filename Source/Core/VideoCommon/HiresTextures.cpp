@@ -4,6 +4,7 @@
 #include "VideoCommon/HiresTextures.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -23,6 +24,7 @@
 #include "Common/IOFile.h"
 #include "Common/Image.h"
 #include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
 #include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
@@ -37,6 +39,11 @@ struct DiskTexture
 {
   std::string path;
   bool has_arbitrary_mipmaps;
+  // Set when the texture lives inside an installed resource pack: a window into the
+  // memory-mapped pack file instead of a standalone file on disk.
+  std::shared_ptr<Common::MappedFile> pack;
+  u64 pack_offset = 0;
+  u64 pack_size = 0;
 };
 
 constexpr std::string_view s_format_prefix{"tex1_"};
@@ -53,6 +60,91 @@ void HiresTexture::Init()
   // Note: Update is not called here so that we handle dynamic textures on startup more gracefully
 }
 
+// Parses a ".texpack" index written by an extraction-free resource pack install. The first
+// line is "DTP1 <pack path>", each following line "<offset> <size> <path under textures/>",
+// with offset/size locating the stored entry's bytes inside the pack zip. Matching entries
+// for the current game are served straight out of the memory-mapped pack.
+static void LoadPackIndex(const std::string& index_path, const std::string& game_id,
+                          bool* failed_insert)
+{
+  std::string contents;
+  if (!File::ReadFileToString(index_path, contents))
+    return;
+
+  const std::vector<std::string> lines = SplitString(contents, '\n');
+  if (lines.empty() || lines[0].compare(0, 5, "DTP1 ") != 0)
+  {
+    ERROR_LOG_FMT(VIDEO, "Resource pack index '{}' has an unknown format", index_path);
+    return;
+  }
+
+  std::string pack_path = lines[0].substr(5);
+  if (!pack_path.empty() && pack_path.back() == '\r')
+    pack_path.pop_back();
+
+  std::shared_ptr<Common::MappedFile> pack = Common::MappedFile::Open(pack_path);
+  if (!pack)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to map resource pack '{}' for index '{}'", pack_path,
+                  index_path);
+    return;
+  }
+
+  const std::string region_free_id = game_id.substr(0, 3);
+
+  for (size_t i = 1; i < lines.size(); i++)
+  {
+    std::string line = lines[i];
+    if (!line.empty() && line.back() == '\r')
+      line.pop_back();
+    if (line.empty())
+      continue;
+
+    const size_t first_sep = line.find(' ');
+    const size_t second_sep = first_sep == std::string::npos ? std::string::npos :
+                                                               line.find(' ', first_sep + 1);
+    if (second_sep == std::string::npos)
+      continue;
+
+    u64 offset = 0;
+    u64 size = 0;
+    if (!TryParse(line.substr(0, first_sep), &offset) ||
+        !TryParse(line.substr(first_sep + 1, second_sep - first_sep - 1), &size))
+    {
+      continue;
+    }
+    if (size == 0 || offset > pack->Size() || size > pack->Size() - offset)
+      continue;
+
+    const std::string entry_path = line.substr(second_sep + 1);
+
+    // Only entries for the running game, mirroring how the texture directories are keyed by
+    // (possibly region-free) game id.
+    const size_t slash = entry_path.find('/');
+    if (slash == std::string::npos)
+      continue;
+    const std::string top_directory = entry_path.substr(0, slash);
+    if (top_directory != game_id && top_directory != region_free_id)
+      continue;
+
+    std::string filename;
+    SplitPath(entry_path, nullptr, &filename, nullptr);
+    if (filename.compare(0, s_format_prefix.length(), s_format_prefix) != 0)
+      continue;
+
+    const size_t arb_index = filename.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    const auto [it, inserted] = s_textureMap.try_emplace(
+        filename,
+        DiskTexture{pack_path + ":" + entry_path, has_arbitrary_mipmaps, pack, offset, size});
+    if (!inserted)
+      *failed_insert = true;
+  }
+}
+
 void HiresTexture::Shutdown()
 {
   Clear();
@@ -116,6 +208,21 @@ void HiresTexture::Update()
     }
   }
 
+  // Resource packs installed without extraction publish an index next to the texture
+  // directories instead of copies of their files.
+  const auto index_paths = Common::DoFileSearch({File::GetUserPath(D_HIRESTEXTURES_IDX)},
+                                                {".texpack"}, /*recursive*/ false);
+  for (const auto& index_path : index_paths)
+  {
+    bool failed_insert = false;
+    LoadPackIndex(index_path, game_id, &failed_insert);
+    if (failed_insert)
+    {
+      ERROR_LOG_FMT(VIDEO, "One or more textures in pack index '{}' were already inserted",
+                    index_path);
+    }
+  }
+
   if (g_ActiveConfig.bCacheHiresTextures)
   {
     // remove cached but deleted textures
@@ -152,20 +259,38 @@ void HiresTexture::Prefetch()
 {
   Common::SetCurrentThreadName("Prefetcher");
 
-  size_t size_sum = 0;
   const size_t sys_mem = Common::MemPhysical();
   const size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
   // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
   const size_t max_mem =
       (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
 
-  const u32 start_time = Common::Timer::GetTimeMs();
+  // Snapshot the work list; s_textureMap is not modified while the prefetcher is running.
+  std::vector<const std::string*> base_filenames;
   for (const auto& entry : s_textureMap)
   {
-    const std::string& base_filename = entry.first;
+    if (entry.first.find("_mip") == std::string::npos)
+      base_filenames.push_back(&entry.first);
+  }
+
+  std::atomic<size_t> next_index{0};
+  std::atomic<size_t> size_sum{0};
+  std::atomic<bool> out_of_memory{false};
 
-    if (base_filename.find("_mip") == std::string::npos)
+  const u32 start_time = Common::Timer::GetTimeMs();
+
+  // PNG and DDS decoding dominates prefetch time and parallelizes cleanly, so split the work
+  // list over a few decode threads. Each base name is claimed by exactly one worker, preserving
+  // the single-count-per-texture memory accounting of the old loop.
+  const auto worker_func = [&] {
+    Common::SetCurrentThreadName("Prefetcher Worker");
+    while (!s_textureCacheAbortLoading.IsSet() && !out_of_memory.load(std::memory_order_relaxed))
     {
+      const size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+      if (index >= base_filenames.size())
+        return;
+
+      const std::string& base_filename = *base_filenames[index];
       std::unique_lock<std::mutex> lk(s_textureCacheMutex);
 
       auto iter = s_textureCache.find(base_filename);
@@ -184,32 +309,41 @@ void HiresTexture::Prefetch()
       }
       if (iter != s_textureCache.end())
       {
+        size_t entry_size = 0;
         for (const Level& l : iter->second->m_levels)
-          size_sum += l.data.size();
+          entry_size += l.data.size();
+        if (size_sum.fetch_add(entry_size, std::memory_order_relaxed) + entry_size > max_mem)
+          out_of_memory.store(true, std::memory_order_relaxed);
       }
     }
+  };
 
-    if (s_textureCacheAbortLoading.IsSet())
-    {
-      return;
-    }
+  const size_t num_workers = std::min<size_t>(
+      4, std::max<size_t>(1, std::thread::hardware_concurrency() / 2));
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; i++)
+    workers.emplace_back(worker_func);
+  for (std::thread& worker : workers)
+    worker.join();
 
-    if (size_sum > max_mem)
-    {
-      Config::SetCurrent(Config::GFX_HIRES_TEXTURES, false);
-
-      OSD::AddMessage(
-          fmt::format(
-              "Custom Textures prefetching after {:.1f} MB aborted, not enough RAM available",
-              size_sum / (1024.0 * 1024.0)),
-          10000);
-      return;
-    }
+  if (out_of_memory.load(std::memory_order_relaxed))
+  {
+    Config::SetCurrent(Config::GFX_HIRES_TEXTURES, false);
+
+    OSD::AddMessage(
+        fmt::format("Custom Textures prefetching after {:.1f} MB aborted, not enough RAM available",
+                    size_sum.load() / (1024.0 * 1024.0)),
+        10000);
+    return;
   }
 
+  if (s_textureCacheAbortLoading.IsSet())
+    return;
+
   const u32 stop_time = Common::Timer::GetTimeMs();
   OSD::AddMessage(fmt::format("Custom Textures loaded, {:.1f} MB in {:.1f}s",
-                              size_sum / (1024.0 * 1024.0), (stop_time - start_time) / 1000.0),
+                              size_sum.load() / (1024.0 * 1024.0), (stop_time - start_time) / 1000.0),
                   10000);
 }
 
@@ -298,7 +432,15 @@ std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filenam
   std::unique_ptr<HiresTexture> ret = std::unique_ptr<HiresTexture>(new HiresTexture());
   const DiskTexture& first_mip_file = filename_iter->second;
   ret->m_has_arbitrary_mipmaps = first_mip_file.has_arbitrary_mipmaps;
-  LoadDDSTexture(ret.get(), first_mip_file.path);
+  if (first_mip_file.pack)
+  {
+    LoadDDSTexture(ret.get(), first_mip_file.pack->Data() + first_mip_file.pack_offset,
+                   first_mip_file.pack_size, first_mip_file.path);
+  }
+  else
+  {
+    LoadDDSTexture(ret.get(), first_mip_file.path);
+  }
 
   // Load remaining mip levels, or from the start if it's not a DDS texture.
   for (u32 mip_level = static_cast<u32>(ret->m_levels.size());; mip_level++)
@@ -313,20 +455,37 @@ std::unique_ptr<HiresTexture> HiresTexture::Load(const std::string& base_filenam
 
     // Try loading DDS textures first, that way we maintain compression of DXT formats.
     // TODO: Reduce the number of open() calls here. We could use one fd.
+    const DiskTexture& mip_file = filename_iter->second;
     Level level;
-    if (!LoadDDSTexture(level, filename_iter->second.path, mip_level))
+    bool loaded;
+    if (mip_file.pack)
     {
-      File::IOFile file;
-      file.Open(filename_iter->second.path, "rb");
-      std::vector<u8> buffer(file.GetSize());
-      file.ReadBytes(buffer.data(), file.GetSize());
-
-      if (!LoadTexture(level, buffer))
+      const u8* mip_data = mip_file.pack->Data() + mip_file.pack_offset;
+      loaded = LoadDDSTexture(level, mip_data, mip_file.pack_size, mip_file.path, mip_level);
+      if (!loaded)
+      {
+        const std::vector<u8> buffer(mip_data, mip_data + mip_file.pack_size);
+        loaded = LoadTexture(level, buffer);
+      }
+    }
+    else
+    {
+      loaded = LoadDDSTexture(level, mip_file.path, mip_level);
+      if (!loaded)
       {
-        ERROR_LOG_FMT(VIDEO, "Custom texture {} failed to load", filename);
-        break;
+        File::IOFile file;
+        file.Open(mip_file.path, "rb");
+        std::vector<u8> buffer(file.GetSize());
+        file.ReadBytes(buffer.data(), file.GetSize());
+
+        loaded = LoadTexture(level, buffer);
       }
     }
+    if (!loaded)
+    {
+      ERROR_LOG_FMT(VIDEO, "Custom texture {} failed to load", filename);
+      break;
+    }
 
     ret->m_levels.push_back(std::move(level));
   }
@@ -50,7 +50,11 @@ private:
   static std::unique_ptr<HiresTexture> Load(const std::string& base_filename, u32 width,
                                             u32 height);
   static bool LoadDDSTexture(HiresTexture* tex, const std::string& filename);
+  static bool LoadDDSTexture(HiresTexture* tex, const u8* data, size_t size,
+                             const std::string& name);
   static bool LoadDDSTexture(Level& level, const std::string& filename, u32 mip_level);
+  static bool LoadDDSTexture(Level& level, const u8* data, size_t size, const std::string& name,
+                             u32 mip_level);
   static bool LoadTexture(Level& level, const std::vector<u8>& buffer);
   static void Prefetch();
 
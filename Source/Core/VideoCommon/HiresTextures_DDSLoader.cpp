@@ -13,6 +13,7 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "VideoCommon/TextureTranscoding.h"
 #include "VideoCommon/VideoConfig.h"
 
 namespace
@@ -143,6 +144,9 @@ struct DDSLoadInfo
   u32 height = 0;
   u32 mip_count = 0;
   AbstractTextureFormat format = AbstractTextureFormat::RGBA8;
+  // When set, mip data is in a compressed format the backend can't consume and must be
+  // run through the CPU transcoder after reading.
+  AbstractTextureFormat transcode_format = AbstractTextureFormat::Undefined;
   size_t first_mip_offset = 0;
   size_t first_mip_size = 0;
   u32 first_mip_row_length = 0;
@@ -150,6 +154,37 @@ struct DDSLoadInfo
   std::function<void(HiresTexture::Level*)> conversion_function;
 };
 
+// Minimal File::IOFile-compatible reader over a memory buffer, so the parsing below can load
+// from memory-mapped resource pack entries as well as plain files.
+struct BufferReader
+{
+  BufferReader(const u8* data_, size_t size_) : data(data_), size(size_) {}
+
+  bool ReadBytes(void* out, size_t length)
+  {
+    if (length > size - pos)
+      return false;
+    std::memcpy(out, data + pos, length);
+    pos += length;
+    return true;
+  }
+
+  bool Seek(s64 offset, int origin)
+  {
+    // Only SEEK_SET is used here.
+    if (origin != SEEK_SET || offset < 0 || static_cast<size_t>(offset) > size)
+      return false;
+    pos = static_cast<size_t>(offset);
+    return true;
+  }
+
+  u64 GetSize() const { return size; }
+
+  const u8* data;
+  size_t size;
+  size_t pos = 0;
+};
+
 u32 GetBlockCount(u32 extent, u32 block_size)
 {
   return std::max(Common::AlignUp(extent, block_size) / block_size, 1u);
@@ -227,7 +262,8 @@ void ConvertTexture_R8G8B8(HiresTexture::Level* level)
   level->data = std::move(new_data);
 }
 
-bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
+template <typename ReaderType>
+bool ParseDDSHeader(ReaderType& file, DDSLoadInfo* info)
 {
   // Exit as early as possible for non-DDS textures, since all extensions are currently
   // passed through this function.
@@ -318,7 +354,11 @@ bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
       info->block_size = 4;
       info->bytes_per_block = 16;
       if (!g_ActiveConfig.backend_info.bSupportsBPTCTextures)
-        return false;
+      {
+        // Old drivers without BC7 support: transcode on the CPU instead of rejecting the
+        // file, so the same texture pack works across a mixed GPU fleet.
+        info->transcode_format = TextureTranscoding::GetTranscodeTargetForBPTC();
+      }
     }
     else
     {
@@ -400,7 +440,8 @@ bool ParseDDSHeader(File::IOFile& file, DDSLoadInfo* info)
   return true;
 }
 
-bool ReadMipLevel(HiresTexture::Level* level, File::IOFile& file, const std::string& filename,
+template <typename ReaderType>
+bool ReadMipLevel(HiresTexture::Level* level, ReaderType& file, const std::string& filename,
                   u32 mip_level, const DDSLoadInfo& info, u32 width, u32 height, u32 row_length,
                   size_t size)
 {
@@ -425,6 +466,19 @@ bool ReadMipLevel(HiresTexture::Level* level, File::IOFile& file, const std::str
   if (!file.ReadBytes(level->data.data(), level->data.size()))
     return false;
 
+  if (info.transcode_format != AbstractTextureFormat::Undefined)
+  {
+    std::vector<u8> transcoded = TextureTranscoding::TranscodeBPTC(
+        level->data.data(), level->data.size(), row_length, height, info.transcode_format);
+    if (transcoded.empty())
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to transcode mip {} of DDS texture {}.", mip_level, filename);
+      return false;
+    }
+    level->data = std::move(transcoded);
+    level->format = info.transcode_format;
+  }
+
   // Apply conversion function for uncompressed textures.
   if (info.conversion_function)
     info.conversion_function(level);
@@ -432,21 +486,15 @@ bool ReadMipLevel(HiresTexture::Level* level, File::IOFile& file, const std::str
   return true;
 }
 
-}  // namespace
-
-bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename)
+template <typename ReaderType>
+bool LoadDDSTextureFromReader(HiresTexture* tex, ReaderType& file, const std::string& filename)
 {
-  File::IOFile file;
-  file.Open(filename, "rb");
-  if (!file.IsOpen())
-    return false;
-
   DDSLoadInfo info;
   if (!ParseDDSHeader(file, &info))
     return false;
 
   // Read first mip level, as it may have a custom pitch.
-  Level first_level;
+  HiresTexture::Level first_level;
   if (!file.Seek(info.first_mip_offset, SEEK_SET) ||
       !ReadMipLevel(&first_level, file, filename, 0, info, info.width, info.height,
                     info.first_mip_row_length, info.first_mip_size))
@@ -470,7 +518,7 @@ bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename
     u32 blocks_high = GetBlockCount(mip_height, info.block_size);
     u32 mip_row_length = blocks_wide * info.block_size;
     size_t mip_size = blocks_wide * static_cast<size_t>(info.bytes_per_block) * blocks_high;
-    Level level;
+    HiresTexture::Level level;
     if (!ReadMipLevel(&level, file, filename, i, info, mip_width, mip_height, mip_row_length,
                       mip_size))
       break;
@@ -481,18 +529,51 @@ bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename
   return true;
 }
 
-bool HiresTexture::LoadDDSTexture(Level& level, const std::string& filename, u32 mip_level)
+template <typename ReaderType>
+bool LoadDDSLevelFromReader(HiresTexture::Level& level, ReaderType& file,
+                            const std::string& filename, u32 mip_level)
 {
   // Only loading a single mip level.
+  DDSLoadInfo info;
+  if (!ParseDDSHeader(file, &info))
+    return false;
+
+  return ReadMipLevel(&level, file, filename, mip_level, info, info.width, info.height,
+                      info.first_mip_row_length, info.first_mip_size);
+}
+
+}  // namespace
+
+bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const std::string& filename)
+{
   File::IOFile file;
   file.Open(filename, "rb");
   if (!file.IsOpen())
     return false;
 
-  DDSLoadInfo info;
-  if (!ParseDDSHeader(file, &info))
+  return LoadDDSTextureFromReader(tex, file, filename);
+}
+
+bool HiresTexture::LoadDDSTexture(HiresTexture* tex, const u8* data, size_t size,
+                                  const std::string& name)
+{
+  BufferReader file(data, size);
+  return LoadDDSTextureFromReader(tex, file, name);
+}
+
+bool HiresTexture::LoadDDSTexture(Level& level, const std::string& filename, u32 mip_level)
+{
+  File::IOFile file;
+  file.Open(filename, "rb");
+  if (!file.IsOpen())
     return false;
 
-  return ReadMipLevel(&level, file, filename, mip_level, info, info.width, info.height,
-                      info.first_mip_row_length, info.first_mip_size);
+  return LoadDDSLevelFromReader(level, file, filename, mip_level);
+}
+
+bool HiresTexture::LoadDDSTexture(Level& level, const u8* data, size_t size,
+                                  const std::string& name, u32 mip_level)
+{
+  BufferReader file(data, size);
+  return LoadDDSLevelFromReader(level, file, name, mip_level);
 }
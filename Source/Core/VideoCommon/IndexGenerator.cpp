@@ -8,6 +8,7 @@
 #include <cstring>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VideoConfig.h"
@@ -27,10 +28,57 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
   return index_ptr;
 }
 
+#if defined(_M_X86)
+// Emits eight indices at once. Every generated index is base + a small
+// pattern offset, so a block is one splat + add; restart lanes are forced
+// to 0xFFFF by the OR with the mask. Callers only use whole blocks, so
+// nothing past the returned pointer is written.
+u16* WriteBlock(u16* index_ptr, u32 base, const __m128i& offsets, const __m128i& restart_mask)
+{
+  const __m128i indices =
+      _mm_or_si128(_mm_add_epi16(_mm_set1_epi16(static_cast<s16>(base)), offsets), restart_mask);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), indices);
+  return index_ptr + 8;
+}
+#endif
+
+// Writes index + 0, index + 1, ..., index + count - 1.
+u16* WriteIota(u16* index_ptr, u32 index, u32 count)
+{
+  u32 i = 0;
+#if defined(_M_X86)
+  __m128i indices = _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(index)),
+                                  _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7));
+  const __m128i step = _mm_set1_epi16(8);
+  for (; i + 8 <= count; i += 8)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), indices);
+    indices = _mm_add_epi16(indices, step);
+    index_ptr += 8;
+  }
+#endif
+  for (; i < count; ++i)
+    *index_ptr++ = index + i;
+  return index_ptr;
+}
+
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  u32 i = 2;
+  if constexpr (!pr)
+  {
+    // Without restarts a triangle list is simply consecutive indices.
+    return WriteIota(index_ptr, index, num_verts / 3 * 3);
+  }
+#if defined(_M_X86)
+  // Two triangles (and their restarts) per block.
+  const __m128i offsets = _mm_setr_epi16(0, 1, 2, 0, 3, 4, 5, 0);
+  const __m128i restart_mask = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+  for (; i + 4 <= num_verts; i += 6)
+    index_ptr = WriteBlock(index_ptr, index + i - 2, offsets, restart_mask);
+#endif
+  for (; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -42,16 +90,29 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
-    {
-      *index_ptr++ = index + i;
-    }
+    index_ptr = WriteIota(index_ptr, index, num_verts);
     *index_ptr++ = s_primitive_restart;
   }
   else
   {
+    u32 i = 2;
+#if defined(_M_X86)
+    // Eight triangles (24 indices) per iteration; the patterns bake in the
+    // alternating winding, so the scalar tail always resumes unwound.
+    const __m128i offsets0 = _mm_setr_epi16(0, 1, 2, 1, 3, 2, 2, 3);
+    const __m128i offsets1 = _mm_setr_epi16(4, 3, 5, 4, 4, 5, 6, 5);
+    const __m128i offsets2 = _mm_setr_epi16(7, 6, 6, 7, 8, 7, 9, 8);
+    const __m128i no_restart = _mm_setzero_si128();
+    for (; i + 8 <= num_verts; i += 8)
+    {
+      const u32 base = index + i - 2;
+      index_ptr = WriteBlock(index_ptr, base, offsets0, no_restart);
+      index_ptr = WriteBlock(index_ptr, base, offsets1, no_restart);
+      index_ptr = WriteBlock(index_ptr, base, offsets2, no_restart);
+    }
+#endif
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -135,6 +196,46 @@ template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
   u32 i = 3;
+#if defined(_M_X86)
+  if constexpr (pr)
+  {
+    // Eight quads (40 indices including restarts) per iteration.
+    const __m128i offsets0 = _mm_setr_epi16(1, 2, 0, 3, 0, 5, 6, 4);
+    const __m128i offsets1 = _mm_setr_epi16(7, 0, 9, 10, 8, 11, 0, 13);
+    const __m128i offsets2 = _mm_setr_epi16(14, 12, 15, 0, 17, 18, 16, 19);
+    const __m128i offsets3 = _mm_setr_epi16(0, 21, 22, 20, 23, 0, 25, 26);
+    const __m128i offsets4 = _mm_setr_epi16(24, 27, 0, 29, 30, 28, 31, 0);
+    const __m128i restart_mask0 = _mm_setr_epi16(0, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i restart_mask1 = _mm_setr_epi16(0, -1, 0, 0, 0, 0, -1, 0);
+    const __m128i restart_mask2 = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, 0);
+    const __m128i restart_mask3 = _mm_setr_epi16(-1, 0, 0, 0, 0, -1, 0, 0);
+    const __m128i restart_mask4 = _mm_setr_epi16(0, 0, -1, 0, 0, 0, 0, -1);
+    for (; i + 28 < num_verts; i += 32)
+    {
+      const u32 base = index + i - 3;
+      index_ptr = WriteBlock(index_ptr, base, offsets0, restart_mask0);
+      index_ptr = WriteBlock(index_ptr, base, offsets1, restart_mask1);
+      index_ptr = WriteBlock(index_ptr, base, offsets2, restart_mask2);
+      index_ptr = WriteBlock(index_ptr, base, offsets3, restart_mask3);
+      index_ptr = WriteBlock(index_ptr, base, offsets4, restart_mask4);
+    }
+  }
+  else
+  {
+    // Four quads (24 indices) per iteration.
+    const __m128i offsets0 = _mm_setr_epi16(0, 1, 2, 0, 2, 3, 4, 5);
+    const __m128i offsets1 = _mm_setr_epi16(6, 4, 6, 7, 8, 9, 10, 8);
+    const __m128i offsets2 = _mm_setr_epi16(10, 11, 12, 13, 14, 12, 14, 15);
+    const __m128i no_restart = _mm_setzero_si128();
+    for (; i + 12 < num_verts; i += 16)
+    {
+      const u32 base = index + i - 3;
+      index_ptr = WriteBlock(index_ptr, base, offsets0, no_restart);
+      index_ptr = WriteBlock(index_ptr, base, offsets1, no_restart);
+      index_ptr = WriteBlock(index_ptr, base, offsets2, no_restart);
+    }
+  }
+#endif
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -192,11 +293,7 @@ u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
-  {
-    *index_ptr++ = index + i;
-  }
-  return index_ptr;
+  return WriteIota(index_ptr, index, num_verts);
 }
 }  // Anonymous namespace
 
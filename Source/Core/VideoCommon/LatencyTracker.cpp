@@ -0,0 +1,124 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/LatencyTracker.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/Timer.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace LatencyTracker
+{
+namespace
+{
+// Frames in flight between Video_BeginField on the CPU thread and Renderer::Swap on the video
+// thread. Anything beyond this means the threads have drifted apart and old entries are stale.
+constexpr size_t MAX_PENDING_FRAMES = 8;
+// ~4 seconds at 60 fps; percentiles are computed over this window.
+constexpr size_t SAMPLE_WINDOW = 240;
+constexpr size_t MIN_SAMPLES_FOR_PERCENTILES = 30;
+// One log line roughly every 2 seconds at 60 fps.
+constexpr u32 LOG_SAMPLE_INTERVAL = 120;
+
+// Written by the CPU thread at every SI poll, read when a frame is issued or presented.
+std::atomic<u64> s_last_input_poll_us{0};
+
+std::mutex s_mutex;
+// Input timestamps of the frames issued to the backend but not yet presented.
+std::deque<u64> s_pending_frames;
+// Circular window of recent latency samples, in milliseconds.
+std::array<double, SAMPLE_WINDOW> s_samples;
+size_t s_sample_count = 0;
+size_t s_sample_index = 0;
+u32 s_samples_since_log = 0;
+}  // Anonymous namespace
+
+void OnInputPolled()
+{
+  if (!g_ActiveConfig.bShowInputLatency)
+    return;
+
+  s_last_input_poll_us.store(Common::Timer::GetTimeUs(), std::memory_order_relaxed);
+}
+
+void OnFrameIssued()
+{
+  if (!g_ActiveConfig.bShowInputLatency)
+    return;
+
+  const u64 input_time = s_last_input_poll_us.load(std::memory_order_relaxed);
+  if (input_time == 0)
+    return;
+
+  std::lock_guard lock(s_mutex);
+  if (s_pending_frames.size() >= MAX_PENDING_FRAMES)
+    s_pending_frames.pop_front();
+  s_pending_frames.push_back(input_time);
+}
+
+void OnFramePresented()
+{
+  if (!g_ActiveConfig.bShowInputLatency)
+    return;
+
+  const u64 now = Common::Timer::GetTimeUs();
+  double p50, p95, p99;
+  {
+    std::lock_guard lock(s_mutex);
+
+    u64 input_time;
+    if (!s_pending_frames.empty())
+    {
+      input_time = s_pending_frames.front();
+      s_pending_frames.pop_front();
+    }
+    else
+    {
+      // Immediate XFB presents from the video thread without a Video_BeginField on the CPU
+      // thread; fall back to the most recent poll.
+      input_time = s_last_input_poll_us.load(std::memory_order_relaxed);
+    }
+    if (input_time == 0 || now <= input_time)
+      return;
+
+    s_samples[s_sample_index] = static_cast<double>(now - input_time) / 1000.0;
+    s_sample_index = (s_sample_index + 1) % SAMPLE_WINDOW;
+    s_sample_count = std::min(s_sample_count + 1, SAMPLE_WINDOW);
+
+    if (++s_samples_since_log < LOG_SAMPLE_INTERVAL)
+      return;
+    s_samples_since_log = 0;
+  }
+
+  if (GetPercentiles(&p50, &p95, &p99))
+  {
+    INFO_LOG_FMT(VIDEO, "Input-to-present latency: p50 {:.1f} ms, p95 {:.1f} ms, p99 {:.1f} ms",
+                 p50, p95, p99);
+  }
+}
+
+bool GetPercentiles(double* p50, double* p95, double* p99)
+{
+  std::vector<double> sorted;
+  {
+    std::lock_guard lock(s_mutex);
+    if (s_sample_count < MIN_SAMPLES_FOR_PERCENTILES)
+      return false;
+    sorted.assign(s_samples.begin(), s_samples.begin() + s_sample_count);
+  }
+
+  std::sort(sorted.begin(), sorted.end());
+  *p50 = sorted[sorted.size() * 50 / 100];
+  *p95 = sorted[sorted.size() * 95 / 100];
+  *p99 = sorted[sorted.size() * 99 / 100];
+  return true;
+}
+}  // namespace LatencyTracker
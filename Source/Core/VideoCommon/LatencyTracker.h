@@ -0,0 +1,25 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Input-to-present latency instrumentation (ShowInputLatency): timestamps host input refreshes
+// at the SI poll, carries them through the frame issued to the video backend, and records the
+// elapsed host time when that frame is presented. Covers the whole input-to-photon chain short
+// of display scanout, the same way FPSCounter covers only the frame rate. All hooks are cheap
+// no-ops while the setting is disabled.
+namespace LatencyTracker
+{
+// Called from the CPU thread each time the host input state is refreshed for an SI poll.
+void OnInputPolled();
+
+// Called from the CPU thread when a finished field is pushed to the video backend.
+void OnFrameIssued();
+
+// Called from the video thread after a (non-duplicate) frame was presented.
+void OnFramePresented();
+
+// Latency percentiles over the recent sample window, in milliseconds.
+// Returns false until enough samples have been collected.
+bool GetPercentiles(double* p50, double* p95, double* p99);
+}  // namespace LatencyTracker
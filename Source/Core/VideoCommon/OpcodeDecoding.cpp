@@ -105,8 +105,19 @@ u8* Run(DataReader src, u32* cycles, bool in_display_list)
     switch (cmd_byte)
     {
     case GX_NOP:
-      total_cycles += 6;  // Hm, this means that we scan over nop streams pretty slowly...
-      break;
+    {
+      // Display lists and the FIFO are typically padded to 32-byte boundaries with
+      // runs of NOPs, so consume the whole run at once instead of going through the
+      // decode loop (and, when recording, the recorder) once per byte.
+      u32 run_length = 1;
+      while (src.size() > 0 && src.Peek<u8>() == GX_NOP)
+      {
+        src.Skip<u8>();
+        run_length++;
+      }
+      total_cycles += 6 * run_length;
+    }
+    break;
 
     case GX_UNKNOWN_RESET:
       total_cycles += 6;  // Datel software uses this command
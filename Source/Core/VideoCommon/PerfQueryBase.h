@@ -28,6 +28,17 @@ enum PerfQueryGroup
   PQG_NUM_MEMBERS,
 };
 
+// Host-side GPU passes that can be timed with backend timestamp queries.
+// Passes must not nest or overlap - some backends (OpenGL) only support a
+// single elapsed-time query at a time.
+enum GPUTimingPass
+{
+  GPU_TIMING_EFB_COPY = 0,
+  GPU_TIMING_POST_PROCESS,
+  GPU_TIMING_PRESENT,
+  GPU_TIMING_NUM_PASSES
+};
+
 class PerfQueryBase
 {
 public:
@@ -62,6 +73,20 @@ public:
   // NOTE: Called from CPU thread
   virtual bool IsFlushed() const { return true; }
 
+  // True if the backend can measure host GPU pass durations.
+  virtual bool SupportsGPUTiming() const { return false; }
+
+  // Brackets the host GPU commands making up the given pass. Must be called on
+  // the GPU thread, and passes must not nest (see GPUTimingPass).
+  virtual void BeginGPUTiming(GPUTimingPass pass) {}
+  virtual void EndGPUTiming(GPUTimingPass pass) {}
+
+  // Returns a smoothed duration of recently completed instances of the given
+  // pass in nanoseconds, without stalling. Results typically lag a frame or
+  // two behind the commands they measure.
+  // NOTE: Called from GPU thread (statistics overlay)
+  virtual u64 GetGPUPassTimeNs(GPUTimingPass pass) { return 0; }
+
 protected:
   std::atomic<u32> m_query_count;
   std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_results;
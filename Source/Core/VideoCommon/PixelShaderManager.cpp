@@ -519,12 +519,16 @@ void PixelShaderManager::SetBoundingBoxActive(bool active)
 
 void PixelShaderManager::DoState(PointerWrap& p)
 {
-  p.Do(s_bFogRangeAdjustChanged);
-  p.Do(s_bViewPortChanged);
-  p.Do(s_bIndirectDirty);
-  p.Do(s_bDestAlphaDirty);
-
-  p.Do(constants);
+  // Built once; every savestate pass then walks the flat table instead of doing a mode
+  // dispatch per field.
+  static const std::array<PointerWrap::StateRegion, 5> regions{
+      PointerWrap::MakeStateRegion(s_bFogRangeAdjustChanged),
+      PointerWrap::MakeStateRegion(s_bViewPortChanged),
+      PointerWrap::MakeStateRegion(s_bIndirectDirty),
+      PointerWrap::MakeStateRegion(s_bDestAlphaDirty),
+      PointerWrap::MakeStateRegion(constants),
+  };
+  p.DoRegions(regions);
 
   if (p.GetMode() == PointerWrap::MODE_READ)
   {
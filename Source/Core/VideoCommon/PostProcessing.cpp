@@ -429,9 +429,39 @@ void PostProcessing::BlitFromTexture(const MathUtil::Rectangle<int>& dst,
   g_renderer->SetPipeline(m_pipeline.get());
   g_renderer->SetTexture(0, src_tex);
   g_renderer->SetSamplerState(0, RenderState::GetLinearSamplerState());
+  if (m_requires_previous_frame)
+  {
+    // Before the first frame has been captured, sample the current frame instead so the
+    // shader never reads an undefined texture.
+    g_renderer->SetTexture(1, m_previous_frame_valid ? m_previous_frame.get() : src_tex);
+    g_renderer->SetSamplerState(1, RenderState::GetLinearSamplerState());
+  }
   g_renderer->Draw(0, 3);
 }
 
+void PostProcessing::UpdatePreviousFrame(const AbstractTexture* src_tex)
+{
+  if (!m_requires_previous_frame)
+    return;
+
+  const TextureConfig frame_config(src_tex->GetWidth(), src_tex->GetHeight(), 1,
+                                   src_tex->GetLayers(), 1, src_tex->GetFormat(), 0);
+  if (!m_previous_frame || m_previous_frame->GetConfig() != frame_config)
+  {
+    m_previous_frame_valid = false;
+    m_previous_frame = g_renderer->CreateTexture(frame_config);
+    if (!m_previous_frame)
+      return;
+  }
+
+  const MathUtil::Rectangle<int> copy_rect(0, 0, static_cast<int>(src_tex->GetWidth()),
+                                           static_cast<int>(src_tex->GetHeight()));
+  for (u32 layer = 0; layer < frame_config.layers; layer++)
+    m_previous_frame->CopyRectangleFromTexture(src_tex, copy_rect, layer, 0, copy_rect, layer, 0);
+  m_previous_frame->FinishedRendering();
+  m_previous_frame_valid = true;
+}
+
 std::string PostProcessing::GetUniformBufferHeader() const
 {
   std::ostringstream ss;
@@ -447,8 +477,8 @@ std::string PostProcessing::GetUniformBufferHeader() const
   ss << "  float4 src_rect;\n";
   ss << "  int src_layer;\n";
   ss << "  uint time;\n";
-  for (u32 i = 0; i < 2; i++)
-    ss << "  uint ubo_align_" << unused_counter++ << "_;\n";
+  ss << "  int prev_frame_available;\n";
+  ss << "  uint ubo_align_" << unused_counter++ << "_;\n";
   ss << "\n";
 
   // Custom options/uniforms
@@ -499,10 +529,13 @@ std::string PostProcessing::GetHeader() const
   {
     ss << "Texture2DArray samp0 : register(t0);\n";
     ss << "SamplerState samp0_ss : register(s0);\n";
+    ss << "Texture2DArray samp1 : register(t1);\n";
+    ss << "SamplerState samp1_ss : register(s1);\n";
   }
   else
   {
     ss << "SAMPLER_BINDING(0) uniform sampler2DArray samp0;\n";
+    ss << "SAMPLER_BINDING(1) uniform sampler2DArray samp1;\n";
 
     if (g_ActiveConfig.backend_info.bSupportsGeometryShaders)
     {
@@ -538,6 +571,15 @@ float4 SampleLocation(float2 location) { return texture(samp0, float3(location,
 float4 SampleLayer(int layer) { return texture(samp0, float3(v_tex0.xy, float(layer))); }
 #define SampleOffset(offset) textureOffset(samp0, v_tex0, offset)
 
+// The previously-presented frame; only valid when PreviousFrameAvailable() returns true,
+// which requires the shader source to reference SamplePrevious.
+float4 SamplePrevious() { return texture(samp1, v_tex0); }
+float4 SamplePreviousLocation(float2 location)
+{
+  return texture(samp1, float3(location, float(v_tex0.z)));
+}
+#define PreviousFrameAvailable() (prev_frame_available != 0)
+
 float2 GetWindowResolution()
 {
   return window_resolution.xy;
@@ -658,7 +700,8 @@ struct BuiltinUniforms
   float src_rect[4];
   s32 src_layer;
   u32 time;
-  u32 padding[2];
+  s32 prev_frame_available;
+  u32 padding;
 };
 
 size_t PostProcessing::CalculateUniformsSize() const
@@ -684,6 +727,7 @@ void PostProcessing::FillUniformBuffer(const MathUtil::Rectangle<int>& src,
        static_cast<float>(src.GetHeight()) * rcp_src_height},
       static_cast<s32>(src_layer),
       static_cast<u32>(m_timer.GetTimeElapsed()),
+      (m_requires_previous_frame && m_previous_frame_valid) ? 1 : 0,
   };
 
   u8* buf = m_uniform_staging_buffer.data();
@@ -744,6 +788,14 @@ bool PostProcessing::CompilePixelShader()
       return false;
   }
 
+  // Only shaders that actually sample the previous frame pay for the per-present copy.
+  m_requires_previous_frame = m_config.GetShaderCode().find("SamplePrevious") != std::string::npos;
+  if (!m_requires_previous_frame)
+  {
+    m_previous_frame.reset();
+    m_previous_frame_valid = false;
+  }
+
   m_uniform_staging_buffer.resize(CalculateUniformsSize());
   return true;
 }
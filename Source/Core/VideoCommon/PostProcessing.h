@@ -107,6 +107,11 @@ public:
   void BlitFromTexture(const MathUtil::Rectangle<int>& dst, const MathUtil::Rectangle<int>& src,
                        const AbstractTexture* src_tex, int src_layer);
 
+  // Called once per presented frame, after all BlitFromTexture() calls for it. Keeps a copy
+  // of the frame for shaders that sample the previous frame (e.g. frame blending for
+  // high-refresh displays); does nothing when the current shader doesn't use it.
+  void UpdatePreviousFrame(const AbstractTexture* src_tex);
+
 protected:
   std::string GetUniformBufferHeader() const;
   std::string GetHeader() const;
@@ -129,5 +134,11 @@ protected:
   std::unique_ptr<AbstractPipeline> m_pipeline;
   AbstractTextureFormat m_framebuffer_format = AbstractTextureFormat::Undefined;
   std::vector<u8> m_uniform_staging_buffer;
+
+  // Copy of the last presented frame, only maintained while the current shader
+  // samples it (m_requires_previous_frame).
+  std::unique_ptr<AbstractTexture> m_previous_frame;
+  bool m_requires_previous_frame = false;
+  bool m_previous_frame_valid = false;
 };
 }  // namespace VideoCommon
@@ -0,0 +1,134 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PresentScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "Common/Timer.h"
+#include "VideoCommon/VideoConfig.h"
+
+// Plausible range for a display refresh period (about 24Hz to 250Hz). Present intervals
+// outside of this range are treated as stalls and ignored.
+constexpr u32 MIN_REFRESH_PERIOD_US = 4000;
+constexpr u32 MAX_REFRESH_PERIOD_US = 42000;
+
+// Finish sleeping this much before the target vblank to leave room for the present call itself.
+constexpr u64 WAKE_MARGIN_US = 500;
+
+bool PresentScheduler::Active() const
+{
+  return g_ActiveConfig.bVSyncActive && g_ActiveConfig.bVSyncFramePacing;
+}
+
+void PresentScheduler::Reset()
+{
+  m_interval_index = 0;
+  m_interval_count = 0;
+  m_last_schedule_time_us = 0;
+  m_last_present_time_us = 0;
+  m_injected_sleep_us = 0;
+  m_refresh_period_us = 0.0;
+  m_cadence_ema_us = 0.0;
+  m_multiplier = 1;
+}
+
+void PresentScheduler::ScheduleBeforePresent()
+{
+  if (!Active())
+  {
+    Reset();
+    return;
+  }
+
+  const u64 now = Common::Timer::GetTimeUs();
+  if (m_last_schedule_time_us != 0)
+  {
+    // Estimate the source cadence from the arrival interval, compensating for the delay we
+    // injected into the previous frame so that pacing doesn't mask a recovering emulation
+    // speed.
+    const u64 raw_interval = now - m_last_schedule_time_us;
+    if (raw_interval > MAX_REFRESH_PERIOD_US * MAX_MULTIPLIER)
+    {
+      // Stall (pause, shader compilation, ...), start over.
+      Reset();
+    }
+    else
+    {
+      const double interval =
+          static_cast<double>(raw_interval) - std::min<u64>(raw_interval, m_injected_sleep_us);
+      m_cadence_ema_us = m_cadence_ema_us == 0.0 ? interval :
+                                                   m_cadence_ema_us * 0.9 + interval * 0.1;
+    }
+  }
+  m_last_schedule_time_us = now;
+  m_injected_sleep_us = 0;
+
+  // Don't pace until the refresh period estimate has settled.
+  if (m_interval_count < WINDOW_SIZE || m_refresh_period_us == 0.0 || m_cadence_ema_us == 0.0)
+  {
+    m_multiplier = 1;
+    return;
+  }
+
+  // Slower-than-refresh cadences are rounded up to the next integer multiple of the refresh
+  // period, with some hysteresis so the multiplier doesn't flap around the thresholds.
+  const double ratio = m_cadence_ema_us / m_refresh_period_us;
+  const double enter_threshold = m_multiplier > 1 ? 1.05 : 1.15;
+  u32 desired = 1;
+  if (ratio >= enter_threshold)
+  {
+    desired = std::min(MAX_MULTIPLIER,
+                       std::max<u32>(2, static_cast<u32>(std::ceil(ratio - 0.1))));
+  }
+  m_multiplier = desired;
+
+  if (m_multiplier > 1 && m_last_present_time_us != 0)
+  {
+    const u64 target = m_last_present_time_us +
+                       static_cast<u64>(m_refresh_period_us) * m_multiplier - WAKE_MARGIN_US;
+    if (now < target)
+    {
+      m_injected_sleep_us = target - now;
+      std::this_thread::sleep_for(std::chrono::microseconds(m_injected_sleep_us));
+    }
+  }
+}
+
+void PresentScheduler::NotifyPresentComplete()
+{
+  if (!Active())
+    return;
+
+  const u64 now = Common::Timer::GetTimeUs();
+  const u64 last = m_last_present_time_us;
+  m_last_present_time_us = now;
+  if (last == 0)
+    return;
+
+  const u64 interval = now - last;
+  if (interval < MIN_REFRESH_PERIOD_US || interval > MAX_REFRESH_PERIOD_US * MAX_MULTIPLIER)
+    return;
+
+  // While presents are being delayed every interval is a multiple of the refresh period, which
+  // would drag the minimum-based estimate upwards, so only sample at the native cadence.
+  if (m_multiplier != 1)
+    return;
+
+  m_present_intervals_us[m_interval_index] = static_cast<u32>(interval);
+  m_interval_index = (m_interval_index + 1) % WINDOW_SIZE;
+  m_interval_count = std::min(m_interval_count + 1, WINDOW_SIZE);
+
+  if (m_interval_count == WINDOW_SIZE)
+  {
+    // With vsync on, blocking presents complete an integer number of refresh periods apart, so
+    // the smallest interval in the window approximates the refresh period itself.
+    const u32 shortest =
+        *std::min_element(m_present_intervals_us.begin(), m_present_intervals_us.end());
+    if (shortest >= MIN_REFRESH_PERIOD_US && shortest <= MAX_REFRESH_PERIOD_US)
+      m_refresh_period_us = static_cast<double>(shortest);
+  }
+}
@@ -0,0 +1,50 @@
+// Copyright 2022 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Common/CommonTypes.h"
+
+// Paces presents against the display clock when vsync is enabled. When emulation runs slightly
+// behind the display refresh rate, presenting each XFB as soon as it arrives makes the blocking
+// present alternate between one and two refresh intervals (16.6/33.3ms on a 60Hz display). This
+// scheduler estimates the refresh period from present completion times and, while the source
+// cadence is slower than the display, delays presents to a constant integer multiple of the
+// refresh period instead.
+//
+// The display clock is derived from how long vsynced presents block; none of our backends
+// currently expose compositor timestamps (VK_GOOGLE_display_timing / DXGI frame statistics),
+// and this needs no backend support.
+class PresentScheduler
+{
+public:
+  // Called on the video thread right before the backbuffer is presented. May sleep to align
+  // the present with the display cadence.
+  void ScheduleBeforePresent();
+
+  // Called right after the present call returns.
+  void NotifyPresentComplete();
+
+private:
+  bool Active() const;
+  void Reset();
+
+  // Number of present intervals used for the refresh period estimate.
+  static constexpr size_t WINDOW_SIZE = 32;
+  // Presents are never delayed beyond this many refresh periods.
+  static constexpr u32 MAX_MULTIPLIER = 4;
+
+  std::array<u32, WINDOW_SIZE> m_present_intervals_us{};
+  size_t m_interval_index = 0;
+  size_t m_interval_count = 0;
+
+  u64 m_last_schedule_time_us = 0;
+  u64 m_last_present_time_us = 0;
+  u64 m_injected_sleep_us = 0;
+  double m_refresh_period_us = 0.0;
+  double m_cadence_ema_us = 0.0;
+  u32 m_multiplier = 1;
+};
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
 
@@ -34,10 +35,13 @@
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Profiler.h"
+#include "Common/SharedMemoryExport.h"
 #include "Common/StringUtil.h"
 #include "Common/Thread.h"
 #include "Common/Timer.h"
+#include "Common/Tracing.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/Config/NetplaySettings.h"
 #include "Core/Config/SYSCONFSettings.h"
 #include "Core/ConfigManager.h"
@@ -49,6 +53,7 @@
 #include "Core/HW/VideoInterface.h"
 #include "Core/Host.h"
 #include "Core/Movie.h"
+#include "Core/PerformanceFlightRecorder.h"
 
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 
@@ -60,6 +65,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/FPSCounter.h"
+#include "VideoCommon/LatencyTracker.h"
 #include "VideoCommon/FrameDump.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
@@ -68,6 +74,7 @@
 #include "VideoCommon/NetPlayGolfUI.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/PostProcessing.h"
@@ -146,7 +153,10 @@ void Renderer::BeginUtilityDrawing()
 
 void Renderer::EndUtilityDrawing()
 {
-  // Reset framebuffer/scissor/viewport. Pipeline will be reset at next draw.
+  // Reset framebuffer/scissor/viewport. The utility draw may have bound over the GX pipeline
+  // and texture bindings, so forget them; they will be re-bound at the next draw.
+  g_vertex_manager->InvalidateBoundPipeline();
+  g_texture_cache->InvalidateBackendBindings();
   g_framebuffer_manager->BindEFBFramebuffer();
   BPFunctions::SetScissor();
   BPFunctions::SetViewport();
@@ -189,7 +199,18 @@ u16 Renderer::BBoxRead(int index)
   if (!g_ActiveConfig.bBBoxEnable || !g_ActiveConfig.backend_info.bSupportsBBox)
     return m_bounding_box_fallback[index];
 
-  return BBoxReadImpl(index);
+  // Games read the four bounding box registers as a burst, and each backend read
+  // drains the GPU pipeline. Read all coordinates on the first access and serve
+  // the rest of the burst from the cache; BBoxFlush invalidates it before any
+  // bounding-box-enabled batch is drawn.
+  if (!m_bounding_box_cached)
+  {
+    for (size_t i = 0; i < m_bounding_box_cache.size(); i++)
+      m_bounding_box_cache[i] = BBoxReadImpl(static_cast<int>(i));
+    m_bounding_box_cached = true;
+  }
+
+  return m_bounding_box_cache[index];
 }
 
 void Renderer::BBoxWrite(int index, u16 value)
@@ -200,11 +221,14 @@ void Renderer::BBoxWrite(int index, u16 value)
     return;
   }
 
+  if (m_bounding_box_cached)
+    m_bounding_box_cache[index] = value;
   BBoxWriteImpl(index, value);
 }
 
 void Renderer::BBoxFlush()
 {
+  m_bounding_box_cached = false;
   BBoxFlushImpl();
 }
 
@@ -542,10 +566,38 @@ void Renderer::DrawDebugText()
                          ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing))
     {
       ImGui::TextColored(ImVec4(0.0f, 1.0f, 1.0f, 1.0f), "FPS: %.2f", m_fps_counter.GetFPS());
+      ImGui::TextColored(ImVec4(0.0f, 1.0f, 1.0f, 1.0f), "dt dev: %.2f ms",
+                         m_fps_counter.GetFrameTimeJitter());
     }
     ImGui::End();
   }
 
+  if (g_ActiveConfig.bShowInputLatency)
+  {
+    double p50, p95, p99;
+    if (LatencyTracker::GetPercentiles(&p50, &p95, &p99))
+    {
+      // Position under the FPS display.
+      ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x - (10.0f * m_backbuffer_scale),
+                                     90.0f * m_backbuffer_scale),
+                              ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+      ImGui::SetNextWindowSize(ImVec2(150.0f * m_backbuffer_scale, 30.0f * m_backbuffer_scale));
+
+      if (ImGui::Begin("Latency", nullptr,
+                       ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoInputs |
+                           ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings |
+                           ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoNav |
+                           ImGuiWindowFlags_AlwaysAutoResize |
+                           ImGuiWindowFlags_NoFocusOnAppearing))
+      {
+        ImGui::TextColored(ImVec4(0.0f, 1.0f, 1.0f, 1.0f), "latency p50/p95/p99:");
+        ImGui::TextColored(ImVec4(0.0f, 1.0f, 1.0f, 1.0f), "%.1f / %.1f / %.1f ms", p50, p95,
+                           p99);
+      }
+      ImGui::End();
+    }
+  }
+
   const bool show_movie_window =
       config.m_ShowFrameCount | config.m_ShowLag | config.m_ShowInputDisplay | config.m_ShowRTC;
   if (show_movie_window)
@@ -1236,6 +1288,8 @@ void Renderer::UpdateWidescreenHeuristic()
 
 void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u64 ticks)
 {
+  TRACE_ZONE("Renderer::Swap");
+
   if (SConfig::GetInstance().bWii)
     m_is_game_widescreen = Config::Get(Config::SYSCONF_WIDESCREEN);
 
@@ -1259,6 +1313,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
   // This is required even if frame dumping has stopped, since the frame dump is one frame
   // behind the renderer.
   FlushFrameDump();
+  TrimFrameDumpResources();
 
   if (xfb_addr && fb_width && fb_stride && fb_height)
   {
@@ -1277,6 +1332,10 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       // with the loader, and it has not been unmapped yet. Force a pipeline flush to avoid this.
       g_vertex_manager->Flush();
 
+      // Prefetch recently-peeked EFB tiles. This is done before presenting so the
+      // readback copies are part of the command buffer the present submits.
+      g_framebuffer_manager->EndOfFrame();
+
       // Render any UI elements to the draw list.
       {
         auto lock = GetImGuiLock();
@@ -1302,14 +1361,21 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
         auto render_source_rc = xfb_rect;
         AdjustRectanglesToFitBounds(&render_target_rc, &render_source_rc, m_backbuffer_width,
                                     m_backbuffer_height);
+        g_perf_query->BeginGPUTiming(GPU_TIMING_POST_PROCESS);
         RenderXFBToScreen(render_target_rc, xfb_entry->texture.get(), render_source_rc);
+        g_perf_query->EndGPUTiming(GPU_TIMING_POST_PROCESS);
 
         DrawImGui();
 
-        // Present to the window system.
+        // Present to the window system. The scheduler may delay us here to keep a steady
+        // cadence on the display when emulation runs slightly behind the refresh rate.
+        m_present_scheduler.ScheduleBeforePresent();
         {
           std::lock_guard<std::mutex> guard(m_swap_mutex);
+          g_perf_query->BeginGPUTiming(GPU_TIMING_PRESENT);
           PresentBackbuffer();
+          g_perf_query->EndGPUTiming(GPU_TIMING_PRESENT);
+          m_present_scheduler.NotifyPresentComplete();
         }
 
         // Update the window size based on the frame that was just rendered.
@@ -1320,12 +1386,20 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
       if (!is_duplicate_frame)
       {
         m_fps_counter.Update();
+        LatencyTracker::OnFramePresented();
+
+        DolphinAnalytics::Instance().ReportPerformanceInfo([] {
+          DolphinAnalytics::PerformanceSample perf_sample;
+          perf_sample.speed_ratio = SystemTimers::GetEstimatedEmulationPerformance();
+          perf_sample.num_prims = g_stats.this_frame.num_prims + g_stats.this_frame.num_dl_prims;
+          perf_sample.num_draw_calls = g_stats.this_frame.num_draw_calls;
+          return perf_sample;
+        });
 
-        DolphinAnalytics::PerformanceSample perf_sample;
-        perf_sample.speed_ratio = SystemTimers::GetEstimatedEmulationPerformance();
-        perf_sample.num_prims = g_stats.this_frame.num_prims + g_stats.this_frame.num_dl_prims;
-        perf_sample.num_draw_calls = g_stats.this_frame.num_draw_calls;
-        DolphinAnalytics::Instance().ReportPerformanceInfo(std::move(perf_sample));
+        Core::FlightRecorder::RecordFrame(
+            m_fps_counter.GetDeltaTime(), SystemTimers::GetEstimatedEmulationPerformance(),
+            g_stats.this_frame.num_prims + g_stats.this_frame.num_dl_prims,
+            g_stats.this_frame.num_draw_calls, g_stats.num_textures_uploaded);
 
         if (IsFrameDumping())
           DumpCurrentFrame(xfb_entry->texture.get(), xfb_rect, ticks, m_frame_count);
@@ -1409,6 +1483,8 @@ void Renderer::RenderXFBToScreen(const MathUtil::Rectangle<int>& target_rc,
   {
     m_post_processor->BlitFromTexture(target_rc, source_rc, source_texture, 0);
   }
+
+  m_post_processor->UpdatePreviousFrame(source_texture);
 }
 
 bool Renderer::IsFrameDumping() const
@@ -1419,6 +1495,9 @@ bool Renderer::IsFrameDumping() const
   if (SConfig::GetInstance().m_DumpFrames)
     return true;
 
+  if (Config::Get(Config::MAIN_SHARED_MEMORY_EXPORT))
+    return true;
+
   return false;
 }
 
@@ -1453,11 +1532,11 @@ void Renderer::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  if (!CheckFrameDumpReadbackTextures(target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
+  auto& readback_texture = m_frame_dump_readback_textures[m_frame_dump_write_index];
+  readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0, readback_texture->GetRect());
   m_last_frame_state = m_frame_dump.FetchState(ticks, frame_number);
   m_frame_dump_needs_flush = true;
 }
@@ -1488,19 +1567,27 @@ bool Renderer::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
   return true;
 }
 
-bool Renderer::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool Renderer::CheckFrameDumpReadbackTextures(u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
-  if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
+  auto& first = m_frame_dump_readback_textures[0];
+  if (first && first->GetWidth() == target_width && first->GetHeight() == target_height)
     return true;
 
-  rbtex.reset();
-  rbtex = CreateStagingTexture(
-      StagingTextureType::Readback,
-      TextureConfig(target_width, target_height, 1, 1, 1, AbstractTextureFormat::RGBA8, 0));
-  if (!rbtex)
-    return false;
+  // The encoder may still be reading from the old textures.
+  WaitForFrameDumpThreadIdle();
+
+  for (auto& rbtex : m_frame_dump_readback_textures)
+  {
+    rbtex.reset();
+    rbtex = CreateStagingTexture(
+        StagingTextureType::Readback,
+        TextureConfig(target_width, target_height, 1, 1, 1, AbstractTextureFormat::RGBA8, 0));
+    if (!rbtex)
+      return false;
+  }
 
+  m_frame_dump_write_index = 0;
+  m_frame_dump_reclaim_index = 0;
   return true;
 }
 
@@ -1509,18 +1596,34 @@ void Renderer::FlushFrameDump()
   if (!m_frame_dump_needs_flush)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
-
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  // Unmap any slots the encoder has finished with.
+  ReclaimFrameDumpSlots();
 
   // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
+  auto& output = m_frame_dump_readback_textures[m_frame_dump_write_index];
   output->Flush();
   if (output->Map())
   {
     DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
                   output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    m_frame_dump_write_index = (m_frame_dump_write_index + 1) % FRAME_DUMP_READBACK_TEXTURES;
+
+    // If the slot we will write into next is still owned by the encoder, it has
+    // fallen a full ring behind; this is the only point where a slow encoder can
+    // stall the video thread.
+    if (m_frame_dump_submitted_frames - m_frame_dump_reclaimed_frames ==
+        FRAME_DUMP_READBACK_TEXTURES)
+    {
+      const u64 stall_start = Common::Timer::GetTimeUs();
+      while (m_frame_dump_completed_frames.load(std::memory_order_acquire) ==
+             m_frame_dump_reclaimed_frames)
+      {
+        m_frame_dump_done.Wait();
+      }
+      m_frame_dump_stall_count++;
+      m_frame_dump_stall_time_us += Common::Timer::GetTimeUs() - stall_start;
+      ReclaimFrameDumpSlots();
+    }
   }
   else
   {
@@ -1528,10 +1631,38 @@ void Renderer::FlushFrameDump()
   }
 
   m_frame_dump_needs_flush = false;
+}
 
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+void Renderer::TrimFrameDumpResources()
+{
+  const bool have_resources = m_frame_dump_thread_running.IsSet() || m_frame_dump_render_texture ||
+                              m_frame_dump_readback_textures[0];
+  if (!have_resources)
+    return;
+
+  if (IsFrameDumping() || m_frame_dump_needs_flush)
+  {
+    m_frame_dump_idle_frame_count = 0;
+    return;
+  }
+
+  // Never block on the encoder here; keep everything alive until it has drained.
+  if (m_frame_dump_completed_frames.load(std::memory_order_acquire) !=
+      m_frame_dump_submitted_frames)
+  {
+    return;
+  }
+  ReclaimFrameDumpSlots();
+
+  // Keep the thread and staging ring warm between shots so bursts of screenshots
+  // (e.g. automated thumbnail capture) don't pay the teardown/realloc cost each time.
+  constexpr u32 FRAME_DUMP_TEARDOWN_DELAY_FRAMES = 600;
+  if (++m_frame_dump_idle_frame_count < FRAME_DUMP_TEARDOWN_DELAY_FRAMES)
+    return;
+
+  // The encoder is idle and nothing is queued, so this cannot stall.
+  ShutdownFrameDumping();
+  m_frame_dump_idle_frame_count = 0;
 }
 
 void Renderer::ShutdownFrameDumping()
@@ -1542,8 +1673,16 @@ void Renderer::ShutdownFrameDumping()
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
-  FinishFrameData();
+  // Ensure all queued frames have been encoded.
+  WaitForFrameDumpThreadIdle();
+
+  if (m_frame_dump_stall_count > 0)
+  {
+    WARN_LOG_FMT(VIDEO, "Frame dump encoder stalled the video thread {} times ({} ms total).",
+                 m_frame_dump_stall_count, m_frame_dump_stall_time_us / 1000);
+    m_frame_dump_stall_count = 0;
+    m_frame_dump_stall_time_us = 0;
+  }
 
   // Wake thread up, and wait for it to exit.
   m_frame_dump_thread_running.Clear();
@@ -1553,13 +1692,17 @@ void Renderer::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (auto& rbtex : m_frame_dump_readback_textures)
+    rbtex.reset();
 }
 
 void Renderer::DumpFrameData(const u8* data, int w, int h, int stride)
 {
-  m_frame_dump_data = FrameDump::FrameData{data, w, h, stride, m_last_frame_state};
+  {
+    std::lock_guard<std::mutex> lk(m_frame_dump_queue_mutex);
+    m_frame_dump_queue.push_back(FrameDump::FrameData{data, w, h, stride, m_last_frame_state});
+  }
+  m_frame_dump_submitted_frames++;
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -1571,18 +1714,28 @@ void Renderer::DumpFrameData(const u8* data, int w, int h, int stride)
 
   // Wake worker thread up.
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
-void Renderer::FinishFrameData()
+void Renderer::ReclaimFrameDumpSlots()
 {
-  if (!m_frame_dump_frame_running)
-    return;
+  const u32 completed = m_frame_dump_completed_frames.load(std::memory_order_acquire);
+  while (m_frame_dump_reclaimed_frames != completed)
+  {
+    m_frame_dump_readback_textures[m_frame_dump_reclaim_index]->Unmap();
+    m_frame_dump_reclaim_index = (m_frame_dump_reclaim_index + 1) % FRAME_DUMP_READBACK_TEXTURES;
+    m_frame_dump_reclaimed_frames++;
+  }
+}
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+void Renderer::WaitForFrameDumpThreadIdle()
+{
+  while (m_frame_dump_completed_frames.load(std::memory_order_acquire) !=
+         m_frame_dump_submitted_frames)
+  {
+    m_frame_dump_done.Wait();
+  }
 
-  m_frame_dump_output_texture->Unmap();
+  ReclaimFrameDumpSlots();
 }
 
 void Renderer::FrameDumpThreadFunc()
@@ -1608,46 +1761,75 @@ void Renderer::FrameDumpThreadFunc()
     if (!m_frame_dump_thread_running.IsSet())
       break;
 
-    auto frame = m_frame_dump_data;
-
-    // Save screenshot
-    if (m_screenshot_request.TestAndClear())
+    while (true)
     {
-      std::lock_guard<std::mutex> lk(m_screenshot_lock);
-
-      if (DumpFrameToPNG(frame, m_screenshot_name))
-        OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+      std::optional<FrameDump::FrameData> frame;
+      {
+        std::lock_guard<std::mutex> lk(m_frame_dump_queue_mutex);
+        if (!m_frame_dump_queue.empty())
+        {
+          frame = m_frame_dump_queue.front();
+          m_frame_dump_queue.pop_front();
+        }
+      }
+      if (!frame)
+        break;
 
-      // Reset settings
-      m_screenshot_name.clear();
-      m_screenshot_completed.Set();
-    }
+      if (Config::Get(Config::MAIN_SHARED_MEMORY_EXPORT))
+      {
+        Common::SharedMemoryExport::PushVideoFrame(frame->data, frame->width, frame->height,
+                                                   frame->stride);
+      }
 
-    if (SConfig::GetInstance().m_DumpFrames)
-    {
-      if (!frame_dump_started)
+      // Save screenshot
+      if (m_screenshot_request.TestAndClear())
       {
-        if (dump_to_ffmpeg)
-          frame_dump_started = StartFrameDumpToFFMPEG(frame);
-        else
-          frame_dump_started = StartFrameDumpToImage(frame);
+        std::lock_guard<std::mutex> lk(m_screenshot_lock);
 
-        // Stop frame dumping if we fail to start.
-        if (!frame_dump_started)
-          SConfig::GetInstance().m_DumpFrames = false;
+        if (DumpFrameToPNG(*frame, m_screenshot_name))
+          OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+
+        // Reset settings
+        m_screenshot_name.clear();
+        m_screenshot_completed.Set();
       }
 
-      // If we failed to start frame dumping, don't write a frame.
-      if (frame_dump_started)
+      if (SConfig::GetInstance().m_DumpFrames)
       {
-        if (dump_to_ffmpeg)
-          DumpFrameToFFMPEG(frame);
-        else
-          DumpFrameToImage(frame);
+        if (!frame_dump_started)
+        {
+          if (dump_to_ffmpeg)
+            frame_dump_started = StartFrameDumpToFFMPEG(*frame);
+          else
+            frame_dump_started = StartFrameDumpToImage(*frame);
+
+          // Stop frame dumping if we fail to start.
+          if (!frame_dump_started)
+            SConfig::GetInstance().m_DumpFrames = false;
+        }
+
+        // If we failed to start frame dumping, don't write a frame.
+        if (frame_dump_started)
+        {
+          if (dump_to_ffmpeg)
+            DumpFrameToFFMPEG(*frame);
+          else
+            DumpFrameToImage(*frame);
+        }
       }
+
+      m_frame_dump_completed_frames.fetch_add(1, std::memory_order_release);
+      m_frame_dump_done.Set();
     }
 
-    m_frame_dump_done.Set();
+    // Finalize the video file as soon as dumping stops rather than when this thread is
+    // torn down, since teardown is deferred while the machinery is kept warm.
+    if (frame_dump_started && !SConfig::GetInstance().m_DumpFrames)
+    {
+      if (dump_to_ffmpeg)
+        StopFrameDumpToFFMPEG();
+      frame_dump_started = false;
+    }
   }
 
   if (frame_dump_started)
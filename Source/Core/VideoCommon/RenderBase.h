@@ -14,6 +14,8 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -30,6 +32,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FPSCounter.h"
 #include "VideoCommon/FrameDump.h"
+#include "VideoCommon/PresentScheduler.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/TextureConfig.h"
 
@@ -328,6 +331,7 @@ protected:
   int m_frame_count = 0;
 
   FPSCounter m_fps_counter;
+  PresentScheduler m_present_scheduler;
 
   std::unique_ptr<VideoCommon::PostProcessing> m_post_processor;
 
@@ -361,26 +365,39 @@ private:
   // Used to kick frame dump thread.
   Common::Event m_frame_dump_start;
 
-  // Set by frame dump thread on frame completion.
+  // Set by frame dump thread after each completed frame.
   Common::Event m_frame_dump_done;
 
   // Holds emulation state during the last swap when dumping.
   FrameDump::FrameState m_last_frame_state;
 
-  // Communication of frame between video and dump threads.
-  FrameDump::FrameData m_frame_dump_data;
+  // Mapped frames owned by the dump thread, oldest first.
+  std::deque<FrameDump::FrameData> m_frame_dump_queue;
+  std::mutex m_frame_dump_queue_mutex;
 
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
+  // Ring of readback textures. The encoder can own all but one slot, so a slow
+  // encoder only stalls the video thread once it has fallen a full ring behind.
+  static constexpr u32 FRAME_DUMP_READBACK_TEXTURES = 4;
+  std::array<std::unique_ptr<AbstractStagingTexture>, FRAME_DUMP_READBACK_TEXTURES>
+      m_frame_dump_readback_textures;
+  // Slot the next frame will be copied into / oldest slot the encoder still owns.
+  u32 m_frame_dump_write_index = 0;
+  u32 m_frame_dump_reclaim_index = 0;
+  // Frames handed to / completed by / reclaimed from the dump thread.
+  u32 m_frame_dump_submitted_frames = 0;
+  std::atomic<u32> m_frame_dump_completed_frames{0};
+  u32 m_frame_dump_reclaimed_frames = 0;
+  // Backpressure stats: how often and for how long the encoder stalled us.
+  u32 m_frame_dump_stall_count = 0;
+  u64 m_frame_dump_stall_time_us = 0;
+  // Set when the write slot holds a frame that needs to be dumped.
   bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  // Presented frames since the dump machinery was last used, for lazy teardown.
+  u32 m_frame_dump_idle_frame_count = 0;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
@@ -405,6 +422,11 @@ private:
   // Ultimate Spider-Man to crash
   std::array<u16, 4> m_bounding_box_fallback = {};
 
+  // Caches the backend's bounding box values between draws, so that a burst of
+  // register reads only costs one GPU synchronization. See BBoxRead.
+  std::array<u16, 4> m_bounding_box_cache = {};
+  bool m_bounding_box_cached = false;
+
   // NOTE: The methods below are called on the framedumping thread.
   void FrameDumpThreadFunc();
   bool StartFrameDumpToFFMPEG(const FrameDump::FrameData&);
@@ -416,13 +438,18 @@ private:
 
   void ShutdownFrameDumping();
 
+  // Called once per presented frame; tears the dump machinery down only after it has
+  // been idle for a while, and only once the encoder has drained, so one-off
+  // screenshots never block the video thread on the PNG encode.
+  void TrimFrameDumpResources();
+
   bool IsFrameDumping() const;
 
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that the frame dump readback textures exist and are the correct size.
+  bool CheckFrameDumpReadbackTextures(u32 target_width, u32 target_height);
 
   // Fills the frame dump staging texture with the current XFB texture.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
@@ -434,8 +461,11 @@ private:
   // Ensures all rendered frames are queued for encoding.
   void FlushFrameDump();
 
-  // Ensures all encoded frames have been written to the output file.
-  void FinishFrameData();
+  // Unmaps readback slots whose frames the dump thread has finished encoding.
+  void ReclaimFrameDumpSlots();
+
+  // Waits until all queued frames have been encoded and reclaims their slots.
+  void WaitForFrameDumpThreadIdle();
 
   std::unique_ptr<NetPlayChatUI> m_netplay_chat_ui;
 
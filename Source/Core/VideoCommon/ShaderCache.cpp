@@ -3,6 +3,8 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
@@ -109,6 +111,9 @@ void ShaderCache::Shutdown()
 
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
+  if (g_ActiveConfig.bShaderCache)
+    m_pipeline_uid_use_counts[uid]++;
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
@@ -125,6 +130,9 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
+  if (g_ActiveConfig.bShaderCache)
+    m_pipeline_uid_use_counts[uid]++;
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
@@ -401,15 +409,48 @@ void ShaderCache::ClearCaches()
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
+  // UIDs replayed from the disk cache are queued most-recently-used first, in batches of
+  // increasing priority, so the pipelines the game needed last session finish soonest while
+  // cold pipelines trickle in behind gameplay.
+  constexpr size_t REPLAY_PRIORITY_BATCH_SIZE = 64;
+
+  // If we have a frequency table from previous sessions, the pipelines the game drew with most
+  // often specialize first. UIDs the table does not know about keep their most-recently-used
+  // order behind the hot ones.
+  if (!m_pipeline_uid_use_counts.empty())
+  {
+    const auto use_count = [this](const GXPipelineUid& uid) -> u32 {
+      const auto it = m_pipeline_uid_use_counts.find(uid);
+      return it != m_pipeline_uid_use_counts.end() ? it->second : 0;
+    };
+    std::stable_sort(m_pipeline_uid_replay_order.begin(), m_pipeline_uid_replay_order.end(),
+                     [&use_count](const GXPipelineUid& lhs, const GXPipelineUid& rhs) {
+                       return use_count(lhs) > use_count(rhs);
+                     });
+  }
+
+  size_t replay_index = 0;
+  for (const GXPipelineUid& uid : m_pipeline_uid_replay_order)
+  {
+    const auto it = m_gx_pipeline_cache.find(uid);
+    if (it == m_gx_pipeline_cache.end() || it->second.first || it->second.second)
+      continue;
+
+    QueuePipelineCompile(uid, COMPILE_PRIORITY_SHADERCACHE_PIPELINE +
+                                  static_cast<u32>(replay_index / REPLAY_PRIORITY_BATCH_SIZE));
+    replay_index++;
+  }
+  m_pipeline_uid_replay_order.clear();
+
+  // Queue any remaining uids with a null pipeline that isn't already pending.
   for (auto& it : m_gx_pipeline_cache)
   {
-    if (!it.second.first)
+    if (!it.second.first && !it.second.second)
       QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
   }
   for (auto& it : m_gx_uber_pipeline_cache)
   {
-    if (!it.second.first)
+    if (!it.second.first && !it.second.second)
       QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
   }
 }
@@ -747,19 +788,19 @@ void ShaderCache::LoadPipelineUIDCache()
       uid_file_valid = file_size == expected_size;
       if (uid_file_valid)
       {
-        for (size_t i = 0; i < uid_count; i++)
+        std::vector<SerializedGXPipelineUid> serialized_uids(uid_count);
+        if (m_gx_pipeline_uid_cache_file.ReadBytes(serialized_uids.data(),
+                                                   uid_count * sizeof(SerializedGXPipelineUid)))
+        {
+          // The file is append-ordered, so replay it backwards: the most recently used UIDs
+          // end up first in the compile queue and become available soonest.
+          // This just adds the pipelines to the map, they are compiled later.
+          for (auto it = serialized_uids.rbegin(); it != serialized_uids.rend(); ++it)
+            AddSerializedGXPipelineUID(*it);
+        }
+        else
         {
-          SerializedGXPipelineUid serialized_uid;
-          if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
-          {
-            // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
-          }
-          else
-          {
-            uid_file_valid = false;
-            break;
-          }
+          uid_file_valid = false;
         }
       }
 
@@ -792,14 +833,95 @@ void ShaderCache::LoadPipelineUIDCache()
   }
 
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
+
+  LoadPipelineFrequencyTable();
 }
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
+  SavePipelineFrequencyTable();
   m_gx_pipeline_uid_cache_file.Close();
 }
 
+// On-disk record of the pipeline frequency table. The UID layout is versioned together with the
+// UID cache file, so both files share GX_PIPELINE_UID_VERSION.
+struct SerializedPipelineFrequencyRecord
+{
+  SerializedGXPipelineUid uid;
+  u32 use_count;
+};
+
+constexpr u32 FREQUENCY_FILE_MAGIC = 0x51524650;  // PFRQ
+
+static std::string GetPipelineFrequencyTableFilename()
+{
+  return File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidfreq";
+}
+
+void ShaderCache::LoadPipelineFrequencyTable()
+{
+  m_pipeline_uid_use_counts.clear();
+
+  File::IOFile file(GetPipelineFrequencyTableFilename(), "rb");
+  if (!file.IsOpen())
+    return;
+
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != FREQUENCY_FILE_MAGIC || version != GX_PIPELINE_UID_VERSION)
+  {
+    return;
+  }
+
+  // As with the UID cache, discard the table entirely if the size doesn't line up with a whole
+  // number of records, as it was most likely cut short by a crash.
+  constexpr size_t header_size = sizeof(u32) + sizeof(u32);
+  const u64 file_size = file.GetSize();
+  const size_t record_count =
+      static_cast<size_t>(file_size - header_size) / sizeof(SerializedPipelineFrequencyRecord);
+  if (file_size != record_count * sizeof(SerializedPipelineFrequencyRecord) + header_size)
+    return;
+
+  std::vector<SerializedPipelineFrequencyRecord> records(record_count);
+  if (!file.ReadBytes(records.data(), record_count * sizeof(SerializedPipelineFrequencyRecord)))
+    return;
+
+  for (const SerializedPipelineFrequencyRecord& record : records)
+  {
+    GXPipelineUid uid;
+    UnserializePipelineUid(record.uid, uid);
+    m_pipeline_uid_use_counts[uid] = record.use_count;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read {} pipeline frequency records", record_count);
+}
+
+void ShaderCache::SavePipelineFrequencyTable()
+{
+  if (m_pipeline_uid_use_counts.empty())
+    return;
+
+  // The counts change every session, so the table is rewritten rather than appended to.
+  File::IOFile file(GetPipelineFrequencyTableFilename(), "wb");
+  if (!file.IsOpen())
+    return;
+
+  file.WriteBytes(&FREQUENCY_FILE_MAGIC, sizeof(FREQUENCY_FILE_MAGIC));
+  file.WriteBytes(&GX_PIPELINE_UID_VERSION, sizeof(GX_PIPELINE_UID_VERSION));
+  for (const auto& it : m_pipeline_uid_use_counts)
+  {
+    SerializedPipelineFrequencyRecord record = {};
+    SerializePipelineUid(it.first, record.uid);
+    record.use_count = it.second;
+    if (!file.WriteBytes(&record, sizeof(record)))
+    {
+      WARN_LOG_FMT(VIDEO, "Writing pipeline frequency table failed.");
+      return;
+    }
+  }
+}
+
 void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
   GXPipelineUid real_uid;
@@ -812,6 +934,9 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
   entry.second = false;
+
+  // Remember the replay order, so CompileMissingPipelines can queue in it.
+  m_pipeline_uid_replay_order.push_back(real_uid);
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -12,6 +12,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -120,6 +121,8 @@ private:
   void ClearCaches();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
+  void LoadPipelineFrequencyTable();
+  void SavePipelineFrequencyTable();
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
@@ -223,10 +226,18 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+  // Hashed rather than ordered containers, as the lookup is part of the draw path.
+  std::unordered_map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+      m_gx_pipeline_cache;
+  std::unordered_map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
+  // UIDs replayed from the on-disk cache in most-recently-used order; drained by
+  // CompileMissingPipelines to decide compilation priority.
+  std::vector<GXPipelineUid> m_pipeline_uid_replay_order;
+  // How often each specialized pipeline has been requested by the draw path, persisted per
+  // title next to the UID cache so the hottest pipelines specialize first on later runs.
+  std::unordered_map<GXPipelineUid, u32> m_pipeline_uid_use_counts;
   LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
@@ -7,6 +7,7 @@
 
 #include <imgui.h>
 
+#include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -63,6 +64,7 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("TexCache VRAM", "%d MB", texture_cache_mem_kb / 1024);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
@@ -71,6 +73,11 @@ void Statistics::Display() const
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
   draw_statistic("Draw calls", "%d", this_frame.num_draw_calls);
+  draw_statistic("Draw calls (uber)", "%d", this_frame.num_uber_draws);
+  draw_statistic("Draw calls (spec)", "%d", this_frame.num_specialized_draws);
+  const int pipeline_draws = this_frame.num_uber_draws + this_frame.num_specialized_draws;
+  draw_statistic("Uber draw ratio", "%.0f%%",
+                 pipeline_draws > 0 ? 100.0 * this_frame.num_uber_draws / pipeline_draws : 0.0);
   draw_statistic("Primitives", "%d", this_frame.num_prims);
   draw_statistic("Primitives (DL)", "%d", this_frame.num_dl_prims);
   draw_statistic("XF loads", "%d", this_frame.num_xf_loads);
@@ -86,6 +93,16 @@ void Statistics::Display() const
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
 
+  if (g_perf_query->SupportsGPUTiming())
+  {
+    const auto pass_ms = [](GPUTimingPass pass) {
+      return g_perf_query->GetGPUPassTimeNs(pass) / 1000000.0;
+    };
+    draw_statistic("GPU EFB copy (ms)", "%.3f", pass_ms(GPU_TIMING_EFB_COPY));
+    draw_statistic("GPU post-process (ms)", "%.3f", pass_ms(GPU_TIMING_POST_PROCESS));
+    draw_statistic("GPU present (ms)", "%.3f", pass_ms(GPU_TIMING_PRESENT));
+  }
+
   ImGui::Columns(1);
 
   ImGui::End();
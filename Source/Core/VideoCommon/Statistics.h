@@ -15,6 +15,7 @@ struct Statistics
   int num_textures_created;
   int num_textures_uploaded;
   int num_textures_alive;
+  int texture_cache_mem_kb;
 
   int num_vertex_loaders;
 
@@ -38,6 +39,8 @@ struct Statistics
 
     int num_primitive_joins;
     int num_draw_calls;
+    int num_uber_draws;
+    int num_specialized_draws;
 
     int num_dlists_called;
 
@@ -22,6 +22,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
+#include "Common/Image.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
@@ -35,9 +36,11 @@
 #include "VideoCommon/AbstractFramebuffer.h"
 #include "VideoCommon/AbstractStagingTexture.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/SamplerCommon.h"
@@ -55,6 +58,24 @@ static const u64 TEXHASH_INVALID = 0;
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
+// Aggressive aging thresholds used while the estimated texture memory exceeds the configured
+// budget, so the cache sheds textures itself instead of letting the driver start paging.
+static const int TEXTURE_KILL_THRESHOLD_OVER_BUDGET = 4;
+static const int TEXTURE_POOL_KILL_THRESHOLD_OVER_BUDGET = 1;
+
+static u64 EstimateTextureMemory(const TextureConfig& config)
+{
+  const u32 block_size = AbstractTexture::GetBlockSizeForFormat(config.format);
+  u64 total = 0;
+  for (u32 level = 0; level < config.levels; level++)
+  {
+    const u32 mip_height = std::max(config.height >> level, 1u);
+    const u32 block_rows = (mip_height + block_size - 1) / block_size;
+    total += static_cast<u64>(config.GetMipStride(level)) * block_rows;
+  }
+  return total * config.layers * config.samples;
+}
+
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
 std::bitset<8> TextureCacheBase::valid_bind_points;
@@ -96,6 +117,7 @@ TextureCacheBase::TextureCacheBase()
   Common::SetHash64Function();
 
   InvalidateAllBindPoints();
+  InvalidateBackendBindings();
 }
 
 TextureCacheBase::~TextureCacheBase()
@@ -124,6 +146,7 @@ void TextureCacheBase::Invalidate()
 {
   FlushEFBCopies();
   InvalidateAllBindPoints();
+  InvalidateBackendBindings();
 
   bound_textures.fill(nullptr);
   for (auto& tex : textures_by_address)
@@ -134,6 +157,12 @@ void TextureCacheBase::Invalidate()
   textures_by_hash.clear();
 
   texture_pool.clear();
+  estimated_texture_memory = 0;
+  over_texture_budget = false;
+
+  // current_memory_generation is deliberately not reset; it stays monotonic so a stale snapshot
+  // can never compare equal to a later state of the table.
+  memory_page_generations.clear();
 }
 
 void TextureCacheBase::ForceReload()
@@ -173,6 +202,26 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 
 void TextureCacheBase::Cleanup(int _frameCount)
 {
+  // Memoized RAM validity checks expire each frame, so CPU writes to copy regions are caught by
+  // at most one rehash per entry per frame.
+  memory_validation_epoch++;
+
+  // Tighten the aging thresholds while over the VRAM budget. The budget state has hysteresis
+  // (an eighth of the budget) so the cache does not oscillate around the limit.
+  const u64 texture_budget = static_cast<u64>(g_ActiveConfig.iTextureCacheVRAMBudgetMB) << 20;
+  if (texture_budget == 0)
+    over_texture_budget = false;
+  else if (estimated_texture_memory > texture_budget)
+    over_texture_budget = true;
+  else if (estimated_texture_memory < texture_budget - texture_budget / 8)
+    over_texture_budget = false;
+  const int kill_threshold =
+      over_texture_budget ? TEXTURE_KILL_THRESHOLD_OVER_BUDGET : TEXTURE_KILL_THRESHOLD;
+  const int pool_kill_threshold =
+      over_texture_budget ? TEXTURE_POOL_KILL_THRESHOLD_OVER_BUDGET : TEXTURE_POOL_KILL_THRESHOLD;
+
+  SETSTAT(g_stats.texture_cache_mem_kb, estimated_texture_memory / 1024);
+
   TexAddrCache::iterator iter = textures_by_address.begin();
   TexAddrCache::iterator tcend = textures_by_address.end();
   while (iter != tcend)
@@ -186,16 +235,16 @@ void TextureCacheBase::Cleanup(int _frameCount)
       iter->second->frameCount = _frameCount;
       ++iter;
     }
-    else if (_frameCount > TEXTURE_KILL_THRESHOLD + iter->second->frameCount)
+    else if (_frameCount > kill_threshold + iter->second->frameCount)
     {
       if (iter->second->IsCopy())
       {
         // Only remove EFB copies when they wouldn't be used anymore(changed hash), because EFB
         // copies living on the
-        // host GPU are unrecoverable. Perform this check only every TEXTURE_KILL_THRESHOLD for
+        // host GPU are unrecoverable. Perform this check only every kill_threshold frames for
         // performance reasons
-        if ((_frameCount - iter->second->frameCount) % TEXTURE_KILL_THRESHOLD == 1 &&
-            iter->second->hash != iter->second->CalculateHash())
+        if ((_frameCount - iter->second->frameCount) % kill_threshold == 1 &&
+            !CheckRAMCopyValidity(iter->second))
         {
           iter = InvalidateTexture(iter);
         }
@@ -215,6 +264,7 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
   }
 
+  bool destroyed_pool_texture = false;
   TexPool::iterator iter2 = texture_pool.begin();
   TexPool::iterator tcend2 = texture_pool.end();
   while (iter2 != tcend2)
@@ -223,15 +273,22 @@ void TextureCacheBase::Cleanup(int _frameCount)
     {
       iter2->second.frameCount = _frameCount;
     }
-    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount)
+    if (_frameCount > pool_kill_threshold + iter2->second.frameCount)
     {
+      estimated_texture_memory -= EstimateTextureMemory(iter2->first);
       iter2 = texture_pool.erase(iter2);
+      destroyed_pool_texture = true;
     }
     else
     {
       ++iter2;
     }
   }
+
+  // A new texture could be allocated at the address of a destroyed one, so the tracked backend
+  // bindings can no longer be trusted for skipping re-binds.
+  if (destroyed_pool_texture)
+    InvalidateBackendBindings();
 }
 
 bool TextureCacheBase::TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -432,12 +489,20 @@ bool TextureCacheBase::CheckReadbackTexture(u32 width, u32 height, AbstractTextu
 
 void TextureCacheBase::SerializeTexture(AbstractTexture* tex, const TextureConfig& config,
                                         PointerWrap& p)
+{
+  SerializeTexture(tex, config, p, nullptr);
+}
+
+void TextureCacheBase::SerializeTexture(AbstractTexture* tex, const TextureConfig& config,
+                                        PointerWrap& p,
+                                        std::vector<PendingTextureReadback>* pending_readbacks)
 {
   // If we're in measure mode, skip the actual readback to save some time.
   const bool skip_readback = p.GetMode() == PointerWrap::MODE_MEASURE;
   p.DoPOD(config);
 
-  if (skip_readback || CheckReadbackTexture(config.width, config.height, config.format))
+  if (skip_readback || pending_readbacks ||
+      CheckReadbackTexture(config.width, config.height, config.format))
   {
     // First, measure the amount of memory needed.
     u32 total_size = 0;
@@ -471,10 +536,33 @@ void TextureCacheBase::SerializeTexture(AbstractTexture* tex, const TextureConfi
           u32 level_width = std::max(config.width >> level, 1u);
           u32 level_height = std::max(config.height >> level, 1u);
           auto rect = tex->GetConfig().GetMipRect(level);
-          m_readback_texture->CopyFromTexture(tex, rect, layer, level, rect);
-
           u32 stride = AbstractTexture::CalculateStrideForFormat(config.format, level_width);
           u32 size = stride * level_height;
+
+          if (pending_readbacks)
+          {
+            // Queue the GPU->staging copy and defer the readback until the caller has issued
+            // the copies for every texture it is serializing.
+            TextureConfig staging_config(level_width, level_height, 1, 1, 1, config.format, 0);
+            auto staging =
+                g_renderer->CreateStagingTexture(StagingTextureType::Readback, staging_config);
+            if (staging)
+            {
+              staging->CopyFromTexture(tex, rect, layer, level, rect);
+              pending_readbacks->push_back({std::move(staging), rect, texture_data, stride});
+              texture_data += size;
+              continue;
+            }
+            // Allocation failed; fall back to the shared synchronous readback texture.
+          }
+
+          if (!CheckReadbackTexture(config.width, config.height, config.format))
+          {
+            PanicAlertFmt("Failed to create staging texture for serialization");
+            return;
+          }
+
+          m_readback_texture->CopyFromTexture(tex, rect, layer, level, rect);
           m_readback_texture->ReadTexels(rect, texture_data, stride);
 
           texture_data += size;
@@ -598,11 +686,36 @@ void TextureCacheBase::DoSaveState(PointerWrap& p)
   // Save the texture cache entries out in the order the were referenced.
   u32 size = static_cast<u32>(entries_to_save.size());
   p.Do(size);
+
+  // Issue the GPU->staging copies for all entries before reading any of them back: the first
+  // readback then drains the GPU pipeline once for everything queued so far, instead of every
+  // entry paying for a full drain of its own. Outstanding staging memory is bounded by
+  // flushing the queue whenever it grows past a fixed budget.
+  constexpr u32 MAX_PENDING_READBACK_BYTES = 64 * 1024 * 1024;
+  std::vector<PendingTextureReadback> pending_readbacks;
+  u32 pending_bytes = 0;
+  const auto flush_pending_readbacks = [&pending_readbacks, &pending_bytes]() {
+    for (PendingTextureReadback& readback : pending_readbacks)
+      readback.staging->ReadTexels(readback.rect, readback.dst, readback.stride);
+    pending_readbacks.clear();
+    pending_bytes = 0;
+  };
+
   for (TCacheEntry* entry : entries_to_save)
   {
-    SerializeTexture(entry->texture.get(), entry->texture->GetConfig(), p);
+    const size_t first_new_readback = pending_readbacks.size();
+    SerializeTexture(entry->texture.get(), entry->texture->GetConfig(), p, &pending_readbacks);
     entry->DoState(p);
+
+    for (size_t i = first_new_readback; i < pending_readbacks.size(); i++)
+    {
+      pending_bytes +=
+          pending_readbacks[i].stride * static_cast<u32>(pending_readbacks[i].rect.GetHeight());
+    }
+    if (pending_bytes >= MAX_PENDING_READBACK_BYTES)
+      flush_pending_readbacks();
   }
+  flush_pending_readbacks();
   p.DoMarker("TextureCacheEntries");
 
   // Save references for each cache entry.
@@ -791,7 +904,7 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, const u8
         entry->OverlapsMemoryRange(entry_to_update->addr, entry_to_update->size_in_bytes) &&
         entry->memory_stride == numBlocksX * block_size)
     {
-      if (entry->hash == entry->CalculateHash())
+      if (CheckRAMCopyValidity(entry))
       {
         // If the texture formats are not compatible or convertible, skip it.
         if (!IsCompatibleTextureFormat(entry_to_update->format.texfmt, entry->format.texfmt))
@@ -937,12 +1050,6 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, const u8
 void TextureCacheBase::DumpTexture(TCacheEntry* entry, std::string basename, unsigned int level,
                                    bool is_arbitrary)
 {
-  std::string szDir = File::GetUserPath(D_DUMPTEXTURES_IDX) + SConfig::GetInstance().GetGameID();
-
-  // make sure that the directory exists
-  if (!File::IsDirectory(szDir))
-    File::CreateDir(szDir);
-
   if (is_arbitrary)
   {
     basename += "_arb";
@@ -960,15 +1067,59 @@ void TextureCacheBase::DumpTexture(TCacheEntry* entry, std::string basename, uns
       return;
   }
 
+  // The basename contains the texture hash, so repeat uploads of an already-dumped texture are
+  // rejected here with a single lookup instead of a file system stat per level.
+  if (!dumped_textures.insert(basename).second)
+    return;
+
+  std::string szDir = File::GetUserPath(D_DUMPTEXTURES_IDX) + SConfig::GetInstance().GetGameID();
+
+  // make sure that the directory exists
+  if (!File::IsDirectory(szDir))
+    File::CreateDir(szDir);
+
   const std::string filename = fmt::format("{}/{}.png", szDir, basename);
   if (File::Exists(filename))
     return;
 
-  entry->texture->Save(filename, level);
+  // Read the texture back here on the video thread, but hand the pixels off to the dump thread
+  // for PNG compression and file IO, which otherwise dominate the frame time while dumping.
+  const u32 level_width = std::max(1u, entry->texture->GetWidth() >> level);
+  const u32 level_height = std::max(1u, entry->texture->GetHeight() >> level);
+  const TextureConfig readback_config(level_width, level_height, 1, 1, 1,
+                                      AbstractTextureFormat::RGBA8, 0);
+  auto readback_texture =
+      g_renderer->CreateStagingTexture(StagingTextureType::Readback, readback_config);
+  if (!readback_texture)
+    return;
+
+  readback_texture->CopyFromTexture(entry->texture.get(), 0, level);
+  readback_texture->Flush();
+  if (!readback_texture->Map())
+    return;
+
+  TextureDumpRequest request;
+  request.filename = filename;
+  request.width = level_width;
+  request.height = level_height;
+  request.stride = static_cast<u32>(readback_texture->GetMappedStride());
+  const u8* data = reinterpret_cast<const u8*>(readback_texture->GetMappedPointer());
+  request.texture_data.assign(data, data + static_cast<size_t>(request.stride) * level_height);
+  readback_texture->Unmap();
+
+  if (!texture_dump_thread_started)
+  {
+    texture_dump_thread.Reset([](TextureDumpRequest item) {
+      Common::SavePNG(item.filename, item.texture_data.data(), Common::ImageByteFormat::RGBA,
+                      item.width, item.height, static_cast<int>(item.stride));
+    });
+    texture_dump_thread_started = true;
+  }
+  texture_dump_thread.EmplaceItem(std::move(request));
 }
 
-static void SetSamplerState(u32 index, float custom_tex_scale, bool custom_tex,
-                            bool has_arbitrary_mips)
+static SamplerState CalculateSamplerState(u32 index, float custom_tex_scale, bool custom_tex,
+                                          bool has_arbitrary_mips)
 {
   const FourTexUnits& tex = bpmem.tex[index / 4];
   const TexMode0& tm0 = tex.texMode0[index % 4];
@@ -1024,7 +1175,7 @@ static void SetSamplerState(u32 index, float custom_tex_scale, bool custom_tex,
     state.anisotropic_filtering = 0;
   }
 
-  g_renderer->SetSamplerState(index, state);
+  return state;
 }
 
 void TextureCacheBase::BindTextures()
@@ -1034,15 +1185,34 @@ void TextureCacheBase::BindTextures()
     const TCacheEntry* tentry = bound_textures[i];
     if (IsValidBindPoint(i) && tentry)
     {
-      g_renderer->SetTexture(i, tentry->texture.get());
+      // Only cross the backend boundary for bindings which actually changed since the last GX
+      // draw. Utility draws and texture pool eviction invalidate the tracked state.
+      const AbstractTexture* texture = tentry->texture.get();
+      if (texture != last_bound_textures[i])
+      {
+        g_renderer->SetTexture(i, texture);
+        last_bound_textures[i] = texture;
+      }
       PixelShaderManager::SetTexDims(i, tentry->native_width, tentry->native_height);
 
       const float custom_tex_scale = tentry->GetWidth() / float(tentry->native_width);
-      SetSamplerState(i, custom_tex_scale, tentry->is_custom_tex, tentry->has_arbitrary_mips);
+      const SamplerState state = CalculateSamplerState(i, custom_tex_scale, tentry->is_custom_tex,
+                                                       tentry->has_arbitrary_mips);
+      if (state != last_sampler_states[i])
+      {
+        g_renderer->SetSamplerState(i, state);
+        last_sampler_states[i] = state;
+      }
     }
   }
 }
 
+void TextureCacheBase::InvalidateBackendBindings()
+{
+  last_bound_textures.fill(nullptr);
+  last_sampler_states.fill(RenderState::GetInvalidSamplerState());
+}
+
 class ArbitraryMipmapDetector
 {
 private:
@@ -1701,8 +1871,17 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
   {
     if (entry->is_xfb_container)
     {
-      StitchXFBCopy(entry);
-      entry->texture->FinishedRendering();
+      // Only re-run the stitching copy passes when an EFB copy has actually written into the
+      // covered range since the last present. CPU writes to the range don't bump the page
+      // generations, but those invalidate the container through the hash check in
+      // GetXFBFromCache, so an unmodified container can be fed to the swap blit as-is.
+      const u64 generation = GetMemoryGeneration(entry->addr, entry->size_in_bytes);
+      if (entry->stitched_generation != generation)
+      {
+        StitchXFBCopy(entry);
+        entry->texture->FinishedRendering();
+        entry->stitched_generation = generation;
+      }
     }
 
     GetDisplayRectForXFBEntry(entry, width, height, display_rect);
@@ -1739,6 +1918,7 @@ TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height, u32 stride,
   // Stitch any VRAM copies into the new RAM copy.
   StitchXFBCopy(entry);
   entry->texture->FinishedRendering();
+  entry->stitched_generation = GetMemoryGeneration(entry->addr, entry->size_in_bytes);
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
   textures_by_address.emplace(entry->addr, entry);
@@ -1772,7 +1952,7 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::GetXFBFromCache(u32 address, u3
     if (entry->is_xfb_copy && entry->memory_stride == stride && entry->native_width >= width &&
         entry->native_height >= height && !entry->may_have_overlapping_textures)
     {
-      if (entry->hash == entry->CalculateHash() && !entry->reference_changed)
+      if (CheckRAMCopyValidity(entry) && !entry->reference_changed)
       {
         return entry;
       }
@@ -1816,7 +1996,7 @@ void TextureCacheBase::StitchXFBCopy(TCacheEntry* stitched_entry)
         entry->OverlapsMemoryRange(stitched_entry->addr, stitched_entry->size_in_bytes) &&
         entry->memory_stride == stitched_entry->memory_stride)
     {
-      if (entry->hash == entry->CalculateHash())
+      if (CheckRAMCopyValidity(entry))
       {
         // Can't check the height here because of Y scaling.
         if (entry->native_width != entry->GetWidth())
@@ -2145,9 +2325,11 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       entry->may_have_overlapping_textures = false;
       entry->is_custom_tex = false;
 
+      g_perf_query->BeginGPUTiming(GPU_TIMING_EFB_COPY);
       CopyEFBToCacheEntry(entry, is_depth_copy, srcRect, scaleByHalf, linear_filter, dstFormat,
                           isIntensity, gamma, clamp_top, clamp_bottom,
                           GetVRAMCopyFilterCoefficients(filter_coefficients));
+      g_perf_query->EndGPUTiming(GPU_TIMING_EFB_COPY);
 
       if (g_ActiveConfig.bDumpEFBTarget && !is_xfb_copy)
       {
@@ -2177,8 +2359,10 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
     if (staging_texture)
     {
+      g_perf_query->BeginGPUTiming(GPU_TIMING_EFB_COPY);
       CopyEFB(staging_texture.get(), format, tex_w, bytes_per_row, num_blocks_y, dstStride, srcRect,
               scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom, coefficients);
+      g_perf_query->EndGPUTiming(GPU_TIMING_EFB_COPY);
 
       // We can't defer if there is no VRAM copy (since we need to update the hash).
       if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
@@ -2223,6 +2407,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   // as our efb copy are marked to check them for partial texture updates.
   // TODO: The logic to detect overlapping strided efb copies is not 100% accurate.
   bool strided_efb_copy = dstStride != bytes_per_row;
+  BumpMemoryGeneration(dstAddr, covered_range);
   auto iter = FindOverlappingTextures(dstAddr, covered_range);
   while (iter.first != iter.second)
   {
@@ -2268,6 +2453,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       if (overlapping_entry->is_xfb_copy && copy_to_ram)
       {
         overlapping_entry->hash = overlapping_entry->CalculateHash();
+        overlapping_entry->valid_check_epoch = 0;
       }
 
       // Do not load textures by hash, if they were at least partly overwritten by an efb copy.
@@ -2319,6 +2505,9 @@ void TextureCacheBase::WriteEFBCopyToRAM(u8* dst_ptr, u32 width, u32 height, u32
   MathUtil::Rectangle<int> copy_rect(0, 0, static_cast<int>(width), static_cast<int>(height));
   staging_texture->ReadTexels(copy_rect, dst_ptr, stride);
   ReleaseEFBCopyStagingTexture(std::move(staging_texture));
+
+  // The copied-back data is now visible to the CPU thread.
+  Fifo::NotifyEFBCopyToRAM();
 }
 
 void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
@@ -2470,6 +2659,7 @@ TextureCacheBase::AllocateTexture(const TextureConfig& config)
     }
   }
 
+  estimated_texture_memory += EstimateTextureMemory(config);
   INCSTAT(g_stats.num_textures_created);
   return TexPoolEntry(std::move(texture), std::move(framebuffer));
 }
@@ -2522,6 +2712,48 @@ TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
   return std::make_pair(begin, end);
 }
 
+void TextureCacheBase::BumpMemoryGeneration(u32 addr, u32 size_in_bytes)
+{
+  const u64 generation = ++current_memory_generation;
+  const u32 start_page = addr >> MEMORY_GENERATION_PAGE_BITS;
+  const u32 end_page = (addr + std::max(size_in_bytes, 1u) - 1) >> MEMORY_GENERATION_PAGE_BITS;
+  for (u32 page = start_page; page <= end_page; page++)
+    memory_page_generations[page] = generation;
+}
+
+u64 TextureCacheBase::GetMemoryGeneration(u32 addr, u32 size_in_bytes) const
+{
+  u64 generation = 0;
+  const u32 start_page = addr >> MEMORY_GENERATION_PAGE_BITS;
+  const u32 end_page = (addr + std::max(size_in_bytes, 1u) - 1) >> MEMORY_GENERATION_PAGE_BITS;
+  for (u32 page = start_page; page <= end_page; page++)
+  {
+    const auto it = memory_page_generations.find(page);
+    if (it != memory_page_generations.end())
+      generation = std::max(generation, it->second);
+  }
+  return generation;
+}
+
+bool TextureCacheBase::CheckRAMCopyValidity(TCacheEntry* entry)
+{
+  // If no EFB/XFB copy has written to the covered pages since the last check this frame, the
+  // memoized result is still valid and the rehash can be skipped. CPU writes don't bump the
+  // page generations, but the epoch rolls over every frame, so they are still caught by the
+  // first check of the following frame.
+  const u64 generation = GetMemoryGeneration(entry->addr, entry->size_in_bytes);
+  if (entry->valid_check_epoch == memory_validation_epoch &&
+      entry->valid_check_generation == generation)
+  {
+    return entry->valid_check_result;
+  }
+
+  entry->valid_check_result = entry->hash == entry->CalculateHash();
+  entry->valid_check_generation = generation;
+  entry->valid_check_epoch = memory_validation_epoch;
+  return entry->valid_check_result;
+}
+
 TextureCacheBase::TexAddrCache::iterator
 TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pending_efb_copy)
 {
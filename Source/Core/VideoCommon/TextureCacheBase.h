@@ -16,8 +16,10 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/RenderState.h"
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
@@ -108,6 +110,10 @@ public:
 
     bool reference_changed = false;  // used by xfb to determine when a reference xfb changed
 
+    // Page generation of the covered range when this XFB container was last stitched. While it
+    // is unchanged, the stitched texture is still current and re-stitching can be skipped.
+    u64 stitched_generation = 0;
+
     unsigned int native_width,
         native_height;  // Texture dimensions from the GameCube's point of view
     unsigned int native_levels;
@@ -130,6 +136,12 @@ public:
     u32 pending_efb_copy_height = 0;
     bool pending_efb_copy_invalidated = false;
 
+    // Memoized result of the last CheckRAMCopyValidity() call, tagged with the page generation
+    // and validation epoch it was computed at.
+    u64 valid_check_generation = 0;
+    u64 valid_check_epoch = 0;
+    bool valid_check_result = false;
+
     explicit TCacheEntry(std::unique_ptr<AbstractTexture> tex,
                          std::unique_ptr<AbstractFramebuffer> fb);
 
@@ -157,6 +169,8 @@ public:
     {
       base_hash = _base_hash;
       hash = _hash;
+      // The memoized validity check compared against the old hash, so it must be redone.
+      valid_check_epoch = 0;
     }
 
     // This texture entry is used by the other entry as a sub-texture
@@ -221,6 +235,11 @@ public:
                              MathUtil::Rectangle<int>* display_rect);
 
   virtual void BindTextures();
+
+  // Forgets which textures/samplers were last handed to the backend, forcing the next
+  // BindTextures() to re-issue every binding. Call when anything outside the GX draw path may
+  // have changed the backend bindings, or when pooled textures are destroyed.
+  void InvalidateBackendBindings();
   void CopyRenderTargetToTexture(u32 dstAddr, EFBCopyFormat dstFormat, u32 width, u32 height,
                                  u32 dstStride, bool is_depth_copy,
                                  const MathUtil::Rectangle<int>& srcRect, bool isIntensity,
@@ -271,6 +290,11 @@ protected:
   std::array<TCacheEntry*, 8> bound_textures{};
   static std::bitset<8> valid_bind_points;
 
+  // Bindings sent to the backend for the last GX draw, used by BindTextures() to skip
+  // redundant backend calls.
+  std::array<const AbstractTexture*, 8> last_bound_textures{};
+  std::array<SamplerState, 8> last_sampler_states{};
+
 private:
   using TexAddrCache = std::multimap<u32, TCacheEntry*>;
   using TexHashCache = std::multimap<u64, TCacheEntry*>;
@@ -307,6 +331,17 @@ private:
   TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter,
                                            bool discard_pending_efb_copy = false);
 
+  // Page-granular generation bookkeeping for guest memory written by EFB/XFB copies. Each copy
+  // bumps the generation of the pages it covers, so the validity checks on copy entries can be
+  // reduced to integer compares instead of rehashing the memory range on every overlap walk.
+  void BumpMemoryGeneration(u32 addr, u32 size_in_bytes);
+  u64 GetMemoryGeneration(u32 addr, u32 size_in_bytes) const;
+
+  // Checks whether the guest RAM backing a copy entry still matches the hash taken when it was
+  // written. The rehash is skipped when the page generations show no copy has written to the
+  // range since the last check this frame.
+  bool CheckRAMCopyValidity(TCacheEntry* entry);
+
   void UninitializeXFBMemory(u8* dst, u32 stride, u32 bytes_per_row, u32 num_blocks_y);
 
   // Precomputing the coefficients for the previous, current, and next lines for the copy filter.
@@ -327,6 +362,19 @@ private:
   void ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex);
 
   bool CheckReadbackTexture(u32 width, u32 height, AbstractTextureFormat format);
+
+  // A GPU->staging copy queued during DoSaveState. Every copy is issued before any of them is
+  // read back, so serializing the whole cache drains the GPU pipeline once, not once per texture.
+  struct PendingTextureReadback
+  {
+    std::unique_ptr<AbstractStagingTexture> staging;
+    MathUtil::Rectangle<int> rect;
+    u8* dst;
+    u32 stride;
+  };
+
+  void SerializeTexture(AbstractTexture* tex, const TextureConfig& config, PointerWrap& p,
+                        std::vector<PendingTextureReadback>* pending_readbacks);
   void DoSaveState(PointerWrap& p);
   void DoLoadState(PointerWrap& p);
 
@@ -335,6 +383,35 @@ private:
   TexPool texture_pool;
   u64 last_entry_id = 0;
 
+  // Estimated bytes of GPU memory held by cache entries and pooled textures. Maintained where
+  // textures are created (AllocateTexture) and destroyed (pool aging, Invalidate), so it covers
+  // pooled textures that no entry references anymore.
+  u64 estimated_texture_memory = 0;
+  // Set while the estimate exceeds the configured budget; cleared with hysteresis in Cleanup().
+  bool over_texture_budget = false;
+
+  // Texture dumping reads back on the video thread but queues PNG compression and file IO to a
+  // worker thread. The basename set (basenames include the texture hash) deduplicates repeat
+  // uploads of already-dumped textures without touching the file system.
+  struct TextureDumpRequest
+  {
+    std::string filename;
+    std::vector<u8> texture_data;
+    u32 width;
+    u32 height;
+    u32 stride;
+  };
+  Common::WorkQueueThread<TextureDumpRequest> texture_dump_thread;
+  bool texture_dump_thread_started = false;
+  std::unordered_set<std::string> dumped_textures;
+
+  // See BumpMemoryGeneration(). The epoch advances once per frame in Cleanup(), so CPU writes to
+  // copy regions (which don't bump page generations) are still caught by one rehash per frame.
+  static constexpr u32 MEMORY_GENERATION_PAGE_BITS = 12;
+  std::unordered_map<u32, u64> memory_page_generations;
+  u64 current_memory_generation = 1;
+  u64 memory_validation_epoch = 1;
+
   // Backup configuration values
   struct BackupConfig
   {
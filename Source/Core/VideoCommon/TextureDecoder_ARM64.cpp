@@ -0,0 +1,352 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <arm_neon.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+
+#include "VideoCommon/LookUpTables.h"
+#include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/TextureDecoder_Util.h"
+#include "VideoCommon/VideoConfig.h"
+
+// GameCube/Wii texture decoder with NEON kernels for the hot formats.
+// Formats without a vector kernel use the same scalar code as TextureDecoder_Generic.
+
+static inline u32 DecodePixel_IA8(u16 val)
+{
+  int a = val & 0xFF;
+  int i = val >> 8;
+  return i | (i << 8) | (i << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_RGB565(u16 val)
+{
+  int r, g, b, a;
+  r = Convert5To8((val >> 11) & 0x1f);
+  g = Convert6To8((val >> 5) & 0x3f);
+  b = Convert5To8((val)&0x1f);
+  a = 0xFF;
+  return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_RGB5A3(u16 val)
+{
+  int r, g, b, a;
+  if ((val & 0x8000))
+  {
+    r = Convert5To8((val >> 10) & 0x1f);
+    g = Convert5To8((val >> 5) & 0x1f);
+    b = Convert5To8((val)&0x1f);
+    a = 0xFF;
+  }
+  else
+  {
+    a = Convert3To8((val >> 12) & 0x7);
+    r = Convert4To8((val >> 8) & 0xf);
+    g = Convert4To8((val >> 4) & 0xf);
+    b = Convert4To8((val)&0xf);
+  }
+  return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static inline u32 DecodePixel_Paletted(u16 pixel, TLUTFormat tlutfmt)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    return DecodePixel_IA8(pixel);
+  case TLUTFormat::RGB565:
+    return DecodePixel_RGB565(Common::swap16(pixel));
+  case TLUTFormat::RGB5A3:
+    return DecodePixel_RGB5A3(Common::swap16(pixel));
+  default:
+    return 0;
+  }
+}
+
+static inline void DecodeBytes_C4(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  const u16* tlut = (u16*)tlut_;
+  for (int x = 0; x < 4; x++)
+  {
+    u8 val = src[x];
+    *dst++ = DecodePixel_Paletted(tlut[val >> 4], tlutfmt);
+    *dst++ = DecodePixel_Paletted(tlut[val & 0xF], tlutfmt);
+  }
+}
+
+static inline void DecodeBytes_C8(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  const u16* tlut = (u16*)tlut_;
+  for (int x = 0; x < 8; x++)
+  {
+    u8 val = src[x];
+    *dst++ = DecodePixel_Paletted(tlut[val], tlutfmt);
+  }
+}
+
+static inline void DecodeBytes_C14X2(u32* dst, const u16* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  const u16* tlut = (u16*)tlut_;
+  for (int x = 0; x < 4; x++)
+  {
+    u16 val = Common::swap16(src[x]);
+    *dst++ = DecodePixel_Paletted(tlut[(val & 0x3FFF)], tlutfmt);
+  }
+}
+
+// Duplicates each byte of the input four times, e.g. to splat an intensity value
+// across all four channels of an RGBA8 texel.
+static inline uint8x16x2_t SplatBytesToRGBA(uint8x8_t v)
+{
+  const uint8x8x2_t pairs = vzip_u8(v, v);
+  const uint16x8_t doubled = vreinterpretq_u16_u8(vcombine_u8(pairs.val[0], pairs.val[1]));
+  const uint16x8x2_t quads = vzipq_u16(doubled, doubled);
+
+  uint8x16x2_t result;
+  result.val[0] = vreinterpretq_u8_u16(quads.val[0]);
+  result.val[1] = vreinterpretq_u8_u16(quads.val[1]);
+  return result;
+}
+
+// One row of an I4 block: 4 source bytes -> 8 RGBA texels.
+static inline void DecodeBytes_I4(u32* dst, const u8* src)
+{
+  u32 packed;
+  std::memcpy(&packed, src, sizeof(packed));
+  const uint8x8_t raw = vreinterpret_u8_u32(vdup_n_u32(packed));
+  const uint8x8_t hi = vshr_n_u8(raw, 4);
+  const uint8x8_t lo = vand_u8(raw, vdup_n_u8(0xF));
+  // Texel order within a byte is high nibble first.
+  const uint8x8_t nibbles = vzip_u8(hi, lo).val[0];
+  const uint8x8_t intensity = vmul_u8(nibbles, vdup_n_u8(0x11));  // Convert4To8
+
+  const uint8x16x2_t rgba = SplatBytesToRGBA(intensity);
+  vst1q_u8(reinterpret_cast<u8*>(dst), rgba.val[0]);
+  vst1q_u8(reinterpret_cast<u8*>(dst) + 16, rgba.val[1]);
+}
+
+// One row of an I8 block: 8 source bytes -> 8 RGBA texels.
+static inline void DecodeBytes_I8(u32* dst, const u8* src)
+{
+  const uint8x16x2_t rgba = SplatBytesToRGBA(vld1_u8(src));
+  vst1q_u8(reinterpret_cast<u8*>(dst), rgba.val[0]);
+  vst1q_u8(reinterpret_cast<u8*>(dst) + 16, rgba.val[1]);
+}
+
+// One row of an IA4 block: 8 source bytes -> 8 RGBA texels of LLLA.
+static inline void DecodeBytes_IA4(u32* dst, const u8* src)
+{
+  const uint8x8_t raw = vld1_u8(src);
+  const uint8x8_t alpha = vmul_u8(vshr_n_u8(raw, 4), vdup_n_u8(0x11));
+  const uint8x8_t lum = vmul_u8(vand_u8(raw, vdup_n_u8(0xF)), vdup_n_u8(0x11));
+
+  const uint8x8x2_t ll = vzip_u8(lum, lum);
+  const uint8x8x2_t la = vzip_u8(lum, alpha);
+  const uint16x8_t ll16 = vreinterpretq_u16_u8(vcombine_u8(ll.val[0], ll.val[1]));
+  const uint16x8_t la16 = vreinterpretq_u16_u8(vcombine_u8(la.val[0], la.val[1]));
+  const uint16x8x2_t texels = vzipq_u16(ll16, la16);
+
+  vst1q_u8(reinterpret_cast<u8*>(dst), vreinterpretq_u8_u16(texels.val[0]));
+  vst1q_u8(reinterpret_cast<u8*>(dst) + 16, vreinterpretq_u8_u16(texels.val[1]));
+}
+
+// One row of an IA8 block: 8 source bytes ([A, I] pairs) -> 4 RGBA texels of IIIA.
+static inline void DecodeBytes_IA8(u32* dst, const u8* src)
+{
+  static constexpr u8 shuffle[16] = {1, 1, 1, 0, 3, 3, 3, 2, 5, 5, 5, 4, 7, 7, 7, 6};
+  const uint8x8_t raw = vld1_u8(src);
+  const uint8x16_t texels = vqtbl1q_u8(vcombine_u8(raw, raw), vld1q_u8(shuffle));
+  vst1q_u8(reinterpret_cast<u8*>(dst), texels);
+}
+
+// Two rows of an RGB565 block: 16 source bytes -> 2x4 RGBA texels.
+static inline void DecodeBytes_RGB565_TwoRows(u32* dst_a, u32* dst_b, const u8* src)
+{
+  const uint16x8_t val = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+  const uint16x8_t r5 = vshrq_n_u16(val, 11);
+  const uint16x8_t g6 = vandq_u16(vshrq_n_u16(val, 5), vdupq_n_u16(0x3F));
+  const uint16x8_t b5 = vandq_u16(val, vdupq_n_u16(0x1F));
+
+  const uint8x8_t r = vmovn_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)));
+  const uint8x8_t g = vmovn_u16(vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4)));
+  const uint8x8_t b = vmovn_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)));
+
+  const uint8x8x2_t rg = vzip_u8(r, g);
+  const uint8x8x2_t ba = vzip_u8(b, vdup_n_u8(0xFF));
+  const uint16x8_t rg16 = vreinterpretq_u16_u8(vcombine_u8(rg.val[0], rg.val[1]));
+  const uint16x8_t ba16 = vreinterpretq_u16_u8(vcombine_u8(ba.val[0], ba.val[1]));
+  const uint16x8x2_t texels = vzipq_u16(rg16, ba16);
+
+  vst1q_u8(reinterpret_cast<u8*>(dst_a), vreinterpretq_u8_u16(texels.val[0]));
+  vst1q_u8(reinterpret_cast<u8*>(dst_b), vreinterpretq_u8_u16(texels.val[1]));
+}
+
+static inline void DecodeBytes_RGB5A3(u32* dst, const u16* src)
+{
+  dst[0] = DecodePixel_RGB5A3(Common::swap16(src[0]));
+  dst[1] = DecodePixel_RGB5A3(Common::swap16(src[1]));
+  dst[2] = DecodePixel_RGB5A3(Common::swap16(src[2]));
+  dst[3] = DecodePixel_RGB5A3(Common::swap16(src[3]));
+}
+
+static inline void DecodeBytes_RGBA8(u32* dst, const u16* src, const u16* src2)
+{
+  dst[0] = ((src[0] & 0xFF) << 24) | ((src[0] & 0xFF00) >> 8) | (src2[0] << 8);
+  dst[1] = ((src[1] & 0xFF) << 24) | ((src[1] & 0xFF00) >> 8) | (src2[1] << 8);
+  dst[2] = ((src[2] & 0xFF) << 24) | ((src[2] & 0xFF00) >> 8) | (src2[2] << 8);
+  dst[3] = ((src[3] & 0xFF) << 24) | ((src[3] & 0xFF00) >> 8) | (src2[3] << 8);
+}
+
+static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  // The color endpoints are computed with the same scalar math as the generic decoder
+  // (GCN's DXT1 variant differs from PC S3TC, so no native formats apply); the per-texel
+  // selection is then a NEON table lookup into the four decoded colors.
+  u16 c1 = Common::swap16(src->color1);
+  u16 c2 = Common::swap16(src->color2);
+  int blue1 = Convert5To8(c1 & 0x1F);
+  int blue2 = Convert5To8(c2 & 0x1F);
+  int green1 = Convert6To8((c1 >> 5) & 0x3F);
+  int green2 = Convert6To8((c2 >> 5) & 0x3F);
+  int red1 = Convert5To8((c1 >> 11) & 0x1F);
+  int red2 = Convert5To8((c2 >> 11) & 0x1F);
+  alignas(16) u32 colors[4];
+  colors[0] = MakeRGBA(red1, green1, blue1, 255);
+  colors[1] = MakeRGBA(red2, green2, blue2, 255);
+  if (c1 > c2)
+  {
+    colors[2] =
+        MakeRGBA(DXTBlend(red2, red1), DXTBlend(green2, green1), DXTBlend(blue2, blue1), 255);
+    colors[3] =
+        MakeRGBA(DXTBlend(red1, red2), DXTBlend(green1, green2), DXTBlend(blue1, blue2), 255);
+  }
+  else
+  {
+    // color[3] is the same as color[2] (average of both colors), but transparent.
+    // This differs from DXT1 where color[3] is transparent black.
+    colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
+    colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
+  }
+
+  const uint8x16_t palette = vld1q_u8(reinterpret_cast<const u8*>(colors));
+  // Expands the four 2-bit selectors of one block line (MSB first) into byte indices
+  // covering the four bytes of each selected palette color.
+  static constexpr s8 selector_shifts[16] = {-6, -6, -6, -6, -4, -4, -4, -4,
+                                             -2, -2, -2, -2, 0,  0,  0,  0};
+  static constexpr u8 byte_offsets[16] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  const int8x16_t shifts = vld1q_s8(selector_shifts);
+  const uint8x16_t offsets = vld1q_u8(byte_offsets);
+
+  for (int y = 0; y < 4; y++)
+  {
+    const uint8x16_t line = vdupq_n_u8(src->lines[y]);
+    const uint8x16_t selectors = vandq_u8(vshlq_u8(line, shifts), vdupq_n_u8(3));
+    const uint8x16_t indices = vaddq_u8(vshlq_n_u8(selectors, 2), offsets);
+    vst1q_u8(reinterpret_cast<u8*>(dst), vqtbl1q_u8(palette, indices));
+    dst += pitch;
+  }
+}
+
+void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
+                            const u8* tlut, TLUTFormat tlutfmt)
+{
+  const int Wsteps4 = (width + 3) / 4;
+  const int Wsteps8 = (width + 7) / 8;
+
+  switch (texformat)
+  {
+  case TextureFormat::C4:
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+          DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, tlut, tlutfmt);
+    break;
+  case TextureFormat::I4:
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy++, src += 4)
+          DecodeBytes_I4(dst + (y + iy) * width + x, src);
+    break;
+  case TextureFormat::I8:  // speed critical
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+          DecodeBytes_I8(dst + (y + iy) * width + x, src);
+    break;
+  case TextureFormat::C8:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
+    break;
+  case TextureFormat::IA4:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_IA4(dst + (y + iy) * width + x, src + 8 * xStep);
+    break;
+  case TextureFormat::IA8:  // speed critical
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+          DecodeBytes_IA8(dst + (y + iy) * width + x, src);
+    break;
+  case TextureFormat::C14X2:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+          DecodeBytes_C14X2(dst + (y + iy) * width + x, (u16*)(src + 8 * xStep), tlut, tlutfmt);
+    break;
+  case TextureFormat::RGB565:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+          DecodeBytes_RGB565_TwoRows(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x,
+                                     src);
+    break;
+  case TextureFormat::RGB5A3:
+    // Data-dependent alpha mode per texel; the scalar version wins here.
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+          DecodeBytes_RGB5A3(dst + (y + iy) * width + x, (u16*)src);
+    break;
+  case TextureFormat::RGBA8:  // speed critical
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+      {
+        for (int iy = 0; iy < 4; iy++)
+          DecodeBytes_RGBA8(dst + (y + iy) * width + x, (u16*)src + 4 * iy,
+                            (u16*)src + 4 * iy + 16);
+        src += 64;
+      }
+    break;
+  case TextureFormat::CMPR:  // speed critical
+    // The metroid games use this format almost exclusively.
+    for (int y = 0; y < height; y += 8)
+    {
+      for (int x = 0; x < width; x += 8)
+      {
+        DecodeDXTBlock((u32*)dst + y * width + x, (DXTBlock*)src, width);
+        src += sizeof(DXTBlock);
+        DecodeDXTBlock((u32*)dst + y * width + x + 4, (DXTBlock*)src, width);
+        src += sizeof(DXTBlock);
+        DecodeDXTBlock((u32*)dst + (y + 4) * width + x, (DXTBlock*)src, width);
+        src += sizeof(DXTBlock);
+        DecodeDXTBlock((u32*)dst + (y + 4) * width + x + 4, (DXTBlock*)src, width);
+        src += sizeof(DXTBlock);
+      }
+    }
+    break;
+  case TextureFormat::XFB:
+    TexDecoder_DecodeXFB(reinterpret_cast<u8*>(dst), src, width, height, width * 2);
+    break;
+  }
+}
@@ -2,12 +2,17 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
+#include <memory>
+#include <thread>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
+#include "Common/Thread.h"
 
 #include "VideoCommon/LookUpTables.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -373,10 +378,127 @@ static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat
   }
 }
 
+namespace
+{
+// Large textures are decoded in horizontal strips on a small pool of worker threads.
+// GX textures store their blocks in raster order, so a strip that is a whole number of
+// block rows is contiguous in both the source and destination and can be decoded by
+// passing offset pointers and a reduced height to the regular decoder.
+class ParallelDecoder
+{
+public:
+  ParallelDecoder()
+  {
+    const unsigned int cores = std::thread::hardware_concurrency();
+    m_num_workers = std::min(cores > 1 ? cores - 1 : 0u, 3u);
+    m_workers = std::make_unique<Worker[]>(m_num_workers);
+    for (u32 i = 0; i < m_num_workers; i++)
+    {
+      m_workers[i].thread = std::thread([this, i] {
+        Common::SetCurrentThreadName("Texture decoder");
+        Worker& worker = m_workers[i];
+        while (true)
+        {
+          worker.start.Wait();
+          if (m_shutting_down.load())
+            return;
+          DecodeStrip(i + 1);
+          worker.done.Set();
+        }
+      });
+    }
+  }
+
+  ~ParallelDecoder()
+  {
+    m_shutting_down.store(true);
+    for (u32 i = 0; i < m_num_workers; i++)
+      m_workers[i].start.Set();
+    for (u32 i = 0; i < m_num_workers; i++)
+      m_workers[i].thread.join();
+  }
+
+  bool ShouldUseFor(int width, int height, TextureFormat texformat) const
+  {
+    return m_num_workers != 0 && width * height >= 512 * 512 &&
+           height >= (m_num_workers + 1) * TexDecoder_GetBlockHeightInTexels(texformat);
+  }
+
+  void Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
+              const u8* tlut, TLUTFormat tlutfmt)
+  {
+    m_dst = dst;
+    m_src = src;
+    m_width = width;
+    m_height = height;
+    m_texformat = texformat;
+    m_tlut = tlut;
+    m_tlutfmt = tlutfmt;
+
+    const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+    const int block_rows = height / block_height;
+    m_strip_height = (block_rows / (m_num_workers + 1)) * block_height;
+
+    for (u32 i = 0; i < m_num_workers; i++)
+      m_workers[i].start.Set();
+
+    // The caller decodes the first strip (plus any remainder rows) itself.
+    DecodeStrip(0);
+
+    for (u32 i = 0; i < m_num_workers; i++)
+      m_workers[i].done.Wait();
+  }
+
+private:
+  struct Worker
+  {
+    std::thread thread;
+    Common::Event start;
+    Common::Event done;
+  };
+
+  void DecodeStrip(u32 index)
+  {
+    const int y_begin = index * m_strip_height;
+    const int y_end = (index == m_num_workers) ? m_height : y_begin + m_strip_height;
+    if (y_begin >= y_end)
+      return;
+
+    const u8* const src = m_src + TexDecoder_GetTextureSizeInBytes(m_width, y_begin, m_texformat);
+    u8* const dst = m_dst + static_cast<size_t>(y_begin) * m_width * sizeof(u32);
+    _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst), src, m_width, y_end - y_begin,
+                           m_texformat, m_tlut, m_tlutfmt);
+  }
+
+  std::unique_ptr<Worker[]> m_workers;
+  u32 m_num_workers = 0;
+  std::atomic<bool> m_shutting_down{false};
+
+  u8* m_dst = nullptr;
+  const u8* m_src = nullptr;
+  int m_width = 0;
+  int m_height = 0;
+  int m_strip_height = 0;
+  TextureFormat m_texformat = TextureFormat::I4;
+  const u8* m_tlut = nullptr;
+  TLUTFormat m_tlutfmt = TLUTFormat::IA8;
+};
+
+ParallelDecoder& GetParallelDecoder()
+{
+  static ParallelDecoder s_parallel_decoder;
+  return s_parallel_decoder;
+}
+}  // namespace
+
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt)
 {
-  _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  ParallelDecoder& parallel_decoder = GetParallelDecoder();
+  if (parallel_decoder.ShouldUseFor(width, height, texformat))
+    parallel_decoder.Decode(dst, src, width, height, texformat, tlut, tlutfmt);
+  else
+    _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
 
   if (TexFmt_Overlay_Enable)
     TexDecoder_DrawOverlay(dst, width, height, texformat);
@@ -0,0 +1,572 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TextureTranscoding.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <fmt/format.h>
+#include <xxhash.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace TextureTranscoding
+{
+namespace
+{
+// BC7 block decoder. Tables and decoding procedure follow the Khronos Data Format /
+// D3D11 functional spec for BPTC.
+
+struct BC7ModeInfo
+{
+  u8 num_subsets;
+  u8 partition_bits;
+  u8 rotation_bits;
+  u8 index_selection_bits;
+  u8 color_bits;
+  u8 alpha_bits;
+  u8 endpoint_pbits;  // 1 = one p-bit per endpoint
+  u8 shared_pbits;    // 1 = one p-bit per subset
+  u8 index_bits;
+  u8 index2_bits;
+};
+
+constexpr std::array<BC7ModeInfo, 8> BC7_MODES{{
+    {3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+    {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+    {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+    {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+    {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+    {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+    {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+    {2, 6, 0, 0, 5, 5, 1, 0, 2, 0},
+}};
+
+// Subset index for each texel, for every 2-subset partition shape.
+constexpr u8 BC7_PARTITION_TABLE_2[64][16] = {
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1},
+    {0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1},
+    {0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1},
+    {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1},
+    {0, 0, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1},
+    {0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1},
+    {0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1},
+    {0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1},
+    {0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0},
+    {0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0},
+    {0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0},
+    {0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1},
+    {0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0},
+    {0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0},
+    {0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0},
+    {0, 0, 1, 1, 0, 1, 1, 0, 0, 1, 1, 0, 1, 1, 0, 0},
+    {0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0},
+    {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0},
+    {0, 1, 1, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1},
+    {0, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1},
+    {0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1},
+    {0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0},
+    {0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0},
+    {0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0},
+    {0, 1, 0, 1, 0, 1, 0, 1, 1, 0, 1, 0, 1, 0, 1, 0},
+    {0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1},
+    {0, 1, 0, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1},
+    {0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0},
+    {0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0},
+    {0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 0, 0},
+    {0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0},
+    {0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0},
+    {0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1},
+    {0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0},
+    {0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0},
+    {0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0},
+    {0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0},
+    {0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0},
+    {0, 1, 1, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1},
+    {0, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0, 0, 1, 0, 0, 1},
+    {0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0},
+    {0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0},
+    {0, 1, 1, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1},
+    {0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 1},
+    {0, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1},
+    {0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1},
+    {0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1},
+    {0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0},
+    {0, 0, 1, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0},
+    {0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1},
+};
+
+// Subset index for each texel, for every 3-subset partition shape.
+constexpr u8 BC7_PARTITION_TABLE_3[64][16] = {
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2},
+    {0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+    {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2},
+    {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2},
+    {0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1},
+    {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2},
+    {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2},
+    {0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2},
+    {0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2},
+    {0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+    {0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0},
+    {0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2},
+    {0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0},
+    {0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2},
+    {0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1},
+    {0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2},
+    {0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2},
+    {0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0},
+    {0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0},
+    {0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2},
+    {0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0},
+    {0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1},
+    {0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2},
+    {0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1},
+    {0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1},
+    {0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+    {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1},
+    {0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2},
+    {0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0},
+    {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0},
+    {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0},
+    {0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0},
+    {0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1},
+    {0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1},
+    {0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2},
+    {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1},
+    {0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1},
+    {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1},
+    {0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1},
+    {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2},
+    {0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1},
+    {0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2},
+    {0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2},
+    {0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2},
+    {0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2},
+    {0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2},
+    {0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2},
+    {0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1},
+    {0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2},
+    {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0},
+};
+
+// Texels whose index is stored with one less bit, per partition shape.
+constexpr u8 BC7_ANCHOR_2[64] = {
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 2,  8,  2,  2,  8,  8,  15, 2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15, 6,  8,  2,  8,  15, 15, 2,  8,  2,  2,  2,  15, 15, 6,
+    6,  2,  6,  8,  15, 15, 2,  2,  15, 15, 15, 15, 15, 2,  2,  15,
+};
+constexpr u8 BC7_ANCHOR_3_SUBSET1[64] = {
+    3,  3,  15, 15, 8,  3,  15, 15, 8,  8,  6,  6,  6,  5,  3,  3,
+    3,  3,  8,  15, 3,  3,  6,  10, 5,  8,  8,  6,  8,  5,  15, 15,
+    8,  15, 3,  5,  6,  10, 8,  15, 15, 3,  15, 5,  15, 15, 15, 15,
+    3,  15, 5,  5,  5,  8,  5,  10, 5,  10, 8,  13, 15, 12, 3,  3,
+};
+constexpr u8 BC7_ANCHOR_3_SUBSET2[64] = {
+    15, 8,  8,  3,  15, 15, 3,  8,  15, 15, 15, 15, 15, 15, 15, 8,
+    15, 8,  15, 3,  15, 8,  15, 8,  3,  15, 6,  10, 15, 15, 10, 8,
+    15, 3,  15, 10, 10, 8,  9,  10, 6,  15, 8,  15, 3,  6,  6,  8,
+    15, 3,  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3,  15, 15, 8,
+};
+
+constexpr u8 BC7_WEIGHTS_2[4] = {0, 21, 43, 64};
+constexpr u8 BC7_WEIGHTS_3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+constexpr u8 BC7_WEIGHTS_4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+const u8* GetBC7WeightTable(u32 index_bits)
+{
+  switch (index_bits)
+  {
+  case 2:
+    return BC7_WEIGHTS_2;
+  case 3:
+    return BC7_WEIGHTS_3;
+  default:
+    return BC7_WEIGHTS_4;
+  }
+}
+
+struct BitReader
+{
+  const u8* data;
+  u32 position = 0;
+
+  u32 Read(u32 count)
+  {
+    u32 value = 0;
+    for (u32 i = 0; i < count; i++)
+    {
+      value |= ((data[position >> 3] >> (position & 7)) & 1u) << i;
+      position++;
+    }
+    return value;
+  }
+};
+
+u8 Interpolate(u8 e0, u8 e1, u8 weight)
+{
+  return static_cast<u8>((e0 * (64 - weight) + e1 * weight + 32) >> 6);
+}
+
+void DecodeBC7Block(const u8* block, u8 out[16][4])
+{
+  BitReader bits{block};
+
+  u32 mode = 0;
+  while (mode < 8 && bits.Read(1) == 0)
+    mode++;
+  if (mode == 8)
+  {
+    // Reserved encoding; the spec requires decoding to transparent black.
+    std::memset(out, 0, 16 * 4);
+    return;
+  }
+
+  const BC7ModeInfo& mi = BC7_MODES[mode];
+  const u32 partition = bits.Read(mi.partition_bits);
+  const u32 rotation = bits.Read(mi.rotation_bits);
+  const u32 index_selection = bits.Read(mi.index_selection_bits);
+  const u32 num_endpoints = mi.num_subsets * 2;
+
+  // Endpoints are stored component-major: all red values, then green, blue, alpha.
+  u32 endpoints[6][4];
+  for (u32 c = 0; c < 3; c++)
+  {
+    for (u32 e = 0; e < num_endpoints; e++)
+      endpoints[e][c] = bits.Read(mi.color_bits);
+  }
+  for (u32 e = 0; e < num_endpoints && mi.alpha_bits != 0; e++)
+    endpoints[e][3] = bits.Read(mi.alpha_bits);
+
+  u32 pbits[6] = {};
+  bool has_pbits = false;
+  if (mi.endpoint_pbits)
+  {
+    has_pbits = true;
+    for (u32 e = 0; e < num_endpoints; e++)
+      pbits[e] = bits.Read(1);
+  }
+  else if (mi.shared_pbits)
+  {
+    has_pbits = true;
+    for (u32 s = 0; s < mi.num_subsets; s++)
+    {
+      const u32 pbit = bits.Read(1);
+      pbits[s * 2 + 0] = pbit;
+      pbits[s * 2 + 1] = pbit;
+    }
+  }
+
+  // Dequantize endpoints to 8 bits.
+  for (u32 e = 0; e < num_endpoints; e++)
+  {
+    for (u32 c = 0; c < 4; c++)
+    {
+      u32 component_bits = c == 3 ? mi.alpha_bits : mi.color_bits;
+      if (c == 3 && component_bits == 0)
+      {
+        endpoints[e][3] = 255;
+        continue;
+      }
+      u32 value = endpoints[e][c];
+      if (has_pbits)
+      {
+        value = (value << 1) | pbits[e];
+        component_bits++;
+      }
+      value <<= (8 - component_bits);
+      value |= value >> component_bits;
+      endpoints[e][c] = value;
+    }
+  }
+
+  const auto subset_of_texel = [&](u32 i) -> u32 {
+    if (mi.num_subsets == 2)
+      return BC7_PARTITION_TABLE_2[partition][i];
+    if (mi.num_subsets == 3)
+      return BC7_PARTITION_TABLE_3[partition][i];
+    return 0;
+  };
+  const auto anchor_of_subset = [&](u32 s) -> u32 {
+    if (s == 0)
+      return 0;
+    if (mi.num_subsets == 2)
+      return BC7_ANCHOR_2[partition];
+    return s == 1 ? BC7_ANCHOR_3_SUBSET1[partition] : BC7_ANCHOR_3_SUBSET2[partition];
+  };
+
+  // Primary index block, then the secondary one for the dual-index modes. Anchor texels
+  // drop their (implicitly zero) most significant bit.
+  u8 index1[16];
+  u8 index2[16] = {};
+  for (u32 i = 0; i < 16; i++)
+  {
+    const u32 anchored = i == anchor_of_subset(subset_of_texel(i)) ? 1 : 0;
+    index1[i] = static_cast<u8>(bits.Read(mi.index_bits - anchored));
+  }
+  for (u32 i = 0; i < 16 && mi.index2_bits != 0; i++)
+    index2[i] = static_cast<u8>(bits.Read(mi.index2_bits - (i == 0 ? 1 : 0)));
+
+  const u8* weights1 = GetBC7WeightTable(mi.index_bits);
+  const u8* weights2 = GetBC7WeightTable(mi.index2_bits);
+
+  for (u32 i = 0; i < 16; i++)
+  {
+    const u32 s = subset_of_texel(i);
+    const u32* e0 = endpoints[s * 2 + 0];
+    const u32* e1 = endpoints[s * 2 + 1];
+
+    u8 color_weight = weights1[index1[i]];
+    u8 alpha_weight = mi.index2_bits != 0 ? weights2[index2[i]] : color_weight;
+    // The index selection bit swaps which index block drives color vs. alpha.
+    if (index_selection != 0)
+      std::swap(color_weight, alpha_weight);
+
+    for (u32 c = 0; c < 3; c++)
+      out[i][c] = Interpolate(static_cast<u8>(e0[c]), static_cast<u8>(e1[c]), color_weight);
+    out[i][3] = Interpolate(static_cast<u8>(e0[3]), static_cast<u8>(e1[3]), alpha_weight);
+
+    if (rotation != 0)
+      std::swap(out[i][3], out[i][rotation - 1]);
+  }
+}
+
+// Fast single-pass DXT5 (BC3) encoder: channel-bounds endpoints, nearest palette entry
+// per texel. Not as good as an offline encoder, but this only runs as a compatibility
+// fallback and the result is cached.
+u16 To565(const u8* color)
+{
+  return static_cast<u16>(((color[0] >> 3) << 11) | ((color[1] >> 2) << 5) | (color[2] >> 3));
+}
+
+void From565(u16 value, u8* color)
+{
+  const u8 r = (value >> 11) & 0x1F;
+  const u8 g = (value >> 5) & 0x3F;
+  const u8 b = value & 0x1F;
+  color[0] = (r << 3) | (r >> 2);
+  color[1] = (g << 2) | (g >> 4);
+  color[2] = (b << 3) | (b >> 2);
+}
+
+void EncodeBlockDXT5(const u8 pixels[16][4], u8* out)
+{
+  // Alpha: interpolated 8-entry mode (alpha0 > alpha1).
+  u8 alpha_min = 255, alpha_max = 0;
+  for (u32 i = 0; i < 16; i++)
+  {
+    alpha_min = std::min(alpha_min, pixels[i][3]);
+    alpha_max = std::max(alpha_max, pixels[i][3]);
+  }
+
+  out[0] = alpha_max;
+  out[1] = alpha_min;
+  u64 alpha_indices = 0;
+  if (alpha_max > alpha_min)
+  {
+    u8 palette[8] = {alpha_max, alpha_min};
+    for (u32 i = 2; i < 8; i++)
+      palette[i] = static_cast<u8>(((8 - i) * alpha_max + (i - 1) * alpha_min + 3) / 7);
+
+    for (u32 i = 0; i < 16; i++)
+    {
+      u32 best_index = 0;
+      int best_error = std::abs(pixels[i][3] - palette[0]);
+      for (u32 j = 1; j < 8; j++)
+      {
+        const int error = std::abs(pixels[i][3] - palette[j]);
+        if (error < best_error)
+        {
+          best_error = error;
+          best_index = j;
+        }
+      }
+      alpha_indices |= static_cast<u64>(best_index) << (3 * i);
+    }
+  }
+  for (u32 i = 0; i < 6; i++)
+    out[2 + i] = static_cast<u8>(alpha_indices >> (8 * i));
+
+  // Color: bounding-box endpoints in 565, four-color mode.
+  u8 color_min[3] = {255, 255, 255};
+  u8 color_max[3] = {0, 0, 0};
+  for (u32 i = 0; i < 16; i++)
+  {
+    for (u32 c = 0; c < 3; c++)
+    {
+      color_min[c] = std::min(color_min[c], pixels[i][c]);
+      color_max[c] = std::max(color_max[c], pixels[i][c]);
+    }
+  }
+
+  u16 c0 = To565(color_max);
+  u16 c1 = To565(color_min);
+  u32 color_indices = 0;
+  if (c0 != c1)
+  {
+    if (c0 < c1)
+      std::swap(c0, c1);
+
+    u8 palette[4][3];
+    From565(c0, palette[0]);
+    From565(c1, palette[1]);
+    for (u32 c = 0; c < 3; c++)
+    {
+      palette[2][c] = static_cast<u8>((2 * palette[0][c] + palette[1][c] + 1) / 3);
+      palette[3][c] = static_cast<u8>((palette[0][c] + 2 * palette[1][c] + 1) / 3);
+    }
+
+    for (u32 i = 0; i < 16; i++)
+    {
+      u32 best_index = 0;
+      int best_error = std::numeric_limits<int>::max();
+      for (u32 j = 0; j < 4; j++)
+      {
+        int error = 0;
+        for (u32 c = 0; c < 3; c++)
+        {
+          const int diff = pixels[i][c] - palette[j][c];
+          error += diff * diff;
+        }
+        if (error < best_error)
+        {
+          best_error = error;
+          best_index = j;
+        }
+      }
+      color_indices |= best_index << (2 * i);
+    }
+  }
+
+  out[8] = static_cast<u8>(c0);
+  out[9] = static_cast<u8>(c0 >> 8);
+  out[10] = static_cast<u8>(c1);
+  out[11] = static_cast<u8>(c1 >> 8);
+  for (u32 i = 0; i < 4; i++)
+    out[12 + i] = static_cast<u8>(color_indices >> (8 * i));
+}
+
+std::string GetCacheFilename(u64 hash, u32 width, u32 height, AbstractTextureFormat target)
+{
+  const char* suffix = target == AbstractTextureFormat::DXT5 ? "dxt5" : "rgba8";
+  return fmt::format("{}{:016x}-{}x{}.{}", File::GetUserPath(D_CACHE_IDX) + "TranscodedTextures/",
+                     hash, width, height, suffix);
+}
+}  // Anonymous namespace
+
+AbstractTextureFormat GetTranscodeTargetForBPTC()
+{
+  // Prefer another compressed format so the fallback doesn't quadruple VRAM use.
+  if (g_ActiveConfig.backend_info.bSupportsST3CTextures)
+    return AbstractTextureFormat::DXT5;
+  return AbstractTextureFormat::RGBA8;
+}
+
+std::vector<u8> TranscodeBPTC(const u8* src, size_t src_size, u32 width, u32 height,
+                              AbstractTextureFormat target)
+{
+  const u32 blocks_wide = (width + 3) / 4;
+  const u32 blocks_high = (height + 3) / 4;
+  if (src_size < static_cast<size_t>(blocks_wide) * blocks_high * 16)
+    return {};
+
+  const size_t out_size = target == AbstractTextureFormat::DXT5 ?
+                              static_cast<size_t>(blocks_wide) * blocks_high * 16 :
+                              static_cast<size_t>(width) * height * 4;
+
+  // The decode+re-encode only has to happen the first time a pack is seen on a machine
+  // that needs the fallback; afterwards the result is loaded straight from the cache.
+  const u64 hash = XXH64(src, src_size, 0);
+  const std::string cache_filename = GetCacheFilename(hash, width, height, target);
+  {
+    File::IOFile cache_file(cache_filename, "rb");
+    if (cache_file.IsOpen() && cache_file.GetSize() == out_size)
+    {
+      std::vector<u8> data(out_size);
+      if (cache_file.ReadBytes(data.data(), data.size()))
+        return data;
+    }
+  }
+
+  std::vector<u8> out(out_size);
+  for (u32 by = 0; by < blocks_high; by++)
+  {
+    for (u32 bx = 0; bx < blocks_wide; bx++)
+    {
+      u8 pixels[16][4];
+      DecodeBC7Block(&src[(static_cast<size_t>(by) * blocks_wide + bx) * 16], pixels);
+
+      if (target == AbstractTextureFormat::DXT5)
+      {
+        EncodeBlockDXT5(pixels, &out[(static_cast<size_t>(by) * blocks_wide + bx) * 16]);
+      }
+      else
+      {
+        for (u32 py = 0; py < 4 && by * 4 + py < height; py++)
+        {
+          for (u32 px = 0; px < 4 && bx * 4 + px < width; px++)
+          {
+            const size_t offset =
+                (static_cast<size_t>(by * 4 + py) * width + (bx * 4 + px)) * 4;
+            std::memcpy(&out[offset], pixels[py * 4 + px], 4);
+          }
+        }
+      }
+    }
+  }
+
+  if (!File::CreateFullPath(cache_filename))
+    return out;
+  const std::string temp_filename = File::GetTempFilenameForAtomicWrite(cache_filename);
+  {
+    File::IOFile cache_file(temp_filename, "wb");
+    if (!cache_file.IsOpen() || !cache_file.WriteBytes(out.data(), out.size()))
+    {
+      File::Delete(temp_filename);
+      return out;
+    }
+  }
+  if (!File::Rename(temp_filename, cache_filename))
+    File::Delete(temp_filename);
+
+  return out;
+}
+}  // namespace TextureTranscoding
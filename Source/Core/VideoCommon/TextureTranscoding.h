@@ -0,0 +1,27 @@
+// Copyright 2021 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureConfig.h"
+
+// CPU fallback for compressed texture formats the backend can't consume directly.
+// Currently this handles BC7 (BPTC), which older GL drivers lack: instead of rejecting
+// the custom texture, the blocks are decoded and re-encoded to DXT5 (or expanded to
+// RGBA8 when S3TC is unavailable too), so one texture pack can be shared across a mixed
+// GPU fleet without uncompressed VRAM bloat on the machines that need the fallback.
+namespace TextureTranscoding
+{
+// The format BC7 data should be transcoded to on the active backend.
+AbstractTextureFormat GetTranscodeTargetForBPTC();
+
+// Transcodes one BC7 mip level. width/height are in texels and must describe the
+// source block layout (multiples of the 4x4 block size, except for the smallest mips).
+// Results are cached on disk keyed by a hash of the source blocks, so a pack is only
+// transcoded the first time it is seen. Returns an empty vector on failure.
+std::vector<u8> TranscodeBPTC(const u8* src, size_t src_size, u32 width, u32 height,
+                              AbstractTextureFormat target);
+}  // namespace TextureTranscoding
@@ -191,8 +191,9 @@ std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVt
 
   // Use the software loader as a fallback
   // (not currently applicable, as both VertexLoaderX64 and VertexLoaderARM64
-  // are always usable, but if a loader that only works on some CPUs is created
-  // then this fallback would be used)
+  // handle every attribute/format combination and are always usable, but if a
+  // loader that only works on some CPUs is created then this fallback would be
+  // used)
   if (!loader)
     loader = std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
 
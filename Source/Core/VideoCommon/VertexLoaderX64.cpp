@@ -98,7 +98,9 @@ int VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute, Com
        _mm_set_epi32(0xFFFFFFFFL, 0xFFFFFFFFL, 0x04050607L, 0x00010203L),   // 2x float
        _mm_set_epi32(0xFFFFFFFFL, 0x08090A0BL, 0x04050607L, 0x00010203L)},  // 3x float
   };
-  static const __m128 scale_factors[32] = {
+  // Entries past 31 exist so that the widening shift of signed formats can be
+  // folded into the dequantization multiply (exponent + 16 or + 24).
+  static const __m128 scale_factors[64] = {
       _mm_set_ps1(1. / (1u << 0)),  _mm_set_ps1(1. / (1u << 1)),  _mm_set_ps1(1. / (1u << 2)),
       _mm_set_ps1(1. / (1u << 3)),  _mm_set_ps1(1. / (1u << 4)),  _mm_set_ps1(1. / (1u << 5)),
       _mm_set_ps1(1. / (1u << 6)),  _mm_set_ps1(1. / (1u << 7)),  _mm_set_ps1(1. / (1u << 8)),
@@ -110,12 +112,41 @@ int VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute, Com
       _mm_set_ps1(1. / (1u << 24)), _mm_set_ps1(1. / (1u << 25)), _mm_set_ps1(1. / (1u << 26)),
       _mm_set_ps1(1. / (1u << 27)), _mm_set_ps1(1. / (1u << 28)), _mm_set_ps1(1. / (1u << 29)),
       _mm_set_ps1(1. / (1u << 30)), _mm_set_ps1(1. / (1u << 31)),
+      _mm_set_ps1(1. / (1ull << 32)), _mm_set_ps1(1. / (1ull << 33)),
+      _mm_set_ps1(1. / (1ull << 34)), _mm_set_ps1(1. / (1ull << 35)),
+      _mm_set_ps1(1. / (1ull << 36)), _mm_set_ps1(1. / (1ull << 37)),
+      _mm_set_ps1(1. / (1ull << 38)), _mm_set_ps1(1. / (1ull << 39)),
+      _mm_set_ps1(1. / (1ull << 40)), _mm_set_ps1(1. / (1ull << 41)),
+      _mm_set_ps1(1. / (1ull << 42)), _mm_set_ps1(1. / (1ull << 43)),
+      _mm_set_ps1(1. / (1ull << 44)), _mm_set_ps1(1. / (1ull << 45)),
+      _mm_set_ps1(1. / (1ull << 46)), _mm_set_ps1(1. / (1ull << 47)),
+      _mm_set_ps1(1. / (1ull << 48)), _mm_set_ps1(1. / (1ull << 49)),
+      _mm_set_ps1(1. / (1ull << 50)), _mm_set_ps1(1. / (1ull << 51)),
+      _mm_set_ps1(1. / (1ull << 52)), _mm_set_ps1(1. / (1ull << 53)),
+      _mm_set_ps1(1. / (1ull << 54)), _mm_set_ps1(1. / (1ull << 55)),
+      _mm_set_ps1(1. / (1ull << 56)), _mm_set_ps1(1. / (1ull << 57)),
+      _mm_set_ps1(1. / (1ull << 58)), _mm_set_ps1(1. / (1ull << 59)),
+      _mm_set_ps1(1. / (1ull << 60)), _mm_set_ps1(1. / (1ull << 61)),
+      _mm_set_ps1(1. / (1ull << 62)), _mm_set_ps1(1. / (1ull << 63)),
   };
 
   X64Reg coords = XMM0;
 
   int elem_size = GetElementSize(format);
   int load_bytes = elem_size * count_in;
+
+  // For signed formats on the SSSE3 path, the widening arithmetic shift can be
+  // folded into the dequantization multiply: PSHUFB leaves exact zeros below
+  // the value, so converting the unshifted value yields exactly x * 2^shift
+  // and scaling by 2^-(shift + exponent) produces bit-identical results with
+  // one shift less per attribute. (Not possible for unsigned formats, where
+  // the unshifted top bit would be read as a sign bit, nor on the SSE2 path,
+  // whose widening leaves duplicated bytes below the value, and only
+  // profitable when a scale multiply is emitted anyway.)
+  const int sign_shift = format == ComponentFormat::Byte ? 24 : 16;
+  const bool fold_sign_shift =
+      cpu_info.bSSSE3 && (format == ComponentFormat::Byte || format == ComponentFormat::Short) &&
+      dequantize && scaling_exponent != 0;
   OpArg dest = MDisp(dst_reg, m_dst_ofs);
 
   native_format->components = count_out;
@@ -141,9 +172,9 @@ int VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute, Com
     PSHUFB(coords, MPIC(&shuffle_lut[u32(format)][count_in - 1]));
 
     // Sign-extend.
-    if (format == ComponentFormat::Byte)
+    if (format == ComponentFormat::Byte && !fold_sign_shift)
       PSRAD(coords, 24);
-    if (format == ComponentFormat::Short)
+    if (format == ComponentFormat::Short && !fold_sign_shift)
       PSRAD(coords, 16);
   }
   else
@@ -235,7 +266,10 @@ int VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute, Com
     CVTDQ2PS(coords, R(coords));
 
     if (dequantize && scaling_exponent)
-      MULPS(coords, MPIC(&scale_factors[scaling_exponent]));
+    {
+      const int effective_exponent = scaling_exponent + (fold_sign_shift ? sign_shift : 0);
+      MULPS(coords, MPIC(&scale_factors[effective_exponent]));
+    }
   }
 
   switch (count_out)
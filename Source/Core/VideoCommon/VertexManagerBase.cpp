@@ -489,12 +489,26 @@ void VertexManagerBase::Flush()
     UpdatePipelineObject();
     if (m_current_pipeline_object)
     {
-      g_renderer->SetPipeline(m_current_pipeline_object);
+      // Skip the backend call if the previous GX draw left this pipeline bound. Utility draws
+      // reset m_previously_bound_pipeline, so the binding cannot have been overwritten.
+      if (m_current_pipeline_object != m_previously_bound_pipeline)
+      {
+        g_renderer->SetPipeline(m_current_pipeline_object);
+        m_previously_bound_pipeline = m_current_pipeline_object;
+      }
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 
       DrawCurrentBatch(base_index, num_indices, base_vertex);
       INCSTAT(g_stats.this_frame.num_draw_calls);
+      if (m_current_pipeline_is_uber)
+      {
+        INCSTAT(g_stats.this_frame.num_uber_draws);
+      }
+      else
+      {
+        INCSTAT(g_stats.this_frame.num_specialized_draws);
+      }
 
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
@@ -524,6 +538,9 @@ void VertexManagerBase::DoState(PointerWrap& p)
     // Clear all caches that touch RAM
     // (? these don't appear to touch any emulation state that gets saved. moved to on load only.)
     VertexLoaderManager::MarkAllDirty();
+
+    // bpmem/xfmem are restored wholesale on load, so the cached pixel shader UID is stale.
+    m_pixel_shader_uid_changed = true;
   }
 
   p.Do(m_zslope);
@@ -612,12 +629,22 @@ void VertexManagerBase::UpdatePipelineConfig()
     m_pipeline_config_changed = true;
   }
 
-  PixelShaderUid ps_uid = GetPixelShaderUid();
-  if (ps_uid != m_current_pipeline_config.ps_uid)
+  // Unlike the other shader UIDs, the pixel shader UID gathers fields from all over the sparse
+  // BP/XF register file, which is expensive to do for every draw. The register update functions
+  // set m_pixel_shader_uid_changed whenever a UID-relevant register actually changes, so the
+  // previous UID can be reused for the common case of consecutive draws with unrelated (or no)
+  // state changes in between.
+  if (m_pixel_shader_uid_changed)
   {
-    m_current_pipeline_config.ps_uid = ps_uid;
-    m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
-    m_pipeline_config_changed = true;
+    m_pixel_shader_uid_changed = false;
+
+    PixelShaderUid ps_uid = GetPixelShaderUid();
+    if (ps_uid != m_current_pipeline_config.ps_uid)
+    {
+      m_current_pipeline_config.ps_uid = ps_uid;
+      m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
+      m_pipeline_config_changed = true;
+    }
   }
 
   GeometryShaderUid gs_uid = GetGeometryShaderUid(GetCurrentPrimitiveType());
@@ -685,6 +712,7 @@ void VertexManagerBase::UpdatePipelineObject()
   {
     // Ubershaders disabled? Block and compile the specialized shader.
     m_current_pipeline_object = g_shader_cache->GetPipelineForUid(m_current_pipeline_config);
+    m_current_pipeline_is_uber = false;
   }
   break;
 
@@ -693,6 +721,7 @@ void VertexManagerBase::UpdatePipelineObject()
     // Exclusive ubershader mode, always use ubershaders.
     m_current_pipeline_object =
         g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+    m_current_pipeline_is_uber = true;
   }
   break;
 
@@ -705,6 +734,7 @@ void VertexManagerBase::UpdatePipelineObject()
     {
       // Specialized shaders are ready, prefer these.
       m_current_pipeline_object = *res;
+      m_current_pipeline_is_uber = false;
       return;
     }
 
@@ -713,6 +743,7 @@ void VertexManagerBase::UpdatePipelineObject()
       // Specialized shaders not ready, use the ubershaders.
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_current_pipeline_is_uber = true;
     }
     else
     {
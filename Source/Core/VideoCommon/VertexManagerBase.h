@@ -107,12 +107,22 @@ public:
   void SetRasterizationStateChanged() { m_rasterization_state_changed = true; }
   void SetDepthStateChanged() { m_depth_state_changed = true; }
   void SetBlendingStateChanged() { m_blending_state_changed = true; }
+  void SetPixelShaderUidChanged() { m_pixel_shader_uid_changed = true; }
   void InvalidatePipelineObject()
   {
     m_current_pipeline_object = nullptr;
+    m_previously_bound_pipeline = nullptr;
     m_pipeline_config_changed = true;
+
+    // The pixel shader UID reads host configuration (e.g. per-pixel lighting, fast depth) in
+    // addition to BP/XF state, so rebuild it whenever the pipeline is invalidated.
+    m_pixel_shader_uid_changed = true;
   }
 
+  // Call when something outside the GX draw path (e.g. a utility draw) may have changed the
+  // backend pipeline binding; the next Flush() will re-bind even if the pipeline is unchanged.
+  void InvalidateBoundPipeline() { m_previously_bound_pipeline = nullptr; }
+
   // Utility pipeline drawing (e.g. EFB copies, post-processing, UI).
   virtual void UploadUtilityUniforms(const void* uniforms, u32 uniforms_size);
   void UploadUtilityVertices(const void* vertices, u32 vertex_stride, u32 num_vertices,
@@ -186,6 +196,7 @@ protected:
   bool m_rasterization_state_changed = true;
   bool m_depth_state_changed = true;
   bool m_blending_state_changed = true;
+  bool m_pixel_shader_uid_changed = true;
   bool m_cull_all = false;
 
   IndexGenerator m_index_generator;
@@ -197,6 +208,14 @@ private:
   void UpdatePipelineConfig();
   void UpdatePipelineObject();
 
+  // The pipeline most recently handed to g_renderer->SetPipeline() by Flush(). While it still
+  // matches m_current_pipeline_object, the backend call can be skipped entirely.
+  const AbstractPipeline* m_previously_bound_pipeline = nullptr;
+
+  // Whether m_current_pipeline_object is an ubershader pipeline, either by choice or standing in
+  // for a specialized one still compiling. Feeds the draw counters in the statistics overlay.
+  bool m_current_pipeline_is_uber = false;
+
   bool m_is_flushed = true;
   FlushStatistics m_flush_statistics = {};
 
@@ -251,11 +251,19 @@ void VertexShaderManager::SetConstants()
     const float* norm =
         &xfmem.normalMatrices[3 * (g_main_cp_state.matrix_index_a.PosNormalMtxIdx & 31)];
 
-    memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
-    memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
-    memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
-    dirty = true;
+    // Games often re-select the same matrix between draws. Don't force a re-upload
+    // of the whole constant block unless the values actually changed.
+    if (memcmp(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4)) != 0 ||
+        memcmp(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float)) != 0 ||
+        memcmp(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float)) != 0 ||
+        memcmp(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float)) != 0)
+    {
+      memcpy(constants.posnormalmatrix.data(), pos, 3 * sizeof(float4));
+      memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
+      memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
+      memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
+      dirty = true;
+    }
   }
 
   if (bTexMatricesChanged[0])
@@ -270,9 +278,12 @@ void VertexShaderManager::SetConstants()
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      if (memcmp(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4)) != 0)
+      {
+        memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+        dirty = true;
+      }
     }
-    dirty = true;
   }
 
   if (bTexMatricesChanged[1])
@@ -287,9 +298,13 @@ void VertexShaderManager::SetConstants()
 
     for (size_t i = 0; i < pos_matrix_ptrs.size(); ++i)
     {
-      memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+      if (memcmp(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i],
+                 3 * sizeof(float4)) != 0)
+      {
+        memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
+        dirty = true;
+      }
     }
-    dirty = true;
   }
 
   if (bViewportChanged)
@@ -433,11 +448,13 @@ void VertexShaderManager::SetConstants()
     if (g_freelook_camera.IsActive() && xfmem.projection.type == ProjectionType::Perspective)
       corrected_matrix *= g_freelook_camera.GetView();
 
-    memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
+    if (memcmp(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4)) != 0)
+    {
+      memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
+      dirty = true;
+    }
 
     g_freelook_camera.SetClean();
-
-    dirty = true;
   }
 
   if (bTexMtxInfoChanged)
@@ -665,24 +682,30 @@ void VertexShaderManager::TransformToClipSpace(const float* data, float* out, u3
 
 void VertexShaderManager::DoState(PointerWrap& p)
 {
-  p.DoArray(g_fProjectionMatrix);
-  p.Do(s_viewportCorrection);
+  // The freelook camera serializes non-trivially-copyable state, so the flat region tables
+  // cover the spans on either side of it.
+  static const std::array<PointerWrap::StateRegion, 2> matrix_regions{
+      PointerWrap::MakeStateRegion(g_fProjectionMatrix),
+      PointerWrap::MakeStateRegion(s_viewportCorrection),
+  };
+  p.DoRegions(matrix_regions);
   g_freelook_camera.DoState(p);
 
-  p.DoArray(nTransformMatricesChanged);
-  p.DoArray(nNormalMatricesChanged);
-  p.DoArray(nPostTransformMatricesChanged);
-  p.DoArray(nLightsChanged);
-
-  p.Do(nMaterialsChanged);
-  p.DoArray(bTexMatricesChanged);
-  p.Do(bPosNormalMatrixChanged);
-  p.Do(bProjectionChanged);
-  p.Do(bViewportChanged);
-  p.Do(bTexMtxInfoChanged);
-  p.Do(bLightingConfigChanged);
-
-  p.Do(constants);
+  static const std::array<PointerWrap::StateRegion, 12> dirty_regions{
+      PointerWrap::MakeStateRegion(nTransformMatricesChanged),
+      PointerWrap::MakeStateRegion(nNormalMatricesChanged),
+      PointerWrap::MakeStateRegion(nPostTransformMatricesChanged),
+      PointerWrap::MakeStateRegion(nLightsChanged),
+      PointerWrap::MakeStateRegion(nMaterialsChanged),
+      PointerWrap::MakeStateRegion(bTexMatricesChanged),
+      PointerWrap::MakeStateRegion(bPosNormalMatrixChanged),
+      PointerWrap::MakeStateRegion(bProjectionChanged),
+      PointerWrap::MakeStateRegion(bViewportChanged),
+      PointerWrap::MakeStateRegion(bTexMtxInfoChanged),
+      PointerWrap::MakeStateRegion(bLightingConfigChanged),
+      PointerWrap::MakeStateRegion(constants),
+  };
+  p.DoRegions(dirty_regions);
 
   if (p.GetMode() == PointerWrap::MODE_READ)
   {
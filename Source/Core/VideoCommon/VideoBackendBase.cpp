@@ -43,6 +43,7 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/LatencyTracker.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/PixelShaderManager.h"
@@ -99,6 +100,8 @@ void VideoBackendBase::Video_BeginField(u32 xfb_addr, u32 fb_width, u32 fb_strid
     e.swap_event.fbStride = fb_stride;
     e.swap_event.fbHeight = fb_height;
     AsyncRequests::GetInstance()->PushEvent(e, false);
+
+    LatencyTracker::OnFrameIssued();
   }
 }
 
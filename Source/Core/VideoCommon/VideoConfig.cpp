@@ -70,6 +70,7 @@ void VideoConfig::Refresh()
   }
 
   bVSync = Config::Get(Config::GFX_VSYNC);
+  bVSyncFramePacing = Config::Get(Config::GFX_VSYNC_FRAME_PACING);
   iAdapter = Config::Get(Config::GFX_ADAPTER);
 
   bWidescreenHack = Config::Get(Config::GFX_WIDESCREEN_HACK);
@@ -77,7 +78,9 @@ void VideoConfig::Refresh()
   suggested_aspect_mode = Config::Get(Config::GFX_SUGGESTED_ASPECT_RATIO);
   bCrop = Config::Get(Config::GFX_CROP);
   iSafeTextureCache_ColorSamples = Config::Get(Config::GFX_SAFE_TEXTURE_CACHE_COLOR_SAMPLES);
+  iTextureCacheVRAMBudgetMB = Config::Get(Config::GFX_TEXTURE_CACHE_VRAM_BUDGET_MB);
   bShowFPS = Config::Get(Config::GFX_SHOW_FPS);
+  bShowInputLatency = Config::Get(Config::GFX_SHOW_INPUT_LATENCY);
   bShowNetPlayPing = Config::Get(Config::GFX_SHOW_NETPLAY_PING);
   bShowNetPlayMessages = Config::Get(Config::GFX_SHOW_NETPLAY_MESSAGES);
   bLogRenderTimeToFile = Config::Get(Config::GFX_LOG_RENDER_TIME_TO_FILE);
@@ -112,6 +115,7 @@ void VideoConfig::Refresh()
   bEnableValidationLayer = Config::Get(Config::GFX_ENABLE_VALIDATION_LAYER);
   bBackendMultithreading = Config::Get(Config::GFX_BACKEND_MULTITHREADING);
   iCommandBufferExecuteInterval = Config::Get(Config::GFX_COMMAND_BUFFER_EXECUTE_INTERVAL);
+  iCommandListsInFlight = Config::Get(Config::GFX_COMMAND_LISTS_IN_FLIGHT);
   bShaderCache = Config::Get(Config::GFX_SHADER_CACHE);
   bWaitForShadersBeforeStarting = Config::Get(Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING);
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
@@ -123,6 +127,7 @@ void VideoConfig::Refresh()
   bDumpObjects = Config::Get(Config::GFX_SW_DUMP_OBJECTS);
   bDumpTevStages = Config::Get(Config::GFX_SW_DUMP_TEV_STAGES);
   bDumpTevTextureFetches = Config::Get(Config::GFX_SW_DUMP_TEV_TEX_FETCHES);
+  bFrameFingerprint = Config::Get(Config::GFX_SW_FRAME_FINGERPRINT);
   drawStart = Config::Get(Config::GFX_SW_DRAW_START);
   drawEnd = Config::Get(Config::GFX_SW_DRAW_END);
 
@@ -60,6 +60,7 @@ struct VideoConfig final
   // General
   bool bVSync;
   bool bVSyncActive;
+  bool bVSyncFramePacing;
   bool bWidescreenHack;
   AspectMode aspect_mode;
   AspectMode suggested_aspect_mode;
@@ -80,6 +81,7 @@ struct VideoConfig final
 
   // Information
   bool bShowFPS;
+  bool bShowInputLatency;
   bool bShowNetPlayPing;
   bool bShowNetPlayMessages;
   bool bOverlayStats;
@@ -127,6 +129,9 @@ struct VideoConfig final
   bool bSkipPresentingDuplicateXFBs;
   bool bCopyEFBScaled;
   int iSafeTextureCache_ColorSamples;
+  // Estimated VRAM (in MB) the texture cache may keep resident before eviction is
+  // tightened. 0 leaves eviction purely age-based.
+  int iTextureCacheVRAMBudgetMB;
   float fAspectRatioHackW, fAspectRatioHackH;
   bool bEnablePixelLighting;
   bool bFastDepthCalc;
@@ -156,6 +161,8 @@ struct VideoConfig final
   bool bDumpObjects;
   bool bDumpTevStages;
   bool bDumpTevTextureFetches;
+  // Log a hash of every presented frame, for automated accuracy comparisons.
+  bool bFrameFingerprint;
 
   // Enable API validation layers, currently only supported with Vulkan.
   bool bEnableValidationLayer;
@@ -167,6 +174,10 @@ struct VideoConfig final
   // Currently only supported with Vulkan.
   int iCommandBufferExecuteInterval;
 
+  // Number of queued command lists the GPU may lag behind by before submission stalls.
+  // Currently only supported with D3D12.
+  int iCommandListsInFlight;
+
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting;
   ShaderCompilationMode iShaderCompilationMode;
@@ -58,7 +58,10 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
 
     case XFMEM_SETNUMCHAN:
       if (xfmem.numChan.numColorChans != (newValue & 3))
+      {
         g_vertex_manager->Flush();
+        g_vertex_manager->SetPixelShaderUidChanged();
+      }
       VertexShaderManager::SetLightingConfigChanged();
       break;
 
@@ -91,7 +94,12 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETCHAN0_ALPHA:  // Channel Alpha
     case XFMEM_SETCHAN1_ALPHA:
       if (((u32*)&xfmem)[address] != (newValue & 0x7fff))
+      {
         g_vertex_manager->Flush();
+        // The channel configuration is baked into the pixel shader UID when per-pixel lighting
+        // is enabled.
+        g_vertex_manager->SetPixelShaderUidChanged();
+      }
       VertexShaderManager::SetLightingConfigChanged();
       break;
 
@@ -150,6 +158,7 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
       g_vertex_manager->Flush();
+      g_vertex_manager->SetPixelShaderUidChanged();
       VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
 
       nextAddress = XFMEM_SETTEXMTXINFO + 8;
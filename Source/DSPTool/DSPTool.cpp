@@ -21,6 +21,10 @@ u8 DSP::Host::ReadHostMemory(u32 addr)
 void DSP::Host::WriteHostMemory(u8 value, u32 addr)
 {
 }
+u8* DSP::Host::GetHostMemoryPtr(u32* mask)
+{
+  return nullptr;
+}
 void DSP::Host::DMAToDSP(u16* dst, u32 addr, u32 size)
 {
 }
@@ -112,3 +112,29 @@ TEST(FixedSizeQueue, NonTrivialTypes)
   EXPECT_EQ(3 + 2, NonTrivialTypeTestData::total_destructed);
   EXPECT_EQ(0u, q.size());
 }
+
+TEST(FixedSizeQueue, BlockTransfers)
+{
+  // Testing bulk push/pop, including wrap-around and overflow dropping the oldest values
+  FixedSizeQueue<int, 8> q;
+
+  const int in[6] = {0, 1, 2, 3, 4, 5};
+  q.push_block(in, 6);
+  EXPECT_EQ(6u, q.size());
+
+  int out[4] = {};
+  q.pop_block(out, 4);
+  EXPECT_EQ(2u, q.size());
+  for (int i = 0; i < 4; ++i)
+    EXPECT_EQ(i, out[i]);
+
+  const int in2[7] = {6, 7, 8, 9, 10, 11, 12};
+  q.push_block(in2, 7);
+  EXPECT_EQ(8u, q.size());
+
+  int out2[8] = {};
+  q.pop_block(out2, 8);
+  EXPECT_EQ(0u, q.size());
+  for (int i = 0; i < 8; ++i)
+    EXPECT_EQ(i + 5, out2[i]);
+}
@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/SIMDDispatch.h"
+
+namespace
+{
+int Generic()
+{
+  return 0;
+}
+int AVX2()
+{
+  return 1;
+}
+int SSE42()
+{
+  return 2;
+}
+int SSSE3()
+{
+  return 3;
+}
+}  // namespace
+
+TEST(SIMDDispatch, FallsBackToGeneric)
+{
+  Common::SIMD::Variants<int()> variants;
+  variants.generic = &Generic;
+  EXPECT_EQ(&Generic, Common::SIMD::Select(variants));
+}
+
+TEST(SIMDDispatch, SelectedVariantIsSupported)
+{
+  Common::SIMD::Variants<int()> variants;
+  variants.generic = &Generic;
+  variants.avx2 = &AVX2;
+  variants.sse4_2 = &SSE42;
+  variants.ssse3 = &SSSE3;
+
+  int (*selected)() = Common::SIMD::Select(variants);
+  ASSERT_NE(nullptr, selected);
+
+#if defined(_M_X86) || defined(_M_X86_64)
+  if (selected == &AVX2)
+    EXPECT_TRUE(cpu_info.bAVX2);
+  else if (selected == &SSE42)
+    EXPECT_TRUE(cpu_info.bSSE4_2);
+  else if (selected == &SSSE3)
+    EXPECT_TRUE(cpu_info.bSSSE3);
+  // Preference order: a better supported variant must not be skipped.
+  if (cpu_info.bAVX2)
+    EXPECT_EQ(&AVX2, selected);
+  else if (cpu_info.bSSE4_2)
+    EXPECT_EQ(&SSE42, selected);
+#else
+  EXPECT_EQ(&Generic, selected);
+#endif
+}